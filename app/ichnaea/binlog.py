@@ -0,0 +1,336 @@
+"""
+Decoder for the firmware's binary deferred log records.
+
+The firmware BLOG_* macros store only a format string ID, a timestamp and the raw arguments. The
+format strings themselves live in the "ichnaea_logfmt" section of the firmware ELF, which this
+module reads to turn records back into text. Run as a module to decode a captured log:
+
+    python -m ichnaea.binlog <firmware.elf> <log capture>
+"""
+
+import argparse
+import re
+import struct
+import sys
+from dataclasses import dataclass
+from pathlib import Path
+from typing import Iterator, List, Optional, Union
+
+# Must match Logging::Binary in src/system/system_binlog.hpp
+SECTION_NAME = "ichnaea_logfmt"
+SYNC_BYTE = 0x00
+HEADER_FORMAT = "<BBBBII"
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+
+ARG_U32 = 0
+ARG_I32 = 1
+ARG_U64 = 2
+ARG_I64 = 3
+ARG_F32 = 4
+ARG_STR = 5
+
+# Must match PersistHeader/PersistSample in src/system/system_flight_recorder.cpp
+FLIGHT_TAG = 0xFD
+FLIGHT_HEADER_FORMAT = "<BBHHH"
+FLIGHT_HEADER_SIZE = struct.calcsize(FLIGHT_HEADER_FORMAT)
+FLIGHT_SAMPLE_FORMAT = "<IBff"
+FLIGHT_SAMPLE_SIZE = struct.calcsize(FLIGHT_SAMPLE_FORMAT)
+
+# Index matches mb::logging::Level
+LEVEL_NAMES = ["TRACE", "DEBUG", "INFO", "WARN", "ERROR", "FATAL"]
+
+_SPEC_REGEX = re.compile(
+    r"%(?P<flags>[-+ #0]*)(?P<width>\*|\d+)?(?:\.(?P<prec>\*|\d+))?(?:hh|h|ll|l|j|z|t|L)?(?P<conv>[diouxXeEfFgGcsp%])"
+)
+
+
+@dataclass
+class BinaryLogRecord:
+    """A single decoded binary log record"""
+
+    level: int  # mb::logging::Level of the message
+    fmt_id: int  # Offset of the format string in the ELF section
+    timestamp: int  # System time in milliseconds
+    args: List[Union[int, float, str]]  # Decoded arguments, in order
+    message: str  # Fully formatted message text
+
+    @property
+    def level_name(self) -> str:
+        return LEVEL_NAMES[self.level] if self.level < len(LEVEL_NAMES) else f"LVL{self.level}"
+
+    def __str__(self) -> str:
+        return f"{self.timestamp / 1000.0:10.3f} {self.level_name}: {self.message}"
+
+
+def is_flight_capture(data: bytes) -> bool:
+    """
+    Args:
+        data: A single stored log entry
+
+    Returns:
+        True if the entry is a chunk of a persisted flight recorder capture
+    """
+    if len(data) < FLIGHT_HEADER_SIZE or data[0] != FLIGHT_TAG:
+        return False
+
+    count = struct.unpack_from(FLIGHT_HEADER_FORMAT, data, 0)[4]
+    return len(data) == FLIGHT_HEADER_SIZE + count * FLIGHT_SAMPLE_SIZE
+
+
+def decode_flight_capture(data: bytes) -> str:
+    """
+    Turns a persisted flight recorder chunk into text, one line per sample
+    Args:
+        data: A single stored log entry, see is_flight_capture()
+
+    Returns:
+        Text of the entry
+    """
+    _, code, offset, total, count = struct.unpack_from(FLIGHT_HEADER_FORMAT, data, 0)
+    lines = [f"Flight capture, trigger code {code}, samples {offset}-{offset + count - 1} of {total}"]
+
+    for idx in range(count):
+        time_ms, channel, raw, value = struct.unpack_from(
+            FLIGHT_SAMPLE_FORMAT, data, FLIGHT_HEADER_SIZE + idx * FLIGHT_SAMPLE_SIZE
+        )
+        lines.append(f"  {time_ms / 1000.0:10.3f} ch{channel:<3d} raw={raw:.6g} value={value:.6g}")
+
+    return "\n".join(lines)
+
+
+class FormatTable:
+    """Format strings extracted from the firmware ELF, indexed by their binary log ID"""
+
+    def __init__(self, data: bytes):
+        """
+        Args:
+            data: Raw contents of the format string section
+        """
+        self._data = data
+
+    @classmethod
+    def from_elf(cls, elf_path: Union[str, Path]) -> "FormatTable":
+        """
+        Loads the format string section from an ELF file. Works for both the 32-bit firmware image
+        and the 64-bit simulator executable.
+        Args:
+            elf_path: Path to the ELF file
+
+        Returns:
+            Table of format strings
+        """
+        blob = Path(elf_path).read_bytes()
+        if blob[:4] != b"\x7fELF":
+            raise ValueError(f"{elf_path} is not an ELF file")
+
+        is_64 = blob[4] == 2
+        endian = "<" if blob[5] == 1 else ">"
+
+        if is_64:
+            shoff, shentsize, shnum, shstrndx = struct.unpack_from(f"{endian}Q10xHHH", blob, 0x28)
+            sh_format = f"{endian}IIQQQQ"
+        else:
+            shoff, shentsize, shnum, shstrndx = struct.unpack_from(f"{endian}I10xHHH", blob, 0x20)
+            sh_format = f"{endian}IIIIII"
+
+        headers = [struct.unpack_from(sh_format, blob, shoff + idx * shentsize) for idx in range(shnum)]
+        names_offset = headers[shstrndx][4]
+
+        for name_idx, _, _, _, offset, size in headers:
+            end = blob.index(b"\x00", names_offset + name_idx)
+            if blob[names_offset + name_idx : end].decode("ascii") == SECTION_NAME:
+                return cls(blob[offset : offset + size])
+
+        raise ValueError(f"{elf_path} has no {SECTION_NAME} section, was it built with binary logging?")
+
+    def lookup(self, fmt_id: int) -> Optional[str]:
+        """
+        Args:
+            fmt_id: Format string ID from a record header
+
+        Returns:
+            The format string, or None if the ID is out of range
+        """
+        if fmt_id >= len(self._data):
+            return None
+        end = self._data.find(b"\x00", fmt_id)
+        return self._data[fmt_id : end if end >= 0 else None].decode("utf-8", errors="replace")
+
+
+class BinaryLogDecoder:
+    """Turns binary log records, or streams mixing them with text logs, back into text"""
+
+    def __init__(self, table: FormatTable):
+        """
+        Args:
+            table: Format strings of the firmware that produced the records
+        """
+        self._table = table
+
+    @staticmethod
+    def is_binary(data: bytes) -> bool:
+        """
+        Args:
+            data: A single log entry
+
+        Returns:
+            True if the entry is a binary record rather than text
+        """
+        return len(data) >= HEADER_SIZE and data[0] == SYNC_BYTE
+
+    def decode(self, data: bytes) -> BinaryLogRecord:
+        """
+        Decodes a single binary record
+        Args:
+            data: Record bytes, starting at the sync byte
+
+        Returns:
+            The decoded record
+        """
+        _, level, length, argc, fmt_id, timestamp = struct.unpack_from(HEADER_FORMAT, data, 0)
+        args = self._unpack_args(data[HEADER_SIZE : HEADER_SIZE + length], argc)
+
+        fmt = self._table.lookup(fmt_id)
+        if fmt is None:
+            message = f"<unknown format 0x{fmt_id:X}> {args}"
+        else:
+            message = self._format(fmt, args)
+
+        return BinaryLogRecord(level=level, fmt_id=fmt_id, timestamp=timestamp, args=args, message=message)
+
+    def decode_entry(self, data: bytes) -> str:
+        """
+        Decodes a log entry that may be text, a binary record or a flight recorder capture
+        Args:
+            data: A single log entry
+
+        Returns:
+            Text of the entry
+        """
+        if is_flight_capture(data):
+            return decode_flight_capture(data)
+        if self.is_binary(data):
+            return str(self.decode(data))
+        return data.decode("utf-8", errors="replace")
+
+    def decode_stream(self, data: bytes) -> Iterator[str]:
+        """
+        Decodes a raw capture, ie the debug UART or simulator log file, where binary records are
+        interleaved with regular text lines.
+        Args:
+            data: Captured bytes
+
+        Yields:
+            One line of text per log entry
+        """
+        idx = 0
+        while idx < len(data):
+            if data[idx] == SYNC_BYTE:
+                if (idx + HEADER_SIZE) > len(data) or (idx + HEADER_SIZE + data[idx + 2]) > len(data):
+                    break  # Capture ended part way through a record
+
+                end = idx + HEADER_SIZE + data[idx + 2]
+                yield str(self.decode(data[idx:end]))
+                idx = end
+                continue
+
+            end = idx
+            while end < len(data) and data[end] not in (SYNC_BYTE, ord("\n")):
+                end += 1
+
+            text = data[idx:end].decode("utf-8", errors="replace").rstrip("\r")
+            if text:
+                yield text
+            idx = end + 1 if end < len(data) and data[end] == ord("\n") else end
+
+    @staticmethod
+    def _unpack_args(data: bytes, argc: int) -> List[Union[int, float, str]]:
+        args: List[Union[int, float, str]] = []
+        idx = 0
+
+        while len(args) < argc and idx < len(data):
+            tag = data[idx]
+            idx += 1
+
+            if tag == ARG_U32:
+                args.append(struct.unpack_from("<I", data, idx)[0])
+                idx += 4
+            elif tag == ARG_I32:
+                args.append(struct.unpack_from("<i", data, idx)[0])
+                idx += 4
+            elif tag == ARG_U64:
+                args.append(struct.unpack_from("<Q", data, idx)[0])
+                idx += 8
+            elif tag == ARG_I64:
+                args.append(struct.unpack_from("<q", data, idx)[0])
+                idx += 8
+            elif tag == ARG_F32:
+                args.append(struct.unpack_from("<f", data, idx)[0])
+                idx += 4
+            elif tag == ARG_STR:
+                length = data[idx]
+                args.append(data[idx + 1 : idx + 1 + length].decode("utf-8", errors="replace"))
+                idx += 1 + length
+            else:
+                break
+
+        return args
+
+    @staticmethod
+    def _format(fmt: str, args: List[Union[int, float, str]]) -> str:
+        """Applies a printf style format string using Python's own % formatting per specifier"""
+        remaining = iter(args)
+
+        def next_arg() -> Union[int, float, str]:
+            return next(remaining, "?")
+
+        def replace(match: re.Match) -> str:
+            conv = match.group("conv")
+            if conv == "%":
+                return "%"
+
+            width = match.group("width") or ""
+            if width == "*":
+                width = str(next_arg())
+
+            prec = match.group("prec")
+            if prec == "*":
+                prec = str(next_arg())
+
+            value = next_arg()
+            if conv in "diu":
+                conv = "d"
+            elif conv == "p":
+                conv = "#x"
+            elif conv == "F":
+                conv = "f"
+            elif conv == "c" and isinstance(value, int):
+                value = chr(value & 0xFF)
+
+            if conv in "xXo" and isinstance(value, int) and value < 0:
+                value &= 0xFFFFFFFF
+
+            spec = f"%{match.group('flags')}{width}{'.' + prec if prec is not None else ''}{conv}"
+            try:
+                return spec % value
+            except (TypeError, ValueError):
+                return str(value)
+
+        return _SPEC_REGEX.sub(replace, fmt)
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Decode Ichnaea binary log captures")
+    parser.add_argument("elf", type=Path, help="Firmware or simulator ELF that produced the log")
+    parser.add_argument("log", type=Path, help="Raw log capture, ie the simulator's Ichnaea.log")
+    args = parser.parse_args()
+
+    decoder = BinaryLogDecoder(FormatTable.from_elf(args.elf))
+    for line in decoder.decode_stream(args.log.read_bytes()):
+        print(line)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -1,3 +1,5 @@
+from typing import Dict, List, Tuple
+
 from ichnaea.proto.ichnaea_rpc_pb2 import *
 from ichnaea.proto.ichnaea_async_pb2 import *
 from mbedutils.rpc.message import BasePBMsg
@@ -150,6 +152,40 @@ class SensorResponsePBMsg(BasePBMsg[SensorResponse]):
         return self.pb_message.value
 
 
+class SensorBatchRequestPBMsg(BasePBMsg[SensorBatchRequest]):
+    def __init__(self):
+        super().__init__()
+        self._pb_msg = SensorBatchRequest()
+        self.pb_message.header.msgId = MSG_SENSOR_BATCH_REQ
+        self.pb_message.header.version = MSG_VER_SENSOR_BATCH_REQ
+        self.pb_message.header.svcId = SVC_SENSOR_BATCH
+        self.pb_message.header.seqId = 0
+        self.pb_message.node_id = 0
+        self.pb_message.sensor_mask = 0
+
+
+class SensorBatchResponsePBMsg(BasePBMsg[SensorBatchResponse]):
+    def __init__(self):
+        super().__init__()
+        self._pb_msg = SensorBatchResponse()
+        self.pb_message.header.msgId = MSG_SENSOR_BATCH_RSP
+        self.pb_message.header.version = MSG_VER_SENSOR_BATCH_RSP
+        self.pb_message.header.svcId = SVC_SENSOR_BATCH
+        self.pb_message.header.seqId = 0
+        self.pb_message.status = ERR_SENSOR_NO_ERROR
+        self.pb_message.sensor_mask = 0
+        self.pb_message.timestamp = 0
+
+    def readings(self) -> Dict[int, float]:
+        """
+        Pairs the returned values with the sensors they belong to
+        Returns:
+            SensorType -> value for each sensor the node read
+        """
+        sensors = [bit for bit in range(16) if self.pb_message.sensor_mask & (1 << bit)]
+        return dict(zip(sensors, self.pb_message.values))
+
+
 class PingNodeRequestPBMsg(BasePBMsg[PingNodeRequest]):
     def __init__(self):
         super().__init__()
@@ -231,6 +267,58 @@ class HeartbeatPBMsg(BasePBMsg[Heartbeat]):
         self.pb_message.timestamp = 0
 
 
+class ConsoleBatchPBMsg(BasePBMsg[ConsoleBatch]):
+    def __init__(self):
+        super().__init__()
+        self._pb_msg = ConsoleBatch()
+        self.pb_message.header.msgId = MSG_CONSOLE_BATCH
+        self.pb_message.header.version = MSG_VER_CONSOLE_BATCH
+        self.pb_message.header.svcId = 0  # Not actually used
+        self.pb_message.header.seqId = 0
+        self.pb_message.count = 0
+        self.pb_message.data = b""
+
+    def records(self) -> List[Tuple[int, bytes]]:
+        """
+        Unpacks the log records carried by the batch
+        Returns:
+            List of (log level, message bytes) in the order they were logged
+        """
+        data = self.pb_message.data
+        records = []
+        idx = 0
+
+        while len(records) < self.pb_message.count and (idx + 2) <= len(data):
+            level, length = data[idx], data[idx + 1]
+            records.append((level, data[idx + 2 : idx + 2 + length]))
+            idx += 2 + length
+
+        return records
+
+
+class TelemetryPBMsg(BasePBMsg[Telemetry]):
+    def __init__(self):
+        super().__init__()
+        self._pb_msg = Telemetry()
+        self.pb_message.header.msgId = MSG_TELEMETRY
+        self.pb_message.header.version = MSG_VER_TELEMETRY
+        self.pb_message.header.svcId = 0  # Not actually used
+        self.pb_message.header.seqId = 0
+        self.pb_message.node_id = 0
+        self.pb_message.timestamp = 0
+        self.pb_message.sequence = 0
+        self.pb_message.sensor_mask = 0
+
+    def readings(self) -> Dict[int, float]:
+        """
+        Pairs the values carried by the frame with the sensors they belong to
+        Returns:
+            SensorType -> value for each sensor present in the frame
+        """
+        sensors = [bit for bit in range(16) if self.pb_message.sensor_mask & (1 << bit)]
+        return dict(zip(sensors, self.pb_message.values))
+
+
 class SystemStatusRequestPBMsg(BasePBMsg[SystemStatusRequest]):
     def __init__(self):
         super().__init__()
@@ -252,3 +340,308 @@ class SystemStatusResponsePBMsg(BasePBMsg[SystemStatusResponse]):
         self.pb_message.header.seqId = 0
         self.pb_message.timestamp = 0
         self.pb_message.output_state = 0
+
+
+class BootTimelineRequestPBMsg(BasePBMsg[BootTimelineRequest]):
+    def __init__(self):
+        super().__init__()
+        self._pb_msg = BootTimelineRequest()
+        self.pb_message.header.msgId = MSG_BOOT_TIMELINE_REQ
+        self.pb_message.header.version = MSG_VER_BOOT_TIMELINE_REQ
+        self.pb_message.header.svcId = SVC_BOOT_TIMELINE
+        self.pb_message.header.seqId = 0
+        self.pb_message.node_id = 0
+        self.pb_message.offset = 0
+
+
+class BootTimelineResponsePBMsg(BasePBMsg[BootTimelineResponse]):
+    def __init__(self):
+        super().__init__()
+        self._pb_msg = BootTimelineResponse()
+        self.pb_message.header.msgId = MSG_BOOT_TIMELINE_RSP
+        self.pb_message.header.version = MSG_VER_BOOT_TIMELINE_RSP
+        self.pb_message.header.svcId = SVC_BOOT_TIMELINE
+        self.pb_message.header.seqId = 0
+        self.pb_message.total = 0
+        self.pb_message.offset = 0
+        self.pb_message.complete = False
+
+
+class CalWriteRequestPBMsg(BasePBMsg[CalWriteRequest]):
+    def __init__(self):
+        super().__init__()
+        self._pb_msg = CalWriteRequest()
+        self.pb_message.header.msgId = MSG_CAL_WRITE_REQ
+        self.pb_message.header.version = MSG_VER_CAL_WRITE_REQ
+        self.pb_message.header.svcId = SVC_CAL_WRITE
+        self.pb_message.header.seqId = 0
+        self.pb_message.node_id = 0
+
+
+class CalWriteResponsePBMsg(BasePBMsg[CalWriteResponse]):
+    def __init__(self):
+        super().__init__()
+        self._pb_msg = CalWriteResponse()
+        self.pb_message.header.msgId = MSG_CAL_WRITE_RSP
+        self.pb_message.header.version = MSG_VER_CAL_WRITE_RSP
+        self.pb_message.header.svcId = SVC_CAL_WRITE
+        self.pb_message.header.seqId = 0
+        self.pb_message.success = False
+
+
+class FlashStatsRequestPBMsg(BasePBMsg[FlashStatsRequest]):
+    def __init__(self):
+        super().__init__()
+        self._pb_msg = FlashStatsRequest()
+        self.pb_message.header.msgId = MSG_FLASH_STATS_REQ
+        self.pb_message.header.version = MSG_VER_FLASH_STATS_REQ
+        self.pb_message.header.svcId = SVC_FLASH_STATS
+        self.pb_message.header.seqId = 0
+        self.pb_message.node_id = 0
+        self.pb_message.sector_offset = 0
+
+
+class FlashStatsResponsePBMsg(BasePBMsg[FlashStatsResponse]):
+    def __init__(self):
+        super().__init__()
+        self._pb_msg = FlashStatsResponse()
+        self.pb_message.header.msgId = MSG_FLASH_STATS_RSP
+        self.pb_message.header.version = MSG_VER_FLASH_STATS_RSP
+        self.pb_message.header.svcId = SVC_FLASH_STATS
+        self.pb_message.header.seqId = 0
+        self.pb_message.bytes_read = 0
+        self.pb_message.bytes_programmed = 0
+        self.pb_message.read_ops = 0
+        self.pb_message.program_ops = 0
+        self.pb_message.erase_ops = 0
+        self.pb_message.num_sectors = 0
+        self.pb_message.sector_offset = 0
+
+
+class LogQueryRequestPBMsg(BasePBMsg[LogQueryRequest]):
+    def __init__(self):
+        super().__init__()
+        self._pb_msg = LogQueryRequest()
+        self.pb_message.header.msgId = MSG_LOG_QUERY_REQ
+        self.pb_message.header.version = MSG_VER_LOG_QUERY_REQ
+        self.pb_message.header.svcId = SVC_LOG_QUERY
+        self.pb_message.header.seqId = 0
+        self.pb_message.node_id = 0
+        self.pb_message.start_time = 0
+        self.pb_message.end_time = 0
+        self.pb_message.last_ms = 0
+        self.pb_message.min_level = 0
+        self.pb_message.max_count = 0
+        self.pb_message.skip = 0
+
+
+class LogQueryResponsePBMsg(BasePBMsg[LogQueryResponse]):
+    def __init__(self):
+        super().__init__()
+        self._pb_msg = LogQueryResponse()
+        self.pb_message.header.msgId = MSG_LOG_QUERY_RSP
+        self.pb_message.header.version = MSG_VER_LOG_QUERY_RSP
+        self.pb_message.header.svcId = SVC_LOG_QUERY
+        self.pb_message.header.seqId = 0
+        self.pb_message.now = 0
+        self.pb_message.base_time = 0
+        self.pb_message.count = 0
+        self.pb_message.more = False
+        self.pb_message.next_time = 0
+        self.pb_message.skip = 0
+        self.pb_message.data = b""
+
+    def records(self) -> List[Tuple[int, int, bytes]]:
+        """
+        Unpacks the log records carried by the response
+        Returns:
+            List of (log time in ms, log level, message bytes), oldest first
+        """
+        data = self.pb_message.data
+        records = []
+        idx = 0
+
+        while len(records) < self.pb_message.count and (idx + 6) <= len(data):
+            offset = int.from_bytes(data[idx : idx + 4], "little")
+            level, length = data[idx + 4], data[idx + 5]
+            records.append((self.pb_message.base_time + offset, level, data[idx + 6 : idx + 6 + length]))
+            idx += 6 + length
+
+        return records
+
+
+class FlightRecorderRequestPBMsg(BasePBMsg[FlightRecorderRequest]):
+    def __init__(self):
+        super().__init__()
+        self._pb_msg = FlightRecorderRequest()
+        self.pb_message.header.msgId = MSG_FLIGHT_RECORDER_REQ
+        self.pb_message.header.version = MSG_VER_FLIGHT_RECORDER_REQ
+        self.pb_message.header.svcId = SVC_FLIGHT_RECORDER
+        self.pb_message.header.seqId = 0
+        self.pb_message.node_id = 0
+        self.pb_message.offset = 0
+        self.pb_message.rearm = False
+        self.pb_message.pre_trigger = 0
+        self.pb_message.post_trigger = 0
+        self.pb_message.persist = False
+
+
+class FlightRecorderResponsePBMsg(BasePBMsg[FlightRecorderResponse]):
+    def __init__(self):
+        super().__init__()
+        self._pb_msg = FlightRecorderResponse()
+        self.pb_message.header.msgId = MSG_FLIGHT_RECORDER_RSP
+        self.pb_message.header.version = MSG_VER_FLIGHT_RECORDER_RSP
+        self.pb_message.header.svcId = SVC_FLIGHT_RECORDER
+        self.pb_message.header.seqId = 0
+        self.pb_message.state = FR_ARMED
+        self.pb_message.trigger_code = 0
+        self.pb_message.trigger_time = 0
+        self.pb_message.total = 0
+        self.pb_message.trigger_index = 0
+        self.pb_message.offset = 0
+
+
+class TelemetrySubscribeRequestPBMsg(BasePBMsg[TelemetrySubscribeRequest]):
+    def __init__(self):
+        super().__init__()
+        self._pb_msg = TelemetrySubscribeRequest()
+        self.pb_message.header.msgId = MSG_TELEMETRY_SUB_REQ
+        self.pb_message.header.version = MSG_VER_TELEMETRY_SUB_REQ
+        self.pb_message.header.svcId = SVC_TELEMETRY
+        self.pb_message.header.seqId = 0
+        self.pb_message.node_id = 0
+        self.pb_message.sensor_mask = 0
+        self.pb_message.period_ms = 0
+        self.pb_message.deadband = 0.0
+        self.pb_message.keyframe_ms = 0
+
+
+class TelemetrySubscribeResponsePBMsg(BasePBMsg[TelemetrySubscribeResponse]):
+    def __init__(self):
+        super().__init__()
+        self._pb_msg = TelemetrySubscribeResponse()
+        self.pb_message.header.msgId = MSG_TELEMETRY_SUB_RSP
+        self.pb_message.header.version = MSG_VER_TELEMETRY_SUB_RSP
+        self.pb_message.header.svcId = SVC_TELEMETRY
+        self.pb_message.header.seqId = 0
+        self.pb_message.sensor_mask = 0
+        self.pb_message.period_ms = 0
+        self.pb_message.deadband = 0.0
+        self.pb_message.keyframe_ms = 0
+
+
+class LinkBaudRequestPBMsg(BasePBMsg[LinkBaudRequest]):
+    def __init__(self):
+        super().__init__()
+        self._pb_msg = LinkBaudRequest()
+        self.pb_message.header.msgId = MSG_LINK_BAUD_REQ
+        self.pb_message.header.version = MSG_VER_LINK_BAUD_REQ
+        self.pb_message.header.svcId = SVC_LINK_BAUD
+        self.pb_message.header.seqId = 0
+        self.pb_message.node_id = 0
+        self.pb_message.baud = 0
+        self.pb_message.confirm = False
+
+
+class LinkBaudResponsePBMsg(BasePBMsg[LinkBaudResponse]):
+    def __init__(self):
+        super().__init__()
+        self._pb_msg = LinkBaudResponse()
+        self.pb_message.header.msgId = MSG_LINK_BAUD_RSP
+        self.pb_message.header.version = MSG_VER_LINK_BAUD_RSP
+        self.pb_message.header.svcId = SVC_LINK_BAUD
+        self.pb_message.header.seqId = 0
+        self.pb_message.status = LINK_BAUD_OK
+        self.pb_message.baud = 0
+        self.pb_message.fallbacks = 0
+        self.pb_message.line_errors = 0
+
+
+class LTCRegGetRequestPBMsg(BasePBMsg[LTCRegGetRequest]):
+    def __init__(self):
+        super().__init__()
+        self._pb_msg = LTCRegGetRequest()
+        self.pb_message.header.msgId = MSG_LTC_REG_GET_REQ
+        self.pb_message.header.version = MSG_VER_LTC_REG_GET_REQ
+        self.pb_message.header.svcId = SVC_LTC_REG_GET
+        self.pb_message.header.seqId = 0
+        self.pb_message.node_id = 0
+        self.pb_message.reg = 0
+        self.pb_message.dump = False
+
+
+class LTCRegGetResponsePBMsg(BasePBMsg[LTCRegGetResponse]):
+    def __init__(self):
+        super().__init__()
+        self._pb_msg = LTCRegGetResponse()
+        self.pb_message.header.msgId = MSG_LTC_REG_GET_RSP
+        self.pb_message.header.version = MSG_VER_LTC_REG_GET_RSP
+        self.pb_message.header.svcId = SVC_LTC_REG_GET
+        self.pb_message.header.seqId = 0
+        self.pb_message.status = LTC_REG_OK
+        self.pb_message.first_reg = 0
+        self.pb_message.values = b""
+
+    def registers(self) -> Dict[int, int]:
+        """
+        Returns:
+            Register address -> value for every register in the response
+        """
+        first = self.pb_message.first_reg
+        return {first + idx: value for idx, value in enumerate(self.pb_message.values)}
+
+
+class LTCRegSetRequestPBMsg(BasePBMsg[LTCRegSetRequest]):
+    def __init__(self):
+        super().__init__()
+        self._pb_msg = LTCRegSetRequest()
+        self.pb_message.header.msgId = MSG_LTC_REG_SET_REQ
+        self.pb_message.header.version = MSG_VER_LTC_REG_SET_REQ
+        self.pb_message.header.svcId = SVC_LTC_REG_SET
+        self.pb_message.header.seqId = 0
+        self.pb_message.node_id = 0
+        self.pb_message.reg = 0
+        self.pb_message.value = 0
+
+
+class LTCRegSetResponsePBMsg(BasePBMsg[LTCRegSetResponse]):
+    def __init__(self):
+        super().__init__()
+        self._pb_msg = LTCRegSetResponse()
+        self.pb_message.header.msgId = MSG_LTC_REG_SET_RSP
+        self.pb_message.header.version = MSG_VER_LTC_REG_SET_RSP
+        self.pb_message.header.svcId = SVC_LTC_REG_SET
+        self.pb_message.header.seqId = 0
+        self.pb_message.status = LTC_REG_OK
+        self.pb_message.value = 0
+
+
+class GroupCommandRequestPBMsg(BasePBMsg[GroupCommandRequest]):
+    def __init__(self):
+        super().__init__()
+        self._pb_msg = GroupCommandRequest()
+        self.pb_message.header.msgId = MSG_GROUP_CMD_REQ
+        self.pb_message.header.version = MSG_VER_GROUP_CMD_REQ
+        self.pb_message.header.svcId = SVC_GROUP_COMMAND
+        self.pb_message.header.seqId = 0
+        self.pb_message.group_id = GROUP_ID_ALL
+        self.pb_message.command_id = 0
+        self.pb_message.action = GROUP_ACTION_SETPOINT
+        self.pb_message.field = SETPOINT_OUTPUT_VOLTAGE
+        self.pb_message.value = 0.0
+        self.pb_message.delay_us = 0
+
+
+class GroupCommandResponsePBMsg(BasePBMsg[GroupCommandResponse]):
+    def __init__(self):
+        super().__init__()
+        self._pb_msg = GroupCommandResponse()
+        self.pb_message.header.msgId = MSG_GROUP_CMD_RSP
+        self.pb_message.header.version = MSG_VER_GROUP_CMD_RSP
+        self.pb_message.header.svcId = SVC_GROUP_COMMAND
+        self.pb_message.header.seqId = 0
+        self.pb_message.node_id = 0
+        self.pb_message.command_id = 0
+        self.pb_message.status = GROUP_CMD_OK
+        self.pb_message.latency_us = 0
@@ -1,13 +1,14 @@
 import copy
 import time
 from dataclasses import dataclass
-from typing import List, Optional, Dict
-from threading import RLock
+from typing import Callable, List, Optional, Dict, Tuple
+from threading import Event, RLock, Thread
 from loguru import logger
 
+from ichnaea.binlog import BinaryLogDecoder
 from ichnaea.messages import *
 from mbedutils.rpc.client import RPCClient
-from mbedutils.rpc.message import get_module_messages
+from mbedutils.rpc.message import BasePBMsg, get_module_messages
 from mbedutils.rpc.observer import MessageObserver
 from mbedutils.rpc.pipe import PipeType
 
@@ -22,6 +23,16 @@ class NetworkClient:
 
     _node_lifetime = 15.0  # How long to keep a node in the observed list before pruning
 
+    # mb::logging::Level -> loguru level name for console records
+    _console_log_levels = {0: "TRACE", 1: "DEBUG", 2: "INFO", 3: "WARNING", 4: "ERROR", 5: "CRITICAL"}
+
+    _LINK_DEFAULT_BAUD = 115200  # Rate a node boots at and falls back to
+    _LINK_SWITCH_DELAY = 0.1  # Time for a node to switch rates after acknowledging
+    _LINK_CONFIRM_TIMEOUT = 2.5  # Longer than a node waits for the confirm before falling back
+    _LINK_MISS_LIMIT = 3  # Unanswered requests in a row that send the host back to the default rate
+    _LINK_HEARTBEAT_TIMEOUT = 3.0  # Heartbeat silence that sends the host back to the default rate
+    _LINK_MONITOR_PERIOD = 0.5  # How often the heartbeat silence is checked
+
     @dataclass
     class NodeProperties:
         """Storage for node attributes observed in the system"""
@@ -31,6 +42,45 @@ class NetworkClient:
         last_seen: float  # System time the node was last seen at
         heartbeat: HeartbeatPBMsg  # Last received heartbeat message
 
+    @dataclass
+    class FlashStats:
+        """Lifetime NOR flash wear and latency statistics of a node"""
+
+        bytes_read: int  # Bytes read from the device
+        bytes_programmed: int  # Bytes programmed into the device
+        read_ops: int  # Read transactions
+        program_ops: int  # Page program operations
+        erase_ops: int  # Sector erases
+        erase_counts: List[int]  # Erase count of each sector, indexed by address / 4096
+        latency: Dict[int, List[int]]  # FlashOp -> log2 latency histogram buckets in us
+
+    @dataclass
+    class LogRecord:
+        """A stored log entry returned by a log query"""
+
+        time: int  # Log time in ms, counting across reboots
+        age: float  # Seconds before the query the entry was logged
+        level: int  # mb::logging::Level of the entry
+        data: bytes  # Raw entry, text or a binary log record
+
+    @dataclass
+    class TelemetryValue:
+        """Latest streamed value of one sensor"""
+
+        value: float  # Sensor value
+        timestamp: int  # Node system time the value was sampled at, in ms
+        received: float  # Host time the value arrived
+
+    @dataclass
+    class FlightRecording:
+        """Samples captured around a fault by a node's flight recorder"""
+
+        state: int  # FlightRecorderState of the recorder
+        trigger_code: int  # Panic error code that froze the capture
+        trigger_time: int  # Node system time of the fault in ms
+        trigger_index: int  # Index in samples of the first sample after the fault
+        samples: List[FlightSample]  # Captured window, oldest first
+
     @staticmethod
     def unique_id_to_string(unique_id: int) -> str:
         """
@@ -70,6 +120,16 @@ class NetworkClient:
         self._msg_observers = set()
         self._observed_nodes: Dict[str, NetworkClient.NodeProperties] = {}
         self._data_lock = RLock()
+        self._log_decoder: Optional[BinaryLogDecoder] = None
+        self._console_handler: Optional[Callable[[int, str], None]] = None
+        self._telemetry: Dict[str, Dict[int, NetworkClient.TelemetryValue]] = {}
+        self._telemetry_handler: Optional[Callable[[str, Dict[int, float]], None]] = None
+        self._group_command_id = 0
+        self._link_lock = RLock()
+        self._link_misses = 0
+        self._link_since = 0.0
+        self._link_stop = Event()
+        self._link_thread: Optional[Thread] = None
 
         # Add the message descriptors to the client
         msg_types = []
@@ -100,14 +160,133 @@ class NetworkClient:
         hb_uuid = self._client.com_pipe.subscribe_observer(hb_obs)
         self._msg_observers.add(hb_uuid)
 
+        # Unpack batched console logs as they arrive
+        console_obs = MessageObserver(func=self._console_batch_observer, msg_type=ConsoleBatchPBMsg)
+        console_uuid = self._client.com_pipe.subscribe_observer(console_obs)
+        self._msg_observers.add(console_uuid)
+
+        # Cache streamed sensor values as they arrive
+        telemetry_obs = MessageObserver(func=self._telemetry_observer, msg_type=TelemetryPBMsg)
+        telemetry_uuid = self._client.com_pipe.subscribe_observer(telemetry_obs)
+        self._msg_observers.add(telemetry_uuid)
+
+        # Watch for a node that dropped back to the default rate without telling us
+        self._link_misses = 0
+        self._link_since = time.time()
+        if not self._link_thread or not self._link_thread.is_alive():
+            self._link_stop.clear()
+            self._link_thread = Thread(target=self._link_monitor, name="ichnaea-link-monitor", daemon=True)
+            self._link_thread.start()
+
+    def set_log_decoder(self, decoder: Optional[BinaryLogDecoder]) -> None:
+        """
+        Sets the decoder used to turn binary log records in the console stream back into text
+        Args:
+            decoder: Decoder for the firmware the nodes are running, or None to disable decoding
+
+        Returns:
+            None
+        """
+        with self._data_lock:
+            self._log_decoder = decoder
+
+    def set_console_handler(self, handler: Optional[Callable[[int, str], None]]) -> None:
+        """
+        Routes console log records to a custom handler instead of the host logger
+        Args:
+            handler: Called with the log level and text of each record, or None to restore the default
+
+        Returns:
+            None
+        """
+        with self._data_lock:
+            self._console_handler = handler
+
     def close(self) -> None:
         """
         Tear down the connection and any other acquired resources
         Returns:
             None
         """
+        self._link_stop.set()
+        if self._link_thread and self._link_thread.is_alive():
+            self._link_thread.join()
+        self._link_thread = None
+
         self._client.close()
 
+    @property
+    def baud(self) -> int:
+        return self._rpc_baud
+
+    def get_link_status(self, node_id: str) -> Optional[LinkBaudResponsePBMsg]:
+        """
+        Reads the node's view of the RPC link
+        Args:
+            node_id: Which node to query
+
+        Returns:
+            Rate in use, fallback and line error counts and the supported rates, or None on failure
+        """
+        msg = LinkBaudRequestPBMsg()
+        msg.pb_message.node_id = self.unique_id_from_string(node_id)
+
+        response = self._write_and_wait(msg=msg, timeout=1.0)
+        if response and isinstance(response[0], LinkBaudResponsePBMsg):
+            return response[0]
+
+        logger.error(f"Failed to read the link status on node {node_id}")
+        return None
+
+    def negotiate_baud(self, node_id: str, baud: int) -> bool:
+        """
+        Moves the link to a new baud rate. The node acknowledges at the current rate and switches,
+        the host reopens its port at the new rate and confirms. If the confirm doesn't make it, the
+        node falls back to its default rate and so does the host. Other nodes on a shared bus have to
+        be moved as well, or they will stop hearing the host.
+        Args:
+            node_id: Which node to talk to
+            baud: Rate to switch to
+
+        Returns:
+            True if the link is running at the new rate, False if not
+        """
+        if baud == self._rpc_baud:
+            return True
+
+        msg = LinkBaudRequestPBMsg()
+        msg.pb_message.node_id = self.unique_id_from_string(node_id)
+        msg.pb_message.baud = baud
+
+        response = self._client.com_pipe.write_and_wait(msg=msg, timeout=1.0)
+        if not response or not isinstance(response[0], LinkBaudResponsePBMsg):
+            logger.error(f"Node {node_id} did not answer the baud rate request")
+            return False
+
+        if response[0].pb_message.status != LINK_BAUD_OK:
+            logger.error(f"Node {node_id} refused {baud} baud, supports {list(response[0].pb_message.supported)}")
+            return False
+
+        # Give the node time to switch before talking at the new rate
+        time.sleep(self._LINK_SWITCH_DELAY)
+        self._reopen(baud)
+
+        msg = LinkBaudRequestPBMsg()
+        msg.pb_message.node_id = self.unique_id_from_string(node_id)
+        msg.pb_message.baud = baud
+        msg.pb_message.confirm = True
+
+        response = self._client.com_pipe.write_and_wait(msg=msg, timeout=1.0)
+        if response and isinstance(response[0], LinkBaudResponsePBMsg) and response[0].pb_message.status == LINK_BAUD_OK:
+            logger.info(f"Link to node {node_id} running at {baud} baud")
+            return True
+
+        # Wait out the node's confirm timeout so both ends land on the default rate
+        logger.error(f"Failed to confirm {baud} baud on node {node_id}, falling back to {self._LINK_DEFAULT_BAUD}")
+        time.sleep(self._LINK_CONFIRM_TIMEOUT)
+        self._reopen(self._LINK_DEFAULT_BAUD)
+        return False
+
     def discover_nodes(self, exp_count: int = -1, timeout: float = 5.0) -> List[NodeProperties]:
         """
         Broadcast to all nodes in the system and request their unique identifiers
@@ -121,7 +300,7 @@ class NetworkClient:
         self._prune_observed_nodes()
 
         start_time = time.time()
-        responses = self._client.com_pipe.write_and_wait(
+        responses = self._write_and_wait(
             msg=GetIdRequestPBMsg(), timeout=timeout, count=exp_count if exp_count > 0 else None
         )
         # No valid response for any requested number of nodes
@@ -177,13 +356,210 @@ class NetworkClient:
         msg = SystemStatusRequestPBMsg()
         msg.pb_message.node_id = self.unique_id_from_string(node_id)
 
-        response = self._client.com_pipe.write_and_wait(msg=msg, timeout=1.0)
+        response = self._write_and_wait(msg=msg, timeout=1.0)
         if response and isinstance(response[0], SystemStatusResponsePBMsg):
             return response[0]
         else:
             logger.error(f"Failed to get status from node {node_id}")
             return None
 
+    def get_boot_timeline(self, node_id: str) -> Optional[List[BootStep]]:
+        """
+        Reads the boot timeline profile from a node. The timeline is returned in pages, so this
+        keeps requesting until all recorded steps have been received.
+        Args:
+            node_id: Which node to query
+
+        Returns:
+            Ordered list of boot steps recorded by the node, or None on failure
+        """
+        steps: List[BootStep] = []
+
+        while True:
+            msg = BootTimelineRequestPBMsg()
+            msg.pb_message.node_id = self.unique_id_from_string(node_id)
+            msg.pb_message.offset = len(steps)
+
+            response = self._write_and_wait(msg=msg, timeout=1.0)
+            if not response or not isinstance(response[0], BootTimelineResponsePBMsg):
+                logger.error(f"Failed to get boot timeline from node {node_id}")
+                return None
+
+            page = response[0].pb_message
+            steps.extend(page.steps)
+            if not page.steps or len(steps) >= page.total:
+                break
+
+        if not page.complete:
+            logger.warning(f"Node {node_id} boot sequence is still in progress")
+
+        return steps
+
+    def get_flash_stats(self, node_id: str) -> Optional[FlashStats]:
+        """
+        Reads the flash wear and latency statistics from a node. The per-sector erase counts
+        are returned in pages, so this keeps requesting until every sector has been received.
+        Args:
+            node_id: Which node to query
+
+        Returns:
+            Lifetime flash statistics of the node, or None on failure
+        """
+        erase_counts: List[int] = []
+
+        while True:
+            msg = FlashStatsRequestPBMsg()
+            msg.pb_message.node_id = self.unique_id_from_string(node_id)
+            msg.pb_message.sector_offset = len(erase_counts)
+
+            response = self._write_and_wait(msg=msg, timeout=1.0)
+            if not response or not isinstance(response[0], FlashStatsResponsePBMsg):
+                logger.error(f"Failed to get flash stats from node {node_id}")
+                return None
+
+            page = response[0].pb_message
+            erase_counts.extend(page.erase_counts)
+            if not page.erase_counts or len(erase_counts) >= page.num_sectors:
+                break
+
+        return NetworkClient.FlashStats(
+            bytes_read=page.bytes_read,
+            bytes_programmed=page.bytes_programmed,
+            read_ops=page.read_ops,
+            program_ops=page.program_ops,
+            erase_ops=page.erase_ops,
+            erase_counts=erase_counts,
+            latency={hist.op: list(hist.buckets) for hist in page.latency},
+        )
+
+    def query_logs(
+        self,
+        node_id: str,
+        start_time: int = 0,
+        end_time: int = 0,
+        last_ms: int = 0,
+        min_level: int = 0,
+        max_count: int = 0,
+        timeout: float = 2.0,
+    ) -> Optional[List[LogRecord]]:
+        """
+        Reads stored logs matching a time range and minimum level. The node seeks straight to the
+        start of the range and only sends matches, paging through them until the query is done.
+        Args:
+            node_id: Which node to query
+            start_time: Oldest log time to return, in ms
+            end_time: Newest log time to return in ms, 0 for the time of the query
+            last_ms: If non-zero, return only entries from the last N ms instead of start/end
+            min_level: Lowest mb::logging::Level to return
+            max_count: Most entries to return, 0 for no limit
+            timeout: How long to wait for each page
+
+        Returns:
+            Matching entries oldest first, or None on failure
+        """
+        records: List[NetworkClient.LogRecord] = []
+        now = None
+        skip = 0
+
+        while True:
+            msg = LogQueryRequestPBMsg()
+            msg.pb_message.node_id = self.unique_id_from_string(node_id)
+            msg.pb_message.start_time = start_time
+            msg.pb_message.end_time = end_time
+            msg.pb_message.last_ms = last_ms
+            msg.pb_message.min_level = min_level
+            msg.pb_message.max_count = min(max_count - len(records), 0xFFFF) if max_count else 0
+            msg.pb_message.skip = skip
+
+            response = self._write_and_wait(msg=msg, timeout=timeout)
+            if not response or not isinstance(response[0], LogQueryResponsePBMsg):
+                logger.error(f"Failed to query logs from node {node_id}")
+                return None
+
+            # Pin the range to the first page so later pages don't chase new entries
+            page = response[0]
+            if now is None:
+                now = page.pb_message.now
+                if last_ms:
+                    start_time = max(now - last_ms, 0)
+                end_time = end_time or now
+                last_ms = 0
+
+            records.extend(
+                NetworkClient.LogRecord(time=time_ms, age=(now - time_ms) / 1000.0, level=level, data=data)
+                for time_ms, level, data in page.records()
+            )
+
+            if not page.pb_message.more or (max_count and len(records) >= max_count):
+                break
+
+            start_time = page.pb_message.next_time
+            skip = page.pb_message.skip
+
+        return records
+
+    def get_flight_recording(
+        self,
+        node_id: str,
+        rearm: bool = False,
+        pre_trigger: int = 0,
+        post_trigger: int = 0,
+        persist: bool = False,
+        timeout: float = 1.0,
+    ) -> Optional[FlightRecording]:
+        """
+        Reads the flight recorder capture of a node. Samples are only returned once the capture has
+        frozen around a fault. The recorder keeps its capture until it is rearmed.
+        Args:
+            node_id: Which node to query
+            rearm: Discard the capture and start recording again after reading it
+            pre_trigger: Samples to keep from before the next fault, 0 to keep the current setting
+            post_trigger: Samples to keep from after the next fault, 0 to keep the current setting
+            persist: Have the node write frozen captures to its log store, applied on rearm
+            timeout: How long to wait for each page
+
+        Returns:
+            The capture, or None on failure
+        """
+        samples: List[FlightSample] = []
+
+        while True:
+            msg = FlightRecorderRequestPBMsg()
+            msg.pb_message.node_id = self.unique_id_from_string(node_id)
+            msg.pb_message.offset = len(samples)
+
+            response = self._write_and_wait(msg=msg, timeout=timeout)
+            if not response or not isinstance(response[0], FlightRecorderResponsePBMsg):
+                logger.error(f"Failed to read flight recorder from node {node_id}")
+                return None
+
+            page = response[0].pb_message
+            samples.extend(page.samples)
+            if not page.samples or len(samples) >= page.total:
+                break
+
+        # Rearm only once the whole window is safely on the host
+        if rearm:
+            msg = FlightRecorderRequestPBMsg()
+            msg.pb_message.node_id = self.unique_id_from_string(node_id)
+            msg.pb_message.offset = page.total
+            msg.pb_message.rearm = True
+            msg.pb_message.pre_trigger = pre_trigger
+            msg.pb_message.post_trigger = post_trigger
+            msg.pb_message.persist = persist
+
+            response = self._write_and_wait(msg=msg, timeout=timeout)
+            if not response or not isinstance(response[0], FlightRecorderResponsePBMsg):
+                logger.error(f"Failed to rearm flight recorder on node {node_id}")
+
+        return NetworkClient.FlightRecording(
+            state=page.state,
+            trigger_code=page.trigger_code,
+            trigger_time=page.trigger_time,
+            trigger_index=page.trigger_index,
+            samples=samples,
+        )
+
     def get_last_heartbeat(self, node_id: str) -> Optional[HeartbeatPBMsg]:
         """
         Returns the last received heartbeat message from a node
@@ -243,7 +619,7 @@ class NetworkClient:
             return True
 
         # Otherwise, wait for a response
-        response = self._client.com_pipe.write_and_wait(msg=msg, timeout=timeout)
+        response = self._write_and_wait(msg=msg, timeout=timeout)
         if not response or not isinstance(response[0], ManagerResponsePBMsg):
             logger.error(f"Missing response from command {command} on node {node_id}")
             return False
@@ -268,7 +644,7 @@ class NetworkClient:
         msg.pb_message.node_id = self.unique_id_from_string(node_id)
         msg.pb_message.pdi_id = data_id
 
-        response = self._client.com_pipe.write_and_wait(msg=msg, timeout=1.0)
+        response = self._write_and_wait(msg=msg, timeout=1.0)
         if response and isinstance(response[0], PDIReadResponsePBMsg) and response[0].pb_message.success:
             return response[0].pb_message.data
         else:
@@ -295,13 +671,39 @@ class NetworkClient:
         msg.pb_message.pdi_id = data_id
         msg.pb_message.data = data
 
-        response = self._client.com_pipe.write_and_wait(msg=msg, timeout=1.0)
+        response = self._write_and_wait(msg=msg, timeout=1.0)
         if response and isinstance(response[0], PDIWriteResponsePBMsg) and response[0].pb_message.success:
             return True
         else:
             logger.error(f"Failed to write PDI {data_id} on node {node_id}")
             return False
 
+    def write_calibrations(self, node_id: str, entries: List[CalibrationEntry]) -> bool:
+        """
+        Writes a set of calibrations to a node's calibration store. All entries are committed
+        to flash together, so either every entry takes effect or none do.
+        Args:
+            node_id: Which node to write to
+            entries: Calibrations to write
+
+        Returns:
+            True if the calibrations were committed, False if not
+        """
+        msg = CalWriteRequestPBMsg()
+        msg.pb_message.node_id = self.unique_id_from_string(node_id)
+        msg.pb_message.entries.extend(entries)
+
+        # Bank swaps erase flash on the node, which can take a while
+        response = self._write_and_wait(msg=msg, timeout=10.0)
+        if response and isinstance(response[0], CalWriteResponsePBMsg) and response[0].pb_message.success:
+            return True
+        elif response and isinstance(response[0], CalWriteResponsePBMsg):
+            logger.error(f"Failed to write calibrations on node {node_id}: {response[0].pb_message.message}")
+            return False
+        else:
+            logger.error(f"Failed to write calibrations on node {node_id}")
+            return False
+
     def read_sensor_data(self, node_id: str, sensor: SensorType.ValueType) -> Optional[float]:
         """
         Reads a sensor value from a node
@@ -316,13 +718,304 @@ class NetworkClient:
         msg.pb_message.node_id = self.unique_id_from_string(node_id)
         msg.pb_message.sensor = sensor
 
-        response = self._client.com_pipe.write_and_wait(msg=msg, timeout=3.0)
+        response = self._write_and_wait(msg=msg, timeout=3.0)
         if response and isinstance(response[0], SensorResponsePBMsg) and response[0].status == ERR_SENSOR_NO_ERROR:
             return response[0].value
 
         logger.error(f"Failed to read sensor {sensor} on node {node_id}")
         return None
 
+    def read_sensors(
+        self, node_id: str, sensors: List[SensorType.ValueType]
+    ) -> Optional[Tuple[int, Dict[int, float]]]:
+        """
+        Reads several sensor values from a node in one round trip. All values come from the same
+        sampling pass on the node.
+        Args:
+            node_id: Which node to query
+            sensors: Which sensors to read
+
+        Returns:
+            Node system time of the sample in ms and SensorType -> value, or None on failure. Sensors
+            the node doesn't support are left out.
+        """
+        mask = 0
+        for sensor in sensors:
+            mask |= 1 << sensor
+
+        msg = SensorBatchRequestPBMsg()
+        msg.pb_message.node_id = self.unique_id_from_string(node_id)
+        msg.pb_message.sensor_mask = mask
+
+        response = self._write_and_wait(msg=msg, timeout=3.0)
+        if not response or not isinstance(response[0], SensorBatchResponsePBMsg):
+            logger.error(f"Failed to read sensors on node {node_id}")
+            return None
+
+        page = response[0]
+        if page.pb_message.status != ERR_SENSOR_NO_ERROR:
+            logger.warning(f"Node {node_id} does not support sensors in mask 0x{mask & ~page.pb_message.sensor_mask:04x}")
+
+        return page.pb_message.timestamp, page.readings()
+
+    def group_command(
+        self,
+        group_id: int,
+        action: GroupAction.ValueType,
+        field: SetpointField.ValueType = SETPOINT_OUTPUT_VOLTAGE,
+        value: float = 0.0,
+        delay: float = 0.1,
+        nodes: Optional[List[str]] = None,
+        timeout: float = 0.5,
+    ) -> Dict[str, int]:
+        """
+        Schedules one command on every member of a group with a single broadcast frame. Members time
+        the delay from when the frame arrived on their link, so nodes on the same bus act together no
+        matter when each one got around to processing it. Frames arriving before a member processes
+        the command move its timing reference, so nothing else should be sent until this returns.
+        Args:
+            group_id: Group to address, or GROUP_ID_ALL for every node
+            action: What the members should do
+            field: Setpoint to change, for GROUP_ACTION_SETPOINT
+            value: Setpoint value, for GROUP_ACTION_SETPOINT
+            delay: Seconds from the frame arriving to the command running
+            nodes: Members expected to acknowledge. Collection stops once all of them have and any
+                that didn't are logged. Without it, acknowledgements are collected for the full timeout.
+            timeout: Time to collect acknowledgements
+
+        Returns:
+            Node ID -> GroupCommandStatus of every member that acknowledged
+        """
+        self._group_command_id = (self._group_command_id + 1) & 0xFFFF
+
+        msg = GroupCommandRequestPBMsg()
+        msg.pb_message.group_id = group_id
+        msg.pb_message.command_id = self._group_command_id
+        msg.pb_message.action = action
+        msg.pb_message.field = field
+        msg.pb_message.value = value
+        msg.pb_message.delay_us = int(delay * 1e6)
+
+        responses = self._write_and_wait(
+            msg=msg, timeout=timeout, count=len(nodes) if nodes else None
+        )
+
+        acks = {}
+        for rsp in responses or []:
+            if isinstance(rsp, GroupCommandResponsePBMsg) and rsp.pb_message.command_id == self._group_command_id:
+                node_id = self.unique_id_to_string(rsp.pb_message.node_id)
+                acks[node_id] = rsp.pb_message.status
+
+                if rsp.pb_message.status != GROUP_CMD_OK:
+                    logger.error(f"Node {node_id} rejected group command: {GroupCommandStatus.Name(rsp.pb_message.status)}")
+
+        for node_id in set(nodes or []) - acks.keys():
+            logger.error(f"Node {node_id} did not acknowledge group command {self._group_command_id}")
+
+        return acks
+
+    def ltc_read_registers(self, node_id: str, reg: Optional[int] = None) -> Optional[Dict[int, int]]:
+        """
+        Reads LTC7871 registers on a node. Without a register, every MFR register is read in one
+        burst so the values form a consistent snapshot of the converter.
+        Args:
+            node_id: Which node to query
+            reg: Register address to read, or None to dump the whole register map
+
+        Returns:
+            Register address -> value, or None on failure
+        """
+        msg = LTCRegGetRequestPBMsg()
+        msg.pb_message.node_id = self.unique_id_from_string(node_id)
+        msg.pb_message.reg = reg or 0
+        msg.pb_message.dump = reg is None
+
+        response = self._write_and_wait(msg=msg, timeout=1.0)
+        if not response or not isinstance(response[0], LTCRegGetResponsePBMsg):
+            logger.error(f"Failed to read LTC7871 registers on node {node_id}")
+            return None
+
+        if response[0].pb_message.status != LTC_REG_OK:
+            logger.error(f"Node {node_id} rejected LTC7871 read: {LTCRegStatus.Name(response[0].pb_message.status)}")
+            return None
+
+        return response[0].registers()
+
+    def ltc_write_register(self, node_id: str, reg: int, value: int) -> Optional[int]:
+        """
+        Writes an LTC7871 register on a node. Only the IDAC and SSFM registers can be written, and
+        only while the power stage is disabled.
+        Args:
+            node_id: Which node to talk to
+            reg: Register address to write
+            value: Value to write
+
+        Returns:
+            Register value read back after the write, or None on failure
+        """
+        msg = LTCRegSetRequestPBMsg()
+        msg.pb_message.node_id = self.unique_id_from_string(node_id)
+        msg.pb_message.reg = reg
+        msg.pb_message.value = value
+
+        response = self._write_and_wait(msg=msg, timeout=1.0)
+        if not response or not isinstance(response[0], LTCRegSetResponsePBMsg):
+            logger.error(f"Failed to write LTC7871 register 0x{reg:02X} on node {node_id}")
+            return None
+
+        if response[0].pb_message.status != LTC_REG_OK:
+            logger.error(f"Node {node_id} rejected LTC7871 write: {LTCRegStatus.Name(response[0].pb_message.status)}")
+            return None
+
+        return response[0].pb_message.value
+
+    def subscribe_telemetry(
+        self,
+        node_id: str,
+        sensors: List[SensorType.ValueType],
+        period: float = 0.1,
+        deadband: float = 0.0,
+        keyframe: float = 0.0,
+    ) -> bool:
+        """
+        Has a node stream sensor values instead of waiting to be polled. Each frame only carries the
+        values that moved by more than the deadband since they were last sent, plus a periodic keyframe
+        with all of them. Replaces any previous subscription on the node.
+        Args:
+            node_id: Which node to stream from
+            sensors: Sensors to stream, empty to stop streaming
+            period: Seconds between frames
+            deadband: Smallest change in a value worth sending
+            keyframe: Seconds between frames carrying every value, 0 for the node default
+
+        Returns:
+            True if the node accepted every requested sensor, False if not
+        """
+        mask = 0
+        for sensor in sensors:
+            mask |= 1 << sensor
+
+        msg = TelemetrySubscribeRequestPBMsg()
+        msg.pb_message.node_id = self.unique_id_from_string(node_id)
+        msg.pb_message.sensor_mask = mask
+        msg.pb_message.period_ms = min(int(period * 1000), 0xFFFF)
+        msg.pb_message.deadband = deadband
+        msg.pb_message.keyframe_ms = min(int(keyframe * 1000), 0xFFFF)
+
+        response = self._write_and_wait(msg=msg, timeout=1.0)
+        if not response or not isinstance(response[0], TelemetrySubscribeResponsePBMsg):
+            logger.error(f"Failed to subscribe to telemetry on node {node_id}")
+            return False
+
+        with self._data_lock:
+            self._telemetry[node_id] = {}
+
+        applied = response[0].pb_message
+        if applied.sensor_mask != mask:
+            logger.warning(f"Node {node_id} does not stream sensors in mask 0x{mask & ~applied.sensor_mask:04x}")
+            return False
+
+        return True
+
+    def get_telemetry(self, node_id: str, sensor: SensorType.ValueType) -> Optional[TelemetryValue]:
+        """
+        Returns the latest streamed value of a sensor
+        Args:
+            node_id: Which node to look up
+            sensor: Which sensor to look up
+
+        Returns:
+            The latest value, or None if the sensor hasn't been streamed
+        """
+        with self._data_lock:
+            return self._telemetry.get(node_id, {}).get(sensor)
+
+    def set_telemetry_handler(self, handler: Optional[Callable[[str, Dict[int, float]], None]]) -> None:
+        """
+        Routes each telemetry frame to a handler as well as the value cache
+        Args:
+            handler: Called with the node id and the SensorType -> value pairs of each frame, or None
+
+        Returns:
+            None
+        """
+        with self._data_lock:
+            self._telemetry_handler = handler
+
+    def _reopen(self, baud: int) -> None:
+        """
+        Reopens the connection at a new baud rate, keeping the message observers
+        Args:
+            baud: Rate to reopen at
+
+        Returns:
+            None
+        """
+        with self._link_lock:
+            for observer_id in self._msg_observers:
+                self._client.com_pipe.unsubscribe(observer_id)
+            self._msg_observers.clear()
+
+            self._client.close()
+            self._rpc_baud = baud
+            self.open()
+
+    def _write_and_wait(self, msg: BasePBMsg, timeout: float, **kwargs) -> Optional[List[BasePBMsg]]:
+        """
+        Sends a request and waits on the response. Too many unanswered requests in a row mean the
+        node has most likely fallen back to the default rate on its own, so the host follows it.
+        Args:
+            msg: Request to send
+            timeout: How long to wait for the response
+            kwargs: Passed through to the pipe
+
+        Returns:
+            Responses received, empty or None if nothing answered
+        """
+        with self._link_lock:
+            response = self._client.com_pipe.write_and_wait(msg=msg, timeout=timeout, **kwargs)
+            if response:
+                self._link_misses = 0
+            else:
+                self._link_misses += 1
+                if self._link_misses >= self._LINK_MISS_LIMIT:
+                    self._link_fall_back(f"{self._link_misses} requests went unanswered")
+
+        return response
+
+    def _link_fall_back(self, reason: str) -> None:
+        """
+        Reopens the connection at the default rate if it is running at anything faster
+        Args:
+            reason: Why the link is considered lost
+
+        Returns:
+            None
+        """
+        with self._link_lock:
+            self._link_misses = 0
+            if self._rpc_baud == self._LINK_DEFAULT_BAUD:
+                return
+
+            logger.warning(f"Link at {self._rpc_baud} baud lost, {reason}. Falling back to {self._LINK_DEFAULT_BAUD}")
+            self._reopen(self._LINK_DEFAULT_BAUD)
+
+    def _link_monitor(self) -> None:
+        """
+        Background check for heartbeats going quiet while the link runs above the default rate
+        Returns:
+            None
+        """
+        while not self._link_stop.wait(self._LINK_MONITOR_PERIOD):
+            if self._rpc_baud == self._LINK_DEFAULT_BAUD:
+                continue
+
+            with self._data_lock:
+                last_heard = max((node.last_seen for node in self._observed_nodes.values()), default=0.0)
+
+            if (time.time() - max(last_heard, self._link_since)) > self._LINK_HEARTBEAT_TIMEOUT:
+                self._link_fall_back("heartbeats stopped")
+
     def _prune_observed_nodes(self) -> None:
         """
         Prunes the list of observed nodes to remove any that have not been seen in a while
@@ -358,3 +1051,54 @@ class NetworkClient:
             self._observed_nodes[node_id] = self.NodeProperties(
                 node_id=node_id, sw_version="unknown", last_seen=time.time(), heartbeat=copy.copy(msg)
             )
+
+    def _console_batch_observer(self, msg: ConsoleBatchPBMsg) -> None:
+        """
+        Callback to unpack a batch of console log records
+        Args:
+            msg: Received console batch
+
+        Returns:
+            None
+        """
+        with self._data_lock:
+            decoder = self._log_decoder
+            handler = self._console_handler
+
+        for level, data in msg.records():
+            if decoder:
+                text = decoder.decode_entry(data)
+            elif BinaryLogDecoder.is_binary(data):
+                text = f"<binary log record: {data.hex()}>"
+            else:
+                text = data.decode("utf-8", errors="replace")
+
+            text = text.rstrip("\r\n")
+            if handler:
+                handler(level, text)
+            else:
+                logger.log(self._console_log_levels.get(level, "INFO"), text)
+
+    def _telemetry_observer(self, msg: TelemetryPBMsg) -> None:
+        """
+        Callback to cache streamed sensor values
+        Args:
+            msg: Received telemetry frame
+
+        Returns:
+            None
+        """
+        node_id = self.unique_id_to_string(msg.pb_message.node_id)
+        readings = msg.readings()
+        now = time.time()
+
+        with self._data_lock:
+            cache = self._telemetry.setdefault(node_id, {})
+            for sensor, value in readings.items():
+                cache[sensor] = NetworkClient.TelemetryValue(
+                    value=value, timestamp=msg.pb_message.timestamp, received=now
+                )
+            handler = self._telemetry_handler
+
+        if handler:
+            handler(node_id, readings)
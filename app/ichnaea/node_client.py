@@ -1,10 +1,11 @@
 import time
 import operator
-from typing import Callable, List
+from typing import Callable, Dict, List
 from typing import Optional
 
 from loguru import logger
 
+from ichnaea.binlog import LEVEL_NAMES, BinaryLogDecoder, FormatTable, decode_flight_capture, is_flight_capture
 from ichnaea.network_client import NetworkClient
 from ichnaea.messages import HeartbeatPBMsg, SetpointRequestPBMsg, SetpointResponsePBMsg
 from ichnaea.proto.ichnaea_pdi_pb2 import *
@@ -28,6 +29,9 @@ pdi_type_to_id_map = {
         PDI_ID.CONFIG_MAX_SYSTEM_VOLTAGE_INPUT,
         PDI_ID.CONFIG_MAX_SYSTEM_VOLTAGE_INPUT_RATED_LIMIT,
     ],
+    PDI_Uint32Configuration: [
+        PDI_ID.CONFIG_GROUP_MEMBERSHIP,
+    ],
     PDI_IIRFilterConfig: [
         PDI_ID.CONFIG_MON_FILTER_INPUT_VOLTAGE,
         PDI_ID.CONFIG_MON_FILTER_OUTPUT_VOLTAGE,
@@ -59,6 +63,15 @@ MAX_OUTPUT_VOLTAGE = 55.0
 MIN_OUTPUT_VOLTAGE = 10.0
 MAX_OUTPUT_CURRENT = 150.0
 
+# NOR flash partitions as (name, first sector, sector count). Mirrors fal_cfg.h.
+FLASH_SECTOR_SIZE = 4096
+FLASH_REGIONS = [
+    ("pdi", 0, 256),
+    ("cal", 256, 256),
+    ("log", 512, 496),
+    ("wear", 1008, 16),
+]
+
 
 class NodeClient:
     """Interface to a single Ichnaea node in the distributed network"""
@@ -75,6 +88,7 @@ class NodeClient:
         # Internal configuration data about this node
         self._rated_system_output_voltage = MAX_OUTPUT_VOLTAGE
         self._rated_system_output_current = MAX_OUTPUT_CURRENT
+        self._log_decoder: Optional[BinaryLogDecoder] = None
 
     @property
     def node_id(self) -> str:
@@ -141,6 +155,17 @@ class NodeClient:
             return self.pdi_read(pdi) == msg
         return False
 
+    def write_calibrations(self, entries: List[CalibrationEntry]) -> bool:
+        """
+        Writes a set of calibrations to the node in a single flash commit
+        Args:
+            entries: Calibrations to write
+
+        Returns:
+            True if the calibrations were committed, False if not
+        """
+        return self._net_client.write_calibrations(self._node_id, entries)
+
     def pdi_flush(self) -> None:
         """
         Flushes the PDI cache on the node to ensure all data is written to non-volatile memory. This is
@@ -186,6 +211,19 @@ class NodeClient:
         data_to_send = message.encode("utf-8")
         return log_client.write(data_to_send, level=level)
 
+    def load_log_formats(self, elf_path: str) -> None:
+        """
+        Loads the binary log format strings from the firmware image running on the node, which
+        allows log_read() and the console stream to turn binary records back into text.
+        Args:
+            elf_path: Path to the firmware or simulator ELF
+
+        Returns:
+            None
+        """
+        self._log_decoder = BinaryLogDecoder(FormatTable.from_elf(elf_path))
+        self._net_client.set_log_decoder(self._log_decoder)
+
     def log_read(self, count: int = 1, direction: bool = True) -> List[str]:
         """
         Reads a number of logs from the node
@@ -198,7 +236,112 @@ class NodeClient:
         """
         # TODO BMB: This is assuming a direct connection to the node. Needs updates for meshed network.
         log_client = LoggerRPCClient(rpc_client=self._net_client.rpc_client, logger_id=0)
-        return [entry.decode("utf-8") for entry in log_client.read(count, direction)]
+        entries = log_client.read(count, direction)
+
+        if not self._log_decoder and any(BinaryLogDecoder.is_binary(entry) for entry in entries):
+            logger.warning("Binary log records present, call load_log_formats() to decode them")
+
+        return [self._entry_text(entry) for entry in entries]
+
+    def log_query(self, since: Optional[float] = None, min_level: int = 0, max_count: int = 0) -> List[str]:
+        """
+        Reads stored logs filtered on the node, ie errors from the last hour:
+            node.log_query(since=3600, min_level=LEVEL_NAMES.index("ERROR"))
+        Args:
+            since: Only return entries from the last N seconds, None for all of them
+            min_level: Lowest mb::logging::Level to return
+            max_count: Most entries to return, 0 for no limit
+
+        Returns:
+            Matching entries oldest first, each prefixed with how long ago it was logged
+        """
+        last_ms = int(since * 1000) if since else 0
+        records = self._net_client.query_logs(self._node_id, last_ms=last_ms, min_level=min_level, max_count=max_count)
+        if records is None:
+            return []
+
+        entries = []
+        for record in records:
+            entries.append(f"-{record.age:.3f}s {self._entry_text(record.data).rstrip()}")
+
+        return entries
+
+    def flight_recording(self, rearm: bool = False) -> Optional[NetworkClient.FlightRecording]:
+        """
+        Reads the samples the node captured around its last monitor or LTC fault
+        Args:
+            rearm: Start recording again once the capture has been read
+
+        Returns:
+            The capture, or None if it could not be read
+        """
+        return self._net_client.get_flight_recording(self._node_id, rearm=rearm)
+
+    def boot_timeline(self) -> List[BootStep]:
+        """
+        Reads the timing profile of each step in the node's last boot sequence
+
+        Returns:
+            Ordered list of boot steps, empty if the timeline could not be read
+        """
+        return self._net_client.get_boot_timeline(self._node_id) or []
+
+    def flash_stats(self) -> Optional[NetworkClient.FlashStats]:
+        """
+        Reads the lifetime flash wear and latency statistics of the node
+
+        Returns:
+            Flash statistics, or None if they could not be read
+        """
+        return self._net_client.get_flash_stats(self._node_id)
+
+    def flash_wear_report(self, top: int = 5) -> str:
+        """
+        Builds a human readable summary of the node's flash usage: lifetime totals, the most
+        erased sectors in each partition and the latency distribution of each operation.
+        Args:
+            top: How many of the most erased sectors to list per partition
+
+        Returns:
+            Multi-line report, empty if the statistics could not be read
+        """
+        stats = self.flash_stats()
+        if not stats:
+            return ""
+
+        lines = [
+            f"Flash statistics for node {self._node_id}",
+            f"  Read:       {stats.bytes_read} bytes in {stats.read_ops} ops",
+            f"  Programmed: {stats.bytes_programmed} bytes in {stats.program_ops} ops",
+            f"  Erased:     {stats.erase_ops} sectors",
+        ]
+
+        for name, first, count in FLASH_REGIONS:
+            counts = stats.erase_counts[first : first + count]
+            if not counts:
+                continue
+
+            hottest = sorted(range(len(counts)), key=lambda idx: counts[idx], reverse=True)[:top]
+            lines.append(
+                f"  [{name}] total {sum(counts)}, max {max(counts)}, mean {sum(counts) / len(counts):.1f} erases"
+            )
+            for idx in hottest:
+                if counts[idx]:
+                    address = (first + idx) * FLASH_SECTOR_SIZE
+                    lines.append(f"    0x{address:08X}: {counts[idx]}")
+
+        for op, buckets in sorted(stats.latency.items()):
+            total = sum(buckets)
+            if not total:
+                continue
+
+            lines.append(f"  {FlashOp.Name(op)} latency ({total} ops):")
+            for idx, qty in enumerate(buckets):
+                if qty:
+                    upper = "inf" if idx == len(buckets) - 1 else f"{2 ** (idx + 1)}us"
+                    lines.append(f"    < {upper:>9}: {qty} ({100.0 * qty / total:.1f}%)")
+
+        return "\n".join(lines)
 
     def reboot(self, timeout: float = 5.0) -> None:
         """
@@ -277,6 +420,20 @@ class NodeClient:
         logger.warning(f"{self._node_id} did not respond to status request")
         return None
 
+    def tx_queue_stats(self) -> Dict[str, TxQueueStats]:
+        """
+        Gets how the node's transmit queues are keeping up, ie to check whether log traffic is
+        being dropped to keep control responses moving
+        Returns:
+            Class name -> queue statistics, empty if the node didn't respond
+        """
+        status = self._net_client.get_status(self._node_id)
+        if status is None:
+            logger.warning(f"{self._node_id} did not respond to status request")
+            return {}
+
+        return dict(zip(["telemetry", "bulk"], status.pb_message.tx_queues))
+
     def wait_for_engagement_state(
         self, target: EngageState.ValueType, timeout: float = 5.0, poll_rate: float = 0.5
     ) -> bool:
@@ -364,6 +521,123 @@ class NodeClient:
         """
         return self._net_client.read_sensor_data(self._node_id, SensorType.SENSOR_INPUT_VOLTAGE)
 
+    def read_sensors(self, sensors: List[SensorType.ValueType]) -> Dict[int, float]:
+        """
+        Reads several sensors in one round trip, all from the same sampling pass on the node, ie:
+            node.read_sensors([SensorType.SENSOR_INPUT_VOLTAGE, SensorType.SENSOR_OUTPUT_CURRENT])
+        Args:
+            sensors: Sensors to read
+
+        Returns:
+            SensorType -> value, empty if the read failed. Unsupported sensors are left out.
+        """
+        result = self._net_client.read_sensors(self._node_id, sensors)
+        return result[1] if result else {}
+
+    def set_link_baud(self, baud: int) -> bool:
+        """
+        Moves the RPC link to a faster baud rate, falling back to the default if the node can't
+        be reached at the new rate
+        Args:
+            baud: Rate to switch to
+
+        Returns:
+            True if the link is running at the new rate, False if not
+        """
+        return self._net_client.negotiate_baud(self._node_id, baud)
+
+    @property
+    def groups(self) -> List[int]:
+        """
+        Returns:
+            Command groups the node belongs to
+        """
+        membership = self.pdi_read(PDI_ID.CONFIG_GROUP_MEMBERSHIP)
+        if membership is None:
+            return []
+        return [group for group in range(GROUP_ID_MAX + 1) if membership.value & (1 << group)]
+
+    def set_groups(self, groups: List[int]) -> bool:
+        """
+        Sets which command groups the node belongs to, ie for NetworkClient.group_command()
+        Args:
+            groups: Groups to join, each in the range 0 to GROUP_ID_MAX. Empty to leave all groups.
+
+        Returns:
+            True if the membership was committed, False if not
+        """
+        mask = 0
+        for group in groups:
+            if not 0 <= group <= GROUP_ID_MAX:
+                raise ValueError(f"Invalid group ID: {group}")
+            mask |= 1 << group
+
+        return self.pdi_write(PDI_ID.CONFIG_GROUP_MEMBERSHIP, PDI_Uint32Configuration(value=mask))
+
+    def ltc_register_dump(self) -> Dict[int, int]:
+        """
+        Snapshots every LTC7871 MFR register in a single round trip
+        Returns:
+            Register address -> value, empty if the read failed
+        """
+        return self._net_client.ltc_read_registers(self._node_id) or {}
+
+    def ltc_read_register(self, reg: int) -> Optional[int]:
+        """
+        Reads a single LTC7871 register
+        Args:
+            reg: Register address, ie ltc7871.REG_MFR_STATUS
+
+        Returns:
+            Register value, or None if the read failed
+        """
+        result = self._net_client.ltc_read_registers(self._node_id, reg)
+        return result.get(reg) if result else None
+
+    def ltc_write_register(self, reg: int, value: int) -> bool:
+        """
+        Writes an LTC7871 register directly. The output must be disengaged.
+        Args:
+            reg: Register address, ie ltc7871.REG_MFR_SSFM
+            value: Value to write
+
+        Returns:
+            True if the register holds the value afterwards, False if not
+        """
+        return self._net_client.ltc_write_register(self._node_id, reg, value) == value
+
+    def stream_sensors(
+        self, sensors: List[SensorType.ValueType], period: float = 0.1, deadband: float = 0.0
+    ) -> bool:
+        """
+        Has the node push sensor values as they change, so reads come from the local cache
+        instead of a round trip each. Pass an empty list to stop streaming.
+        Args:
+            sensors: Sensors to stream
+            period: Seconds between updates
+            deadband: Smallest change in a value worth sending
+
+        Returns:
+            True if the node is streaming every requested sensor, False if not
+        """
+        return self._net_client.subscribe_telemetry(self._node_id, sensors, period=period, deadband=deadband)
+
+    def streamed_value(self, sensor: SensorType.ValueType, max_age: float = 10.0) -> Optional[float]:
+        """
+        Returns the latest streamed value of a sensor, if it arrived recently enough
+        Args:
+            sensor: Sensor to look up
+            max_age: Oldest value in seconds to accept. Unchanged values are only resent every keyframe.
+
+        Returns:
+            The value, or None if the sensor isn't being streamed
+        """
+        entry = self._net_client.get_telemetry(self._node_id, sensor)
+        if entry is None or (time.time() - entry.received) > max_age:
+            return None
+
+        return entry.value
+
     def await_sensor_value(
         self,
         sensor: SensorType.ValueType,
@@ -389,8 +663,10 @@ class NodeClient:
         start_time = time.time()
         actual = None
         while (time.time() - start_time) < timeout:
-            # Take another reading from the sensor
-            actual = self._net_client.read_sensor_data(self._node_id, sensor)
+            # Take another reading from the sensor, from the stream if there is one
+            actual = self.streamed_value(sensor)
+            if actual is None:
+                actual = self._net_client.read_sensor_data(self._node_id, sensor)
 
             # Calculate the percent error and check if it is within the specified tolerance
             pct_error = abs(actual - target) / target
@@ -462,3 +738,19 @@ class NodeClient:
             Output current in amperes
         """
         return self._net_client.read_sensor_data(self._node_id, SensorType.SENSOR_OUTPUT_CURRENT)
+
+    def _entry_text(self, data: bytes) -> str:
+        """
+        Turns a stored log entry into text. Flight recorder captures are self describing, binary
+        records need the formats from load_log_formats().
+        Args:
+            data: A single stored log entry
+
+        Returns:
+            Text of the entry
+        """
+        if is_flight_capture(data):
+            return decode_flight_capture(data)
+        if self._log_decoder:
+            return self._log_decoder.decode_entry(data)
+        return data.decode("utf-8", errors="replace")
@@ -26,23 +26,43 @@ import nanopb_pb2 as nanopb__pb2
 import mbed_rpc_pb2 as mbed__rpc__pb2
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x13ichnaea_async.proto\x12\x07ichnaea\x1a\x0cnanopb.proto\x1a\x0embed_rpc.proto\"z\n\tHeartbeat\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x19\n\nboot_count\x18\x02 \x02(\rB\x05\x92?\x02\x38 \x12\x16\n\x07node_id\x18\x03 \x02(\rB\x05\x92?\x02\x38 \x12\x18\n\ttimestamp\x18\x04 \x02(\rB\x05\x92?\x02\x38 *$\n\x0e\x41syncMessageId\x12\x12\n\rMSG_HEARTBEAT\x10\xc8\x01*,\n\x13\x41syncMessageVersion\x12\x15\n\x11MSG_VER_HEARTBEAT\x10\x00')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x13ichnaea_async.proto\x12\x07ichnaea\x1a\x0cnanopb.proto\x1a\x0embed_rpc.proto\"z\n\tHeartbeat\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x19\n\nboot_count\x18\x02 \x02(\rB\x05\x92?\x02\x38 \x12\x16\n\x07node_id\x18\x03 \x02(\rB\x05\x92?\x02\x38 \x12\x18\n\ttimestamp\x18\x04 \x02(\rB\x05\x92?\x02\x38 \"\\\n\x0c\x43onsoleBatch\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x14\n\x05\x63ount\x18\x02 \x02(\rB\x05\x92?\x02\x38\x08\x12\x14\n\x04\x64\x61ta\x18\x03 \x02(\x0c\x42\x06\x92?\x03\x08\xc0\x04\"\xad\x01\n\tTelemetry\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x16\n\x07node_id\x18\x02 \x02(\rB\x05\x92?\x02\x38 \x12\x18\n\ttimestamp\x18\x03 \x02(\rB\x05\x92?\x02\x38 \x12\x17\n\x08sequence\x18\x04 \x02(\rB\x05\x92?\x02\x38\x10\x12\x1a\n\x0bsensor_mask\x18\x05 \x02(\rB\x05\x92?\x02\x38\x10\x12\x17\n\x06values\x18\x06 \x03(\x02\x42\x07\x10\x01\x92?\x02\x10\x0b*P\n\x0e\x41syncMessageId\x12\x12\n\rMSG_HEARTBEAT\x10\xc8\x01\x12\x16\n\x11MSG_CONSOLE_BATCH\x10\xc9\x01\x12\x12\n\rMSG_TELEMETRY\x10\xca\x01*b\n\x13\x41syncMessageVersion\x12\x15\n\x11MSG_VER_HEARTBEAT\x10\x00\x12\x19\n\x15MSG_VER_CONSOLE_BATCH\x10\x01\x12\x15\n\x11MSG_VER_TELEMETRY\x10\x00\x1a\x02\x10\x01')
 
 _globals = globals()
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, _globals)
 _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'ichnaea_async_pb2', _globals)
 if not _descriptor._USE_C_DESCRIPTORS:
   DESCRIPTOR._loaded_options = None
+  _globals['_ASYNCMESSAGEVERSION']._loaded_options = None
+  _globals['_ASYNCMESSAGEVERSION']._serialized_options = b'\020\001'
   _globals['_HEARTBEAT'].fields_by_name['boot_count']._loaded_options = None
   _globals['_HEARTBEAT'].fields_by_name['boot_count']._serialized_options = b'\222?\0028 '
   _globals['_HEARTBEAT'].fields_by_name['node_id']._loaded_options = None
   _globals['_HEARTBEAT'].fields_by_name['node_id']._serialized_options = b'\222?\0028 '
   _globals['_HEARTBEAT'].fields_by_name['timestamp']._loaded_options = None
   _globals['_HEARTBEAT'].fields_by_name['timestamp']._serialized_options = b'\222?\0028 '
-  _globals['_ASYNCMESSAGEID']._serialized_start=186
-  _globals['_ASYNCMESSAGEID']._serialized_end=222
-  _globals['_ASYNCMESSAGEVERSION']._serialized_start=224
-  _globals['_ASYNCMESSAGEVERSION']._serialized_end=268
+  _globals['_CONSOLEBATCH'].fields_by_name['count']._loaded_options = None
+  _globals['_CONSOLEBATCH'].fields_by_name['count']._serialized_options = b'\222?\0028\010'
+  _globals['_CONSOLEBATCH'].fields_by_name['data']._loaded_options = None
+  _globals['_CONSOLEBATCH'].fields_by_name['data']._serialized_options = b'\222?\003\010\300\004'
+  _globals['_TELEMETRY'].fields_by_name['node_id']._loaded_options = None
+  _globals['_TELEMETRY'].fields_by_name['node_id']._serialized_options = b'\222?\0028 '
+  _globals['_TELEMETRY'].fields_by_name['timestamp']._loaded_options = None
+  _globals['_TELEMETRY'].fields_by_name['timestamp']._serialized_options = b'\222?\0028 '
+  _globals['_TELEMETRY'].fields_by_name['sequence']._loaded_options = None
+  _globals['_TELEMETRY'].fields_by_name['sequence']._serialized_options = b'\222?\0028\020'
+  _globals['_TELEMETRY'].fields_by_name['sensor_mask']._loaded_options = None
+  _globals['_TELEMETRY'].fields_by_name['sensor_mask']._serialized_options = b'\222?\0028\020'
+  _globals['_TELEMETRY'].fields_by_name['values']._loaded_options = None
+  _globals['_TELEMETRY'].fields_by_name['values']._serialized_options = b'\020\001\222?\002\020\013'
+  _globals['_ASYNCMESSAGEID']._serialized_start=456
+  _globals['_ASYNCMESSAGEID']._serialized_end=536
+  _globals['_ASYNCMESSAGEVERSION']._serialized_start=538
+  _globals['_ASYNCMESSAGEVERSION']._serialized_end=636
   _globals['_HEARTBEAT']._serialized_start=62
   _globals['_HEARTBEAT']._serialized_end=184
+  _globals['_CONSOLEBATCH']._serialized_start=186
+  _globals['_CONSOLEBATCH']._serialized_end=278
+  _globals['_TELEMETRY']._serialized_start=281
+  _globals['_TELEMETRY']._serialized_end=454
 # @@protoc_insertion_point(module_scope)
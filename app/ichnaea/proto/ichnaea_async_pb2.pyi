@@ -4,7 +4,9 @@ isort:skip_file
 """
 
 import builtins
+import collections.abc
 import google.protobuf.descriptor
+import google.protobuf.internal.containers
 import google.protobuf.internal.enum_type_wrapper
 import google.protobuf.message
 import mbed_rpc_pb2
@@ -25,6 +27,8 @@ class _AsyncMessageId:
 class _AsyncMessageIdEnumTypeWrapper(google.protobuf.internal.enum_type_wrapper._EnumTypeWrapper[_AsyncMessageId.ValueType], builtins.type):
     DESCRIPTOR: google.protobuf.descriptor.EnumDescriptor
     MSG_HEARTBEAT: _AsyncMessageId.ValueType  # 200
+    MSG_CONSOLE_BATCH: _AsyncMessageId.ValueType  # 201
+    MSG_TELEMETRY: _AsyncMessageId.ValueType  # 202
 
 class AsyncMessageId(_AsyncMessageId, metaclass=_AsyncMessageIdEnumTypeWrapper):
     """Asynchronous messages that can be sent between nodes in the network and are not RPCs. Usually this is
@@ -33,6 +37,8 @@ class AsyncMessageId(_AsyncMessageId, metaclass=_AsyncMessageIdEnumTypeWrapper):
     """
 
 MSG_HEARTBEAT: AsyncMessageId.ValueType  # 200
+MSG_CONSOLE_BATCH: AsyncMessageId.ValueType  # 201
+MSG_TELEMETRY: AsyncMessageId.ValueType  # 202
 global___AsyncMessageId = AsyncMessageId
 
 class _AsyncMessageVersion:
@@ -42,12 +48,14 @@ class _AsyncMessageVersion:
 class _AsyncMessageVersionEnumTypeWrapper(google.protobuf.internal.enum_type_wrapper._EnumTypeWrapper[_AsyncMessageVersion.ValueType], builtins.type):
     DESCRIPTOR: google.protobuf.descriptor.EnumDescriptor
     MSG_VER_HEARTBEAT: _AsyncMessageVersion.ValueType  # 0
-    """option allow_alias = true;"""
+    MSG_VER_CONSOLE_BATCH: _AsyncMessageVersion.ValueType  # 1
+    MSG_VER_TELEMETRY: _AsyncMessageVersion.ValueType  # 0
 
 class AsyncMessageVersion(_AsyncMessageVersion, metaclass=_AsyncMessageVersionEnumTypeWrapper): ...
 
 MSG_VER_HEARTBEAT: AsyncMessageVersion.ValueType  # 0
-"""option allow_alias = true;"""
+MSG_VER_CONSOLE_BATCH: AsyncMessageVersion.ValueType  # 1
+MSG_VER_TELEMETRY: AsyncMessageVersion.ValueType  # 0
 global___AsyncMessageVersion = AsyncMessageVersion
 
 @typing.final
@@ -77,3 +85,73 @@ class Heartbeat(google.protobuf.message.Message):
     def ClearField(self, field_name: typing.Literal["boot_count", b"boot_count", "header", b"header", "node_id", b"node_id", "timestamp", b"timestamp"]) -> None: ...
 
 global___Heartbeat = Heartbeat
+
+@typing.final
+class ConsoleBatch(google.protobuf.message.Message):
+    """MSG_CONSOLE_BATCH
+
+    Several console log records packed into one frame. Each record in data is a one byte log level, a one
+    byte length, then that many bytes of the message. Records never span batches.
+    """
+
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    HEADER_FIELD_NUMBER: builtins.int
+    COUNT_FIELD_NUMBER: builtins.int
+    DATA_FIELD_NUMBER: builtins.int
+    count: builtins.int
+    data: builtins.bytes
+    @property
+    def header(self) -> mbed_rpc_pb2.Header: ...
+    def __init__(
+        self,
+        *,
+        header: mbed_rpc_pb2.Header | None = ...,
+        count: builtins.int | None = ...,
+        data: builtins.bytes | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["count", b"count", "data", b"data", "header", b"header"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["count", b"count", "data", b"data", "header", b"header"]) -> None: ...
+
+global___ConsoleBatch = ConsoleBatch
+
+@typing.final
+class Telemetry(google.protobuf.message.Message):
+    """MSG_TELEMETRY
+
+    Streamed sensor values for a telemetry subscription. Bit N of sensor_mask is set when the value of
+    SensorType N is present, and values holds those values in order of increasing SensorType. Values that
+    stayed inside the deadband are left out, except in periodic keyframes which carry all of them.
+    """
+
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    HEADER_FIELD_NUMBER: builtins.int
+    NODE_ID_FIELD_NUMBER: builtins.int
+    TIMESTAMP_FIELD_NUMBER: builtins.int
+    SEQUENCE_FIELD_NUMBER: builtins.int
+    SENSOR_MASK_FIELD_NUMBER: builtins.int
+    VALUES_FIELD_NUMBER: builtins.int
+    node_id: builtins.int
+    timestamp: builtins.int
+    sequence: builtins.int
+    """Increments each frame, gaps mean lost frames"""
+    sensor_mask: builtins.int
+    @property
+    def header(self) -> mbed_rpc_pb2.Header: ...
+    @property
+    def values(self) -> google.protobuf.internal.containers.RepeatedScalarFieldContainer[builtins.float]: ...
+    def __init__(
+        self,
+        *,
+        header: mbed_rpc_pb2.Header | None = ...,
+        node_id: builtins.int | None = ...,
+        timestamp: builtins.int | None = ...,
+        sequence: builtins.int | None = ...,
+        sensor_mask: builtins.int | None = ...,
+        values: collections.abc.Iterable[builtins.float] | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["header", b"header", "node_id", b"node_id", "sensor_mask", b"sensor_mask", "sequence", b"sequence", "timestamp", b"timestamp"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["header", b"header", "node_id", b"node_id", "sensor_mask", b"sensor_mask", "sequence", b"sequence", "timestamp", b"timestamp", "values", b"values"]) -> None: ...
+
+global___Telemetry = Telemetry
@@ -25,7 +25,7 @@ _sym_db = _symbol_database.Default()
 import nanopb_pb2 as nanopb__pb2
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x11ichnaea_pdi.proto\x12\x07ichnaea\x1a\x0cnanopb.proto\"*\n\rPDI_BootCount\x12\x19\n\nboot_count\x18\x01 \x02(\rB\x05\x92?\x02\x38 \"0\n\x10PDI_SerialNumber\x12\x1c\n\rserial_number\x18\x01 \x02(\tB\x05\x92?\x02\x08 \"T\n\x13PDI_ManufactureDate\x12\x12\n\x03\x64\x61y\x18\x01 \x02(\rB\x05\x92?\x02\x38\x08\x12\x14\n\x05month\x18\x02 \x02(\rB\x05\x92?\x02\x38\x08\x12\x13\n\x04year\x18\x03 \x02(\rB\x05\x92?\x02\x38\x10\"T\n\x13PDI_CalibrationDate\x12\x12\n\x03\x64\x61y\x18\x01 \x02(\rB\x05\x92?\x02\x38\x08\x12\x14\n\x05month\x18\x02 \x02(\rB\x05\x92?\x02\x38\x08\x12\x13\n\x04year\x18\x03 \x02(\rB\x05\x92?\x02\x38\x10\"\'\n\x16PDI_FloatConfiguration\x12\r\n\x05value\x18\x01 \x02(\x02\"/\n\x17PDI_Uint32Configuration\x12\x14\n\x05value\x18\x01 \x02(\rB\x05\x92?\x02\x38 \")\n\x18PDI_BooleanConfiguration\x12\r\n\x05value\x18\x01 \x02(\x08\"\x90\x01\n\x13PDI_IIRFilterConfig\x12\x14\n\x05order\x18\x01 \x02(\rB\x05\x92?\x02\x38\x08\x12\x1b\n\x0csampleRateMs\x18\x02 \x02(\rB\x05\x92?\x02\x38 \x12\x1e\n\x0c\x63oefficients\x18\x03 \x03(\x02\x42\x08\x92?\x05\x10\x0f\x80\x01\x01\"&\n\x0eMaxFilterOrder\x12\x14\n\x10MAX_FILTER_ORDER\x10\x06\"Z\n\x14PDI_BasicCalibration\x12\x0e\n\x06offset\x18\x01 \x02(\x02\x12\x0c\n\x04gain\x18\x02 \x02(\x02\x12\x11\n\tvalid_min\x18\x03 \x02(\x02\x12\x11\n\tvalid_max\x18\x04 \x02(\x02*\xa2\x11\n\x06PDI_ID\x12\x0e\n\nBOOT_COUNT\x10\x00\x12\x11\n\rSERIAL_NUMBER\x10\x01\x12\x0c\n\x08MFG_DATE\x10\x02\x12\x0c\n\x08\x43\x41L_DATE\x10\x03\x12 \n\x1cTARGET_SYSTEM_VOLTAGE_OUTPUT\x10\x19\x12,\n(CONFIG_SYSTEM_VOLTAGE_OUTPUT_RATED_LIMIT\x10\x1a\x12 \n\x1cTARGET_SYSTEM_CURRENT_OUTPUT\x10\x1b\x12,\n(CONFIG_SYSTEM_CURRENT_OUTPUT_RATED_LIMIT\x10\x1c\x12\x1f\n\x1bTARGET_PHASE_CURRENT_OUTPUT\x10\x1d\x12+\n\'CONFIG_PHASE_CURRENT_OUTPUT_RATED_LIMIT\x10\x1e\x12#\n\x1f\x43ONFIG_MIN_SYSTEM_VOLTAGE_INPUT\x10\x1f\x12/\n+CONFIG_MIN_SYSTEM_VOLTAGE_INPUT_RATED_LIMIT\x10 \x12#\n\x1f\x43ONFIG_MAX_SYSTEM_VOLTAGE_INPUT\x10!\x12/\n+CONFIG_MAX_SYSTEM_VOLTAGE_INPUT_RATED_LIMIT\x10\"\x12#\n\x1f\x43ONFIG_PGOOD_MONITOR_TIMEOUT_MS\x10#\x12!\n\x1d\x43ONFIG_LTC_PHASE_INDUCTOR_DCR\x10\x32\x12\x18\n\x14TARGET_FAN_SPEED_RPM\x10<\x12\x19\n\x15\x43ONFIG_MIN_TEMP_LIMIT\x10=\x12\x19\n\x15\x43ONFIG_MAX_TEMP_LIMIT\x10>\x12/\n+CONFIG_MON_INPUT_VOLTAGE_OOR_ENTRY_DELAY_MS\x10P\x12.\n*CONFIG_MON_INPUT_VOLTAGE_OOR_EXIT_DELAY_MS\x10Q\x12\x32\n.CONFIG_MON_LOAD_OVERCURRENT_OOR_ENTRY_DELAY_MS\x10R\x12\x31\n-CONFIG_MON_LOAD_OVERCURRENT_OOR_EXIT_DELAY_MS\x10S\x12/\n+CONFIG_MON_LOAD_VOLTAGE_PCT_ERROR_OOR_LIMIT\x10T\x12\x38\n4CONFIG_MON_LOAD_VOLTAGE_PCT_ERROR_OOR_ENTRY_DELAY_MS\x10U\x12\x37\n3CONFIG_MON_LOAD_VOLTAGE_PCT_ERROR_OOR_EXIT_DELAY_MS\x10V\x12,\n(CONFIG_MON_FAN_SPEED_PCT_ERROR_OOR_LIMIT\x10W\x12+\n\'CONFIG_MON_FAN_SPEED_OOR_ENTRY_DELAY_MS\x10X\x12*\n&CONFIG_MON_FAN_SPEED_OOR_EXIT_DELAY_MS\x10Y\x12-\n)CONFIG_MON_TEMPERATURE_OOR_ENTRY_DELAY_MS\x10Z\x12,\n(CONFIG_MON_TEMPERATURE_OOR_EXIT_DELAY_MS\x10[\x12#\n\x1f\x43ONFIG_MON_FILTER_INPUT_VOLTAGE\x10\\\x12$\n CONFIG_MON_FILTER_OUTPUT_CURRENT\x10]\x12$\n CONFIG_MON_FILTER_OUTPUT_VOLTAGE\x10^\x12!\n\x1d\x43ONFIG_MON_FILTER_1V1_VOLTAGE\x10_\x12!\n\x1d\x43ONFIG_MON_FILTER_3V3_VOLTAGE\x10`\x12!\n\x1d\x43ONFIG_MON_FILTER_5V0_VOLTAGE\x10\x61\x12\"\n\x1e\x43ONFIG_MON_FILTER_12V0_VOLTAGE\x10\x62\x12!\n\x1d\x43ONFIG_MON_FILTER_TEMPERATURE\x10\x63\x12\x1f\n\x1b\x43ONFIG_MON_FILTER_FAN_SPEED\x10\x64\x12\x1a\n\x15MON_INPUT_VOLTAGE_RAW\x10\xc8\x01\x12\x1f\n\x1aMON_INPUT_VOLTAGE_FILTERED\x10\xc9\x01\x12\x1b\n\x16MON_OUTPUT_CURRENT_RAW\x10\xca\x01\x12 \n\x1bMON_OUTPUT_CURRENT_FILTERED\x10\xcb\x01\x12\x1b\n\x16MON_OUTPUT_VOLTAGE_RAW\x10\xcc\x01\x12 \n\x1bMON_OUTPUT_VOLTAGE_FILTERED\x10\xcd\x01\x12\x1d\n\x18MON_1V1_VOLTAGE_FILTERED\x10\xce\x01\x12\x1d\n\x18MON_3V3_VOLTAGE_FILTERED\x10\xcf\x01\x12\x1d\n\x18MON_5V0_VOLTAGE_FILTERED\x10\xd0\x01\x12\x1e\n\x19MON_12V0_VOLTAGE_FILTERED\x10\xd1\x01\x12\x1d\n\x18MON_TEMPERATURE_FILTERED\x10\xd2\x01\x12\x1b\n\x16MON_FAN_SPEED_FILTERED\x10\xd3\x01\x12\x1c\n\x17MON_INPUT_VOLTAGE_VALID\x10\xd4\x01\x12\x1d\n\x18MON_OUTPUT_CURRENT_VALID\x10\xd5\x01\x12\x1d\n\x18MON_OUTPUT_VOLTAGE_VALID\x10\xd6\x01\x12\x1a\n\x15MON_1V1_VOLTAGE_VALID\x10\xd7\x01\x12\x1a\n\x15MON_3V3_VOLTAGE_VALID\x10\xd8\x01\x12\x1a\n\x15MON_5V0_VOLTAGE_VALID\x10\xd9\x01\x12\x1b\n\x16MON_12V0_VOLTAGE_VALID\x10\xda\x01\x12\x1a\n\x15MON_TEMPERATURE_VALID\x10\xdb\x01\x12\x18\n\x13MON_FAN_SPEED_VALID\x10\xdc\x01\x12\x1e\n\x19\x43ONFIG_CAL_OUTPUT_CURRENT\x10\xac\x02')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x11ichnaea_pdi.proto\x12\x07ichnaea\x1a\x0cnanopb.proto\"*\n\rPDI_BootCount\x12\x19\n\nboot_count\x18\x01 \x02(\rB\x05\x92?\x02\x38 \"0\n\x10PDI_SerialNumber\x12\x1c\n\rserial_number\x18\x01 \x02(\tB\x05\x92?\x02\x08 \"T\n\x13PDI_ManufactureDate\x12\x12\n\x03\x64\x61y\x18\x01 \x02(\rB\x05\x92?\x02\x38\x08\x12\x14\n\x05month\x18\x02 \x02(\rB\x05\x92?\x02\x38\x08\x12\x13\n\x04year\x18\x03 \x02(\rB\x05\x92?\x02\x38\x10\"T\n\x13PDI_CalibrationDate\x12\x12\n\x03\x64\x61y\x18\x01 \x02(\rB\x05\x92?\x02\x38\x08\x12\x14\n\x05month\x18\x02 \x02(\rB\x05\x92?\x02\x38\x08\x12\x13\n\x04year\x18\x03 \x02(\rB\x05\x92?\x02\x38\x10\"\'\n\x16PDI_FloatConfiguration\x12\r\n\x05value\x18\x01 \x02(\x02\"/\n\x17PDI_Uint32Configuration\x12\x14\n\x05value\x18\x01 \x02(\rB\x05\x92?\x02\x38 \")\n\x18PDI_BooleanConfiguration\x12\r\n\x05value\x18\x01 \x02(\x08\"\x93\x01\n\x13PDI_IIRFilterConfig\x12\x14\n\x05order\x18\x01 \x02(\rB\x05\x92?\x02\x38\x08\x12\x1b\n\x0csampleRateMs\x18\x02 \x02(\rB\x05\x92?\x02\x38 \x12!\n\x0c\x63oefficients\x18\x03 \x03(\x02\x42\x0b\x92?\x02\x10\x0f\x92?\x03\x80\x01\x01\"&\n\x0eMaxFilterOrder\x12\x14\n\x10MAX_FILTER_ORDER\x10\x06\"Z\n\x14PDI_BasicCalibration\x12\x0e\n\x06offset\x18\x01 \x02(\x02\x12\x0c\n\x04gain\x18\x02 \x02(\x02\x12\x11\n\tvalid_min\x18\x03 \x02(\x02\x12\x11\n\tvalid_max\x18\x04 \x02(\x02*\xbf\x11\n\x06PDI_ID\x12\x0e\n\nBOOT_COUNT\x10\x00\x12\x11\n\rSERIAL_NUMBER\x10\x01\x12\x0c\n\x08MFG_DATE\x10\x02\x12\x0c\n\x08\x43\x41L_DATE\x10\x03\x12\x1b\n\x17\x43ONFIG_GROUP_MEMBERSHIP\x10\n\x12 \n\x1cTARGET_SYSTEM_VOLTAGE_OUTPUT\x10\x19\x12,\n(CONFIG_SYSTEM_VOLTAGE_OUTPUT_RATED_LIMIT\x10\x1a\x12 \n\x1cTARGET_SYSTEM_CURRENT_OUTPUT\x10\x1b\x12,\n(CONFIG_SYSTEM_CURRENT_OUTPUT_RATED_LIMIT\x10\x1c\x12\x1f\n\x1bTARGET_PHASE_CURRENT_OUTPUT\x10\x1d\x12+\n\'CONFIG_PHASE_CURRENT_OUTPUT_RATED_LIMIT\x10\x1e\x12#\n\x1f\x43ONFIG_MIN_SYSTEM_VOLTAGE_INPUT\x10\x1f\x12/\n+CONFIG_MIN_SYSTEM_VOLTAGE_INPUT_RATED_LIMIT\x10 \x12#\n\x1f\x43ONFIG_MAX_SYSTEM_VOLTAGE_INPUT\x10!\x12/\n+CONFIG_MAX_SYSTEM_VOLTAGE_INPUT_RATED_LIMIT\x10\"\x12#\n\x1f\x43ONFIG_PGOOD_MONITOR_TIMEOUT_MS\x10#\x12!\n\x1d\x43ONFIG_LTC_PHASE_INDUCTOR_DCR\x10\x32\x12\x18\n\x14TARGET_FAN_SPEED_RPM\x10<\x12\x19\n\x15\x43ONFIG_MIN_TEMP_LIMIT\x10=\x12\x19\n\x15\x43ONFIG_MAX_TEMP_LIMIT\x10>\x12/\n+CONFIG_MON_INPUT_VOLTAGE_OOR_ENTRY_DELAY_MS\x10P\x12.\n*CONFIG_MON_INPUT_VOLTAGE_OOR_EXIT_DELAY_MS\x10Q\x12\x32\n.CONFIG_MON_LOAD_OVERCURRENT_OOR_ENTRY_DELAY_MS\x10R\x12\x31\n-CONFIG_MON_LOAD_OVERCURRENT_OOR_EXIT_DELAY_MS\x10S\x12/\n+CONFIG_MON_LOAD_VOLTAGE_PCT_ERROR_OOR_LIMIT\x10T\x12\x38\n4CONFIG_MON_LOAD_VOLTAGE_PCT_ERROR_OOR_ENTRY_DELAY_MS\x10U\x12\x37\n3CONFIG_MON_LOAD_VOLTAGE_PCT_ERROR_OOR_EXIT_DELAY_MS\x10V\x12,\n(CONFIG_MON_FAN_SPEED_PCT_ERROR_OOR_LIMIT\x10W\x12+\n\'CONFIG_MON_FAN_SPEED_OOR_ENTRY_DELAY_MS\x10X\x12*\n&CONFIG_MON_FAN_SPEED_OOR_EXIT_DELAY_MS\x10Y\x12-\n)CONFIG_MON_TEMPERATURE_OOR_ENTRY_DELAY_MS\x10Z\x12,\n(CONFIG_MON_TEMPERATURE_OOR_EXIT_DELAY_MS\x10[\x12#\n\x1f\x43ONFIG_MON_FILTER_INPUT_VOLTAGE\x10\\\x12$\n CONFIG_MON_FILTER_OUTPUT_CURRENT\x10]\x12$\n CONFIG_MON_FILTER_OUTPUT_VOLTAGE\x10^\x12!\n\x1d\x43ONFIG_MON_FILTER_1V1_VOLTAGE\x10_\x12!\n\x1d\x43ONFIG_MON_FILTER_3V3_VOLTAGE\x10`\x12!\n\x1d\x43ONFIG_MON_FILTER_5V0_VOLTAGE\x10\x61\x12\"\n\x1e\x43ONFIG_MON_FILTER_12V0_VOLTAGE\x10\x62\x12!\n\x1d\x43ONFIG_MON_FILTER_TEMPERATURE\x10\x63\x12\x1f\n\x1b\x43ONFIG_MON_FILTER_FAN_SPEED\x10\x64\x12\x1a\n\x15MON_INPUT_VOLTAGE_RAW\x10\xc8\x01\x12\x1f\n\x1aMON_INPUT_VOLTAGE_FILTERED\x10\xc9\x01\x12\x1b\n\x16MON_OUTPUT_CURRENT_RAW\x10\xca\x01\x12 \n\x1bMON_OUTPUT_CURRENT_FILTERED\x10\xcb\x01\x12\x1b\n\x16MON_OUTPUT_VOLTAGE_RAW\x10\xcc\x01\x12 \n\x1bMON_OUTPUT_VOLTAGE_FILTERED\x10\xcd\x01\x12\x1d\n\x18MON_1V1_VOLTAGE_FILTERED\x10\xce\x01\x12\x1d\n\x18MON_3V3_VOLTAGE_FILTERED\x10\xcf\x01\x12\x1d\n\x18MON_5V0_VOLTAGE_FILTERED\x10\xd0\x01\x12\x1e\n\x19MON_12V0_VOLTAGE_FILTERED\x10\xd1\x01\x12\x1d\n\x18MON_TEMPERATURE_FILTERED\x10\xd2\x01\x12\x1b\n\x16MON_FAN_SPEED_FILTERED\x10\xd3\x01\x12\x1c\n\x17MON_INPUT_VOLTAGE_VALID\x10\xd4\x01\x12\x1d\n\x18MON_OUTPUT_CURRENT_VALID\x10\xd5\x01\x12\x1d\n\x18MON_OUTPUT_VOLTAGE_VALID\x10\xd6\x01\x12\x1a\n\x15MON_1V1_VOLTAGE_VALID\x10\xd7\x01\x12\x1a\n\x15MON_3V3_VOLTAGE_VALID\x10\xd8\x01\x12\x1a\n\x15MON_5V0_VOLTAGE_VALID\x10\xd9\x01\x12\x1b\n\x16MON_12V0_VOLTAGE_VALID\x10\xda\x01\x12\x1a\n\x15MON_TEMPERATURE_VALID\x10\xdb\x01\x12\x18\n\x13MON_FAN_SPEED_VALID\x10\xdc\x01\x12\x1e\n\x19\x43ONFIG_CAL_OUTPUT_CURRENT\x10\xac\x02')
 
 _globals = globals()
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, _globals)
@@ -55,9 +55,9 @@ if not _descriptor._USE_C_DESCRIPTORS:
   _globals['_PDI_IIRFILTERCONFIG'].fields_by_name['sampleRateMs']._loaded_options = None
   _globals['_PDI_IIRFILTERCONFIG'].fields_by_name['sampleRateMs']._serialized_options = b'\222?\0028 '
   _globals['_PDI_IIRFILTERCONFIG'].fields_by_name['coefficients']._loaded_options = None
-  _globals['_PDI_IIRFILTERCONFIG'].fields_by_name['coefficients']._serialized_options = b'\222?\005\020\017\200\001\001'
-  _globals['_PDI_ID']._serialized_start=683
-  _globals['_PDI_ID']._serialized_end=2893
+  _globals['_PDI_IIRFILTERCONFIG'].fields_by_name['coefficients']._serialized_options = b'\222?\002\020\017\222?\003\200\001\001'
+  _globals['_PDI_ID']._serialized_start=686
+  _globals['_PDI_ID']._serialized_end=2925
   _globals['_PDI_BOOTCOUNT']._serialized_start=44
   _globals['_PDI_BOOTCOUNT']._serialized_end=86
   _globals['_PDI_SERIALNUMBER']._serialized_start=88
@@ -73,9 +73,9 @@ if not _descriptor._USE_C_DESCRIPTORS:
   _globals['_PDI_BOOLEANCONFIGURATION']._serialized_start=400
   _globals['_PDI_BOOLEANCONFIGURATION']._serialized_end=441
   _globals['_PDI_IIRFILTERCONFIG']._serialized_start=444
-  _globals['_PDI_IIRFILTERCONFIG']._serialized_end=588
-  _globals['_PDI_IIRFILTERCONFIG_MAXFILTERORDER']._serialized_start=550
-  _globals['_PDI_IIRFILTERCONFIG_MAXFILTERORDER']._serialized_end=588
-  _globals['_PDI_BASICCALIBRATION']._serialized_start=590
-  _globals['_PDI_BASICCALIBRATION']._serialized_end=680
+  _globals['_PDI_IIRFILTERCONFIG']._serialized_end=591
+  _globals['_PDI_IIRFILTERCONFIG_MAXFILTERORDER']._serialized_start=553
+  _globals['_PDI_IIRFILTERCONFIG_MAXFILTERORDER']._serialized_end=591
+  _globals['_PDI_BASICCALIBRATION']._serialized_start=593
+  _globals['_PDI_BASICCALIBRATION']._serialized_end=683
 # @@protoc_insertion_point(module_scope)
@@ -35,6 +35,10 @@ class _PDI_IDEnumTypeWrapper(google.protobuf.internal.enum_type_wrapper._EnumTyp
     """Date the system was manufactured"""
     CAL_DATE: _PDI_ID.ValueType  # 3
     """Date the system was last calibrated"""
+    CONFIG_GROUP_MEMBERSHIP: _PDI_ID.ValueType  # 10
+    """Network configuration
+    Bit mask of the command groups (0-31) the node belongs to
+    """
     TARGET_SYSTEM_VOLTAGE_OUTPUT: _PDI_ID.ValueType  # 25
     """Power system configuration data
     Requested voltage target (lower than rated limit)
@@ -179,6 +183,10 @@ MFG_DATE: PDI_ID.ValueType  # 2
 """Date the system was manufactured"""
 CAL_DATE: PDI_ID.ValueType  # 3
 """Date the system was last calibrated"""
+CONFIG_GROUP_MEMBERSHIP: PDI_ID.ValueType  # 10
+"""Network configuration
+Bit mask of the command groups (0-31) the node belongs to
+"""
 TARGET_SYSTEM_VOLTAGE_OUTPUT: PDI_ID.ValueType  # 25
 """Power system configuration data
 Requested voltage target (lower than rated limit)
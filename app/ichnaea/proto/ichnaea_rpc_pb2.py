@@ -26,7 +26,7 @@ import nanopb_pb2 as nanopb__pb2
 import mbed_rpc_pb2 as mbed__rpc__pb2
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x11ichnaea_rpc.proto\x12\x07ichnaea\x1a\x0cnanopb.proto\x1a\x0embed_rpc.proto\"D\n\x0fPingNodeRequest\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07node_id\x18\x02 \x02(\r\"4\n\x10PingNodeResponse\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\"0\n\x0cGetIdRequest\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\"\x92\x01\n\rGetIdResponse\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x11\n\tunique_id\x18\x02 \x02(\r\x12\x18\n\tver_major\x18\x03 \x02(\rB\x05\x92?\x02\x38\x08\x12\x18\n\tver_minor\x18\x04 \x02(\rB\x05\x92?\x02\x38\x08\x12\x18\n\tver_patch\x18\x05 \x02(\rB\x05\x92?\x02\x38\x08\"m\n\x0eManagerRequest\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07node_id\x18\x02 \x02(\r\x12(\n\x07\x63ommand\x18\x03 \x02(\x0e\x32\x17.ichnaea.ManagerCommand\"r\n\x0fManagerResponse\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12%\n\x06status\x18\x02 \x02(\x0e\x32\x15.ichnaea.ManagerError\x12\x16\n\x07message\x18\x03 \x01(\tB\x05\x92?\x02\x08@\"\xa7\x01\n\x0fSetpointRequest\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07node_id\x18\x02 \x02(\r\x12%\n\x05\x66ield\x18\x03 \x02(\x0e\x32\x16.ichnaea.SetpointField\x12\x15\n\x0buint32_type\x18\x04 \x01(\rH\x00\x12\x14\n\nfloat_type\x18\x05 \x01(\x02H\x00\x42\r\n\x0bvalue_oneof\"t\n\x10SetpointResponse\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12&\n\x06status\x18\x02 \x02(\x0e\x32\x16.ichnaea.SetpointError\x12\x16\n\x07message\x18\x03 \x01(\tB\x05\x92?\x02\x08@\"g\n\rSensorRequest\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07node_id\x18\x02 \x02(\r\x12#\n\x06sensor\x18\x03 \x02(\x0e\x32\x13.ichnaea.SensorType\"g\n\x0eSensorResponse\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12$\n\x06status\x18\x02 \x02(\x0e\x32\x14.ichnaea.SensorError\x12\r\n\x05value\x18\x03 \x02(\x02\"S\n\x0ePDIReadRequest\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07node_id\x18\x02 \x02(\r\x12\x0e\n\x06pdi_id\x18\x03 \x02(\r\"Z\n\x0fPDIReadResponse\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07success\x18\x02 \x02(\x08\x12\x14\n\x04\x64\x61ta\x18\x03 \x02(\x0c\x42\x06\x92?\x03\x08\x80\x04\"j\n\x0fPDIWriteRequest\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07node_id\x18\x02 \x02(\r\x12\x0e\n\x06pdi_id\x18\x03 \x02(\r\x12\x14\n\x04\x64\x61ta\x18\x04 \x02(\x0c\x42\x06\x92?\x03\x08\x80\x04\"E\n\x10PDIWriteResponse\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07success\x18\x02 \x02(\x08\"H\n\x13SystemStatusRequest\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07node_id\x18\x02 \x02(\r\"\x85\x01\n\x14SystemStatusResponse\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x18\n\ttimestamp\x18\x02 \x02(\rB\x05\x92?\x02\x38 \x12\x31\n\x0coutput_state\x18\x03 \x02(\x0e\x32\x14.ichnaea.EngageStateB\x05\x92?\x02\x38\x08*\xc7\x01\n\x07Service\x12\x10\n\x0cSVC_IDENTITY\x10\x64\x12\x10\n\x0cSVC_SETPOINT\x10\x65\x12\x0f\n\x0bSVC_MANAGER\x10\x66\x12\x0e\n\nSVC_SENSOR\x10g\x12\x11\n\rSVC_PING_NODE\x10h\x12\x13\n\x0fSVC_LTC_REG_GET\x10i\x12\x13\n\x0fSVC_LTC_REG_SET\x10j\x12\x10\n\x0cSVC_PDI_READ\x10k\x12\x11\n\rSVC_PDI_WRITE\x10l\x12\x15\n\x11SVC_SYSTEM_STATUS\x10m*\xed\x02\n\x07Message\x12\x12\n\x0eMSG_GET_ID_REQ\x10\x64\x12\x12\n\x0eMSG_GET_ID_RSP\x10\x65\x12\x14\n\x10MSG_SETPOINT_REQ\x10\x66\x12\x14\n\x10MSG_SETPOINT_RSP\x10g\x12\x13\n\x0fMSG_MANAGER_REQ\x10h\x12\x13\n\x0fMSG_MANAGER_RSP\x10i\x12\x12\n\x0eMSG_SENSOR_REQ\x10j\x12\x12\n\x0eMSG_SENSOR_RSP\x10k\x12\x15\n\x11MSG_PING_NODE_REQ\x10l\x12\x15\n\x11MSG_PING_NODE_RSP\x10m\x12\x14\n\x10MSG_PDI_READ_REQ\x10r\x12\x14\n\x10MSG_PDI_READ_RSP\x10s\x12\x15\n\x11MSG_PDI_WRITE_REQ\x10t\x12\x15\n\x11MSG_PDI_WRITE_RSP\x10u\x12\x19\n\x15MSG_SYSTEM_STATUS_REQ\x10v\x12\x19\n\x15MSG_SYSTEM_STATUS_RSP\x10w*\xb8\x03\n\x0eMessageVersion\x12\x16\n\x12MSG_VER_GET_ID_REQ\x10\x00\x12\x16\n\x12MSG_VER_GET_ID_RSP\x10\x00\x12\x18\n\x14MSG_VER_SETPOINT_REQ\x10\x00\x12\x18\n\x14MSG_VER_SETPOINT_RSP\x10\x00\x12\x17\n\x13MSG_VER_MANAGER_REQ\x10\x00\x12\x17\n\x13MSG_VER_MANAGER_RSP\x10\x00\x12\x16\n\x12MSG_VER_SENSOR_REQ\x10\x00\x12\x16\n\x12MSG_VER_SENSOR_RSP\x10\x00\x12\x19\n\x15MSG_VER_PING_NODE_REQ\x10\x00\x12\x19\n\x15MSG_VER_PING_NODE_RSP\x10\x00\x12\x18\n\x14MSG_VER_PDI_READ_REQ\x10\x00\x12\x18\n\x14MSG_VER_PDI_READ_RSP\x10\x00\x12\x19\n\x15MSG_VER_PDI_WRITE_REQ\x10\x00\x12\x19\n\x15MSG_VER_PDI_WRITE_RSP\x10\x00\x12\x1d\n\x19MSG_VER_SYSTEM_STATUS_REQ\x10\x00\x12\x1d\n\x19MSG_VER_SYSTEM_STATUS_RSP\x10\x00\x1a\x02\x10\x01*\x87\x01\n\x0eManagerCommand\x12\x0e\n\nCMD_REBOOT\x10\x00\x12\x15\n\x11\x43MD_ENGAGE_OUTPUT\x10\x01\x12\x18\n\x14\x43MD_DISENGAGE_OUTPUT\x10\x02\x12\x17\n\x13\x43MD_FLUSH_PDI_CACHE\x10\x03\x12\x1b\n\x17\x43MD_ZERO_OUTPUT_CURRENT\x10\x04*M\n\x0cManagerError\x12\x14\n\x10\x45RR_CMD_NO_ERROR\x10\x00\x12\x13\n\x0f\x45RR_CMD_INVALID\x10\x01\x12\x12\n\x0e\x45RR_CMD_FAILED\x10\x02*d\n\rSetpointError\x12\x19\n\x15\x45RR_SETPOINT_NO_ERROR\x10\x00\x12\x18\n\x14\x45RR_SETPOINT_INVALID\x10\x01\x12\x1e\n\x1a\x45RR_SETPOINT_NOT_SUPPORTED\x10\x02*I\n\rSetpointField\x12\x1b\n\x17SETPOINT_OUTPUT_VOLTAGE\x10\x00\x12\x1b\n\x17SETPOINT_OUTPUT_CURRENT\x10\x01*x\n\x0bSensorError\x12\x17\n\x13\x45RR_SENSOR_NO_ERROR\x10\x00\x12\x1c\n\x18\x45RR_SENSOR_NOT_SUPPORTED\x10\x01\x12\x1a\n\x16\x45RR_SENSOR_READ_FAILED\x10\x02\x12\x16\n\x12\x45RR_SENSOR_UNKNOWN\x10\x03*\xb9\x02\n\nSensorType\x12\x19\n\x15SENSOR_OUTPUT_VOLTAGE\x10\x00\x12\x18\n\x14SENSOR_INPUT_VOLTAGE\x10\x01\x12\x19\n\x15SENSOR_OUTPUT_CURRENT\x10\x02\x12!\n\x1dSENSOR_LTC_AVG_OUTPUT_CURRENT\x10\x03\x12\x17\n\x13SENSOR_BOARD_TEMP_1\x10\x04\x12\x17\n\x13SENSOR_BOARD_TEMP_2\x10\x05\x12\x17\n\x13SENSOR_BOARD_TEMP_3\x10\x06\x12\x1a\n\x16SENSOR_VOLTAGE_MON_1V1\x10\x07\x12\x1a\n\x16SENSOR_VOLTAGE_MON_3V3\x10\x08\x12\x19\n\x15SENSOR_VOLTAGE_MON_5V\x10\t\x12\x1a\n\x16SENSOR_VOLTAGE_MON_12V\x10\n*7\n\x0b\x45ngageState\x12\x0b\n\x07\x45NGAGED\x10\x00\x12\x0e\n\nDISENGAGED\x10\x01\x12\x0b\n\x07\x46\x41ULTED\x10\x02')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x11ichnaea_rpc.proto\x12\x07ichnaea\x1a\x0cnanopb.proto\x1a\x0embed_rpc.proto\"D\n\x0fPingNodeRequest\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07node_id\x18\x02 \x02(\r\"4\n\x10PingNodeResponse\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\"0\n\x0cGetIdRequest\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\"\x92\x01\n\rGetIdResponse\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x11\n\tunique_id\x18\x02 \x02(\r\x12\x18\n\tver_major\x18\x03 \x02(\rB\x05\x92?\x02\x38\x08\x12\x18\n\tver_minor\x18\x04 \x02(\rB\x05\x92?\x02\x38\x08\x12\x18\n\tver_patch\x18\x05 \x02(\rB\x05\x92?\x02\x38\x08\"m\n\x0eManagerRequest\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07node_id\x18\x02 \x02(\r\x12(\n\x07\x63ommand\x18\x03 \x02(\x0e\x32\x17.ichnaea.ManagerCommand\"r\n\x0fManagerResponse\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12%\n\x06status\x18\x02 \x02(\x0e\x32\x15.ichnaea.ManagerError\x12\x16\n\x07message\x18\x03 \x01(\tB\x05\x92?\x02\x08@\"\xa7\x01\n\x0fSetpointRequest\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07node_id\x18\x02 \x02(\r\x12%\n\x05\x66ield\x18\x03 \x02(\x0e\x32\x16.ichnaea.SetpointField\x12\x15\n\x0buint32_type\x18\x04 \x01(\rH\x00\x12\x14\n\nfloat_type\x18\x05 \x01(\x02H\x00\x42\r\n\x0bvalue_oneof\"t\n\x10SetpointResponse\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12&\n\x06status\x18\x02 \x02(\x0e\x32\x16.ichnaea.SetpointError\x12\x16\n\x07message\x18\x03 \x01(\tB\x05\x92?\x02\x08@\"g\n\rSensorRequest\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07node_id\x18\x02 \x02(\r\x12#\n\x06sensor\x18\x03 \x02(\x0e\x32\x13.ichnaea.SensorType\"g\n\x0eSensorResponse\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12$\n\x06status\x18\x02 \x02(\x0e\x32\x14.ichnaea.SensorError\x12\r\n\x05value\x18\x03 \x02(\x02\"c\n\x12SensorBatchRequest\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07node_id\x18\x02 \x02(\r\x12\x1a\n\x0bsensor_mask\x18\x03 \x02(\rB\x05\x92?\x02\x38\x10\"\xa5\x01\n\x13SensorBatchResponse\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12$\n\x06status\x18\x02 \x02(\x0e\x32\x14.ichnaea.SensorError\x12\x1a\n\x0bsensor_mask\x18\x03 \x02(\rB\x05\x92?\x02\x38\x10\x12\x11\n\ttimestamp\x18\x04 \x02(\r\x12\x17\n\x06values\x18\x05 \x03(\x02\x42\x07\x10\x01\x92?\x02\x10\x0b\"S\n\x0ePDIReadRequest\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07node_id\x18\x02 \x02(\r\x12\x0e\n\x06pdi_id\x18\x03 \x02(\r\"Z\n\x0fPDIReadResponse\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07success\x18\x02 \x02(\x08\x12\x14\n\x04\x64\x61ta\x18\x03 \x02(\x0c\x42\x06\x92?\x03\x08\x80\x04\"j\n\x0fPDIWriteRequest\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07node_id\x18\x02 \x02(\r\x12\x0e\n\x06pdi_id\x18\x03 \x02(\r\x12\x14\n\x04\x64\x61ta\x18\x04 \x02(\x0c\x42\x06\x92?\x03\x08\x80\x04\"E\n\x10PDIWriteResponse\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07success\x18\x02 \x02(\x08\"H\n\x13SystemStatusRequest\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07node_id\x18\x02 \x02(\r\"^\n\x0cTxQueueStats\x12\x14\n\x05\x64\x65pth\x18\x01 \x02(\rB\x05\x92?\x02\x38\x10\x12\x19\n\nhigh_water\x18\x02 \x02(\rB\x05\x92?\x02\x38\x10\x12\x0c\n\x04sent\x18\x03 \x02(\r\x12\x0f\n\x07\x64ropped\x18\x04 \x02(\r\"\xb6\x01\n\x14SystemStatusResponse\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x18\n\ttimestamp\x18\x02 \x02(\rB\x05\x92?\x02\x38 \x12\x31\n\x0coutput_state\x18\x03 \x02(\x0e\x32\x14.ichnaea.EngageStateB\x05\x92?\x02\x38\x08\x12/\n\ttx_queues\x18\x04 \x03(\x0b\x32\x15.ichnaea.TxQueueStatsB\x05\x92?\x02\x10\x02\"\x85\x01\n\x08\x42ootStep\x12(\n\x04step\x18\x01 \x02(\x0e\x32\x13.ichnaea.BootStepIdB\x05\x92?\x02\x38\x08\x12\x14\n\x05\x64\x65pth\x18\x02 \x02(\rB\x05\x92?\x02\x38\x08\x12\x12\n\x03tag\x18\x03 \x02(\rB\x05\x92?\x02\x38\x10\x12\x10\n\x08start_us\x18\x04 \x02(\r\x12\x13\n\x0b\x64uration_us\x18\x05 \x02(\r\"_\n\x13\x42ootTimelineRequest\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07node_id\x18\x02 \x02(\r\x12\x15\n\x06offset\x18\x03 \x02(\rB\x05\x92?\x02\x38\x08\"\xa0\x01\n\x14\x42ootTimelineResponse\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x14\n\x05total\x18\x02 \x02(\rB\x05\x92?\x02\x38\x08\x12\x15\n\x06offset\x18\x03 \x02(\rB\x05\x92?\x02\x38\x08\x12\x10\n\x08\x63omplete\x18\x04 \x02(\x08\x12\'\n\x05steps\x18\x05 \x03(\x0b\x32\x11.ichnaea.BootStepB\x05\x92?\x02\x10\x14\"\x81\x01\n\x10\x43\x61librationEntry\x12)\n\x02id\x18\x01 \x02(\x0e\x32\x16.ichnaea.CalibrationIdB\x05\x92?\x02\x38\x08\x12\x0e\n\x06offset\x18\x02 \x02(\x02\x12\x0c\n\x04gain\x18\x03 \x02(\x02\x12\x11\n\tvalid_min\x18\x04 \x02(\x02\x12\x11\n\tvalid_max\x18\x05 \x02(\x02\"w\n\x0f\x43\x61lWriteRequest\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07node_id\x18\x02 \x02(\r\x12\x31\n\x07\x65ntries\x18\x03 \x03(\x0b\x32\x19.ichnaea.CalibrationEntryB\x05\x92?\x02\x10\x08\"]\n\x10\x43\x61lWriteResponse\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07success\x18\x02 \x02(\x08\x12\x16\n\x07message\x18\x03 \x01(\tB\x05\x92?\x02\x08@\"V\n\x15\x46lashLatencyHistogram\x12#\n\x02op\x18\x01 \x02(\x0e\x32\x10.ichnaea.FlashOpB\x05\x92?\x02\x38\x08\x12\x18\n\x07\x62uckets\x18\x02 \x03(\rB\x07\x10\x01\x92?\x02\x10\x14\"d\n\x11\x46lashStatsRequest\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07node_id\x18\x02 \x02(\r\x12\x1c\n\rsector_offset\x18\x03 \x02(\rB\x05\x92?\x02\x38\x10\"\xaf\x02\n\x12\x46lashStatsResponse\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x12\n\nbytes_read\x18\x02 \x02(\x04\x12\x18\n\x10\x62ytes_programmed\x18\x03 \x02(\x04\x12\x10\n\x08read_ops\x18\x04 \x02(\x04\x12\x13\n\x0bprogram_ops\x18\x05 \x02(\x04\x12\x11\n\terase_ops\x18\x06 \x02(\x04\x12\x1a\n\x0bnum_sectors\x18\x07 \x02(\rB\x05\x92?\x02\x38\x10\x12\x1c\n\rsector_offset\x18\x08 \x02(\rB\x05\x92?\x02\x38\x10\x12\x1d\n\x0c\x65rase_counts\x18\t \x03(\rB\x07\x10\x01\x92?\x02\x10\x14\x12\x36\n\x07latency\x18\n \x03(\x0b\x32\x1e.ichnaea.FlashLatencyHistogramB\x05\x92?\x02\x10\x03\"\xc4\x01\n\x0fLogQueryRequest\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07node_id\x18\x02 \x02(\r\x12\x12\n\nstart_time\x18\x03 \x02(\x04\x12\x10\n\x08\x65nd_time\x18\x04 \x02(\x04\x12\x0f\n\x07last_ms\x18\x05 \x02(\r\x12\x18\n\tmin_level\x18\x06 \x02(\rB\x05\x92?\x02\x38\x08\x12\x18\n\tmax_count\x18\x07 \x02(\rB\x05\x92?\x02\x38\x10\x12\x13\n\x04skip\x18\x08 \x02(\rB\x05\x92?\x02\x38\x10\"\xb6\x01\n\x10LogQueryResponse\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0b\n\x03now\x18\x02 \x02(\x04\x12\x11\n\tbase_time\x18\x03 \x02(\x04\x12\x14\n\x05\x63ount\x18\x04 \x02(\rB\x05\x92?\x02\x38\x10\x12\x0c\n\x04more\x18\x05 \x02(\x08\x12\x11\n\tnext_time\x18\x06 \x02(\x04\x12\x13\n\x04skip\x18\x07 \x02(\rB\x05\x92?\x02\x38\x10\x12\x14\n\x04\x64\x61ta\x18\x08 \x02(\x0c\x42\x06\x92?\x03\x08\x80\x04\"P\n\x0c\x46lightSample\x12\x0c\n\x04time\x18\x01 \x02(\r\x12\x16\n\x07\x63hannel\x18\x02 \x02(\rB\x05\x92?\x02\x38\x08\x12\x0b\n\x03raw\x18\x03 \x02(\x02\x12\r\n\x05value\x18\x04 \x02(\x02\"\xba\x01\n\x15\x46lightRecorderRequest\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07node_id\x18\x02 \x02(\r\x12\x15\n\x06offset\x18\x03 \x02(\rB\x05\x92?\x02\x38\x10\x12\r\n\x05rearm\x18\x04 \x02(\x08\x12\x1a\n\x0bpre_trigger\x18\x05 \x02(\rB\x05\x92?\x02\x38\x10\x12\x1b\n\x0cpost_trigger\x18\x06 \x02(\rB\x05\x92?\x02\x38\x10\x12\x0f\n\x07persist\x18\x07 \x02(\x08\"\x94\x02\n\x16\x46lightRecorderResponse\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12+\n\x05state\x18\x02 \x02(\x0e\x32\x1c.ichnaea.FlightRecorderState\x12\x1b\n\x0ctrigger_code\x18\x03 \x02(\rB\x05\x92?\x02\x38\x08\x12\x14\n\x0ctrigger_time\x18\x04 \x02(\r\x12\x14\n\x05total\x18\x05 \x02(\rB\x05\x92?\x02\x38\x10\x12\x1c\n\rtrigger_index\x18\x06 \x02(\rB\x05\x92?\x02\x38\x10\x12\x15\n\x06offset\x18\x07 \x02(\rB\x05\x92?\x02\x38\x10\x12-\n\x07samples\x18\x08 \x03(\x0b\x32\x15.ichnaea.FlightSampleB\x05\x92?\x02\x10\x18\"\xb2\x01\n\x19TelemetrySubscribeRequest\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07node_id\x18\x02 \x02(\r\x12\x1a\n\x0bsensor_mask\x18\x03 \x02(\rB\x05\x92?\x02\x38\x10\x12\x18\n\tperiod_ms\x18\x04 \x02(\rB\x05\x92?\x02\x38\x10\x12\x10\n\x08\x64\x65\x61\x64\x62\x61nd\x18\x05 \x02(\x02\x12\x1a\n\x0bkeyframe_ms\x18\x06 \x02(\rB\x05\x92?\x02\x38\x10\"\xa2\x01\n\x1aTelemetrySubscribeResponse\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x1a\n\x0bsensor_mask\x18\x02 \x02(\rB\x05\x92?\x02\x38\x10\x12\x18\n\tperiod_ms\x18\x03 \x02(\rB\x05\x92?\x02\x38\x10\x12\x10\n\x08\x64\x65\x61\x64\x62\x61nd\x18\x04 \x02(\x02\x12\x1a\n\x0bkeyframe_ms\x18\x05 \x02(\rB\x05\x92?\x02\x38\x10\"c\n\x0fLinkBaudRequest\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07node_id\x18\x02 \x02(\r\x12\x0c\n\x04\x62\x61ud\x18\x03 \x02(\r\x12\x0f\n\x07\x63onfirm\x18\x04 \x02(\x08\"\xad\x01\n\x10LinkBaudResponse\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\'\n\x06status\x18\x02 \x02(\x0e\x32\x17.ichnaea.LinkBaudStatus\x12\x0c\n\x04\x62\x61ud\x18\x03 \x02(\r\x12\x11\n\tfallbacks\x18\x04 \x02(\r\x12\x13\n\x0bline_errors\x18\x05 \x02(\r\x12\x18\n\tsupported\x18\x06 \x03(\rB\x05\x92?\x02\x10\x08\"g\n\x10LTCRegGetRequest\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07node_id\x18\x02 \x02(\r\x12\x12\n\x03reg\x18\x03 \x02(\rB\x05\x92?\x02\x38\x08\x12\x0c\n\x04\x64ump\x18\x04 \x02(\x08\"\x8d\x01\n\x11LTCRegGetResponse\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12%\n\x06status\x18\x02 \x02(\x0e\x32\x15.ichnaea.LTCRegStatus\x12\x18\n\tfirst_reg\x18\x03 \x02(\rB\x05\x92?\x02\x38\x08\x12\x15\n\x06values\x18\x04 \x02(\x0c\x42\x05\x92?\x02\x08\x10\"o\n\x10LTCRegSetRequest\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07node_id\x18\x02 \x02(\r\x12\x12\n\x03reg\x18\x03 \x02(\rB\x05\x92?\x02\x38\x08\x12\x14\n\x05value\x18\x04 \x02(\rB\x05\x92?\x02\x38\x08\"r\n\x11LTCRegSetResponse\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12%\n\x06status\x18\x02 \x02(\x0e\x32\x15.ichnaea.LTCRegStatus\x12\x14\n\x05value\x18\x03 \x02(\rB\x05\x92?\x02\x38\x08\"\xd9\x01\n\x13GroupCommandRequest\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x17\n\x08group_id\x18\x02 \x02(\rB\x05\x92?\x02\x38\x08\x12\x19\n\ncommand_id\x18\x03 \x02(\rB\x05\x92?\x02\x38\x10\x12$\n\x06\x61\x63tion\x18\x04 \x02(\x0e\x32\x14.ichnaea.GroupAction\x12%\n\x05\x66ield\x18\x05 \x02(\x0e\x32\x16.ichnaea.SetpointField\x12\r\n\x05value\x18\x06 \x02(\x02\x12\x10\n\x08\x64\x65lay_us\x18\x07 \x02(\r\"\xa5\x01\n\x14GroupCommandResponse\x12 \n\x06header\x18\x01 \x02(\x0b\x32\x10.mbed.rpc.Header\x12\x0f\n\x07node_id\x18\x02 \x02(\r\x12\x19\n\ncommand_id\x18\x03 \x02(\rB\x05\x92?\x02\x38\x10\x12+\n\x06status\x18\x04 \x02(\x0e\x32\x1b.ichnaea.GroupCommandStatus\x12\x12\n\nlatency_us\x18\x05 \x02(\r*\x85\x03\n\x07Service\x12\x10\n\x0cSVC_IDENTITY\x10\x64\x12\x10\n\x0cSVC_SETPOINT\x10\x65\x12\x0f\n\x0bSVC_MANAGER\x10\x66\x12\x0e\n\nSVC_SENSOR\x10g\x12\x11\n\rSVC_PING_NODE\x10h\x12\x13\n\x0fSVC_LTC_REG_GET\x10i\x12\x13\n\x0fSVC_LTC_REG_SET\x10j\x12\x10\n\x0cSVC_PDI_READ\x10k\x12\x11\n\rSVC_PDI_WRITE\x10l\x12\x15\n\x11SVC_SYSTEM_STATUS\x10m\x12\x15\n\x11SVC_BOOT_TIMELINE\x10n\x12\x11\n\rSVC_CAL_WRITE\x10o\x12\x13\n\x0fSVC_FLASH_STATS\x10p\x12\x11\n\rSVC_LOG_QUERY\x10q\x12\x17\n\x13SVC_FLIGHT_RECORDER\x10r\x12\x11\n\rSVC_TELEMETRY\x10s\x12\x14\n\x10SVC_SENSOR_BATCH\x10t\x12\x11\n\rSVC_LINK_BAUD\x10u\x12\x15\n\x11SVC_GROUP_COMMAND\x10v*\xa3\x07\n\x07Message\x12\x12\n\x0eMSG_GET_ID_REQ\x10\x64\x12\x12\n\x0eMSG_GET_ID_RSP\x10\x65\x12\x14\n\x10MSG_SETPOINT_REQ\x10\x66\x12\x14\n\x10MSG_SETPOINT_RSP\x10g\x12\x13\n\x0fMSG_MANAGER_REQ\x10h\x12\x13\n\x0fMSG_MANAGER_RSP\x10i\x12\x12\n\x0eMSG_SENSOR_REQ\x10j\x12\x12\n\x0eMSG_SENSOR_RSP\x10k\x12\x15\n\x11MSG_PING_NODE_REQ\x10l\x12\x15\n\x11MSG_PING_NODE_RSP\x10m\x12\x14\n\x10MSG_PDI_READ_REQ\x10r\x12\x14\n\x10MSG_PDI_READ_RSP\x10s\x12\x15\n\x11MSG_PDI_WRITE_REQ\x10t\x12\x15\n\x11MSG_PDI_WRITE_RSP\x10u\x12\x19\n\x15MSG_SYSTEM_STATUS_REQ\x10v\x12\x19\n\x15MSG_SYSTEM_STATUS_RSP\x10w\x12\x19\n\x15MSG_BOOT_TIMELINE_REQ\x10x\x12\x19\n\x15MSG_BOOT_TIMELINE_RSP\x10y\x12\x15\n\x11MSG_CAL_WRITE_REQ\x10z\x12\x15\n\x11MSG_CAL_WRITE_RSP\x10{\x12\x17\n\x13MSG_FLASH_STATS_REQ\x10|\x12\x17\n\x13MSG_FLASH_STATS_RSP\x10}\x12\x15\n\x11MSG_LOG_QUERY_REQ\x10~\x12\x15\n\x11MSG_LOG_QUERY_RSP\x10\x7f\x12\x1c\n\x17MSG_FLIGHT_RECORDER_REQ\x10\x80\x01\x12\x1c\n\x17MSG_FLIGHT_RECORDER_RSP\x10\x81\x01\x12\x1a\n\x15MSG_TELEMETRY_SUB_REQ\x10\x82\x01\x12\x1a\n\x15MSG_TELEMETRY_SUB_RSP\x10\x83\x01\x12\x19\n\x14MSG_SENSOR_BATCH_REQ\x10\x84\x01\x12\x19\n\x14MSG_SENSOR_BATCH_RSP\x10\x85\x01\x12\x16\n\x11MSG_LINK_BAUD_REQ\x10\x86\x01\x12\x16\n\x11MSG_LINK_BAUD_RSP\x10\x87\x01\x12\x18\n\x13MSG_LTC_REG_GET_REQ\x10\x88\x01\x12\x18\n\x13MSG_LTC_REG_GET_RSP\x10\x89\x01\x12\x18\n\x13MSG_LTC_REG_SET_REQ\x10\x8a\x01\x12\x18\n\x13MSG_LTC_REG_SET_RSP\x10\x8b\x01\x12\x16\n\x11MSG_GROUP_CMD_REQ\x10\x8c\x01\x12\x16\n\x11MSG_GROUP_CMD_RSP\x10\x8d\x01*\xb8\x08\n\x0eMessageVersion\x12\x16\n\x12MSG_VER_GET_ID_REQ\x10\x00\x12\x16\n\x12MSG_VER_GET_ID_RSP\x10\x00\x12\x18\n\x14MSG_VER_SETPOINT_REQ\x10\x00\x12\x18\n\x14MSG_VER_SETPOINT_RSP\x10\x00\x12\x17\n\x13MSG_VER_MANAGER_REQ\x10\x00\x12\x17\n\x13MSG_VER_MANAGER_RSP\x10\x00\x12\x16\n\x12MSG_VER_SENSOR_REQ\x10\x00\x12\x16\n\x12MSG_VER_SENSOR_RSP\x10\x00\x12\x19\n\x15MSG_VER_PING_NODE_REQ\x10\x00\x12\x19\n\x15MSG_VER_PING_NODE_RSP\x10\x00\x12\x18\n\x14MSG_VER_PDI_READ_REQ\x10\x00\x12\x18\n\x14MSG_VER_PDI_READ_RSP\x10\x00\x12\x19\n\x15MSG_VER_PDI_WRITE_REQ\x10\x00\x12\x19\n\x15MSG_VER_PDI_WRITE_RSP\x10\x00\x12\x1d\n\x19MSG_VER_SYSTEM_STATUS_REQ\x10\x00\x12\x1d\n\x19MSG_VER_SYSTEM_STATUS_RSP\x10\x00\x12\x1d\n\x19MSG_VER_BOOT_TIMELINE_REQ\x10\x00\x12\x1d\n\x19MSG_VER_BOOT_TIMELINE_RSP\x10\x00\x12\x19\n\x15MSG_VER_CAL_WRITE_REQ\x10\x00\x12\x19\n\x15MSG_VER_CAL_WRITE_RSP\x10\x00\x12\x1b\n\x17MSG_VER_FLASH_STATS_REQ\x10\x00\x12\x1b\n\x17MSG_VER_FLASH_STATS_RSP\x10\x00\x12\x19\n\x15MSG_VER_LOG_QUERY_REQ\x10\x00\x12\x19\n\x15MSG_VER_LOG_QUERY_RSP\x10\x00\x12\x1f\n\x1bMSG_VER_FLIGHT_RECORDER_REQ\x10\x00\x12\x1f\n\x1bMSG_VER_FLIGHT_RECORDER_RSP\x10\x00\x12\x1d\n\x19MSG_VER_TELEMETRY_SUB_REQ\x10\x00\x12\x1d\n\x19MSG_VER_TELEMETRY_SUB_RSP\x10\x00\x12\x1c\n\x18MSG_VER_SENSOR_BATCH_REQ\x10\x00\x12\x1c\n\x18MSG_VER_SENSOR_BATCH_RSP\x10\x00\x12\x19\n\x15MSG_VER_LINK_BAUD_REQ\x10\x00\x12\x19\n\x15MSG_VER_LINK_BAUD_RSP\x10\x00\x12\x1b\n\x17MSG_VER_LTC_REG_GET_REQ\x10\x00\x12\x1b\n\x17MSG_VER_LTC_REG_GET_RSP\x10\x00\x12\x1b\n\x17MSG_VER_LTC_REG_SET_REQ\x10\x00\x12\x1b\n\x17MSG_VER_LTC_REG_SET_RSP\x10\x00\x12\x19\n\x15MSG_VER_GROUP_CMD_REQ\x10\x00\x12\x19\n\x15MSG_VER_GROUP_CMD_RSP\x10\x00\x1a\x02\x10\x01*\x87\x01\n\x0eManagerCommand\x12\x0e\n\nCMD_REBOOT\x10\x00\x12\x15\n\x11\x43MD_ENGAGE_OUTPUT\x10\x01\x12\x18\n\x14\x43MD_DISENGAGE_OUTPUT\x10\x02\x12\x17\n\x13\x43MD_FLUSH_PDI_CACHE\x10\x03\x12\x1b\n\x17\x43MD_ZERO_OUTPUT_CURRENT\x10\x04*M\n\x0cManagerError\x12\x14\n\x10\x45RR_CMD_NO_ERROR\x10\x00\x12\x13\n\x0f\x45RR_CMD_INVALID\x10\x01\x12\x12\n\x0e\x45RR_CMD_FAILED\x10\x02*d\n\rSetpointError\x12\x19\n\x15\x45RR_SETPOINT_NO_ERROR\x10\x00\x12\x18\n\x14\x45RR_SETPOINT_INVALID\x10\x01\x12\x1e\n\x1a\x45RR_SETPOINT_NOT_SUPPORTED\x10\x02*I\n\rSetpointField\x12\x1b\n\x17SETPOINT_OUTPUT_VOLTAGE\x10\x00\x12\x1b\n\x17SETPOINT_OUTPUT_CURRENT\x10\x01*x\n\x0bSensorError\x12\x17\n\x13\x45RR_SENSOR_NO_ERROR\x10\x00\x12\x1c\n\x18\x45RR_SENSOR_NOT_SUPPORTED\x10\x01\x12\x1a\n\x16\x45RR_SENSOR_READ_FAILED\x10\x02\x12\x16\n\x12\x45RR_SENSOR_UNKNOWN\x10\x03*\xb9\x02\n\nSensorType\x12\x19\n\x15SENSOR_OUTPUT_VOLTAGE\x10\x00\x12\x18\n\x14SENSOR_INPUT_VOLTAGE\x10\x01\x12\x19\n\x15SENSOR_OUTPUT_CURRENT\x10\x02\x12!\n\x1dSENSOR_LTC_AVG_OUTPUT_CURRENT\x10\x03\x12\x17\n\x13SENSOR_BOARD_TEMP_1\x10\x04\x12\x17\n\x13SENSOR_BOARD_TEMP_2\x10\x05\x12\x17\n\x13SENSOR_BOARD_TEMP_3\x10\x06\x12\x1a\n\x16SENSOR_VOLTAGE_MON_1V1\x10\x07\x12\x1a\n\x16SENSOR_VOLTAGE_MON_3V3\x10\x08\x12\x19\n\x15SENSOR_VOLTAGE_MON_5V\x10\t\x12\x1a\n\x16SENSOR_VOLTAGE_MON_12V\x10\n*7\n\x0b\x45ngageState\x12\x0b\n\x07\x45NGAGED\x10\x00\x12\x0e\n\nDISENGAGED\x10\x01\x12\x0b\n\x07\x46\x41ULTED\x10\x02*\x98\x06\n\nBootStepId\x12\x1a\n\x16\x42OOT_STEP_INIT_DRIVERS\x10\x00\x12\x12\n\x0e\x42OOT_STEP_OSAL\x10\x01\x12\x11\n\rBOOT_STEP_BSP\x10\x02\x12\x15\n\x11\x42OOT_STEP_HW_INTF\x10\x03\x12\x15\n\x11\x42OOT_STEP_HW_GPIO\x10\x04\x12\x14\n\x10\x42OOT_STEP_HW_LED\x10\x05\x12\x14\n\x10\x42OOT_STEP_HW_ADC\x10\x06\x12\x15\n\x11\x42OOT_STEP_HW_UART\x10\x07\x12\x14\n\x10\x42OOT_STEP_HW_FAN\x10\x08\x12\x18\n\x14\x42OOT_STEP_HW_LTC7871\x10\t\x12\x15\n\x11\x42OOT_STEP_THREADS\x10\n\x12\x17\n\x13\x42OOT_STEP_INIT_TECH\x10\x0b\x12\x15\n\x11\x42OOT_STEP_CONTROL\x10\x0c\x12\x15\n\x11\x42OOT_STEP_LOGGING\x10\r\x12\x17\n\x13\x42OOT_STEP_KVDB_INIT\x10\x0e\x12\x14\n\x10\x42OOT_STEP_SENSOR\x10\x0f\x12\x12\n\x0e\x42OOT_STEP_POST\x10\x10\x12\x1a\n\x16\x42OOT_STEP_POST_LOGGING\x10\x11\x12\x1a\n\x16\x42OOT_STEP_POST_LTC7871\x10\x12\x12\x16\n\x12\x42OOT_STEP_POST_LED\x10\x13\x12\x16\n\x12\x42OOT_STEP_POST_ADC\x10\x14\x12\x16\n\x12\x42OOT_STEP_POST_FAN\x10\x15\x12\x18\n\x14\x42OOT_STEP_APP_CONFIG\x10\x16\x12\x17\n\x13\x42OOT_STEP_APP_STATS\x10\x17\x12\x17\n\x13\x42OOT_STEP_APP_POWER\x10\x18\x12\x18\n\x14\x42OOT_STEP_APP_FILTER\x10\x19\x12\x19\n\x15\x42OOT_STEP_APP_MONITOR\x10\x1a\x12\x1a\n\x16\x42OOT_STEP_PDI_REGISTER\x10\x1b\x12\x1b\n\x17\x42OOT_STEP_POST_DEFERRED\x10\x1c\x12\x17\n\x13\x42OOT_STEP_CAL_STORE\x10\x1d\x12\x19\n\x15\x42OOT_STEP_FLASH_STATS\x10\x1e\x12\x17\n\x13\x42OOT_STEP_APP_GROUP\x10\x1f*\'\n\rCalibrationId\x12\x16\n\x12\x43\x41L_OUTPUT_CURRENT\x10\x00*F\n\x07\x46lashOp\x12\x11\n\rFLASH_OP_READ\x10\x00\x12\x14\n\x10\x46LASH_OP_PROGRAM\x10\x01\x12\x12\n\x0e\x46LASH_OP_ERASE\x10\x02*D\n\x13\x46lightRecorderState\x12\x0c\n\x08\x46R_ARMED\x10\x00\x12\x10\n\x0c\x46R_TRIGGERED\x10\x01\x12\r\n\tFR_FROZEN\x10\x02*Q\n\x0eLinkBaudStatus\x12\x10\n\x0cLINK_BAUD_OK\x10\x00\x12\x19\n\x15LINK_BAUD_UNSUPPORTED\x10\x01\x12\x12\n\x0eLINK_BAUD_BUSY\x10\x02*|\n\x0cLTCRegStatus\x12\x0e\n\nLTC_REG_OK\x10\x00\x12\x18\n\x14LTC_REG_INVALID_ADDR\x10\x01\x12\x15\n\x11LTC_REG_READ_ONLY\x10\x02\x12\x14\n\x10LTC_REG_BAD_MODE\x10\x03\x12\x15\n\x11LTC_REG_BAD_VALUE\x10\x04*3\n\x0cGroupAddress\x12\x10\n\x0cGROUP_ID_MAX\x10\x1f\x12\x11\n\x0cGROUP_ID_ALL\x10\xff\x01*\x84\x01\n\x0bGroupAction\x12\x19\n\x15GROUP_ACTION_SETPOINT\x10\x00\x12\x1e\n\x1aGROUP_ACTION_ENGAGE_OUTPUT\x10\x01\x12!\n\x1dGROUP_ACTION_DISENGAGE_OUTPUT\x10\x02\x12\x17\n\x13GROUP_ACTION_CANCEL\x10\x03*\x83\x01\n\x12GroupCommandStatus\x12\x10\n\x0cGROUP_CMD_OK\x10\x00\x12\x15\n\x11GROUP_CMD_INVALID\x10\x01\x12\x17\n\x13GROUP_CMD_BAD_DELAY\x10\x02\x12\x12\n\x0eGROUP_CMD_LATE\x10\x03\x12\x17\n\x13GROUP_CMD_BAD_VALUE\x10\x04')
 
 _globals = globals()
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, _globals)
@@ -45,34 +45,160 @@ if not _descriptor._USE_C_DESCRIPTORS:
   _globals['_MANAGERRESPONSE'].fields_by_name['message']._serialized_options = b'\222?\002\010@'
   _globals['_SETPOINTRESPONSE'].fields_by_name['message']._loaded_options = None
   _globals['_SETPOINTRESPONSE'].fields_by_name['message']._serialized_options = b'\222?\002\010@'
+  _globals['_SENSORBATCHREQUEST'].fields_by_name['sensor_mask']._loaded_options = None
+  _globals['_SENSORBATCHREQUEST'].fields_by_name['sensor_mask']._serialized_options = b'\222?\0028\020'
+  _globals['_SENSORBATCHRESPONSE'].fields_by_name['sensor_mask']._loaded_options = None
+  _globals['_SENSORBATCHRESPONSE'].fields_by_name['sensor_mask']._serialized_options = b'\222?\0028\020'
+  _globals['_SENSORBATCHRESPONSE'].fields_by_name['values']._loaded_options = None
+  _globals['_SENSORBATCHRESPONSE'].fields_by_name['values']._serialized_options = b'\020\001\222?\002\020\013'
   _globals['_PDIREADRESPONSE'].fields_by_name['data']._loaded_options = None
   _globals['_PDIREADRESPONSE'].fields_by_name['data']._serialized_options = b'\222?\003\010\200\004'
   _globals['_PDIWRITEREQUEST'].fields_by_name['data']._loaded_options = None
   _globals['_PDIWRITEREQUEST'].fields_by_name['data']._serialized_options = b'\222?\003\010\200\004'
+  _globals['_TXQUEUESTATS'].fields_by_name['depth']._loaded_options = None
+  _globals['_TXQUEUESTATS'].fields_by_name['depth']._serialized_options = b'\222?\0028\020'
+  _globals['_TXQUEUESTATS'].fields_by_name['high_water']._loaded_options = None
+  _globals['_TXQUEUESTATS'].fields_by_name['high_water']._serialized_options = b'\222?\0028\020'
   _globals['_SYSTEMSTATUSRESPONSE'].fields_by_name['timestamp']._loaded_options = None
   _globals['_SYSTEMSTATUSRESPONSE'].fields_by_name['timestamp']._serialized_options = b'\222?\0028 '
   _globals['_SYSTEMSTATUSRESPONSE'].fields_by_name['output_state']._loaded_options = None
   _globals['_SYSTEMSTATUSRESPONSE'].fields_by_name['output_state']._serialized_options = b'\222?\0028\010'
-  _globals['_SERVICE']._serialized_start=1675
-  _globals['_SERVICE']._serialized_end=1874
-  _globals['_MESSAGE']._serialized_start=1877
-  _globals['_MESSAGE']._serialized_end=2242
-  _globals['_MESSAGEVERSION']._serialized_start=2245
-  _globals['_MESSAGEVERSION']._serialized_end=2685
-  _globals['_MANAGERCOMMAND']._serialized_start=2688
-  _globals['_MANAGERCOMMAND']._serialized_end=2823
-  _globals['_MANAGERERROR']._serialized_start=2825
-  _globals['_MANAGERERROR']._serialized_end=2902
-  _globals['_SETPOINTERROR']._serialized_start=2904
-  _globals['_SETPOINTERROR']._serialized_end=3004
-  _globals['_SETPOINTFIELD']._serialized_start=3006
-  _globals['_SETPOINTFIELD']._serialized_end=3079
-  _globals['_SENSORERROR']._serialized_start=3081
-  _globals['_SENSORERROR']._serialized_end=3201
-  _globals['_SENSORTYPE']._serialized_start=3204
-  _globals['_SENSORTYPE']._serialized_end=3517
-  _globals['_ENGAGESTATE']._serialized_start=3519
-  _globals['_ENGAGESTATE']._serialized_end=3574
+  _globals['_SYSTEMSTATUSRESPONSE'].fields_by_name['tx_queues']._loaded_options = None
+  _globals['_SYSTEMSTATUSRESPONSE'].fields_by_name['tx_queues']._serialized_options = b'\222?\002\020\002'
+  _globals['_BOOTSTEP'].fields_by_name['step']._loaded_options = None
+  _globals['_BOOTSTEP'].fields_by_name['step']._serialized_options = b'\222?\0028\010'
+  _globals['_BOOTSTEP'].fields_by_name['depth']._loaded_options = None
+  _globals['_BOOTSTEP'].fields_by_name['depth']._serialized_options = b'\222?\0028\010'
+  _globals['_BOOTSTEP'].fields_by_name['tag']._loaded_options = None
+  _globals['_BOOTSTEP'].fields_by_name['tag']._serialized_options = b'\222?\0028\020'
+  _globals['_BOOTTIMELINEREQUEST'].fields_by_name['offset']._loaded_options = None
+  _globals['_BOOTTIMELINEREQUEST'].fields_by_name['offset']._serialized_options = b'\222?\0028\010'
+  _globals['_BOOTTIMELINERESPONSE'].fields_by_name['total']._loaded_options = None
+  _globals['_BOOTTIMELINERESPONSE'].fields_by_name['total']._serialized_options = b'\222?\0028\010'
+  _globals['_BOOTTIMELINERESPONSE'].fields_by_name['offset']._loaded_options = None
+  _globals['_BOOTTIMELINERESPONSE'].fields_by_name['offset']._serialized_options = b'\222?\0028\010'
+  _globals['_BOOTTIMELINERESPONSE'].fields_by_name['steps']._loaded_options = None
+  _globals['_BOOTTIMELINERESPONSE'].fields_by_name['steps']._serialized_options = b'\222?\002\020\024'
+  _globals['_CALIBRATIONENTRY'].fields_by_name['id']._loaded_options = None
+  _globals['_CALIBRATIONENTRY'].fields_by_name['id']._serialized_options = b'\222?\0028\010'
+  _globals['_CALWRITEREQUEST'].fields_by_name['entries']._loaded_options = None
+  _globals['_CALWRITEREQUEST'].fields_by_name['entries']._serialized_options = b'\222?\002\020\010'
+  _globals['_CALWRITERESPONSE'].fields_by_name['message']._loaded_options = None
+  _globals['_CALWRITERESPONSE'].fields_by_name['message']._serialized_options = b'\222?\002\010@'
+  _globals['_FLASHLATENCYHISTOGRAM'].fields_by_name['op']._loaded_options = None
+  _globals['_FLASHLATENCYHISTOGRAM'].fields_by_name['op']._serialized_options = b'\222?\0028\010'
+  _globals['_FLASHLATENCYHISTOGRAM'].fields_by_name['buckets']._loaded_options = None
+  _globals['_FLASHLATENCYHISTOGRAM'].fields_by_name['buckets']._serialized_options = b'\020\001\222?\002\020\024'
+  _globals['_FLASHSTATSREQUEST'].fields_by_name['sector_offset']._loaded_options = None
+  _globals['_FLASHSTATSREQUEST'].fields_by_name['sector_offset']._serialized_options = b'\222?\0028\020'
+  _globals['_FLASHSTATSRESPONSE'].fields_by_name['num_sectors']._loaded_options = None
+  _globals['_FLASHSTATSRESPONSE'].fields_by_name['num_sectors']._serialized_options = b'\222?\0028\020'
+  _globals['_FLASHSTATSRESPONSE'].fields_by_name['sector_offset']._loaded_options = None
+  _globals['_FLASHSTATSRESPONSE'].fields_by_name['sector_offset']._serialized_options = b'\222?\0028\020'
+  _globals['_FLASHSTATSRESPONSE'].fields_by_name['erase_counts']._loaded_options = None
+  _globals['_FLASHSTATSRESPONSE'].fields_by_name['erase_counts']._serialized_options = b'\020\001\222?\002\020\024'
+  _globals['_FLASHSTATSRESPONSE'].fields_by_name['latency']._loaded_options = None
+  _globals['_FLASHSTATSRESPONSE'].fields_by_name['latency']._serialized_options = b'\222?\002\020\003'
+  _globals['_LOGQUERYREQUEST'].fields_by_name['min_level']._loaded_options = None
+  _globals['_LOGQUERYREQUEST'].fields_by_name['min_level']._serialized_options = b'\222?\0028\010'
+  _globals['_LOGQUERYREQUEST'].fields_by_name['max_count']._loaded_options = None
+  _globals['_LOGQUERYREQUEST'].fields_by_name['max_count']._serialized_options = b'\222?\0028\020'
+  _globals['_LOGQUERYREQUEST'].fields_by_name['skip']._loaded_options = None
+  _globals['_LOGQUERYREQUEST'].fields_by_name['skip']._serialized_options = b'\222?\0028\020'
+  _globals['_LOGQUERYRESPONSE'].fields_by_name['count']._loaded_options = None
+  _globals['_LOGQUERYRESPONSE'].fields_by_name['count']._serialized_options = b'\222?\0028\020'
+  _globals['_LOGQUERYRESPONSE'].fields_by_name['skip']._loaded_options = None
+  _globals['_LOGQUERYRESPONSE'].fields_by_name['skip']._serialized_options = b'\222?\0028\020'
+  _globals['_LOGQUERYRESPONSE'].fields_by_name['data']._loaded_options = None
+  _globals['_LOGQUERYRESPONSE'].fields_by_name['data']._serialized_options = b'\222?\003\010\200\004'
+  _globals['_FLIGHTSAMPLE'].fields_by_name['channel']._loaded_options = None
+  _globals['_FLIGHTSAMPLE'].fields_by_name['channel']._serialized_options = b'\222?\0028\010'
+  _globals['_FLIGHTRECORDERREQUEST'].fields_by_name['offset']._loaded_options = None
+  _globals['_FLIGHTRECORDERREQUEST'].fields_by_name['offset']._serialized_options = b'\222?\0028\020'
+  _globals['_FLIGHTRECORDERREQUEST'].fields_by_name['pre_trigger']._loaded_options = None
+  _globals['_FLIGHTRECORDERREQUEST'].fields_by_name['pre_trigger']._serialized_options = b'\222?\0028\020'
+  _globals['_FLIGHTRECORDERREQUEST'].fields_by_name['post_trigger']._loaded_options = None
+  _globals['_FLIGHTRECORDERREQUEST'].fields_by_name['post_trigger']._serialized_options = b'\222?\0028\020'
+  _globals['_FLIGHTRECORDERRESPONSE'].fields_by_name['trigger_code']._loaded_options = None
+  _globals['_FLIGHTRECORDERRESPONSE'].fields_by_name['trigger_code']._serialized_options = b'\222?\0028\010'
+  _globals['_FLIGHTRECORDERRESPONSE'].fields_by_name['total']._loaded_options = None
+  _globals['_FLIGHTRECORDERRESPONSE'].fields_by_name['total']._serialized_options = b'\222?\0028\020'
+  _globals['_FLIGHTRECORDERRESPONSE'].fields_by_name['trigger_index']._loaded_options = None
+  _globals['_FLIGHTRECORDERRESPONSE'].fields_by_name['trigger_index']._serialized_options = b'\222?\0028\020'
+  _globals['_FLIGHTRECORDERRESPONSE'].fields_by_name['offset']._loaded_options = None
+  _globals['_FLIGHTRECORDERRESPONSE'].fields_by_name['offset']._serialized_options = b'\222?\0028\020'
+  _globals['_FLIGHTRECORDERRESPONSE'].fields_by_name['samples']._loaded_options = None
+  _globals['_FLIGHTRECORDERRESPONSE'].fields_by_name['samples']._serialized_options = b'\222?\002\020\030'
+  _globals['_TELEMETRYSUBSCRIBEREQUEST'].fields_by_name['sensor_mask']._loaded_options = None
+  _globals['_TELEMETRYSUBSCRIBEREQUEST'].fields_by_name['sensor_mask']._serialized_options = b'\222?\0028\020'
+  _globals['_TELEMETRYSUBSCRIBEREQUEST'].fields_by_name['period_ms']._loaded_options = None
+  _globals['_TELEMETRYSUBSCRIBEREQUEST'].fields_by_name['period_ms']._serialized_options = b'\222?\0028\020'
+  _globals['_TELEMETRYSUBSCRIBEREQUEST'].fields_by_name['keyframe_ms']._loaded_options = None
+  _globals['_TELEMETRYSUBSCRIBEREQUEST'].fields_by_name['keyframe_ms']._serialized_options = b'\222?\0028\020'
+  _globals['_TELEMETRYSUBSCRIBERESPONSE'].fields_by_name['sensor_mask']._loaded_options = None
+  _globals['_TELEMETRYSUBSCRIBERESPONSE'].fields_by_name['sensor_mask']._serialized_options = b'\222?\0028\020'
+  _globals['_TELEMETRYSUBSCRIBERESPONSE'].fields_by_name['period_ms']._loaded_options = None
+  _globals['_TELEMETRYSUBSCRIBERESPONSE'].fields_by_name['period_ms']._serialized_options = b'\222?\0028\020'
+  _globals['_TELEMETRYSUBSCRIBERESPONSE'].fields_by_name['keyframe_ms']._loaded_options = None
+  _globals['_TELEMETRYSUBSCRIBERESPONSE'].fields_by_name['keyframe_ms']._serialized_options = b'\222?\0028\020'
+  _globals['_LINKBAUDRESPONSE'].fields_by_name['supported']._loaded_options = None
+  _globals['_LINKBAUDRESPONSE'].fields_by_name['supported']._serialized_options = b'\222?\002\020\010'
+  _globals['_LTCREGGETREQUEST'].fields_by_name['reg']._loaded_options = None
+  _globals['_LTCREGGETREQUEST'].fields_by_name['reg']._serialized_options = b'\222?\0028\010'
+  _globals['_LTCREGGETRESPONSE'].fields_by_name['first_reg']._loaded_options = None
+  _globals['_LTCREGGETRESPONSE'].fields_by_name['first_reg']._serialized_options = b'\222?\0028\010'
+  _globals['_LTCREGGETRESPONSE'].fields_by_name['values']._loaded_options = None
+  _globals['_LTCREGGETRESPONSE'].fields_by_name['values']._serialized_options = b'\222?\002\010\020'
+  _globals['_LTCREGSETREQUEST'].fields_by_name['reg']._loaded_options = None
+  _globals['_LTCREGSETREQUEST'].fields_by_name['reg']._serialized_options = b'\222?\0028\010'
+  _globals['_LTCREGSETREQUEST'].fields_by_name['value']._loaded_options = None
+  _globals['_LTCREGSETREQUEST'].fields_by_name['value']._serialized_options = b'\222?\0028\010'
+  _globals['_LTCREGSETRESPONSE'].fields_by_name['value']._loaded_options = None
+  _globals['_LTCREGSETRESPONSE'].fields_by_name['value']._serialized_options = b'\222?\0028\010'
+  _globals['_GROUPCOMMANDREQUEST'].fields_by_name['group_id']._loaded_options = None
+  _globals['_GROUPCOMMANDREQUEST'].fields_by_name['group_id']._serialized_options = b'\222?\0028\010'
+  _globals['_GROUPCOMMANDREQUEST'].fields_by_name['command_id']._loaded_options = None
+  _globals['_GROUPCOMMANDREQUEST'].fields_by_name['command_id']._serialized_options = b'\222?\0028\020'
+  _globals['_GROUPCOMMANDRESPONSE'].fields_by_name['command_id']._loaded_options = None
+  _globals['_GROUPCOMMANDRESPONSE'].fields_by_name['command_id']._serialized_options = b'\222?\0028\020'
+  _globals['_SERVICE']._serialized_start=5752
+  _globals['_SERVICE']._serialized_end=6141
+  _globals['_MESSAGE']._serialized_start=6144
+  _globals['_MESSAGE']._serialized_end=7075
+  _globals['_MESSAGEVERSION']._serialized_start=7078
+  _globals['_MESSAGEVERSION']._serialized_end=8158
+  _globals['_MANAGERCOMMAND']._serialized_start=8161
+  _globals['_MANAGERCOMMAND']._serialized_end=8296
+  _globals['_MANAGERERROR']._serialized_start=8298
+  _globals['_MANAGERERROR']._serialized_end=8375
+  _globals['_SETPOINTERROR']._serialized_start=8377
+  _globals['_SETPOINTERROR']._serialized_end=8477
+  _globals['_SETPOINTFIELD']._serialized_start=8479
+  _globals['_SETPOINTFIELD']._serialized_end=8552
+  _globals['_SENSORERROR']._serialized_start=8554
+  _globals['_SENSORERROR']._serialized_end=8674
+  _globals['_SENSORTYPE']._serialized_start=8677
+  _globals['_SENSORTYPE']._serialized_end=8990
+  _globals['_ENGAGESTATE']._serialized_start=8992
+  _globals['_ENGAGESTATE']._serialized_end=9047
+  _globals['_BOOTSTEPID']._serialized_start=9050
+  _globals['_BOOTSTEPID']._serialized_end=9842
+  _globals['_CALIBRATIONID']._serialized_start=9844
+  _globals['_CALIBRATIONID']._serialized_end=9883
+  _globals['_FLASHOP']._serialized_start=9885
+  _globals['_FLASHOP']._serialized_end=9955
+  _globals['_FLIGHTRECORDERSTATE']._serialized_start=9957
+  _globals['_FLIGHTRECORDERSTATE']._serialized_end=10025
+  _globals['_LINKBAUDSTATUS']._serialized_start=10027
+  _globals['_LINKBAUDSTATUS']._serialized_end=10108
+  _globals['_LTCREGSTATUS']._serialized_start=10110
+  _globals['_LTCREGSTATUS']._serialized_end=10234
+  _globals['_GROUPADDRESS']._serialized_start=10236
+  _globals['_GROUPADDRESS']._serialized_end=10287
+  _globals['_GROUPACTION']._serialized_start=10290
+  _globals['_GROUPACTION']._serialized_end=10422
+  _globals['_GROUPCOMMANDSTATUS']._serialized_start=10425
+  _globals['_GROUPCOMMANDSTATUS']._serialized_end=10556
   _globals['_PINGNODEREQUEST']._serialized_start=60
   _globals['_PINGNODEREQUEST']._serialized_end=128
   _globals['_PINGNODERESPONSE']._serialized_start=130
@@ -93,16 +219,70 @@ if not _descriptor._USE_C_DESCRIPTORS:
   _globals['_SENSORREQUEST']._serialized_end=1001
   _globals['_SENSORRESPONSE']._serialized_start=1003
   _globals['_SENSORRESPONSE']._serialized_end=1106
-  _globals['_PDIREADREQUEST']._serialized_start=1108
-  _globals['_PDIREADREQUEST']._serialized_end=1191
-  _globals['_PDIREADRESPONSE']._serialized_start=1193
-  _globals['_PDIREADRESPONSE']._serialized_end=1283
-  _globals['_PDIWRITEREQUEST']._serialized_start=1285
-  _globals['_PDIWRITEREQUEST']._serialized_end=1391
-  _globals['_PDIWRITERESPONSE']._serialized_start=1393
-  _globals['_PDIWRITERESPONSE']._serialized_end=1462
-  _globals['_SYSTEMSTATUSREQUEST']._serialized_start=1464
-  _globals['_SYSTEMSTATUSREQUEST']._serialized_end=1536
-  _globals['_SYSTEMSTATUSRESPONSE']._serialized_start=1539
-  _globals['_SYSTEMSTATUSRESPONSE']._serialized_end=1672
+  _globals['_SENSORBATCHREQUEST']._serialized_start=1108
+  _globals['_SENSORBATCHREQUEST']._serialized_end=1207
+  _globals['_SENSORBATCHRESPONSE']._serialized_start=1210
+  _globals['_SENSORBATCHRESPONSE']._serialized_end=1375
+  _globals['_PDIREADREQUEST']._serialized_start=1377
+  _globals['_PDIREADREQUEST']._serialized_end=1460
+  _globals['_PDIREADRESPONSE']._serialized_start=1462
+  _globals['_PDIREADRESPONSE']._serialized_end=1552
+  _globals['_PDIWRITEREQUEST']._serialized_start=1554
+  _globals['_PDIWRITEREQUEST']._serialized_end=1660
+  _globals['_PDIWRITERESPONSE']._serialized_start=1662
+  _globals['_PDIWRITERESPONSE']._serialized_end=1731
+  _globals['_SYSTEMSTATUSREQUEST']._serialized_start=1733
+  _globals['_SYSTEMSTATUSREQUEST']._serialized_end=1805
+  _globals['_TXQUEUESTATS']._serialized_start=1807
+  _globals['_TXQUEUESTATS']._serialized_end=1901
+  _globals['_SYSTEMSTATUSRESPONSE']._serialized_start=1904
+  _globals['_SYSTEMSTATUSRESPONSE']._serialized_end=2086
+  _globals['_BOOTSTEP']._serialized_start=2089
+  _globals['_BOOTSTEP']._serialized_end=2222
+  _globals['_BOOTTIMELINEREQUEST']._serialized_start=2224
+  _globals['_BOOTTIMELINEREQUEST']._serialized_end=2319
+  _globals['_BOOTTIMELINERESPONSE']._serialized_start=2322
+  _globals['_BOOTTIMELINERESPONSE']._serialized_end=2482
+  _globals['_CALIBRATIONENTRY']._serialized_start=2485
+  _globals['_CALIBRATIONENTRY']._serialized_end=2614
+  _globals['_CALWRITEREQUEST']._serialized_start=2616
+  _globals['_CALWRITEREQUEST']._serialized_end=2735
+  _globals['_CALWRITERESPONSE']._serialized_start=2737
+  _globals['_CALWRITERESPONSE']._serialized_end=2830
+  _globals['_FLASHLATENCYHISTOGRAM']._serialized_start=2832
+  _globals['_FLASHLATENCYHISTOGRAM']._serialized_end=2918
+  _globals['_FLASHSTATSREQUEST']._serialized_start=2920
+  _globals['_FLASHSTATSREQUEST']._serialized_end=3020
+  _globals['_FLASHSTATSRESPONSE']._serialized_start=3023
+  _globals['_FLASHSTATSRESPONSE']._serialized_end=3326
+  _globals['_LOGQUERYREQUEST']._serialized_start=3329
+  _globals['_LOGQUERYREQUEST']._serialized_end=3525
+  _globals['_LOGQUERYRESPONSE']._serialized_start=3528
+  _globals['_LOGQUERYRESPONSE']._serialized_end=3710
+  _globals['_FLIGHTSAMPLE']._serialized_start=3712
+  _globals['_FLIGHTSAMPLE']._serialized_end=3792
+  _globals['_FLIGHTRECORDERREQUEST']._serialized_start=3795
+  _globals['_FLIGHTRECORDERREQUEST']._serialized_end=3981
+  _globals['_FLIGHTRECORDERRESPONSE']._serialized_start=3984
+  _globals['_FLIGHTRECORDERRESPONSE']._serialized_end=4260
+  _globals['_TELEMETRYSUBSCRIBEREQUEST']._serialized_start=4263
+  _globals['_TELEMETRYSUBSCRIBEREQUEST']._serialized_end=4441
+  _globals['_TELEMETRYSUBSCRIBERESPONSE']._serialized_start=4444
+  _globals['_TELEMETRYSUBSCRIBERESPONSE']._serialized_end=4606
+  _globals['_LINKBAUDREQUEST']._serialized_start=4608
+  _globals['_LINKBAUDREQUEST']._serialized_end=4707
+  _globals['_LINKBAUDRESPONSE']._serialized_start=4710
+  _globals['_LINKBAUDRESPONSE']._serialized_end=4883
+  _globals['_LTCREGGETREQUEST']._serialized_start=4885
+  _globals['_LTCREGGETREQUEST']._serialized_end=4988
+  _globals['_LTCREGGETRESPONSE']._serialized_start=4991
+  _globals['_LTCREGGETRESPONSE']._serialized_end=5132
+  _globals['_LTCREGSETREQUEST']._serialized_start=5134
+  _globals['_LTCREGSETREQUEST']._serialized_end=5245
+  _globals['_LTCREGSETRESPONSE']._serialized_start=5247
+  _globals['_LTCREGSETRESPONSE']._serialized_end=5361
+  _globals['_GROUPCOMMANDREQUEST']._serialized_start=5364
+  _globals['_GROUPCOMMANDREQUEST']._serialized_end=5581
+  _globals['_GROUPCOMMANDRESPONSE']._serialized_start=5584
+  _globals['_GROUPCOMMANDRESPONSE']._serialized_end=5749
 # @@protoc_insertion_point(module_scope)
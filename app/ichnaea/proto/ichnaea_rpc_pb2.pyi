@@ -4,7 +4,9 @@ isort:skip_file
 """
 
 import builtins
+import collections.abc
 import google.protobuf.descriptor
+import google.protobuf.internal.containers
 import google.protobuf.internal.enum_type_wrapper
 import google.protobuf.message
 import mbed_rpc_pb2
@@ -44,6 +46,24 @@ class _ServiceEnumTypeWrapper(google.protobuf.internal.enum_type_wrapper._EnumTy
     """Write PDI data to the node"""
     SVC_SYSTEM_STATUS: _Service.ValueType  # 109
     """Get the system status"""
+    SVC_BOOT_TIMELINE: _Service.ValueType  # 110
+    """Read the boot timeline profile"""
+    SVC_CAL_WRITE: _Service.ValueType  # 111
+    """Bulk write calibration data"""
+    SVC_FLASH_STATS: _Service.ValueType  # 112
+    """Read the NOR flash wear and latency statistics"""
+    SVC_LOG_QUERY: _Service.ValueType  # 113
+    """Read stored logs filtered by time and level"""
+    SVC_FLIGHT_RECORDER: _Service.ValueType  # 114
+    """Read or rearm the fault flight recorder"""
+    SVC_TELEMETRY: _Service.ValueType  # 115
+    """Subscribe to streamed sensor telemetry"""
+    SVC_SENSOR_BATCH: _Service.ValueType  # 116
+    """Read several sensor values at once"""
+    SVC_LINK_BAUD: _Service.ValueType  # 117
+    """Negotiate the RPC link baud rate"""
+    SVC_GROUP_COMMAND: _Service.ValueType  # 118
+    """Scheduled command broadcast to a group of nodes"""
 
 class Service(_Service, metaclass=_ServiceEnumTypeWrapper):
     """System services that are available to all nodes in the network."""
@@ -68,6 +88,24 @@ SVC_PDI_WRITE: Service.ValueType  # 108
 """Write PDI data to the node"""
 SVC_SYSTEM_STATUS: Service.ValueType  # 109
 """Get the system status"""
+SVC_BOOT_TIMELINE: Service.ValueType  # 110
+"""Read the boot timeline profile"""
+SVC_CAL_WRITE: Service.ValueType  # 111
+"""Bulk write calibration data"""
+SVC_FLASH_STATS: Service.ValueType  # 112
+"""Read the NOR flash wear and latency statistics"""
+SVC_LOG_QUERY: Service.ValueType  # 113
+"""Read stored logs filtered by time and level"""
+SVC_FLIGHT_RECORDER: Service.ValueType  # 114
+"""Read or rearm the fault flight recorder"""
+SVC_TELEMETRY: Service.ValueType  # 115
+"""Subscribe to streamed sensor telemetry"""
+SVC_SENSOR_BATCH: Service.ValueType  # 116
+"""Read several sensor values at once"""
+SVC_LINK_BAUD: Service.ValueType  # 117
+"""Negotiate the RPC link baud rate"""
+SVC_GROUP_COMMAND: Service.ValueType  # 118
+"""Scheduled command broadcast to a group of nodes"""
 global___Service = Service
 
 class _Message:
@@ -108,6 +146,50 @@ class _MessageEnumTypeWrapper(google.protobuf.internal.enum_type_wrapper._EnumTy
     """Request the system status"""
     MSG_SYSTEM_STATUS_RSP: _Message.ValueType  # 119
     """Response to the GetSysStatusRequest message"""
+    MSG_BOOT_TIMELINE_REQ: _Message.ValueType  # 120
+    """Request a page of the boot timeline"""
+    MSG_BOOT_TIMELINE_RSP: _Message.ValueType  # 121
+    """Response to the BootTimelineRequest message"""
+    MSG_CAL_WRITE_REQ: _Message.ValueType  # 122
+    """Request to write a set of calibrations"""
+    MSG_CAL_WRITE_RSP: _Message.ValueType  # 123
+    """Response to the CalWriteRequest message"""
+    MSG_FLASH_STATS_REQ: _Message.ValueType  # 124
+    """Request a page of the flash statistics"""
+    MSG_FLASH_STATS_RSP: _Message.ValueType  # 125
+    """Response to the FlashStatsRequest message"""
+    MSG_LOG_QUERY_REQ: _Message.ValueType  # 126
+    """Request a page of filtered log records"""
+    MSG_LOG_QUERY_RSP: _Message.ValueType  # 127
+    """Response to the LogQueryRequest message"""
+    MSG_FLIGHT_RECORDER_REQ: _Message.ValueType  # 128
+    """Request a page of the flight recorder capture"""
+    MSG_FLIGHT_RECORDER_RSP: _Message.ValueType  # 129
+    """Response to the FlightRecorderRequest message"""
+    MSG_TELEMETRY_SUB_REQ: _Message.ValueType  # 130
+    """Request to change the telemetry subscription"""
+    MSG_TELEMETRY_SUB_RSP: _Message.ValueType  # 131
+    """Response to the TelemetrySubscribeRequest message"""
+    MSG_SENSOR_BATCH_REQ: _Message.ValueType  # 132
+    """Request to read a set of sensor values"""
+    MSG_SENSOR_BATCH_RSP: _Message.ValueType  # 133
+    """Response to the SensorBatchRequest message"""
+    MSG_LINK_BAUD_REQ: _Message.ValueType  # 134
+    """Request to change the RPC link baud rate"""
+    MSG_LINK_BAUD_RSP: _Message.ValueType  # 135
+    """Response to the LinkBaudRequest message"""
+    MSG_LTC_REG_GET_REQ: _Message.ValueType  # 136
+    """Request to read LTC7871 registers"""
+    MSG_LTC_REG_GET_RSP: _Message.ValueType  # 137
+    """Response to the LTCRegGetRequest message"""
+    MSG_LTC_REG_SET_REQ: _Message.ValueType  # 138
+    """Request to write an LTC7871 register"""
+    MSG_LTC_REG_SET_RSP: _Message.ValueType  # 139
+    """Response to the LTCRegSetRequest message"""
+    MSG_GROUP_CMD_REQ: _Message.ValueType  # 140
+    """Request to schedule a command on a group of nodes"""
+    MSG_GROUP_CMD_RSP: _Message.ValueType  # 141
+    """Response to the GroupCommandRequest message"""
 
 class Message(_Message, metaclass=_MessageEnumTypeWrapper):
     """Message types available. These start at 100 to avoid conflicts with the
@@ -146,6 +228,50 @@ MSG_SYSTEM_STATUS_REQ: Message.ValueType  # 118
 """Request the system status"""
 MSG_SYSTEM_STATUS_RSP: Message.ValueType  # 119
 """Response to the GetSysStatusRequest message"""
+MSG_BOOT_TIMELINE_REQ: Message.ValueType  # 120
+"""Request a page of the boot timeline"""
+MSG_BOOT_TIMELINE_RSP: Message.ValueType  # 121
+"""Response to the BootTimelineRequest message"""
+MSG_CAL_WRITE_REQ: Message.ValueType  # 122
+"""Request to write a set of calibrations"""
+MSG_CAL_WRITE_RSP: Message.ValueType  # 123
+"""Response to the CalWriteRequest message"""
+MSG_FLASH_STATS_REQ: Message.ValueType  # 124
+"""Request a page of the flash statistics"""
+MSG_FLASH_STATS_RSP: Message.ValueType  # 125
+"""Response to the FlashStatsRequest message"""
+MSG_LOG_QUERY_REQ: Message.ValueType  # 126
+"""Request a page of filtered log records"""
+MSG_LOG_QUERY_RSP: Message.ValueType  # 127
+"""Response to the LogQueryRequest message"""
+MSG_FLIGHT_RECORDER_REQ: Message.ValueType  # 128
+"""Request a page of the flight recorder capture"""
+MSG_FLIGHT_RECORDER_RSP: Message.ValueType  # 129
+"""Response to the FlightRecorderRequest message"""
+MSG_TELEMETRY_SUB_REQ: Message.ValueType  # 130
+"""Request to change the telemetry subscription"""
+MSG_TELEMETRY_SUB_RSP: Message.ValueType  # 131
+"""Response to the TelemetrySubscribeRequest message"""
+MSG_SENSOR_BATCH_REQ: Message.ValueType  # 132
+"""Request to read a set of sensor values"""
+MSG_SENSOR_BATCH_RSP: Message.ValueType  # 133
+"""Response to the SensorBatchRequest message"""
+MSG_LINK_BAUD_REQ: Message.ValueType  # 134
+"""Request to change the RPC link baud rate"""
+MSG_LINK_BAUD_RSP: Message.ValueType  # 135
+"""Response to the LinkBaudRequest message"""
+MSG_LTC_REG_GET_REQ: Message.ValueType  # 136
+"""Request to read LTC7871 registers"""
+MSG_LTC_REG_GET_RSP: Message.ValueType  # 137
+"""Response to the LTCRegGetRequest message"""
+MSG_LTC_REG_SET_REQ: Message.ValueType  # 138
+"""Request to write an LTC7871 register"""
+MSG_LTC_REG_SET_RSP: Message.ValueType  # 139
+"""Response to the LTCRegSetRequest message"""
+MSG_GROUP_CMD_REQ: Message.ValueType  # 140
+"""Request to schedule a command on a group of nodes"""
+MSG_GROUP_CMD_RSP: Message.ValueType  # 141
+"""Response to the GroupCommandRequest message"""
 global___Message = Message
 
 class _MessageVersion:
@@ -170,6 +296,28 @@ class _MessageVersionEnumTypeWrapper(google.protobuf.internal.enum_type_wrapper.
     MSG_VER_PDI_WRITE_RSP: _MessageVersion.ValueType  # 0
     MSG_VER_SYSTEM_STATUS_REQ: _MessageVersion.ValueType  # 0
     MSG_VER_SYSTEM_STATUS_RSP: _MessageVersion.ValueType  # 0
+    MSG_VER_BOOT_TIMELINE_REQ: _MessageVersion.ValueType  # 0
+    MSG_VER_BOOT_TIMELINE_RSP: _MessageVersion.ValueType  # 0
+    MSG_VER_CAL_WRITE_REQ: _MessageVersion.ValueType  # 0
+    MSG_VER_CAL_WRITE_RSP: _MessageVersion.ValueType  # 0
+    MSG_VER_FLASH_STATS_REQ: _MessageVersion.ValueType  # 0
+    MSG_VER_FLASH_STATS_RSP: _MessageVersion.ValueType  # 0
+    MSG_VER_LOG_QUERY_REQ: _MessageVersion.ValueType  # 0
+    MSG_VER_LOG_QUERY_RSP: _MessageVersion.ValueType  # 0
+    MSG_VER_FLIGHT_RECORDER_REQ: _MessageVersion.ValueType  # 0
+    MSG_VER_FLIGHT_RECORDER_RSP: _MessageVersion.ValueType  # 0
+    MSG_VER_TELEMETRY_SUB_REQ: _MessageVersion.ValueType  # 0
+    MSG_VER_TELEMETRY_SUB_RSP: _MessageVersion.ValueType  # 0
+    MSG_VER_SENSOR_BATCH_REQ: _MessageVersion.ValueType  # 0
+    MSG_VER_SENSOR_BATCH_RSP: _MessageVersion.ValueType  # 0
+    MSG_VER_LINK_BAUD_REQ: _MessageVersion.ValueType  # 0
+    MSG_VER_LINK_BAUD_RSP: _MessageVersion.ValueType  # 0
+    MSG_VER_LTC_REG_GET_REQ: _MessageVersion.ValueType  # 0
+    MSG_VER_LTC_REG_GET_RSP: _MessageVersion.ValueType  # 0
+    MSG_VER_LTC_REG_SET_REQ: _MessageVersion.ValueType  # 0
+    MSG_VER_LTC_REG_SET_RSP: _MessageVersion.ValueType  # 0
+    MSG_VER_GROUP_CMD_REQ: _MessageVersion.ValueType  # 0
+    MSG_VER_GROUP_CMD_RSP: _MessageVersion.ValueType  # 0
 
 class MessageVersion(_MessageVersion, metaclass=_MessageVersionEnumTypeWrapper):
     """Version of the message. This is used to ensure that the message is compatible
@@ -192,6 +340,28 @@ MSG_VER_PDI_WRITE_REQ: MessageVersion.ValueType  # 0
 MSG_VER_PDI_WRITE_RSP: MessageVersion.ValueType  # 0
 MSG_VER_SYSTEM_STATUS_REQ: MessageVersion.ValueType  # 0
 MSG_VER_SYSTEM_STATUS_RSP: MessageVersion.ValueType  # 0
+MSG_VER_BOOT_TIMELINE_REQ: MessageVersion.ValueType  # 0
+MSG_VER_BOOT_TIMELINE_RSP: MessageVersion.ValueType  # 0
+MSG_VER_CAL_WRITE_REQ: MessageVersion.ValueType  # 0
+MSG_VER_CAL_WRITE_RSP: MessageVersion.ValueType  # 0
+MSG_VER_FLASH_STATS_REQ: MessageVersion.ValueType  # 0
+MSG_VER_FLASH_STATS_RSP: MessageVersion.ValueType  # 0
+MSG_VER_LOG_QUERY_REQ: MessageVersion.ValueType  # 0
+MSG_VER_LOG_QUERY_RSP: MessageVersion.ValueType  # 0
+MSG_VER_FLIGHT_RECORDER_REQ: MessageVersion.ValueType  # 0
+MSG_VER_FLIGHT_RECORDER_RSP: MessageVersion.ValueType  # 0
+MSG_VER_TELEMETRY_SUB_REQ: MessageVersion.ValueType  # 0
+MSG_VER_TELEMETRY_SUB_RSP: MessageVersion.ValueType  # 0
+MSG_VER_SENSOR_BATCH_REQ: MessageVersion.ValueType  # 0
+MSG_VER_SENSOR_BATCH_RSP: MessageVersion.ValueType  # 0
+MSG_VER_LINK_BAUD_REQ: MessageVersion.ValueType  # 0
+MSG_VER_LINK_BAUD_RSP: MessageVersion.ValueType  # 0
+MSG_VER_LTC_REG_GET_REQ: MessageVersion.ValueType  # 0
+MSG_VER_LTC_REG_GET_RSP: MessageVersion.ValueType  # 0
+MSG_VER_LTC_REG_SET_REQ: MessageVersion.ValueType  # 0
+MSG_VER_LTC_REG_SET_RSP: MessageVersion.ValueType  # 0
+MSG_VER_GROUP_CMD_REQ: MessageVersion.ValueType  # 0
+MSG_VER_GROUP_CMD_RSP: MessageVersion.ValueType  # 0
 global___MessageVersion = MessageVersion
 
 class _ManagerCommand:
@@ -369,6 +539,365 @@ FAULTED: EngageState.ValueType  # 2
 """Power stage faulted"""
 global___EngageState = EngageState
 
+class _BootStepId:
+    ValueType = typing.NewType("ValueType", builtins.int)
+    V: typing_extensions.TypeAlias = ValueType
+
+class _BootStepIdEnumTypeWrapper(google.protobuf.internal.enum_type_wrapper._EnumTypeWrapper[_BootStepId.ValueType], builtins.type):
+    DESCRIPTOR: google.protobuf.descriptor.EnumDescriptor
+    BOOT_STEP_INIT_DRIVERS: _BootStepId.ValueType  # 0
+    """System::Boot::initDrivers"""
+    BOOT_STEP_OSAL: _BootStepId.ValueType  # 1
+    """OSAL, assert and panic handler setup"""
+    BOOT_STEP_BSP: _BootStepId.ValueType  # 2
+    """Board support package power up"""
+    BOOT_STEP_HW_INTF: _BootStepId.ValueType  # 3
+    """mbedutils hardware integration layers"""
+    BOOT_STEP_HW_GPIO: _BootStepId.ValueType  # 4
+    """HW::GPIO::initialize"""
+    BOOT_STEP_HW_LED: _BootStepId.ValueType  # 5
+    """HW::LED::initialize"""
+    BOOT_STEP_HW_ADC: _BootStepId.ValueType  # 6
+    """HW::ADC::initialize"""
+    BOOT_STEP_HW_UART: _BootStepId.ValueType  # 7
+    """HW::UART::initialize"""
+    BOOT_STEP_HW_FAN: _BootStepId.ValueType  # 8
+    """HW::FAN::initialize"""
+    BOOT_STEP_HW_LTC7871: _BootStepId.ValueType  # 9
+    """HW::LTC7871::driver_init"""
+    BOOT_STEP_THREADS: _BootStepId.ValueType  # 10
+    """Threads::initialize"""
+    BOOT_STEP_INIT_TECH: _BootStepId.ValueType  # 11
+    """System::Boot::initTech"""
+    BOOT_STEP_CONTROL: _BootStepId.ValueType  # 12
+    """Control::initialize"""
+    BOOT_STEP_LOGGING: _BootStepId.ValueType  # 13
+    """Logging::initialize"""
+    BOOT_STEP_KVDB_INIT: _BootStepId.ValueType  # 14
+    """System::Database::initialize"""
+    BOOT_STEP_SENSOR: _BootStepId.ValueType  # 15
+    """System::Sensor::initialize"""
+    BOOT_STEP_POST: _BootStepId.ValueType  # 16
+    """System::Boot::runPostInit"""
+    BOOT_STEP_POST_LOGGING: _BootStepId.ValueType  # 17
+    """Logging::postSequence"""
+    BOOT_STEP_POST_LTC7871: _BootStepId.ValueType  # 18
+    """HW::LTC7871::postSequence"""
+    BOOT_STEP_POST_LED: _BootStepId.ValueType  # 19
+    """HW::LED::postSequence"""
+    BOOT_STEP_POST_ADC: _BootStepId.ValueType  # 20
+    """HW::ADC::postSequence"""
+    BOOT_STEP_POST_FAN: _BootStepId.ValueType  # 21
+    """HW::FAN::postSequence"""
+    BOOT_STEP_APP_CONFIG: _BootStepId.ValueType  # 22
+    """App::Config::driver_init"""
+    BOOT_STEP_APP_STATS: _BootStepId.ValueType  # 23
+    """App::Stats::driver_init"""
+    BOOT_STEP_APP_POWER: _BootStepId.ValueType  # 24
+    """App::Power::driver_init"""
+    BOOT_STEP_APP_FILTER: _BootStepId.ValueType  # 25
+    """App::Filter::driver_init"""
+    BOOT_STEP_APP_MONITOR: _BootStepId.ValueType  # 26
+    """App::Monitor::driver_init"""
+    BOOT_STEP_PDI_REGISTER: _BootStepId.ValueType  # 27
+    """PDI key registration. Tag is the PDI_ID."""
+    BOOT_STEP_POST_DEFERRED: _BootStepId.ValueType  # 28
+    """System::Boot::runDeferredPost"""
+    BOOT_STEP_CAL_STORE: _BootStepId.ValueType  # 29
+    """System::CalStore::initialize"""
+    BOOT_STEP_FLASH_STATS: _BootStepId.ValueType  # 30
+    """System::FlashStats::initialize"""
+    BOOT_STEP_APP_GROUP: _BootStepId.ValueType  # 31
+    """App::Group::driver_init"""
+
+class BootStepId(_BootStepId, metaclass=_BootStepIdEnumTypeWrapper):
+    """****************************************************************************
+    Boot Timeline Service
+    ****************************************************************************
+
+    Individual steps of the boot sequence that are timed by the profiler
+    """
+
+BOOT_STEP_INIT_DRIVERS: BootStepId.ValueType  # 0
+"""System::Boot::initDrivers"""
+BOOT_STEP_OSAL: BootStepId.ValueType  # 1
+"""OSAL, assert and panic handler setup"""
+BOOT_STEP_BSP: BootStepId.ValueType  # 2
+"""Board support package power up"""
+BOOT_STEP_HW_INTF: BootStepId.ValueType  # 3
+"""mbedutils hardware integration layers"""
+BOOT_STEP_HW_GPIO: BootStepId.ValueType  # 4
+"""HW::GPIO::initialize"""
+BOOT_STEP_HW_LED: BootStepId.ValueType  # 5
+"""HW::LED::initialize"""
+BOOT_STEP_HW_ADC: BootStepId.ValueType  # 6
+"""HW::ADC::initialize"""
+BOOT_STEP_HW_UART: BootStepId.ValueType  # 7
+"""HW::UART::initialize"""
+BOOT_STEP_HW_FAN: BootStepId.ValueType  # 8
+"""HW::FAN::initialize"""
+BOOT_STEP_HW_LTC7871: BootStepId.ValueType  # 9
+"""HW::LTC7871::driver_init"""
+BOOT_STEP_THREADS: BootStepId.ValueType  # 10
+"""Threads::initialize"""
+BOOT_STEP_INIT_TECH: BootStepId.ValueType  # 11
+"""System::Boot::initTech"""
+BOOT_STEP_CONTROL: BootStepId.ValueType  # 12
+"""Control::initialize"""
+BOOT_STEP_LOGGING: BootStepId.ValueType  # 13
+"""Logging::initialize"""
+BOOT_STEP_KVDB_INIT: BootStepId.ValueType  # 14
+"""System::Database::initialize"""
+BOOT_STEP_SENSOR: BootStepId.ValueType  # 15
+"""System::Sensor::initialize"""
+BOOT_STEP_POST: BootStepId.ValueType  # 16
+"""System::Boot::runPostInit"""
+BOOT_STEP_POST_LOGGING: BootStepId.ValueType  # 17
+"""Logging::postSequence"""
+BOOT_STEP_POST_LTC7871: BootStepId.ValueType  # 18
+"""HW::LTC7871::postSequence"""
+BOOT_STEP_POST_LED: BootStepId.ValueType  # 19
+"""HW::LED::postSequence"""
+BOOT_STEP_POST_ADC: BootStepId.ValueType  # 20
+"""HW::ADC::postSequence"""
+BOOT_STEP_POST_FAN: BootStepId.ValueType  # 21
+"""HW::FAN::postSequence"""
+BOOT_STEP_APP_CONFIG: BootStepId.ValueType  # 22
+"""App::Config::driver_init"""
+BOOT_STEP_APP_STATS: BootStepId.ValueType  # 23
+"""App::Stats::driver_init"""
+BOOT_STEP_APP_POWER: BootStepId.ValueType  # 24
+"""App::Power::driver_init"""
+BOOT_STEP_APP_FILTER: BootStepId.ValueType  # 25
+"""App::Filter::driver_init"""
+BOOT_STEP_APP_MONITOR: BootStepId.ValueType  # 26
+"""App::Monitor::driver_init"""
+BOOT_STEP_PDI_REGISTER: BootStepId.ValueType  # 27
+"""PDI key registration. Tag is the PDI_ID."""
+BOOT_STEP_POST_DEFERRED: BootStepId.ValueType  # 28
+"""System::Boot::runDeferredPost"""
+BOOT_STEP_CAL_STORE: BootStepId.ValueType  # 29
+"""System::CalStore::initialize"""
+BOOT_STEP_FLASH_STATS: BootStepId.ValueType  # 30
+"""System::FlashStats::initialize"""
+BOOT_STEP_APP_GROUP: BootStepId.ValueType  # 31
+"""App::Group::driver_init"""
+global___BootStepId = BootStepId
+
+class _CalibrationId:
+    ValueType = typing.NewType("ValueType", builtins.int)
+    V: typing_extensions.TypeAlias = ValueType
+
+class _CalibrationIdEnumTypeWrapper(google.protobuf.internal.enum_type_wrapper._EnumTypeWrapper[_CalibrationId.ValueType], builtins.type):
+    DESCRIPTOR: google.protobuf.descriptor.EnumDescriptor
+    CAL_OUTPUT_CURRENT: _CalibrationId.ValueType  # 0
+    """Load output current sensor"""
+
+class CalibrationId(_CalibrationId, metaclass=_CalibrationIdEnumTypeWrapper):
+    """****************************************************************************
+    Calibration Write Service
+    ****************************************************************************
+
+    Calibrations held in the dedicated calibration store
+    """
+
+CAL_OUTPUT_CURRENT: CalibrationId.ValueType  # 0
+"""Load output current sensor"""
+global___CalibrationId = CalibrationId
+
+class _FlashOp:
+    ValueType = typing.NewType("ValueType", builtins.int)
+    V: typing_extensions.TypeAlias = ValueType
+
+class _FlashOpEnumTypeWrapper(google.protobuf.internal.enum_type_wrapper._EnumTypeWrapper[_FlashOp.ValueType], builtins.type):
+    DESCRIPTOR: google.protobuf.descriptor.EnumDescriptor
+    FLASH_OP_READ: _FlashOp.ValueType  # 0
+    FLASH_OP_PROGRAM: _FlashOp.ValueType  # 1
+    FLASH_OP_ERASE: _FlashOp.ValueType  # 2
+
+class FlashOp(_FlashOp, metaclass=_FlashOpEnumTypeWrapper):
+    """****************************************************************************
+    Flash Statistics Service
+    ****************************************************************************
+
+    Operations tracked by the flash latency histograms
+    """
+
+FLASH_OP_READ: FlashOp.ValueType  # 0
+FLASH_OP_PROGRAM: FlashOp.ValueType  # 1
+FLASH_OP_ERASE: FlashOp.ValueType  # 2
+global___FlashOp = FlashOp
+
+class _FlightRecorderState:
+    ValueType = typing.NewType("ValueType", builtins.int)
+    V: typing_extensions.TypeAlias = ValueType
+
+class _FlightRecorderStateEnumTypeWrapper(google.protobuf.internal.enum_type_wrapper._EnumTypeWrapper[_FlightRecorderState.ValueType], builtins.type):
+    DESCRIPTOR: google.protobuf.descriptor.EnumDescriptor
+    FR_ARMED: _FlightRecorderState.ValueType  # 0
+    """Recording, waiting on a fault"""
+    FR_TRIGGERED: _FlightRecorderState.ValueType  # 1
+    """Fault seen, filling the post-trigger window"""
+    FR_FROZEN: _FlightRecorderState.ValueType  # 2
+    """Window captured and ready to read"""
+
+class FlightRecorderState(_FlightRecorderState, metaclass=_FlightRecorderStateEnumTypeWrapper):
+    """****************************************************************************
+    Flight Recorder Service
+    ****************************************************************************
+    """
+
+FR_ARMED: FlightRecorderState.ValueType  # 0
+"""Recording, waiting on a fault"""
+FR_TRIGGERED: FlightRecorderState.ValueType  # 1
+"""Fault seen, filling the post-trigger window"""
+FR_FROZEN: FlightRecorderState.ValueType  # 2
+"""Window captured and ready to read"""
+global___FlightRecorderState = FlightRecorderState
+
+class _LinkBaudStatus:
+    ValueType = typing.NewType("ValueType", builtins.int)
+    V: typing_extensions.TypeAlias = ValueType
+
+class _LinkBaudStatusEnumTypeWrapper(google.protobuf.internal.enum_type_wrapper._EnumTypeWrapper[_LinkBaudStatus.ValueType], builtins.type):
+    DESCRIPTOR: google.protobuf.descriptor.EnumDescriptor
+    LINK_BAUD_OK: _LinkBaudStatus.ValueType  # 0
+    """Request accepted"""
+    LINK_BAUD_UNSUPPORTED: _LinkBaudStatus.ValueType  # 1
+    """Rate is not one the node can run at"""
+    LINK_BAUD_BUSY: _LinkBaudStatus.ValueType  # 2
+    """A switch is already in progress or the confirm did not match"""
+
+class LinkBaudStatus(_LinkBaudStatus, metaclass=_LinkBaudStatusEnumTypeWrapper):
+    """****************************************************************************
+    Link Baud Service
+    ****************************************************************************
+    """
+
+LINK_BAUD_OK: LinkBaudStatus.ValueType  # 0
+"""Request accepted"""
+LINK_BAUD_UNSUPPORTED: LinkBaudStatus.ValueType  # 1
+"""Rate is not one the node can run at"""
+LINK_BAUD_BUSY: LinkBaudStatus.ValueType  # 2
+"""A switch is already in progress or the confirm did not match"""
+global___LinkBaudStatus = LinkBaudStatus
+
+class _LTCRegStatus:
+    ValueType = typing.NewType("ValueType", builtins.int)
+    V: typing_extensions.TypeAlias = ValueType
+
+class _LTCRegStatusEnumTypeWrapper(google.protobuf.internal.enum_type_wrapper._EnumTypeWrapper[_LTCRegStatus.ValueType], builtins.type):
+    DESCRIPTOR: google.protobuf.descriptor.EnumDescriptor
+    LTC_REG_OK: _LTCRegStatus.ValueType  # 0
+    """Access completed"""
+    LTC_REG_INVALID_ADDR: _LTCRegStatus.ValueType  # 1
+    """Register is outside the MFR register map"""
+    LTC_REG_READ_ONLY: _LTCRegStatus.ValueType  # 2
+    """Register cannot be written from the host"""
+    LTC_REG_BAD_MODE: _LTCRegStatus.ValueType  # 3
+    """Driver is not in a mode that allows the access"""
+    LTC_REG_BAD_VALUE: _LTCRegStatus.ValueType  # 4
+    """Value sets bits the register does not implement"""
+
+class LTCRegStatus(_LTCRegStatus, metaclass=_LTCRegStatusEnumTypeWrapper):
+    """****************************************************************************
+    LTC7871 Register Services
+    ****************************************************************************
+    """
+
+LTC_REG_OK: LTCRegStatus.ValueType  # 0
+"""Access completed"""
+LTC_REG_INVALID_ADDR: LTCRegStatus.ValueType  # 1
+"""Register is outside the MFR register map"""
+LTC_REG_READ_ONLY: LTCRegStatus.ValueType  # 2
+"""Register cannot be written from the host"""
+LTC_REG_BAD_MODE: LTCRegStatus.ValueType  # 3
+"""Driver is not in a mode that allows the access"""
+LTC_REG_BAD_VALUE: LTCRegStatus.ValueType  # 4
+"""Value sets bits the register does not implement"""
+global___LTCRegStatus = LTCRegStatus
+
+class _GroupAddress:
+    ValueType = typing.NewType("ValueType", builtins.int)
+    V: typing_extensions.TypeAlias = ValueType
+
+class _GroupAddressEnumTypeWrapper(google.protobuf.internal.enum_type_wrapper._EnumTypeWrapper[_GroupAddress.ValueType], builtins.type):
+    DESCRIPTOR: google.protobuf.descriptor.EnumDescriptor
+    GROUP_ID_MAX: _GroupAddress.ValueType  # 31
+    """Highest group a node can join through its PDI membership mask"""
+    GROUP_ID_ALL: _GroupAddress.ValueType  # 255
+    """Reaches every node regardless of membership"""
+
+class GroupAddress(_GroupAddress, metaclass=_GroupAddressEnumTypeWrapper):
+    """****************************************************************************
+    Group Command Service
+    ****************************************************************************
+    """
+
+GROUP_ID_MAX: GroupAddress.ValueType  # 31
+"""Highest group a node can join through its PDI membership mask"""
+GROUP_ID_ALL: GroupAddress.ValueType  # 255
+"""Reaches every node regardless of membership"""
+global___GroupAddress = GroupAddress
+
+class _GroupAction:
+    ValueType = typing.NewType("ValueType", builtins.int)
+    V: typing_extensions.TypeAlias = ValueType
+
+class _GroupActionEnumTypeWrapper(google.protobuf.internal.enum_type_wrapper._EnumTypeWrapper[_GroupAction.ValueType], builtins.type):
+    DESCRIPTOR: google.protobuf.descriptor.EnumDescriptor
+    GROUP_ACTION_SETPOINT: _GroupAction.ValueType  # 0
+    """Apply field and value as a SetpointRequest would"""
+    GROUP_ACTION_ENGAGE_OUTPUT: _GroupAction.ValueType  # 1
+    """Enable power output from the node"""
+    GROUP_ACTION_DISENGAGE_OUTPUT: _GroupAction.ValueType  # 2
+    """Disable power output from the node"""
+    GROUP_ACTION_CANCEL: _GroupAction.ValueType  # 3
+    """Drop the pending command without running it"""
+
+class GroupAction(_GroupAction, metaclass=_GroupActionEnumTypeWrapper): ...
+
+GROUP_ACTION_SETPOINT: GroupAction.ValueType  # 0
+"""Apply field and value as a SetpointRequest would"""
+GROUP_ACTION_ENGAGE_OUTPUT: GroupAction.ValueType  # 1
+"""Enable power output from the node"""
+GROUP_ACTION_DISENGAGE_OUTPUT: GroupAction.ValueType  # 2
+"""Disable power output from the node"""
+GROUP_ACTION_CANCEL: GroupAction.ValueType  # 3
+"""Drop the pending command without running it"""
+global___GroupAction = GroupAction
+
+class _GroupCommandStatus:
+    ValueType = typing.NewType("ValueType", builtins.int)
+    V: typing_extensions.TypeAlias = ValueType
+
+class _GroupCommandStatusEnumTypeWrapper(google.protobuf.internal.enum_type_wrapper._EnumTypeWrapper[_GroupCommandStatus.ValueType], builtins.type):
+    DESCRIPTOR: google.protobuf.descriptor.EnumDescriptor
+    GROUP_CMD_OK: _GroupCommandStatus.ValueType  # 0
+    """Command is scheduled"""
+    GROUP_CMD_INVALID: _GroupCommandStatus.ValueType  # 1
+    """Action or setpoint field is not supported"""
+    GROUP_CMD_BAD_DELAY: _GroupCommandStatus.ValueType  # 2
+    """Delay is outside the range the node can schedule"""
+    GROUP_CMD_LATE: _GroupCommandStatus.ValueType  # 3
+    """Node processed the frame after the execution time"""
+    GROUP_CMD_BAD_VALUE: _GroupCommandStatus.ValueType  # 4
+    """Setpoint value is outside what the node accepts"""
+
+class GroupCommandStatus(_GroupCommandStatus, metaclass=_GroupCommandStatusEnumTypeWrapper): ...
+
+GROUP_CMD_OK: GroupCommandStatus.ValueType  # 0
+"""Command is scheduled"""
+GROUP_CMD_INVALID: GroupCommandStatus.ValueType  # 1
+"""Action or setpoint field is not supported"""
+GROUP_CMD_BAD_DELAY: GroupCommandStatus.ValueType  # 2
+"""Delay is outside the range the node can schedule"""
+GROUP_CMD_LATE: GroupCommandStatus.ValueType  # 3
+"""Node processed the frame after the execution time"""
+GROUP_CMD_BAD_VALUE: GroupCommandStatus.ValueType  # 4
+"""Setpoint value is outside what the node accepts"""
+global___GroupCommandStatus = GroupCommandStatus
+
 @typing.final
 class PingNodeRequest(google.protobuf.message.Message):
     """****************************************************************************
@@ -620,6 +1149,68 @@ class SensorResponse(google.protobuf.message.Message):
 
 global___SensorResponse = SensorResponse
 
+@typing.final
+class SensorBatchRequest(google.protobuf.message.Message):
+    """Reads every sensor with its bit set in sensor_mask (bit N is SensorType N)."""
+
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    HEADER_FIELD_NUMBER: builtins.int
+    NODE_ID_FIELD_NUMBER: builtins.int
+    SENSOR_MASK_FIELD_NUMBER: builtins.int
+    node_id: builtins.int
+    sensor_mask: builtins.int
+    @property
+    def header(self) -> mbed_rpc_pb2.Header: ...
+    def __init__(
+        self,
+        *,
+        header: mbed_rpc_pb2.Header | None = ...,
+        node_id: builtins.int | None = ...,
+        sensor_mask: builtins.int | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["header", b"header", "node_id", b"node_id", "sensor_mask", b"sensor_mask"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["header", b"header", "node_id", b"node_id", "sensor_mask", b"sensor_mask"]) -> None: ...
+
+global___SensorBatchRequest = SensorBatchRequest
+
+@typing.final
+class SensorBatchResponse(google.protobuf.message.Message):
+    """Values are in order of increasing SensorType, one per bit set in
+    sensor_mask. All of them come from the same monitor pass, taken at
+    timestamp. Unsupported sensors are dropped from the mask and flagged with
+    ERR_SENSOR_NOT_SUPPORTED.
+    """
+
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    HEADER_FIELD_NUMBER: builtins.int
+    STATUS_FIELD_NUMBER: builtins.int
+    SENSOR_MASK_FIELD_NUMBER: builtins.int
+    TIMESTAMP_FIELD_NUMBER: builtins.int
+    VALUES_FIELD_NUMBER: builtins.int
+    status: global___SensorError.ValueType
+    sensor_mask: builtins.int
+    timestamp: builtins.int
+    """System time in milliseconds of the sample"""
+    @property
+    def header(self) -> mbed_rpc_pb2.Header: ...
+    @property
+    def values(self) -> google.protobuf.internal.containers.RepeatedScalarFieldContainer[builtins.float]: ...
+    def __init__(
+        self,
+        *,
+        header: mbed_rpc_pb2.Header | None = ...,
+        status: global___SensorError.ValueType | None = ...,
+        sensor_mask: builtins.int | None = ...,
+        timestamp: builtins.int | None = ...,
+        values: collections.abc.Iterable[builtins.float] | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["header", b"header", "sensor_mask", b"sensor_mask", "status", b"status", "timestamp", b"timestamp"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["header", b"header", "sensor_mask", b"sensor_mask", "status", b"status", "timestamp", b"timestamp", "values", b"values"]) -> None: ...
+
+global___SensorBatchResponse = SensorBatchResponse
+
 @typing.final
 class PDIReadRequest(google.protobuf.message.Message):
     """****************************************************************************
@@ -742,6 +1333,39 @@ class SystemStatusRequest(google.protobuf.message.Message):
 
 global___SystemStatusRequest = SystemStatusRequest
 
+@typing.final
+class TxQueueStats(google.protobuf.message.Message):
+    """Transmit queue of one priority class. Entries of SystemStatusResponse
+    are in priority order: telemetry, then bulk logs.
+    """
+
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    DEPTH_FIELD_NUMBER: builtins.int
+    HIGH_WATER_FIELD_NUMBER: builtins.int
+    SENT_FIELD_NUMBER: builtins.int
+    DROPPED_FIELD_NUMBER: builtins.int
+    depth: builtins.int
+    """Messages waiting to be sent"""
+    high_water: builtins.int
+    """Deepest the queue has been"""
+    sent: builtins.int
+    """Messages sent"""
+    dropped: builtins.int
+    """Messages lost to a full queue"""
+    def __init__(
+        self,
+        *,
+        depth: builtins.int | None = ...,
+        high_water: builtins.int | None = ...,
+        sent: builtins.int | None = ...,
+        dropped: builtins.int | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["depth", b"depth", "dropped", b"dropped", "high_water", b"high_water", "sent", b"sent"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["depth", b"depth", "dropped", b"dropped", "high_water", b"high_water", "sent", b"sent"]) -> None: ...
+
+global___TxQueueStats = TxQueueStats
+
 @typing.final
 class SystemStatusResponse(google.protobuf.message.Message):
     DESCRIPTOR: google.protobuf.descriptor.Descriptor
@@ -749,20 +1373,865 @@ class SystemStatusResponse(google.protobuf.message.Message):
     HEADER_FIELD_NUMBER: builtins.int
     TIMESTAMP_FIELD_NUMBER: builtins.int
     OUTPUT_STATE_FIELD_NUMBER: builtins.int
+    TX_QUEUES_FIELD_NUMBER: builtins.int
     timestamp: builtins.int
     """System time in ms"""
     output_state: global___EngageState.ValueType
     """Power stage output state"""
     @property
     def header(self) -> mbed_rpc_pb2.Header: ...
+    @property
+    def tx_queues(self) -> google.protobuf.internal.containers.RepeatedCompositeFieldContainer[global___TxQueueStats]:
+        """TODO: Asserts/fault counters"""
+
     def __init__(
         self,
         *,
         header: mbed_rpc_pb2.Header | None = ...,
         timestamp: builtins.int | None = ...,
         output_state: global___EngageState.ValueType | None = ...,
+        tx_queues: collections.abc.Iterable[global___TxQueueStats] | None = ...,
     ) -> None: ...
     def HasField(self, field_name: typing.Literal["header", b"header", "output_state", b"output_state", "timestamp", b"timestamp"]) -> builtins.bool: ...
-    def ClearField(self, field_name: typing.Literal["header", b"header", "output_state", b"output_state", "timestamp", b"timestamp"]) -> None: ...
+    def ClearField(self, field_name: typing.Literal["header", b"header", "output_state", b"output_state", "timestamp", b"timestamp", "tx_queues", b"tx_queues"]) -> None: ...
 
 global___SystemStatusResponse = SystemStatusResponse
+
+@typing.final
+class BootStep(google.protobuf.message.Message):
+    """A single timed step in the boot sequence"""
+
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    STEP_FIELD_NUMBER: builtins.int
+    DEPTH_FIELD_NUMBER: builtins.int
+    TAG_FIELD_NUMBER: builtins.int
+    START_US_FIELD_NUMBER: builtins.int
+    DURATION_US_FIELD_NUMBER: builtins.int
+    step: global___BootStepId.ValueType
+    depth: builtins.int
+    """Nesting level of the step"""
+    tag: builtins.int
+    """Step specific tag, ie PDI_ID"""
+    start_us: builtins.int
+    """Start time since power on in us"""
+    duration_us: builtins.int
+    """Time spent in the step in us"""
+    def __init__(
+        self,
+        *,
+        step: global___BootStepId.ValueType | None = ...,
+        depth: builtins.int | None = ...,
+        tag: builtins.int | None = ...,
+        start_us: builtins.int | None = ...,
+        duration_us: builtins.int | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["depth", b"depth", "duration_us", b"duration_us", "start_us", b"start_us", "step", b"step", "tag", b"tag"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["depth", b"depth", "duration_us", b"duration_us", "start_us", b"start_us", "step", b"step", "tag", b"tag"]) -> None: ...
+
+global___BootStep = BootStep
+
+@typing.final
+class BootTimelineRequest(google.protobuf.message.Message):
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    HEADER_FIELD_NUMBER: builtins.int
+    NODE_ID_FIELD_NUMBER: builtins.int
+    OFFSET_FIELD_NUMBER: builtins.int
+    node_id: builtins.int
+    offset: builtins.int
+    """First step index to return"""
+    @property
+    def header(self) -> mbed_rpc_pb2.Header: ...
+    def __init__(
+        self,
+        *,
+        header: mbed_rpc_pb2.Header | None = ...,
+        node_id: builtins.int | None = ...,
+        offset: builtins.int | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["header", b"header", "node_id", b"node_id", "offset", b"offset"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["header", b"header", "node_id", b"node_id", "offset", b"offset"]) -> None: ...
+
+global___BootTimelineRequest = BootTimelineRequest
+
+@typing.final
+class BootTimelineResponse(google.protobuf.message.Message):
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    HEADER_FIELD_NUMBER: builtins.int
+    TOTAL_FIELD_NUMBER: builtins.int
+    OFFSET_FIELD_NUMBER: builtins.int
+    COMPLETE_FIELD_NUMBER: builtins.int
+    STEPS_FIELD_NUMBER: builtins.int
+    total: builtins.int
+    """Total steps recorded this boot"""
+    offset: builtins.int
+    """Index of the first step returned"""
+    complete: builtins.bool
+    """Boot sequence finished"""
+    @property
+    def header(self) -> mbed_rpc_pb2.Header: ...
+    @property
+    def steps(self) -> google.protobuf.internal.containers.RepeatedCompositeFieldContainer[global___BootStep]: ...
+    def __init__(
+        self,
+        *,
+        header: mbed_rpc_pb2.Header | None = ...,
+        total: builtins.int | None = ...,
+        offset: builtins.int | None = ...,
+        complete: builtins.bool | None = ...,
+        steps: collections.abc.Iterable[global___BootStep] | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["complete", b"complete", "header", b"header", "offset", b"offset", "total", b"total"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["complete", b"complete", "header", b"header", "offset", b"offset", "steps", b"steps", "total", b"total"]) -> None: ...
+
+global___BootTimelineResponse = BootTimelineResponse
+
+@typing.final
+class CalibrationEntry(google.protobuf.message.Message):
+    """Linear calibration for a single sensor: y = gain * x - offset"""
+
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    ID_FIELD_NUMBER: builtins.int
+    OFFSET_FIELD_NUMBER: builtins.int
+    GAIN_FIELD_NUMBER: builtins.int
+    VALID_MIN_FIELD_NUMBER: builtins.int
+    VALID_MAX_FIELD_NUMBER: builtins.int
+    id: global___CalibrationId.ValueType
+    offset: builtins.float
+    gain: builtins.float
+    valid_min: builtins.float
+    """Minimum valid calibrated value"""
+    valid_max: builtins.float
+    """Maximum valid calibrated value"""
+    def __init__(
+        self,
+        *,
+        id: global___CalibrationId.ValueType | None = ...,
+        offset: builtins.float | None = ...,
+        gain: builtins.float | None = ...,
+        valid_min: builtins.float | None = ...,
+        valid_max: builtins.float | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["gain", b"gain", "id", b"id", "offset", b"offset", "valid_max", b"valid_max", "valid_min", b"valid_min"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["gain", b"gain", "id", b"id", "offset", b"offset", "valid_max", b"valid_max", "valid_min", b"valid_min"]) -> None: ...
+
+global___CalibrationEntry = CalibrationEntry
+
+@typing.final
+class CalWriteRequest(google.protobuf.message.Message):
+    """Write a set of calibrations in one shot. The entries are committed to flash
+    as a single record, so either all of them take effect or none do.
+    """
+
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    HEADER_FIELD_NUMBER: builtins.int
+    NODE_ID_FIELD_NUMBER: builtins.int
+    ENTRIES_FIELD_NUMBER: builtins.int
+    node_id: builtins.int
+    @property
+    def header(self) -> mbed_rpc_pb2.Header: ...
+    @property
+    def entries(self) -> google.protobuf.internal.containers.RepeatedCompositeFieldContainer[global___CalibrationEntry]: ...
+    def __init__(
+        self,
+        *,
+        header: mbed_rpc_pb2.Header | None = ...,
+        node_id: builtins.int | None = ...,
+        entries: collections.abc.Iterable[global___CalibrationEntry] | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["header", b"header", "node_id", b"node_id"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["entries", b"entries", "header", b"header", "node_id", b"node_id"]) -> None: ...
+
+global___CalWriteRequest = CalWriteRequest
+
+@typing.final
+class CalWriteResponse(google.protobuf.message.Message):
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    HEADER_FIELD_NUMBER: builtins.int
+    SUCCESS_FIELD_NUMBER: builtins.int
+    MESSAGE_FIELD_NUMBER: builtins.int
+    success: builtins.bool
+    message: builtins.str
+    @property
+    def header(self) -> mbed_rpc_pb2.Header: ...
+    def __init__(
+        self,
+        *,
+        header: mbed_rpc_pb2.Header | None = ...,
+        success: builtins.bool | None = ...,
+        message: builtins.str | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["header", b"header", "message", b"message", "success", b"success"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["header", b"header", "message", b"message", "success", b"success"]) -> None: ...
+
+global___CalWriteResponse = CalWriteResponse
+
+@typing.final
+class FlashLatencyHistogram(google.protobuf.message.Message):
+    """Log2 latency histogram. Bucket 0 counts ops under 2us, bucket N counts ops
+    in [2^N, 2^(N+1)) us and the last bucket catches everything slower.
+    """
+
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    OP_FIELD_NUMBER: builtins.int
+    BUCKETS_FIELD_NUMBER: builtins.int
+    op: global___FlashOp.ValueType
+    @property
+    def buckets(self) -> google.protobuf.internal.containers.RepeatedScalarFieldContainer[builtins.int]: ...
+    def __init__(
+        self,
+        *,
+        op: global___FlashOp.ValueType | None = ...,
+        buckets: collections.abc.Iterable[builtins.int] | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["op", b"op"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["buckets", b"buckets", "op", b"op"]) -> None: ...
+
+global___FlashLatencyHistogram = FlashLatencyHistogram
+
+@typing.final
+class FlashStatsRequest(google.protobuf.message.Message):
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    HEADER_FIELD_NUMBER: builtins.int
+    NODE_ID_FIELD_NUMBER: builtins.int
+    SECTOR_OFFSET_FIELD_NUMBER: builtins.int
+    node_id: builtins.int
+    sector_offset: builtins.int
+    """First sector erase count to return"""
+    @property
+    def header(self) -> mbed_rpc_pb2.Header: ...
+    def __init__(
+        self,
+        *,
+        header: mbed_rpc_pb2.Header | None = ...,
+        node_id: builtins.int | None = ...,
+        sector_offset: builtins.int | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["header", b"header", "node_id", b"node_id", "sector_offset", b"sector_offset"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["header", b"header", "node_id", b"node_id", "sector_offset", b"sector_offset"]) -> None: ...
+
+global___FlashStatsRequest = FlashStatsRequest
+
+@typing.final
+class FlashStatsResponse(google.protobuf.message.Message):
+    """Lifetime totals and histograms are repeated in every page. The per-sector
+    erase counts are paged, starting from the requested sector.
+    """
+
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    HEADER_FIELD_NUMBER: builtins.int
+    BYTES_READ_FIELD_NUMBER: builtins.int
+    BYTES_PROGRAMMED_FIELD_NUMBER: builtins.int
+    READ_OPS_FIELD_NUMBER: builtins.int
+    PROGRAM_OPS_FIELD_NUMBER: builtins.int
+    ERASE_OPS_FIELD_NUMBER: builtins.int
+    NUM_SECTORS_FIELD_NUMBER: builtins.int
+    SECTOR_OFFSET_FIELD_NUMBER: builtins.int
+    ERASE_COUNTS_FIELD_NUMBER: builtins.int
+    LATENCY_FIELD_NUMBER: builtins.int
+    bytes_read: builtins.int
+    bytes_programmed: builtins.int
+    read_ops: builtins.int
+    program_ops: builtins.int
+    erase_ops: builtins.int
+    num_sectors: builtins.int
+    """Sectors with erase counters"""
+    sector_offset: builtins.int
+    """Sector of the first erase count"""
+    @property
+    def header(self) -> mbed_rpc_pb2.Header: ...
+    @property
+    def erase_counts(self) -> google.protobuf.internal.containers.RepeatedScalarFieldContainer[builtins.int]: ...
+    @property
+    def latency(self) -> google.protobuf.internal.containers.RepeatedCompositeFieldContainer[global___FlashLatencyHistogram]: ...
+    def __init__(
+        self,
+        *,
+        header: mbed_rpc_pb2.Header | None = ...,
+        bytes_read: builtins.int | None = ...,
+        bytes_programmed: builtins.int | None = ...,
+        read_ops: builtins.int | None = ...,
+        program_ops: builtins.int | None = ...,
+        erase_ops: builtins.int | None = ...,
+        num_sectors: builtins.int | None = ...,
+        sector_offset: builtins.int | None = ...,
+        erase_counts: collections.abc.Iterable[builtins.int] | None = ...,
+        latency: collections.abc.Iterable[global___FlashLatencyHistogram] | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["bytes_programmed", b"bytes_programmed", "bytes_read", b"bytes_read", "erase_ops", b"erase_ops", "header", b"header", "num_sectors", b"num_sectors", "program_ops", b"program_ops", "read_ops", b"read_ops", "sector_offset", b"sector_offset"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["bytes_programmed", b"bytes_programmed", "bytes_read", b"bytes_read", "erase_counts", b"erase_counts", "erase_ops", b"erase_ops", "header", b"header", "latency", b"latency", "num_sectors", b"num_sectors", "program_ops", b"program_ops", "read_ops", b"read_ops", "sector_offset", b"sector_offset"]) -> None: ...
+
+global___FlashStatsResponse = FlashStatsResponse
+
+@typing.final
+class LogQueryRequest(google.protobuf.message.Message):
+    """****************************************************************************
+    Log Query Service
+    ****************************************************************************
+
+    Times are in log time, milliseconds on a clock that keeps counting across
+    reboots. Each response reports the node's current log time so the host can
+    convert. Continue a query by sending the next_time and skip values from the
+    previous response as start_time and skip.
+    """
+
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    HEADER_FIELD_NUMBER: builtins.int
+    NODE_ID_FIELD_NUMBER: builtins.int
+    START_TIME_FIELD_NUMBER: builtins.int
+    END_TIME_FIELD_NUMBER: builtins.int
+    LAST_MS_FIELD_NUMBER: builtins.int
+    MIN_LEVEL_FIELD_NUMBER: builtins.int
+    MAX_COUNT_FIELD_NUMBER: builtins.int
+    SKIP_FIELD_NUMBER: builtins.int
+    node_id: builtins.int
+    start_time: builtins.int
+    """Oldest record to return"""
+    end_time: builtins.int
+    """Newest record to return, 0 for now"""
+    last_ms: builtins.int
+    """If non-zero, overrides start/end with the last N ms"""
+    min_level: builtins.int
+    """mb::logging::Level"""
+    max_count: builtins.int
+    """Records to return, 0 for as many as fit"""
+    skip: builtins.int
+    """Matches at start_time already received"""
+    @property
+    def header(self) -> mbed_rpc_pb2.Header: ...
+    def __init__(
+        self,
+        *,
+        header: mbed_rpc_pb2.Header | None = ...,
+        node_id: builtins.int | None = ...,
+        start_time: builtins.int | None = ...,
+        end_time: builtins.int | None = ...,
+        last_ms: builtins.int | None = ...,
+        min_level: builtins.int | None = ...,
+        max_count: builtins.int | None = ...,
+        skip: builtins.int | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["end_time", b"end_time", "header", b"header", "last_ms", b"last_ms", "max_count", b"max_count", "min_level", b"min_level", "node_id", b"node_id", "skip", b"skip", "start_time", b"start_time"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["end_time", b"end_time", "header", b"header", "last_ms", b"last_ms", "max_count", b"max_count", "min_level", b"min_level", "node_id", b"node_id", "skip", b"skip", "start_time", b"start_time"]) -> None: ...
+
+global___LogQueryRequest = LogQueryRequest
+
+@typing.final
+class LogQueryResponse(google.protobuf.message.Message):
+    """Records are packed into data back to back. Each one is a 4 byte little
+    endian offset from base_time, a one byte log level, a one byte length, then
+    that many bytes of the message.
+    """
+
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    HEADER_FIELD_NUMBER: builtins.int
+    NOW_FIELD_NUMBER: builtins.int
+    BASE_TIME_FIELD_NUMBER: builtins.int
+    COUNT_FIELD_NUMBER: builtins.int
+    MORE_FIELD_NUMBER: builtins.int
+    NEXT_TIME_FIELD_NUMBER: builtins.int
+    SKIP_FIELD_NUMBER: builtins.int
+    DATA_FIELD_NUMBER: builtins.int
+    now: builtins.int
+    """Current log time on the node"""
+    base_time: builtins.int
+    """Time the record offsets are relative to"""
+    count: builtins.int
+    """Records in data"""
+    more: builtins.bool
+    """Matches remain past this page"""
+    next_time: builtins.int
+    """Start time to continue the query from"""
+    skip: builtins.int
+    """Skip value to continue the query with"""
+    data: builtins.bytes
+    @property
+    def header(self) -> mbed_rpc_pb2.Header: ...
+    def __init__(
+        self,
+        *,
+        header: mbed_rpc_pb2.Header | None = ...,
+        now: builtins.int | None = ...,
+        base_time: builtins.int | None = ...,
+        count: builtins.int | None = ...,
+        more: builtins.bool | None = ...,
+        next_time: builtins.int | None = ...,
+        skip: builtins.int | None = ...,
+        data: builtins.bytes | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["base_time", b"base_time", "count", b"count", "data", b"data", "header", b"header", "more", b"more", "next_time", b"next_time", "now", b"now", "skip", b"skip"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["base_time", b"base_time", "count", b"count", "data", b"data", "header", b"header", "more", b"more", "next_time", b"next_time", "now", b"now", "skip", b"skip"]) -> None: ...
+
+global___LogQueryResponse = LogQueryResponse
+
+@typing.final
+class FlightSample(google.protobuf.message.Message):
+    """Channels below the sensor count are SensorType values. The next three are
+    the LTC output voltage setpoint, current setpoint and fault bits.
+    """
+
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    TIME_FIELD_NUMBER: builtins.int
+    CHANNEL_FIELD_NUMBER: builtins.int
+    RAW_FIELD_NUMBER: builtins.int
+    VALUE_FIELD_NUMBER: builtins.int
+    time: builtins.int
+    """System time in milliseconds"""
+    channel: builtins.int
+    raw: builtins.float
+    """Measurement or requested setpoint"""
+    value: builtins.float
+    """Filter output or programmed register code"""
+    def __init__(
+        self,
+        *,
+        time: builtins.int | None = ...,
+        channel: builtins.int | None = ...,
+        raw: builtins.float | None = ...,
+        value: builtins.float | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["channel", b"channel", "raw", b"raw", "time", b"time", "value", b"value"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["channel", b"channel", "raw", b"raw", "time", b"time", "value", b"value"]) -> None: ...
+
+global___FlightSample = FlightSample
+
+@typing.final
+class FlightRecorderRequest(google.protobuf.message.Message):
+    """Read the capture a page at a time by advancing offset. Setting rearm
+    discards the capture after this page is filled.
+    """
+
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    HEADER_FIELD_NUMBER: builtins.int
+    NODE_ID_FIELD_NUMBER: builtins.int
+    OFFSET_FIELD_NUMBER: builtins.int
+    REARM_FIELD_NUMBER: builtins.int
+    PRE_TRIGGER_FIELD_NUMBER: builtins.int
+    POST_TRIGGER_FIELD_NUMBER: builtins.int
+    PERSIST_FIELD_NUMBER: builtins.int
+    node_id: builtins.int
+    offset: builtins.int
+    """First sample of the window to return"""
+    rearm: builtins.bool
+    """Start recording again"""
+    pre_trigger: builtins.int
+    """New pre-trigger depth on rearm, 0 to keep"""
+    post_trigger: builtins.int
+    """New post-trigger depth on rearm, 0 to keep"""
+    persist: builtins.bool
+    """Write future captures to the log store, applied on rearm"""
+    @property
+    def header(self) -> mbed_rpc_pb2.Header: ...
+    def __init__(
+        self,
+        *,
+        header: mbed_rpc_pb2.Header | None = ...,
+        node_id: builtins.int | None = ...,
+        offset: builtins.int | None = ...,
+        rearm: builtins.bool | None = ...,
+        pre_trigger: builtins.int | None = ...,
+        post_trigger: builtins.int | None = ...,
+        persist: builtins.bool | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["header", b"header", "node_id", b"node_id", "offset", b"offset", "persist", b"persist", "post_trigger", b"post_trigger", "pre_trigger", b"pre_trigger", "rearm", b"rearm"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["header", b"header", "node_id", b"node_id", "offset", b"offset", "persist", b"persist", "post_trigger", b"post_trigger", "pre_trigger", b"pre_trigger", "rearm", b"rearm"]) -> None: ...
+
+global___FlightRecorderRequest = FlightRecorderRequest
+
+@typing.final
+class FlightRecorderResponse(google.protobuf.message.Message):
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    HEADER_FIELD_NUMBER: builtins.int
+    STATE_FIELD_NUMBER: builtins.int
+    TRIGGER_CODE_FIELD_NUMBER: builtins.int
+    TRIGGER_TIME_FIELD_NUMBER: builtins.int
+    TOTAL_FIELD_NUMBER: builtins.int
+    TRIGGER_INDEX_FIELD_NUMBER: builtins.int
+    OFFSET_FIELD_NUMBER: builtins.int
+    SAMPLES_FIELD_NUMBER: builtins.int
+    state: global___FlightRecorderState.ValueType
+    trigger_code: builtins.int
+    """Panic error code that froze the capture"""
+    trigger_time: builtins.int
+    """System time of the trigger"""
+    total: builtins.int
+    """Samples in the captured window"""
+    trigger_index: builtins.int
+    """Window index of the first post-trigger sample"""
+    offset: builtins.int
+    """Window index of the first sample in this page"""
+    @property
+    def header(self) -> mbed_rpc_pb2.Header: ...
+    @property
+    def samples(self) -> google.protobuf.internal.containers.RepeatedCompositeFieldContainer[global___FlightSample]: ...
+    def __init__(
+        self,
+        *,
+        header: mbed_rpc_pb2.Header | None = ...,
+        state: global___FlightRecorderState.ValueType | None = ...,
+        trigger_code: builtins.int | None = ...,
+        trigger_time: builtins.int | None = ...,
+        total: builtins.int | None = ...,
+        trigger_index: builtins.int | None = ...,
+        offset: builtins.int | None = ...,
+        samples: collections.abc.Iterable[global___FlightSample] | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["header", b"header", "offset", b"offset", "state", b"state", "total", b"total", "trigger_code", b"trigger_code", "trigger_index", b"trigger_index", "trigger_time", b"trigger_time"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["header", b"header", "offset", b"offset", "samples", b"samples", "state", b"state", "total", b"total", "trigger_code", b"trigger_code", "trigger_index", b"trigger_index", "trigger_time", b"trigger_time"]) -> None: ...
+
+global___FlightRecorderResponse = FlightRecorderResponse
+
+@typing.final
+class TelemetrySubscribeRequest(google.protobuf.message.Message):
+    """****************************************************************************
+    Telemetry Service
+    ****************************************************************************
+
+    Replaces the node's single telemetry subscription. Frames are then pushed
+    as async Telemetry messages until a request with an empty mask stops them.
+    """
+
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    HEADER_FIELD_NUMBER: builtins.int
+    NODE_ID_FIELD_NUMBER: builtins.int
+    SENSOR_MASK_FIELD_NUMBER: builtins.int
+    PERIOD_MS_FIELD_NUMBER: builtins.int
+    DEADBAND_FIELD_NUMBER: builtins.int
+    KEYFRAME_MS_FIELD_NUMBER: builtins.int
+    node_id: builtins.int
+    sensor_mask: builtins.int
+    """Bit per SensorType, 0 to stop"""
+    period_ms: builtins.int
+    """Time between frames"""
+    deadband: builtins.float
+    """Smallest change in a value that gets sent"""
+    keyframe_ms: builtins.int
+    """Time between full frames, 0 for the default"""
+    @property
+    def header(self) -> mbed_rpc_pb2.Header: ...
+    def __init__(
+        self,
+        *,
+        header: mbed_rpc_pb2.Header | None = ...,
+        node_id: builtins.int | None = ...,
+        sensor_mask: builtins.int | None = ...,
+        period_ms: builtins.int | None = ...,
+        deadband: builtins.float | None = ...,
+        keyframe_ms: builtins.int | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["deadband", b"deadband", "header", b"header", "keyframe_ms", b"keyframe_ms", "node_id", b"node_id", "period_ms", b"period_ms", "sensor_mask", b"sensor_mask"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["deadband", b"deadband", "header", b"header", "keyframe_ms", b"keyframe_ms", "node_id", b"node_id", "period_ms", b"period_ms", "sensor_mask", b"sensor_mask"]) -> None: ...
+
+global___TelemetrySubscribeRequest = TelemetrySubscribeRequest
+
+@typing.final
+class TelemetrySubscribeResponse(google.protobuf.message.Message):
+    """Echoes the subscription as applied, after unsupported sensors are dropped
+    and the timing is clamped to what the node can send.
+    """
+
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    HEADER_FIELD_NUMBER: builtins.int
+    SENSOR_MASK_FIELD_NUMBER: builtins.int
+    PERIOD_MS_FIELD_NUMBER: builtins.int
+    DEADBAND_FIELD_NUMBER: builtins.int
+    KEYFRAME_MS_FIELD_NUMBER: builtins.int
+    sensor_mask: builtins.int
+    period_ms: builtins.int
+    deadband: builtins.float
+    keyframe_ms: builtins.int
+    @property
+    def header(self) -> mbed_rpc_pb2.Header: ...
+    def __init__(
+        self,
+        *,
+        header: mbed_rpc_pb2.Header | None = ...,
+        sensor_mask: builtins.int | None = ...,
+        period_ms: builtins.int | None = ...,
+        deadband: builtins.float | None = ...,
+        keyframe_ms: builtins.int | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["deadband", b"deadband", "header", b"header", "keyframe_ms", b"keyframe_ms", "period_ms", b"period_ms", "sensor_mask", b"sensor_mask"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["deadband", b"deadband", "header", b"header", "keyframe_ms", b"keyframe_ms", "period_ms", b"period_ms", "sensor_mask", b"sensor_mask"]) -> None: ...
+
+global___TelemetrySubscribeResponse = TelemetrySubscribeResponse
+
+@typing.final
+class LinkBaudRequest(google.protobuf.message.Message):
+    """A request with confirm clear asks the node to switch rates. The response
+    goes out at the old rate and the node switches shortly after. The host then
+    reopens its port at the new rate and sends the same request with confirm
+    set. Without that confirm the node drops back to the default rate.
+    """
+
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    HEADER_FIELD_NUMBER: builtins.int
+    NODE_ID_FIELD_NUMBER: builtins.int
+    BAUD_FIELD_NUMBER: builtins.int
+    CONFIRM_FIELD_NUMBER: builtins.int
+    node_id: builtins.int
+    baud: builtins.int
+    """Requested line rate, 0 to only read the status"""
+    confirm: builtins.bool
+    """Host is now talking at this rate"""
+    @property
+    def header(self) -> mbed_rpc_pb2.Header: ...
+    def __init__(
+        self,
+        *,
+        header: mbed_rpc_pb2.Header | None = ...,
+        node_id: builtins.int | None = ...,
+        baud: builtins.int | None = ...,
+        confirm: builtins.bool | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["baud", b"baud", "confirm", b"confirm", "header", b"header", "node_id", b"node_id"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["baud", b"baud", "confirm", b"confirm", "header", b"header", "node_id", b"node_id"]) -> None: ...
+
+global___LinkBaudRequest = LinkBaudRequest
+
+@typing.final
+class LinkBaudResponse(google.protobuf.message.Message):
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    HEADER_FIELD_NUMBER: builtins.int
+    STATUS_FIELD_NUMBER: builtins.int
+    BAUD_FIELD_NUMBER: builtins.int
+    FALLBACKS_FIELD_NUMBER: builtins.int
+    LINE_ERRORS_FIELD_NUMBER: builtins.int
+    SUPPORTED_FIELD_NUMBER: builtins.int
+    status: global___LinkBaudStatus.ValueType
+    baud: builtins.int
+    """Rate the link is running at"""
+    fallbacks: builtins.int
+    """Times the link dropped back to the default rate"""
+    line_errors: builtins.int
+    """Receive line errors seen since boot"""
+    @property
+    def header(self) -> mbed_rpc_pb2.Header: ...
+    @property
+    def supported(self) -> google.protobuf.internal.containers.RepeatedScalarFieldContainer[builtins.int]: ...
+    def __init__(
+        self,
+        *,
+        header: mbed_rpc_pb2.Header | None = ...,
+        status: global___LinkBaudStatus.ValueType | None = ...,
+        baud: builtins.int | None = ...,
+        fallbacks: builtins.int | None = ...,
+        line_errors: builtins.int | None = ...,
+        supported: collections.abc.Iterable[builtins.int] | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["baud", b"baud", "fallbacks", b"fallbacks", "header", b"header", "line_errors", b"line_errors", "status", b"status"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["baud", b"baud", "fallbacks", b"fallbacks", "header", b"header", "line_errors", b"line_errors", "status", b"status", "supported", b"supported"]) -> None: ...
+
+global___LinkBaudResponse = LinkBaudResponse
+
+@typing.final
+class LTCRegGetRequest(google.protobuf.message.Message):
+    """Reads a single register, or with dump set every MFR register in one burst
+    on the bus so the values form a consistent snapshot.
+    """
+
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    HEADER_FIELD_NUMBER: builtins.int
+    NODE_ID_FIELD_NUMBER: builtins.int
+    REG_FIELD_NUMBER: builtins.int
+    DUMP_FIELD_NUMBER: builtins.int
+    node_id: builtins.int
+    reg: builtins.int
+    """Register address, ignored for a dump"""
+    dump: builtins.bool
+    """Read the whole register map"""
+    @property
+    def header(self) -> mbed_rpc_pb2.Header: ...
+    def __init__(
+        self,
+        *,
+        header: mbed_rpc_pb2.Header | None = ...,
+        node_id: builtins.int | None = ...,
+        reg: builtins.int | None = ...,
+        dump: builtins.bool | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["dump", b"dump", "header", b"header", "node_id", b"node_id", "reg", b"reg"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["dump", b"dump", "header", b"header", "node_id", b"node_id", "reg", b"reg"]) -> None: ...
+
+global___LTCRegGetRequest = LTCRegGetRequest
+
+@typing.final
+class LTCRegGetResponse(google.protobuf.message.Message):
+    """Register values in address order, starting at first_reg"""
+
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    HEADER_FIELD_NUMBER: builtins.int
+    STATUS_FIELD_NUMBER: builtins.int
+    FIRST_REG_FIELD_NUMBER: builtins.int
+    VALUES_FIELD_NUMBER: builtins.int
+    status: global___LTCRegStatus.ValueType
+    first_reg: builtins.int
+    values: builtins.bytes
+    @property
+    def header(self) -> mbed_rpc_pb2.Header: ...
+    def __init__(
+        self,
+        *,
+        header: mbed_rpc_pb2.Header | None = ...,
+        status: global___LTCRegStatus.ValueType | None = ...,
+        first_reg: builtins.int | None = ...,
+        values: builtins.bytes | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["first_reg", b"first_reg", "header", b"header", "status", b"status", "values", b"values"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["first_reg", b"first_reg", "header", b"header", "status", b"status", "values", b"values"]) -> None: ...
+
+global___LTCRegGetResponse = LTCRegGetResponse
+
+@typing.final
+class LTCRegSetRequest(google.protobuf.message.Message):
+    """Writes are limited to the IDAC and spread spectrum registers and are only
+    accepted while the power stage is not enabled. The IDAC write protection is
+    lifted for the write and restored after.
+    """
+
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    HEADER_FIELD_NUMBER: builtins.int
+    NODE_ID_FIELD_NUMBER: builtins.int
+    REG_FIELD_NUMBER: builtins.int
+    VALUE_FIELD_NUMBER: builtins.int
+    node_id: builtins.int
+    reg: builtins.int
+    value: builtins.int
+    @property
+    def header(self) -> mbed_rpc_pb2.Header: ...
+    def __init__(
+        self,
+        *,
+        header: mbed_rpc_pb2.Header | None = ...,
+        node_id: builtins.int | None = ...,
+        reg: builtins.int | None = ...,
+        value: builtins.int | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["header", b"header", "node_id", b"node_id", "reg", b"reg", "value", b"value"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["header", b"header", "node_id", b"node_id", "reg", b"reg", "value", b"value"]) -> None: ...
+
+global___LTCRegSetRequest = LTCRegSetRequest
+
+@typing.final
+class LTCRegSetResponse(google.protobuf.message.Message):
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    HEADER_FIELD_NUMBER: builtins.int
+    STATUS_FIELD_NUMBER: builtins.int
+    VALUE_FIELD_NUMBER: builtins.int
+    status: global___LTCRegStatus.ValueType
+    value: builtins.int
+    """Register read back after the write"""
+    @property
+    def header(self) -> mbed_rpc_pb2.Header: ...
+    def __init__(
+        self,
+        *,
+        header: mbed_rpc_pb2.Header | None = ...,
+        status: global___LTCRegStatus.ValueType | None = ...,
+        value: builtins.int | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["header", b"header", "status", b"status", "value", b"value"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["header", b"header", "status", b"status", "value", b"value"]) -> None: ...
+
+global___LTCRegSetResponse = LTCRegSetResponse
+
+@typing.final
+class GroupCommandRequest(google.protobuf.message.Message):
+    """Broadcast once to every member of a group. Each member times the delay from
+    the moment the frame finished arriving on its link, not from when it got
+    around to processing it, so members on the same bus act together. A newer
+    command replaces one that is still pending.
+    """
+
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    HEADER_FIELD_NUMBER: builtins.int
+    GROUP_ID_FIELD_NUMBER: builtins.int
+    COMMAND_ID_FIELD_NUMBER: builtins.int
+    ACTION_FIELD_NUMBER: builtins.int
+    FIELD_FIELD_NUMBER: builtins.int
+    VALUE_FIELD_NUMBER: builtins.int
+    DELAY_US_FIELD_NUMBER: builtins.int
+    group_id: builtins.int
+    """Group to address, or GROUP_ID_ALL"""
+    command_id: builtins.int
+    """Host chosen tag echoed in every ack"""
+    action: global___GroupAction.ValueType
+    field: global___SetpointField.ValueType
+    """Setpoint to change, only for GROUP_ACTION_SETPOINT"""
+    value: builtins.float
+    """Setpoint value, only for GROUP_ACTION_SETPOINT"""
+    delay_us: builtins.int
+    """Time from frame arrival to execution"""
+    @property
+    def header(self) -> mbed_rpc_pb2.Header: ...
+    def __init__(
+        self,
+        *,
+        header: mbed_rpc_pb2.Header | None = ...,
+        group_id: builtins.int | None = ...,
+        command_id: builtins.int | None = ...,
+        action: global___GroupAction.ValueType | None = ...,
+        field: global___SetpointField.ValueType | None = ...,
+        value: builtins.float | None = ...,
+        delay_us: builtins.int | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["action", b"action", "command_id", b"command_id", "delay_us", b"delay_us", "field", b"field", "group_id", b"group_id", "header", b"header", "value", b"value"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["action", b"action", "command_id", b"command_id", "delay_us", b"delay_us", "field", b"field", "group_id", b"group_id", "header", b"header", "value", b"value"]) -> None: ...
+
+global___GroupCommandRequest = GroupCommandRequest
+
+@typing.final
+class GroupCommandResponse(google.protobuf.message.Message):
+    """Sent by every member that received the command. Nodes outside the group
+    stay silent.
+    """
+
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+
+    HEADER_FIELD_NUMBER: builtins.int
+    NODE_ID_FIELD_NUMBER: builtins.int
+    COMMAND_ID_FIELD_NUMBER: builtins.int
+    STATUS_FIELD_NUMBER: builtins.int
+    LATENCY_US_FIELD_NUMBER: builtins.int
+    node_id: builtins.int
+    command_id: builtins.int
+    status: global___GroupCommandStatus.ValueType
+    latency_us: builtins.int
+    """Time between frame arrival and the node processing it"""
+    @property
+    def header(self) -> mbed_rpc_pb2.Header: ...
+    def __init__(
+        self,
+        *,
+        header: mbed_rpc_pb2.Header | None = ...,
+        node_id: builtins.int | None = ...,
+        command_id: builtins.int | None = ...,
+        status: global___GroupCommandStatus.ValueType | None = ...,
+        latency_us: builtins.int | None = ...,
+    ) -> None: ...
+    def HasField(self, field_name: typing.Literal["command_id", b"command_id", "header", b"header", "latency_us", b"latency_us", "node_id", b"node_id", "status", b"status"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing.Literal["command_id", b"command_id", "header", b"header", "latency_us", b"latency_us", "node_id", b"node_id", "status", b"status"]) -> None: ...
+
+global___GroupCommandResponse = GroupCommandResponse
@@ -107,4 +107,16 @@ namespace App::Filter
     return ret_val;
   }
 
+
+  void IIRFilter::getState( float ( &dst )[ STATE_SIZE ] ) const
+  {
+    memcpy( dst, state, sizeof( state ) );
+  }
+
+
+  void IIRFilter::setState( const float ( &src )[ STATE_SIZE ] )
+  {
+    memcpy( state, src, sizeof( state ) );
+  }
+
 }    // namespace App::Filter
@@ -40,6 +40,11 @@ namespace App::Filter
   class IIRFilter
   {
   public:
+    /**
+     * @brief Number of delay line elements held by the filter
+     */
+    static constexpr size_t STATE_SIZE = ichnaea_PDI_IIRFilterConfig_MaxFilterOrder_MAX_FILTER_ORDER;
+
     IIRFilter();
     ~IIRFilter();
 
@@ -64,10 +69,24 @@ namespace App::Filter
      */
     float apply( const float input );
 
+    /**
+     * @brief Copy out the filter delay line
+     *
+     * @param dst Where to place the state
+     */
+    void getState( float ( &dst )[ STATE_SIZE ] ) const;
+
+    /**
+     * @brief Load the filter delay line, ie to resume a previously converged filter
+     *
+     * @param src State to load
+     */
+    void setState( const float ( &src )[ STATE_SIZE ] );
+
   private:
     arm_biquad_cascade_df2T_instance_f32 filter;
     ichnaea_PDI_IIRFilterConfig          config;
-    float                                state[ ichnaea_PDI_IIRFilterConfig_MaxFilterOrder_MAX_FILTER_ORDER ];
+    float                                state[ STATE_SIZE ];
   };
 
 }    // namespace App::Filter
@@ -0,0 +1,225 @@
+/******************************************************************************
+ *  File Name:
+ *    app_group.cpp
+ *
+ *  Description:
+ *    Group addressed command implementation
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <mbedutils/logging.hpp>
+#include <mbedutils/threading.hpp>
+#include <pico/time.h>
+#include <src/app/app_group.hpp>
+#include <src/app/app_power.hpp>
+#include <src/app/pdi/config_group_membership.hpp>
+
+namespace App::Group
+{
+  /*---------------------------------------------------------------------------
+  Static Data
+  ---------------------------------------------------------------------------*/
+
+  static bool     s_pending;  /**< A command is waiting to run */
+  static Command  s_command;  /**< The waiting command */
+  static uint32_t s_deadline; /**< Hardware timer value to run it at */
+
+  /*---------------------------------------------------------------------------
+  Private Functions
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Current hardware timer value in microseconds, on the same clock
+   * the UART stamps frame arrivals with
+   *
+   * @return uint32_t
+   */
+  static inline uint32_t now_us()
+  {
+    return static_cast<uint32_t>( time_us_64() );
+  }
+
+
+  static bool execute( const Command &cmd )
+  {
+    switch( cmd.action )
+    {
+      case ichnaea_GroupAction_GROUP_ACTION_SETPOINT:
+        if( cmd.field == ichnaea_SetpointField_SETPOINT_OUTPUT_VOLTAGE )
+        {
+          return App::Power::setOutputVoltage( cmd.value );
+        }
+        return App::Power::setOutputCurrentLimit( cmd.value );
+
+      case ichnaea_GroupAction_GROUP_ACTION_ENGAGE_OUTPUT:
+        return App::Power::engageOutput();
+
+      case ichnaea_GroupAction_GROUP_ACTION_DISENGAGE_OUTPUT:
+        App::Power::disengageOutput();
+        return true;
+
+      default:
+        return false;
+    }
+  }
+
+  /*---------------------------------------------------------------------------
+  Public Functions
+  ---------------------------------------------------------------------------*/
+
+  void driver_init()
+  {
+    /*-------------------------------------------------------------------------
+    Initialize module data
+    -------------------------------------------------------------------------*/
+    s_pending  = false;
+    s_command  = {};
+    s_deadline = 0;
+
+    /*-------------------------------------------------------------------------
+    Register the PDI keys for group membership
+    -------------------------------------------------------------------------*/
+    App::PDI::pdi_register_key__config_group_membership();
+  }
+
+
+  bool isMember( const uint32_t group_id )
+  {
+    if( group_id == ichnaea_GroupAddress_GROUP_ID_ALL )
+    {
+      return true;
+    }
+
+    if( group_id > ichnaea_GroupAddress_GROUP_ID_MAX )
+    {
+      return false;
+    }
+
+    return ( App::PDI::getConfigGroupMembership() & ( 1u << group_id ) ) != 0;
+  }
+
+
+  ichnaea_GroupCommandStatus schedule( const Command &cmd, const uint32_t arrival_us, const uint32_t delay_us,
+                                       uint32_t &latency_us )
+  {
+    latency_us = 0;
+
+    /*-------------------------------------------------------------------------
+    Cancelling needs no timing, it only drops what is waiting
+    -------------------------------------------------------------------------*/
+    if( cmd.action == ichnaea_GroupAction_GROUP_ACTION_CANCEL )
+    {
+      s_pending = false;
+      return ichnaea_GroupCommandStatus_GROUP_CMD_OK;
+    }
+
+    /*-------------------------------------------------------------------------
+    Validate the command before anything is replaced
+    -------------------------------------------------------------------------*/
+    if( ( cmd.action > ichnaea_GroupAction_GROUP_ACTION_DISENGAGE_OUTPUT ) ||
+        ( ( cmd.action == ichnaea_GroupAction_GROUP_ACTION_SETPOINT ) &&
+          ( cmd.field != ichnaea_SetpointField_SETPOINT_OUTPUT_VOLTAGE ) &&
+          ( cmd.field != ichnaea_SetpointField_SETPOINT_OUTPUT_CURRENT ) ) )
+    {
+      return ichnaea_GroupCommandStatus_GROUP_CMD_INVALID;
+    }
+
+    /*-------------------------------------------------------------------------
+    Check the setpoint now so the host hears about a bad value in the ack
+    rather than from a silent failure when the command falls due
+    -------------------------------------------------------------------------*/
+    if( cmd.action == ichnaea_GroupAction_GROUP_ACTION_SETPOINT )
+    {
+      const bool valid = ( cmd.field == ichnaea_SetpointField_SETPOINT_OUTPUT_VOLTAGE )
+                             ? App::Power::isOutputVoltageValid( cmd.value )
+                             : App::Power::isOutputCurrentLimitValid( cmd.value );
+      if( !valid )
+      {
+        return ichnaea_GroupCommandStatus_GROUP_CMD_BAD_VALUE;
+      }
+    }
+
+    if( ( delay_us < MIN_DELAY_US ) || ( delay_us > MAX_DELAY_US ) )
+    {
+      return ichnaea_GroupCommandStatus_GROUP_CMD_BAD_DELAY;
+    }
+
+    /*-------------------------------------------------------------------------
+    Time the delay from when the frame arrived. Without a usable stamp, as in
+    the simulator, fall back to now and accept the processing skew.
+    -------------------------------------------------------------------------*/
+    const uint32_t now     = now_us();
+    uint32_t       arrival = arrival_us;
+
+    if( !arrival || ( ( now - arrival ) > MIN_DELAY_US ) )
+    {
+      arrival = now;
+    }
+
+    latency_us = now - arrival;
+    if( latency_us >= delay_us )
+    {
+      return ichnaea_GroupCommandStatus_GROUP_CMD_LATE;
+    }
+
+    LOG_WARN_IF( s_pending, "Group command %u replaced by %u", static_cast<unsigned>( s_command.command_id ),
+                 static_cast<unsigned>( cmd.command_id ) );
+
+    s_command  = cmd;
+    s_deadline = arrival + delay_us;
+    s_pending  = true;
+
+    return ichnaea_GroupCommandStatus_GROUP_CMD_OK;
+  }
+
+
+  void process()
+  {
+    if( !s_pending )
+    {
+      return;
+    }
+
+    /*-------------------------------------------------------------------------
+    Leave it for a later cycle if one will still come around in time. A cycle
+    runs a little longer than the thread's sleep, hence the extra spin margin.
+    -------------------------------------------------------------------------*/
+    const int32_t remaining = static_cast<int32_t>( s_deadline - now_us() );
+    if( remaining > static_cast<int32_t>( CYCLE_US + SPIN_US ) )
+    {
+      return;
+    }
+
+    /*-------------------------------------------------------------------------
+    Sleep most of the way, then spin so every member acts on the same tick
+    -------------------------------------------------------------------------*/
+    if( remaining > static_cast<int32_t>( SPIN_US ) )
+    {
+      mb::thread::this_thread::sleep_for( ( remaining - SPIN_US ) / 1000 );
+    }
+
+    while( static_cast<int32_t>( s_deadline - now_us() ) > 0 )
+    {
+      continue;
+    }
+
+    s_pending = false;
+
+    /*-------------------------------------------------------------------------
+    Run the command
+    -------------------------------------------------------------------------*/
+    if( execute( s_command ) )
+    {
+      LOG_DEBUG( "Group command %u executed", static_cast<unsigned>( s_command.command_id ) );
+    }
+    else
+    {
+      LOG_WARN( "Group command %u failed", static_cast<unsigned>( s_command.command_id ) );
+    }
+  }
+
+}    // namespace App::Group
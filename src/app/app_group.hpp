@@ -0,0 +1,88 @@
+/******************************************************************************
+ *  File Name:
+ *    app_group.hpp
+ *
+ *  Description:
+ *    Group addressed commands. A node joins command groups through its PDI
+ *    membership mask, and a single broadcast frame schedules a command on
+ *    every member at the same moment: the delay is timed from when the frame
+ *    finished arriving on the link, which all members on a bus share.
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+#pragma once
+#ifndef ICHNAEA_APP_GROUP_HPP
+#define ICHNAEA_APP_GROUP_HPP
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <cstddef>
+#include <cstdint>
+#include <src/app/proto/ichnaea_rpc.pb.h>
+
+namespace App::Group
+{
+  /*---------------------------------------------------------------------------
+  Constants
+  ---------------------------------------------------------------------------*/
+
+  static constexpr uint32_t CYCLE_US     = 25'000;       /**< Period of the control thread that runs commands */
+  static constexpr uint32_t MIN_DELAY_US = 2 * CYCLE_US; /**< Every member has processed the frame by then */
+  static constexpr uint32_t MAX_DELAY_US = 10'000'000;   /**< Longest a command may wait */
+  static constexpr uint32_t SPIN_US      = 2'000;        /**< Final approach to the deadline is a busy wait */
+
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  struct Command
+  {
+    uint16_t              command_id; /**< Host chosen tag */
+    ichnaea_GroupAction   action;     /**< What to do */
+    ichnaea_SetpointField field;      /**< Setpoint to change, for GROUP_ACTION_SETPOINT */
+    float                 value;      /**< Setpoint value, for GROUP_ACTION_SETPOINT */
+  };
+
+  /*---------------------------------------------------------------------------
+  Public Functions
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Initialize the group command module
+   */
+  void driver_init();
+
+  /**
+   * @brief Check if this node should act on a command for a group
+   *
+   * @param group_id  Addressed group, or GROUP_ID_ALL
+   * @return true     The node is a member
+   * @return false    The node is not a member
+   */
+  bool isMember( const uint32_t group_id );
+
+  /**
+   * @brief Schedule a command to run delay_us after its frame arrived. Replaces
+   * any command still pending.
+   *
+   * @param cmd         Command to run
+   * @param arrival_us  Time the command's frame arrived, 0 if unknown
+   * @param delay_us    Time from frame arrival to execution
+   * @param latency_us  Output for the time between frame arrival and this call
+   * @return ichnaea_GroupCommandStatus
+   */
+  ichnaea_GroupCommandStatus schedule( const Command &cmd, const uint32_t arrival_us, const uint32_t delay_us,
+                                       uint32_t &latency_us );
+
+  /**
+   * @brief Run the pending command once its time comes. If it falls due
+   * before the next cycle, this waits for it. Called periodically from the
+   * control thread, the same thread that runs the group command service.
+   */
+  void process();
+
+}    // namespace App::Group
+
+#endif /* !ICHNAEA_APP_GROUP_HPP */
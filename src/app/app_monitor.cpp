@@ -11,6 +11,7 @@
 /*-----------------------------------------------------------------------------
 Includes
 -----------------------------------------------------------------------------*/
+#include <atomic>
 #include <cmath>
 #include <etl/math.h>
 #include <mbedutils/assert.hpp>
@@ -40,8 +41,11 @@ Includes
 #include <src/app/pdi/target_system_current_output.hpp>
 #include <src/app/pdi/target_system_voltage_output.hpp>
 #include <src/app/proto/ichnaea_pdi.pb.h>
+#include <src/system/system_binlog.hpp>
 #include <src/system/system_db.hpp>
 #include <src/system/system_error.hpp>
+#include <src/system/system_flight_recorder.hpp>
+#include <src/system/system_retained.hpp>
 #include <src/system/system_sensor.hpp>
 
 namespace App::Monitor
@@ -120,9 +124,11 @@ namespace App::Monitor
   Private Data
   ---------------------------------------------------------------------------*/
 
-  static MonStateArray s_monitor_state;
-  static bool          s_monitor_enabled;
-  static bool          s_driver_initialized;
+  static MonStateArray         s_monitor_state;
+  static bool                  s_monitor_enabled;
+  static bool                  s_driver_initialized;
+  static std::atomic<uint32_t> s_cycle_count;
+  static volatile uint32_t     s_cycle_time;
 
   /*---------------------------------------------------------------------------
   Private Function Declarations
@@ -216,6 +222,19 @@ namespace App::Monitor
     {
       refreshPDIDependencies( ( System::Sensor::Element )i );
     }
+
+    /*-------------------------------------------------------------------------
+    Resume the converged filters from before a warm restart
+    -------------------------------------------------------------------------*/
+    if( System::Retained::isValid() )
+    {
+      const RetainedState &retained = System::Retained::image().monitor;
+      for( size_t i = 0; i < s_monitor_state.size(); i++ )
+      {
+        s_monitor_state[ i ].valid = retained.monitors[ i ].valid;
+        s_monitor_state[ i ].filter.setState( retained.monitors[ i ].filter_state );
+      }
+    }
   }
 
 
@@ -258,6 +277,41 @@ namespace App::Monitor
   }
 
 
+  void beginCycle()
+  {
+    s_cycle_count.fetch_add( 1, std::memory_order_acq_rel );
+  }
+
+
+  void endCycle()
+  {
+    s_cycle_time = static_cast<uint32_t>( mb::time::millis() );
+    s_cycle_count.fetch_add( 1, std::memory_order_acq_rel );
+  }
+
+
+  uint32_t cycleCount()
+  {
+    return s_cycle_count.load( std::memory_order_acquire );
+  }
+
+
+  uint32_t cycleTime()
+  {
+    return s_cycle_time;
+  }
+
+
+  void saveRetainedState( RetainedState &state )
+  {
+    for( size_t i = 0; i < s_monitor_state.size(); i++ )
+    {
+      state.monitors[ i ].valid = s_monitor_state[ i ].valid;
+      s_monitor_state[ i ].filter.getState( state.monitors[ i ].filter_state );
+    }
+  }
+
+
   void refreshPDIDependencies( const System::Sensor::Element element )
   {
     /*-------------------------------------------------------------------------
@@ -412,6 +466,8 @@ namespace App::Monitor
     float raw_voltage   = System::Sensor::getMeasurement( System::Sensor::Element::VMON_SOLAR_INPUT );
     float filtered_data = s->filter.apply( raw_voltage );
 
+    System::FlightRecorder::record( System::Sensor::Element::VMON_SOLAR_INPUT, raw_voltage, filtered_data );
+
     /*-------------------------------------------------------------------------
     Update the PDI database with the new data
     -------------------------------------------------------------------------*/
@@ -428,17 +484,17 @@ namespace App::Monitor
     {
       case RangeStateEvent::OUT_OF_RANGE:
         PDI::setMonInputVoltageValid( false );
-        LOG_WARN_IF( s_monitor_enabled, "%s Invalid: %.2fV", s->name.c_str(), filtered_data );
+        BLOG_WARN_IF( s_monitor_enabled, "%s Invalid: %.2fV", s->name.c_str(), filtered_data );
 
         if( s_monitor_enabled )
         {
-          mbed_assert_continue_msg( false, "%s OOR: %.2fV", s->name.c_str(), filtered_data );
+          BLOG_ERROR( "%s OOR: %.2fV", s->name.c_str(), filtered_data );
           Panic::throwError( Panic::ErrorCode::ERR_MONITOR_VIN_OOR );
         }
         break;
 
       case RangeStateEvent::IN_RANGE:
-        LOG_TRACE_IF( s_monitor_enabled, "%s Valid: %.2fV", s->name.c_str(), filtered_data );
+        BLOG_TRACE_IF( s_monitor_enabled, "%s Valid: %.2fV", s->name.c_str(), filtered_data );
         PDI::setMonInputVoltageValid( true );
         break;
 
@@ -470,6 +526,8 @@ namespace App::Monitor
     float raw_current   = System::Sensor::getMeasurement( System::Sensor::Element::IMON_LOAD );
     float filtered_data = s->filter.apply( raw_current );
 
+    System::FlightRecorder::record( System::Sensor::Element::IMON_LOAD, raw_current, filtered_data );
+
     /*-------------------------------------------------------------------------
     Update the PDI database with the new data
     -------------------------------------------------------------------------*/
@@ -486,17 +544,17 @@ namespace App::Monitor
     {
       case RangeStateEvent::OUT_OF_RANGE:
         PDI::setMonOutputCurrentValid( false );
-        LOG_WARN_IF( s_monitor_enabled, "%s Invalid: %.2fA", s->name.c_str(), filtered_data );
+        BLOG_WARN_IF( s_monitor_enabled, "%s Invalid: %.2fA", s->name.c_str(), filtered_data );
 
         if( s_monitor_enabled )
         {
-          mbed_assert_continue_msg( false, "%s OOR: %.2fA", s->name.c_str(), filtered_data );
+          BLOG_ERROR( "%s OOR: %.2fA", s->name.c_str(), filtered_data );
           Panic::throwError( Panic::ErrorCode::ERR_MONITOR_IOUT_OOR );
         }
         break;
 
       case RangeStateEvent::IN_RANGE:
-        LOG_TRACE_IF( s_monitor_enabled, "%s Valid: %.2fA", s->name.c_str(), filtered_data );
+        BLOG_TRACE_IF( s_monitor_enabled, "%s Valid: %.2fA", s->name.c_str(), filtered_data );
         PDI::setMonOutputCurrentValid( true );
         break;
 
@@ -528,6 +586,8 @@ namespace App::Monitor
     float raw_voltage   = System::Sensor::getMeasurement( System::Sensor::Element::VMON_LOAD );
     float filtered_data = s->filter.apply( raw_voltage );
 
+    System::FlightRecorder::record( System::Sensor::Element::VMON_LOAD, raw_voltage, filtered_data );
+
     /*-------------------------------------------------------------------------
     Update the PDI database with the new data
     -------------------------------------------------------------------------*/
@@ -549,18 +609,17 @@ namespace App::Monitor
         PDI::setMonOutputVoltageValid( false );
         if( s_monitor_enabled )
         {
-          mbed_assert_continue_msg( !pct_error_oor, "%s exceeded %.2f%% error, Exp: %.2fV, Act: %.2fV", s->name.c_str(),
-                                    s->pdi.output_voltage.pct_error_limit * 100.0f, s->pdi.output_voltage.user_target,
-                                    filtered_data );
+          BLOG_ERROR_IF( pct_error_oor, "%s exceeded %.2f%% error, Exp: %.2fV, Act: %.2fV", s->name.c_str(),
+                         s->pdi.output_voltage.pct_error_limit * 100.0f, s->pdi.output_voltage.user_target, filtered_data );
 
-          mbed_assert_continue_msg( !vout_max_oor, "%s exceeded max limit: %.2fV, Act: %.2fV", s->name.c_str(),
-                                    s->pdi.output_voltage.system_limit, filtered_data );
+          BLOG_ERROR_IF( vout_max_oor, "%s exceeded max limit: %.2fV, Act: %.2fV", s->name.c_str(),
+                         s->pdi.output_voltage.system_limit, filtered_data );
           Panic::throwError( Panic::ErrorCode::ERR_MONITOR_VOUT_OOR );
         }
         break;
 
       case RangeStateEvent::IN_RANGE:
-        LOG_TRACE_IF( s_monitor_enabled, "%s Valid: %.2fV", s->name.c_str(), filtered_data );
+        BLOG_TRACE_IF( s_monitor_enabled, "%s Valid: %.2fV", s->name.c_str(), filtered_data );
         PDI::setMonOutputVoltageValid( true );
         break;
 
@@ -592,6 +651,8 @@ namespace App::Monitor
     float raw_voltage   = System::Sensor::getMeasurement( System::Sensor::Element::VMON_1V1 );
     float filtered_data = s->filter.apply( raw_voltage );
 
+    System::FlightRecorder::record( System::Sensor::Element::VMON_1V1, raw_voltage, filtered_data );
+
     /*-------------------------------------------------------------------------
     Update the PDI database with the new data
     -------------------------------------------------------------------------*/
@@ -607,16 +668,16 @@ namespace App::Monitor
     {
       case RangeStateEvent::OUT_OF_RANGE:
         PDI::setMon1V1VoltageValid( false );
-        LOG_WARN_IF( s_monitor_enabled, "%s Invalid: %.2fV", s->name.c_str(), filtered_data );
+        BLOG_WARN_IF( s_monitor_enabled, "%s Invalid: %.2fV", s->name.c_str(), filtered_data );
 
         if( s_monitor_enabled )
         {
-          mbed_assert_continue_msg( false, "%s OOR: %.2fV", s->name.c_str(), filtered_data );
+          BLOG_ERROR( "%s OOR: %.2fV", s->name.c_str(), filtered_data );
         }
         break;
 
       case RangeStateEvent::IN_RANGE:
-        LOG_TRACE_IF( s_monitor_enabled, "%s Valid: %.2fV", s->name.c_str(), filtered_data );
+        BLOG_TRACE_IF( s_monitor_enabled, "%s Valid: %.2fV", s->name.c_str(), filtered_data );
         PDI::setMon1V1VoltageValid( true );
         break;
 
@@ -648,6 +709,8 @@ namespace App::Monitor
     float raw_voltage   = System::Sensor::getMeasurement( System::Sensor::Element::VMON_3V3 );
     float filtered_data = s->filter.apply( raw_voltage );
 
+    System::FlightRecorder::record( System::Sensor::Element::VMON_3V3, raw_voltage, filtered_data );
+
     /*-------------------------------------------------------------------------
     Update the PDI database with the new data
     -------------------------------------------------------------------------*/
@@ -663,16 +726,16 @@ namespace App::Monitor
     {
       case RangeStateEvent::OUT_OF_RANGE:
         PDI::setMon3V3VoltageValid( false );
-        LOG_WARN_IF( s_monitor_enabled, "%s Invalid: %.2fV", s->name.c_str(), filtered_data );
+        BLOG_WARN_IF( s_monitor_enabled, "%s Invalid: %.2fV", s->name.c_str(), filtered_data );
 
         if( s_monitor_enabled )
         {
-          mbed_assert_continue_msg( false, "%s OOR: %.2fV", s->name.c_str(), filtered_data );
+          BLOG_ERROR( "%s OOR: %.2fV", s->name.c_str(), filtered_data );
         }
         break;
 
       case RangeStateEvent::IN_RANGE:
-        LOG_TRACE_IF( s_monitor_enabled, "%s Valid: %.2fV", s->name.c_str(), filtered_data );
+        BLOG_TRACE_IF( s_monitor_enabled, "%s Valid: %.2fV", s->name.c_str(), filtered_data );
         PDI::setMon3V3VoltageValid( true );
         break;
 
@@ -704,6 +767,8 @@ namespace App::Monitor
     float raw_voltage   = System::Sensor::getMeasurement( System::Sensor::Element::VMON_5V0 );
     float filtered_data = s->filter.apply( raw_voltage );
 
+    System::FlightRecorder::record( System::Sensor::Element::VMON_5V0, raw_voltage, filtered_data );
+
     /*-------------------------------------------------------------------------
     Update the PDI database with the new data
     -------------------------------------------------------------------------*/
@@ -719,16 +784,16 @@ namespace App::Monitor
     {
       case RangeStateEvent::OUT_OF_RANGE:
         PDI::setMon5V0VoltageValid( false );
-        LOG_WARN_IF( s_monitor_enabled, "%s Invalid: %.2fV", s->name.c_str(), filtered_data );
+        BLOG_WARN_IF( s_monitor_enabled, "%s Invalid: %.2fV", s->name.c_str(), filtered_data );
 
         if( s_monitor_enabled )
         {
-          mbed_assert_continue_msg( false, "%s OOR: %.2fV", s->name.c_str(), filtered_data );
+          BLOG_ERROR( "%s OOR: %.2fV", s->name.c_str(), filtered_data );
         }
         break;
 
       case RangeStateEvent::IN_RANGE:
-        LOG_TRACE_IF( s_monitor_enabled, "%s Valid: %.2fV", s->name.c_str(), filtered_data );
+        BLOG_TRACE_IF( s_monitor_enabled, "%s Valid: %.2fV", s->name.c_str(), filtered_data );
         PDI::setMon5V0VoltageValid( true );
         break;
 
@@ -760,6 +825,8 @@ namespace App::Monitor
     float raw_voltage   = System::Sensor::getMeasurement( System::Sensor::Element::VMON_12V );
     float filtered_data = s->filter.apply( raw_voltage );
 
+    System::FlightRecorder::record( System::Sensor::Element::VMON_12V, raw_voltage, filtered_data );
+
     /*-------------------------------------------------------------------------
     Update the PDI database with the new data
     -------------------------------------------------------------------------*/
@@ -775,17 +842,17 @@ namespace App::Monitor
     {
       case RangeStateEvent::OUT_OF_RANGE:
         PDI::setMon12V0VoltageValid( false );
-        LOG_WARN_IF( s_monitor_enabled, "%s Invalid: %.2fV", s->name.c_str(), filtered_data );
+        BLOG_WARN_IF( s_monitor_enabled, "%s Invalid: %.2fV", s->name.c_str(), filtered_data );
 
         if( s_monitor_enabled )
         {
-          mbed_assert_continue_msg( false, "%s OOR: %.2fV", s->name.c_str(), filtered_data );
+          BLOG_ERROR( "%s OOR: %.2fV", s->name.c_str(), filtered_data );
           Panic::throwError( Panic::ErrorCode::ERR_MONITOR_12V0_OOR );
         }
         break;
 
       case RangeStateEvent::IN_RANGE:
-        LOG_TRACE_IF( s_monitor_enabled, "%s Valid: %.2fV", s->name.c_str(), filtered_data );
+        BLOG_TRACE_IF( s_monitor_enabled, "%s Valid: %.2fV", s->name.c_str(), filtered_data );
         PDI::setMon12V0VoltageValid( true );
         break;
 
@@ -819,6 +886,9 @@ namespace App::Monitor
     float avg_temp      = ( raw_temp0 + raw_temp1 ) / 2.0f;
     float filtered_data = s->filter.apply( avg_temp );
 
+    System::FlightRecorder::record( System::Sensor::Element::BOARD_TEMP_0, raw_temp0, filtered_data );
+    System::FlightRecorder::record( System::Sensor::Element::BOARD_TEMP_1, raw_temp1, filtered_data );
+
     mbed_dbg_assert( !etl::is_nan( filtered_data ) );
 
     /*-------------------------------------------------------------------------
@@ -835,17 +905,17 @@ namespace App::Monitor
     {
       case RangeStateEvent::OUT_OF_RANGE:
         PDI::setMonTemperatureValid( false );
-        LOG_WARN_IF( s_monitor_enabled, "%s Invalid: %.2fC", s->name.c_str(), filtered_data );
+        BLOG_WARN_IF( s_monitor_enabled, "%s Invalid: %.2fC", s->name.c_str(), filtered_data );
 
         if( s_monitor_enabled )
         {
-          mbed_assert_continue_msg( false, "%s OOR: %.2fC", s->name.c_str(), filtered_data );
+          BLOG_ERROR( "%s OOR: %.2fC", s->name.c_str(), filtered_data );
           Panic::throwError( Panic::ErrorCode::ERR_MONITOR_TEMP_OOR );
         }
         break;
 
       case RangeStateEvent::IN_RANGE:
-        LOG_TRACE_IF( s_monitor_enabled, "%s Valid: %.2fC", s->name.c_str(), filtered_data );
+        BLOG_TRACE_IF( s_monitor_enabled, "%s Valid: %.2fC", s->name.c_str(), filtered_data );
         PDI::setMonTemperatureValid( true );
         break;
 
@@ -878,6 +948,8 @@ namespace App::Monitor
     float raw_speed     = System::Sensor::getMeasurement( System::Sensor::Element::FAN_SPEED );
     float filtered_data = s->filter.apply( raw_speed );
 
+    System::FlightRecorder::record( System::Sensor::Element::FAN_SPEED, raw_speed, filtered_data );
+
     /*-------------------------------------------------------------------------
     Update the PDI database with the new data
     -------------------------------------------------------------------------*/
@@ -893,17 +965,17 @@ namespace App::Monitor
     {
       case RangeStateEvent::OUT_OF_RANGE:
         PDI::setMonFanSpeedValid( false );
-        LOG_WARN_IF( s_monitor_enabled, "%s Invalid: %.2f RPM", s->name.c_str(), filtered_data );
+        BLOG_WARN_IF( s_monitor_enabled, "%s Invalid: %.2f RPM", s->name.c_str(), filtered_data );
 
         if( s_monitor_enabled )
         {
-          mbed_assert_continue_msg( false, "%s OOR: %.2f RPM", s->name.c_str(), filtered_data );
+          BLOG_ERROR( "%s OOR: %.2f RPM", s->name.c_str(), filtered_data );
           begin_invalid_state = currentTime;
         }
         break;
 
       case RangeStateEvent::IN_RANGE:
-        LOG_TRACE_IF( s_monitor_enabled, "%s Valid: %.2f RPM", s->name.c_str(), filtered_data );
+        BLOG_TRACE_IF( s_monitor_enabled, "%s Valid: %.2f RPM", s->name.c_str(), filtered_data );
         PDI::setMonFanSpeedValid( true );
         begin_invalid_state = 0;
         break;
@@ -17,10 +17,27 @@
 /*-----------------------------------------------------------------------------
 Includes
 -----------------------------------------------------------------------------*/
+#include <src/app/app_filter.hpp>
 #include <src/system/system_sensor.hpp>
 
 namespace App::Monitor
 {
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Monitor state carried across a warm restart
+   */
+  struct RetainedState
+  {
+    struct Entry
+    {
+      bool  valid;                                              /**< Monitor had valid data */
+      float filter_state[ App::Filter::IIRFilter::STATE_SIZE ]; /**< Converged filter delay line */
+    } monitors[ static_cast<size_t>( System::Sensor::Element::NUM_OPTIONS ) ];
+  };
+
   /*---------------------------------------------------------------------------
   Public Functions
   ---------------------------------------------------------------------------*/
@@ -56,6 +73,39 @@ namespace App::Monitor
    */
   void refreshPDIDependencies( const System::Sensor::Element element );
 
+  /**
+   * @brief Snapshot the monitor state so it can be resumed after a warm restart
+   *
+   * @param state Where to place the snapshot
+   */
+  void saveRetainedState( RetainedState &state );
+
+  /**
+   * @brief Mark the start of a pass over the sensors and monitors. Readers
+   * that need every value from the same pass check cycleCount() around their
+   * reads and retry if it moved.
+   */
+  void beginCycle();
+
+  /**
+   * @brief Mark the end of a pass over the sensors and monitors
+   */
+  void endCycle();
+
+  /**
+   * @brief Number of begin/end marks so far. Odd while a pass is running.
+   *
+   * @return uint32_t
+   */
+  uint32_t cycleCount();
+
+  /**
+   * @brief System time in milliseconds the last pass finished
+   *
+   * @return uint32_t
+   */
+  uint32_t cycleTime();
+
   /**
    * @brief Monitor input voltage
    */
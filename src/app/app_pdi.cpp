@@ -11,18 +11,86 @@
 /*-----------------------------------------------------------------------------
 Includes
 -----------------------------------------------------------------------------*/
+#include <cstring>
+#include <etl/flat_map.h>
 #include <mbedutils/assert.hpp>
 #include <src/app/app_pdi.hpp>
 #include <src/system/system_db.hpp>
 
 namespace App::PDI
 {
+  /*---------------------------------------------------------------------------
+  Constants
+  ---------------------------------------------------------------------------*/
+
+  static constexpr size_t MAX_TRACKED_KEYS       = 100;
+  static constexpr size_t ENCODE_CACHE_SLOTS     = 32;
+  static constexpr size_t ENCODE_CACHE_SLOT_SIZE = 96;
+
+  static_assert( ichnaea_PDI_IIRFilterConfig_size <= ENCODE_CACHE_SLOT_SIZE, "Largest PDI type must fit in the cache" );
+
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Write tracking for a single registered key
+   */
+  struct WriteHook
+  {
+    mb::db::VisitorFunc callback;   /**< User onWrite callback for the key */
+    uint32_t            generation; /**< Bumped on every write to the key */
+  };
+
+  /**
+   * @brief Encoded copy of a key's data
+   */
+  struct EncodeSlot
+  {
+    PDIKey   key;                            /**< Key the data belongs to */
+    uint32_t generation;                     /**< Write generation the data was encoded at */
+    uint16_t size;                           /**< Encoded size, zero if the slot is unused */
+    uint8_t  data[ ENCODE_CACHE_SLOT_SIZE ]; /**< Encoded data */
+  };
+
   /*---------------------------------------------------------------------------
   Public Data
   ---------------------------------------------------------------------------*/
 
   PDIData Internal::RAMCache; /**< RAM cache for the PDI database */
 
+  /*---------------------------------------------------------------------------
+  Static Data
+  ---------------------------------------------------------------------------*/
+
+  static etl::flat_map<mb::db::HashKey, WriteHook, MAX_TRACKED_KEYS> s_write_hooks;
+  static EncodeSlot                                                  s_encode_cache[ ENCODE_CACHE_SLOTS ];
+  static size_t                                                      s_encode_victim;
+
+  /*---------------------------------------------------------------------------
+  Private Functions
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Common onWrite handler installed on every tracked node
+   *
+   * @param node  Node that was written
+   */
+  static void on_write_dispatch( mb::db::KVNode &node )
+  {
+    auto iter = s_write_hooks.find( node.hashKey );
+    if( iter == s_write_hooks.end() )
+    {
+      return;
+    }
+
+    iter->second.generation++;
+    if( iter->second.callback.is_valid() )
+    {
+      iter->second.callback( node );
+    }
+  }
+
   /*---------------------------------------------------------------------------
   Public Functions
   ---------------------------------------------------------------------------*/
@@ -79,9 +147,125 @@ namespace App::PDI
 
   void add_on_write_callback( const PDIKey key, mb::db::VisitorFunc callback )
   {
+    auto iter = s_write_hooks.find( key );
+    if( iter != s_write_hooks.end() )
+    {
+      iter->second.callback = callback;
+      return;
+    }
+
     auto node = System::Database::pdiDB().find( key );
     mbed_dbg_assert( node != nullptr );
     node->onWrite = callback;
   }
 
+
+  int encode( const PDIKey key, void *buffer, const size_t size )
+  {
+    /*-------------------------------------------------------------------------
+    Untracked keys can't be invalidated, so always encode them fresh
+    -------------------------------------------------------------------------*/
+    auto hook = s_write_hooks.find( key );
+    if( hook == s_write_hooks.end() )
+    {
+      return System::Database::pdiDB().encode( key, buffer, size );
+    }
+
+    /*-------------------------------------------------------------------------
+    Serve from the cache if the key hasn't been written since it was encoded.
+    The generation is sampled before encoding so a write that races with the
+    encode forces a refresh on the next read.
+    -------------------------------------------------------------------------*/
+    const uint32_t generation = hook->second.generation;
+    EncodeSlot    *slot       = nullptr;
+
+    for( auto &entry : s_encode_cache )
+    {
+      if( ( entry.size != 0 ) && ( entry.key == key ) )
+      {
+        slot = &entry;
+        break;
+      }
+    }
+
+    if( slot && ( slot->generation == generation ) )
+    {
+      if( slot->size > size )
+      {
+        return 0;
+      }
+
+      memcpy( buffer, slot->data, slot->size );
+      return slot->size;
+    }
+
+    /*-------------------------------------------------------------------------
+    Miss. Encode and refill the key's slot, or evict another one.
+    -------------------------------------------------------------------------*/
+    int encoded = System::Database::pdiDB().encode( key, buffer, size );
+    if( ( encoded <= 0 ) || ( static_cast<size_t>( encoded ) > ENCODE_CACHE_SLOT_SIZE ) )
+    {
+      return encoded;
+    }
+
+    if( !slot )
+    {
+      slot            = &s_encode_cache[ s_encode_victim ];
+      s_encode_victim = ( s_encode_victim + 1 ) % ENCODE_CACHE_SLOTS;
+    }
+
+    slot->key        = key;
+    slot->generation = generation;
+    slot->size       = static_cast<uint16_t>( encoded );
+    memcpy( slot->data, buffer, encoded );
+
+    return encoded;
+  }
+
+
+  void invalidate_encode_cache( const PDIKey key )
+  {
+    auto iter = s_write_hooks.find( key );
+    if( iter != s_write_hooks.end() )
+    {
+      iter->second.generation++;
+    }
+  }
+
+
+  void Internal::track_writes( mb::db::KVNode &node )
+  {
+    mbed_assert_msg( !s_write_hooks.full(), "PDI write tracking full" );
+
+    WriteHook hook;
+    hook.callback   = node.onWrite;
+    hook.generation = 0;
+
+    s_write_hooks[ node.hashKey ] = hook;
+    node.onWrite                  = mb::db::VisitorFunc::create<on_write_dispatch>();
+  }
+
+
+  size_t Internal::collect_dirty_keys( mb::db::HashKey *const keys, const size_t max_keys )
+  {
+    size_t count = 0;
+
+    for( const auto &entry : s_write_hooks )
+    {
+      auto node = System::Database::pdiDB().find( entry.first );
+      if( ( node == nullptr ) || !( node->flags & mb::db::KV_FLAG_DIRTY ) )
+      {
+        continue;
+      }
+
+      if( count < max_keys )
+      {
+        keys[ count ] = entry.first;
+      }
+      count++;
+    }
+
+    return count;
+  }
+
 }  // namespace App::PDI
@@ -42,6 +42,11 @@ namespace App::PDI
     KEY_MFG_DATE      = ichnaea_PDI_ID_MFG_DATE,
     KEY_CAL_DATE      = ichnaea_PDI_ID_CAL_DATE,
 
+    /*-------------------------------------------------------------------------
+    Network Configuration
+    -------------------------------------------------------------------------*/
+    KEY_CONFIG_GROUP_MEMBERSHIP = ichnaea_PDI_ID_CONFIG_GROUP_MEMBERSHIP,
+
     /*-------------------------------------------------------------------------
     Power System Descriptors
     -------------------------------------------------------------------------*/
@@ -138,6 +143,11 @@ namespace App::PDI
     -------------------------------------------------------------------------*/
     uint32_t bootCount; /**< KEY_BOOT_COUNT */
 
+    /*-------------------------------------------------------------------------
+    Network Configuration
+    -------------------------------------------------------------------------*/
+    uint32_t configGroupMembership; /**< KEY_CONFIG_GROUP_MEMBERSHIP */
+
     /*-------------------------------------------------------------------------
     Power System Descriptors
     -------------------------------------------------------------------------*/
@@ -272,6 +282,49 @@ namespace App::PDI
    */
   void add_on_write_callback( const PDIKey key, mb::db::VisitorFunc callback );
 
+  /**
+   * @brief Encode a data item into its protobuf wire format.
+   *
+   * Read-mostly keys are served from an encode cache that is invalidated when
+   * the key is written, so repeated reads of an unchanged key skip nanopb.
+   * The cache is not thread safe and is intended for the RPC server context.
+   *
+   * @param key     Key to encode
+   * @param buffer  Output buffer for the encoded data
+   * @param size    Size of the output buffer
+   * @return int    Number of bytes encoded, <= 0 on failure
+   */
+  int encode( const PDIKey key, void *buffer, const size_t size );
+
+  /**
+   * @brief Marks a key as modified for code paths that update the RAM cache
+   * directly instead of going through write().
+   *
+   * @param key   Key that was modified
+   */
+  void invalidate_encode_cache( const PDIKey key );
+
+  namespace Internal
+  {
+    /**
+     * @brief Hooks a node's onWrite so every write bumps its write generation.
+     *
+     * Must be called on the node before it is inserted into the database.
+     *
+     * @param node  Node being registered
+     */
+    void track_writes( mb::db::KVNode &node );
+
+    /**
+     * @brief Collects the tracked keys whose data is waiting to be flushed to NVM
+     *
+     * @param keys      Output list of dirty keys
+     * @param max_keys  Capacity of the output list
+     * @return size_t   Total dirty keys, which may exceed max_keys
+     */
+    size_t collect_dirty_keys( mb::db::HashKey *const keys, const size_t max_keys );
+  }    // namespace Internal
+
 }    // namespace App::PDI
 
 #endif /* !ICHNAEA_APP_PDI_HPP */
@@ -232,6 +232,18 @@ namespace App::Power
   }
 
 
+  bool isOutputVoltageValid( const float voltage )
+  {
+    return is_voltage_target_valid( voltage );
+  }
+
+
+  bool isOutputCurrentLimitValid( const float current )
+  {
+    return is_current_target_valid( current );
+  }
+
+
   void periodicProcessing()
   {
     HW::LTC7871::runStateUpdater();
@@ -56,6 +56,24 @@ namespace App::Power
    */
   bool setOutputCurrentLimit( const float current );
 
+  /**
+   * @brief Check an output voltage against the configured limits and the
+   * present input voltage without applying it.
+   *
+   * @param voltage Output voltage to check (Volts)
+   * @return True if setOutputVoltage() would accept it right now
+   */
+  bool isOutputVoltageValid( const float voltage );
+
+  /**
+   * @brief Check an output current limit against the rated limits without
+   * applying it.
+   *
+   * @param current Output current limit to check (Amps)
+   * @return True if setOutputCurrentLimit() would accept it
+   */
+  bool isOutputCurrentLimitValid( const float current );
+
   /**
    * @brief Single step the core controller of the power stage.
    *
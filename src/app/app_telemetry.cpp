@@ -0,0 +1,263 @@
+/******************************************************************************
+ *  File Name:
+ *    app_telemetry.cpp
+ *
+ *  Description:
+ *    Streaming sensor telemetry implementation
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <cmath>
+#include <etl/algorithm.h>
+#include <mbedutils/interfaces/time_intf.hpp>
+#include <mbedutils/threading.hpp>
+#include <src/app/app_monitor.hpp>
+#include <src/app/app_pdi.hpp>
+#include <src/app/app_telemetry.hpp>
+#include <src/app/pdi/mon_12v0_voltage.hpp>
+#include <src/app/pdi/mon_1v1_voltage.hpp>
+#include <src/app/pdi/mon_3v3_voltage.hpp>
+#include <src/app/pdi/mon_5v0_voltage.hpp>
+#include <src/app/pdi/mon_input_voltage.hpp>
+#include <src/app/pdi/mon_output_current.hpp>
+#include <src/app/pdi/mon_output_voltage.hpp>
+#include <src/app/proto/ichnaea_async.pb.h>
+#include <src/com/ctrl_server.hpp>
+#include <src/system/system_sensor.hpp>
+#include <src/system/system_util.hpp>
+
+namespace App::Telemetry
+{
+  /*---------------------------------------------------------------------------
+  Constants
+  ---------------------------------------------------------------------------*/
+
+  static constexpr size_t SNAPSHOT_RETRIES = 4; /**< Attempts at a coherent read before settling */
+
+  /*---------------------------------------------------------------------------
+  Static Data
+  ---------------------------------------------------------------------------*/
+
+  static Subscription      s_sub;
+  static size_t            s_last_frame;
+  static size_t            s_last_keyframe;
+  static bool              s_force_keyframe;
+  static uint16_t          s_sequence;
+  static float             s_last_sent[ NUM_SENSORS ];
+  static ichnaea_Telemetry s_frame;
+
+  /*---------------------------------------------------------------------------
+  Private Functions
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Reads each sensor in the mask into consecutive slots of values
+   *
+   * @return Mask of the sensors that were read
+   */
+  static uint32_t read_values( const uint32_t mask, float *const values )
+  {
+    uint32_t read  = 0;
+    size_t   count = 0;
+
+    for( size_t idx = 0; idx < NUM_SENSORS; idx++ )
+    {
+      if( ( mask & ( 1u << idx ) ) && readSensor( static_cast<ichnaea_SensorType>( idx ), values[ count ] ) )
+      {
+        read |= ( 1u << idx );
+        count++;
+      }
+    }
+
+    return read;
+  }
+
+  /*---------------------------------------------------------------------------
+  Public Functions
+  ---------------------------------------------------------------------------*/
+
+  bool readSensor( const ichnaea_SensorType sensor, float &value )
+  {
+    using namespace System::Sensor;
+
+    switch( sensor )
+    {
+      case ichnaea_SensorType_SENSOR_INPUT_VOLTAGE:
+        value = App::PDI::getMonInputVoltageFiltered();
+        break;
+
+      case ichnaea_SensorType_SENSOR_OUTPUT_VOLTAGE:
+        value = App::PDI::getMonOutputVoltageFiltered();
+        break;
+
+      case ichnaea_SensorType_SENSOR_LTC_AVG_OUTPUT_CURRENT:
+        value = getMeasurement( Element::IMON_LTC_AVG );
+        break;
+
+      case ichnaea_SensorType_SENSOR_BOARD_TEMP_1:
+        value = getMeasurement( Element::RP2040_TEMP );
+        break;
+
+      case ichnaea_SensorType_SENSOR_BOARD_TEMP_2:
+        value = getMeasurement( Element::BOARD_TEMP_0 );
+        break;
+
+      case ichnaea_SensorType_SENSOR_BOARD_TEMP_3:
+        value = getMeasurement( Element::BOARD_TEMP_1 );
+        break;
+
+      case ichnaea_SensorType_SENSOR_OUTPUT_CURRENT:
+        value = App::PDI::getMonOutputCurrentFiltered();
+        break;
+
+      case ichnaea_SensorType_SENSOR_VOLTAGE_MON_1V1:
+        value = App::PDI::getMon1V1VoltageFiltered();
+        break;
+
+      case ichnaea_SensorType_SENSOR_VOLTAGE_MON_3V3:
+        value = App::PDI::getMon3V3VoltageFiltered();
+        break;
+
+      case ichnaea_SensorType_SENSOR_VOLTAGE_MON_5V:
+        value = App::PDI::getMon5V0VoltageFiltered();
+        break;
+
+      case ichnaea_SensorType_SENSOR_VOLTAGE_MON_12V:
+        value = App::PDI::getMon12V0VoltageFiltered();
+        break;
+
+      default:
+        return false;
+    }
+
+    return true;
+  }
+
+
+  uint32_t readSensors( const uint32_t mask, float *const values, uint32_t &timestamp )
+  {
+    for( size_t attempt = 0; attempt < SNAPSHOT_RETRIES; attempt++ )
+    {
+      /*-----------------------------------------------------------------------
+      Wait out a pass that is already running
+      -----------------------------------------------------------------------*/
+      const uint32_t cycle = App::Monitor::cycleCount();
+      if( cycle & 1u )
+      {
+        mb::thread::this_thread::sleep_for( 1 );
+        continue;
+      }
+
+      timestamp           = App::Monitor::cycleTime();
+      const uint32_t read = read_values( mask, values );
+
+      if( App::Monitor::cycleCount() == cycle )
+      {
+        return read;
+      }
+    }
+
+    /*-------------------------------------------------------------------------
+    The monitor kept getting in the way. Every value is still at most one pass
+    old, so hand them back rather than nothing.
+    -------------------------------------------------------------------------*/
+    timestamp = App::Monitor::cycleTime();
+    return read_values( mask, values );
+  }
+
+
+  Subscription subscribe( const Subscription &sub )
+  {
+    s_sub.sensor_mask = sub.sensor_mask & ALL_SENSORS;
+    s_sub.period_ms   = etl::max( sub.period_ms, MIN_PERIOD_MS );
+    s_sub.deadband    = std::fabs( sub.deadband );
+    s_sub.keyframe_ms = sub.keyframe_ms ? etl::max( sub.keyframe_ms, s_sub.period_ms ) : DEFAULT_KEYFRAME;
+
+    s_force_keyframe = true;
+    s_last_frame     = 0;
+    s_sequence       = 0;
+
+    return s_sub;
+  }
+
+
+  Subscription subscription()
+  {
+    return s_sub;
+  }
+
+
+  void process()
+  {
+    const size_t now = mb::time::millis();
+
+    if( !s_sub.sensor_mask || ( !s_force_keyframe && ( ( now - s_last_frame ) < s_sub.period_ms ) ) )
+    {
+      return;
+    }
+
+    s_last_frame = now;
+
+    /*-------------------------------------------------------------------------
+    Keyframes carry every subscribed value so a host that missed a frame, or
+    just started listening, catches up without asking.
+    -------------------------------------------------------------------------*/
+    const bool keyframe = s_force_keyframe || ( ( now - s_last_keyframe ) >= s_sub.keyframe_ms );
+
+    s_frame                = ichnaea_Telemetry_init_zero;
+    s_frame.header.version = ichnaea_AsyncMessageVersion_MSG_VER_TELEMETRY;
+    s_frame.header.msgId   = ichnaea_AsyncMessageId_MSG_TELEMETRY;
+    s_frame.header.seqId   = mb::rpc::message::next_seq_id();
+    s_frame.header.svcId   = 0;
+    s_frame.node_id        = System::identity();
+    s_frame.sequence       = s_sequence;
+    s_frame.sensor_mask    = 0;
+    s_frame.values_count   = 0;
+
+    float          values[ NUM_SENSORS ];
+    uint32_t       sample_time = 0;
+    const uint32_t read        = readSensors( s_sub.sensor_mask, values, sample_time );
+    size_t         count       = 0;
+
+    s_frame.timestamp = sample_time;
+
+    for( size_t idx = 0; idx < NUM_SENSORS; idx++ )
+    {
+      if( !( read & ( 1u << idx ) ) )
+      {
+        continue;
+      }
+
+      const float value = values[ count++ ];
+      if( keyframe || ( std::fabs( value - s_last_sent[ idx ] ) > s_sub.deadband ) )
+      {
+        s_last_sent[ idx ]                       = value;
+        s_frame.sensor_mask                     |= ( 1u << idx );
+        s_frame.values[ s_frame.values_count++ ] = value;
+      }
+    }
+
+    /*-------------------------------------------------------------------------
+    Nothing moved, so nothing to say
+    -------------------------------------------------------------------------*/
+    if( !s_frame.values_count )
+    {
+      return;
+    }
+
+    if( Control::publish( Control::TxClass::TELEMETRY, s_frame.header.msgId, ichnaea_Telemetry_fields, s_frame ) )
+    {
+      s_sequence++;
+      if( keyframe )
+      {
+        s_force_keyframe = false;
+        s_last_keyframe  = now;
+      }
+    }
+  }
+
+}    // namespace App::Telemetry
@@ -0,0 +1,98 @@
+/******************************************************************************
+ *  File Name:
+ *    app_telemetry.hpp
+ *
+ *  Description:
+ *    Streaming sensor telemetry. A host subscribes to a set of sensors once
+ *    and the node pushes Telemetry frames to it, carrying only the values
+ *    that moved past the deadband since they were last sent.
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+#pragma once
+#ifndef ICHNAEA_APP_TELEMETRY_HPP
+#define ICHNAEA_APP_TELEMETRY_HPP
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <cstddef>
+#include <cstdint>
+#include <src/app/proto/ichnaea_rpc.pb.h>
+
+namespace App::Telemetry
+{
+  /*---------------------------------------------------------------------------
+  Constants
+  ---------------------------------------------------------------------------*/
+
+  static constexpr size_t   NUM_SENSORS      = static_cast<size_t>( _ichnaea_SensorType_MAX ) + 1u;
+  static constexpr uint32_t ALL_SENSORS      = ( 1u << NUM_SENSORS ) - 1u;
+  static constexpr uint32_t MIN_PERIOD_MS    = 25;   /**< Rate of the control thread that sends the frames */
+  static constexpr uint32_t DEFAULT_KEYFRAME = 5000; /**< Time between full frames if none is requested */
+
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  struct Subscription
+  {
+    uint32_t sensor_mask; /**< Bit per ichnaea_SensorType, 0 to stop streaming */
+    uint32_t period_ms;   /**< Time between frames */
+    float    deadband;    /**< Smallest change in a value that gets sent */
+    uint32_t keyframe_ms; /**< Time between frames carrying every subscribed value */
+  };
+
+  /*---------------------------------------------------------------------------
+  Public Functions
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Read the latest value of a sensor as reported to hosts
+   *
+   * @param sensor  Which sensor to read
+   * @param value   Output for the value
+   * @return true   The sensor is supported
+   * @return false  The sensor is not supported
+   */
+  bool readSensor( const ichnaea_SensorType sensor, float &value );
+
+  /**
+   * @brief Read several sensors from the same monitor pass. Retries if the
+   * monitor thread updates the values part way through.
+   *
+   * @param mask      Bit per ichnaea_SensorType to read
+   * @param values    Output for the values, in order of increasing sensor type.
+   *                  Must hold NUM_SENSORS entries.
+   * @param timestamp Output for the system time of the pass the values came from
+   * @return uint32_t Mask of the sensors that were read
+   */
+  uint32_t readSensors( const uint32_t mask, float *const values, uint32_t &timestamp );
+
+  /**
+   * @brief Replace the active subscription. Unsupported sensors are dropped
+   * from the mask and the period is clamped to the rate frames can be sent.
+   * The next frame carries every subscribed value.
+   *
+   * @param sub   Requested subscription
+   * @return Subscription that was applied
+   */
+  Subscription subscribe( const Subscription &sub );
+
+  /**
+   * @brief Get the active subscription
+   *
+   * @return Subscription
+   */
+  Subscription subscription();
+
+  /**
+   * @brief Send a telemetry frame if one is due. Called periodically from the
+   * control thread, the same thread that runs the subscription service.
+   */
+  void process();
+
+}    // namespace App::Telemetry
+
+#endif /* !ICHNAEA_APP_TELEMETRY_HPP */
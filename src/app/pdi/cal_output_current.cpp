@@ -1,7 +1,9 @@
 #include <mbedutils/assert.hpp>
+#include <mbedutils/logging.hpp>
 #include <src/app/app_monitor.hpp>
 #include <src/app/app_pdi.hpp>
 #include <src/app/pdi/cal_output_current.hpp>
+#include <src/system/system_cal.hpp>
 #include <src/system/system_db.hpp>
 
 namespace App::PDI
@@ -13,7 +15,16 @@ namespace App::PDI
 
   void getCalOutputCurrent( ichnaea_PDI_BasicCalibration &value )
   {
-    read( KEY_CAL_OUTPUT_CURRENT, &value, sizeof( value ) );
+    value = System::CalStore::data().outputCurrent;
+  }
+
+  static void onWrite__cal_output_current( mb::db::KVNode &node )
+  {
+    ( void )node;
+
+    System::CalStore::CalData cal = System::CalStore::data();
+    cal.outputCurrent             = PDI::Internal::RAMCache.calOutputCurrent;
+    System::CalStore::commit( cal );
   }
 
   void pdi_register_key_cal_output_current()
@@ -22,12 +33,8 @@ namespace App::PDI
     using namespace mb::db;
     using namespace System::Database;
 
-    // Default initialize the parameter
-    PDI::Internal::RAMCache.calOutputCurrent           = {};
-    PDI::Internal::RAMCache.calOutputCurrent.valid_min = -250.0f;
-    PDI::Internal::RAMCache.calOutputCurrent.valid_max = 250.0f;
-    PDI::Internal::RAMCache.calOutputCurrent.gain      = 1.0f;
-    PDI::Internal::RAMCache.calOutputCurrent.offset    = 0.0f;
+    // Mirror the parameter from the calibration store, which owns persistence
+    PDI::Internal::RAMCache.calOutputCurrent = System::CalStore::data().outputCurrent;
 
     // Register the parameter with the database
     KVNode node;
@@ -37,8 +44,36 @@ namespace App::PDI
     node.datacache = &PDI::Internal::RAMCache.calOutputCurrent;
     node.dataSize  = ichnaea_PDI_BasicCalibration_size;
     node.pbFields  = ichnaea_PDI_BasicCalibration_fields;
-    node.flags     = KV_FLAG_DEFAULT_PERSISTENT;
+    node.flags     = KV_FLAG_DEFAULT_VOLATILE;
+
+    // Nodes calibrated before the store existed hold this key in the KVDB.
+    // Register it the old persistent way once so the NVM copy is pulled in.
+    const bool import = !System::CalStore::isLoaded();
+    if( import )
+    {
+      node.flags = KV_FLAG_DEFAULT_PERSISTENT;
+    }
 
     pdi_insert_and_create( node, node.datacache, node.dataSize );
+
+    // Move the imported value into the store and stop persisting it in the KVDB
+    if( import )
+    {
+      System::CalStore::CalData cal = System::CalStore::data();
+      cal.outputCurrent             = PDI::Internal::RAMCache.calOutputCurrent;
+
+      if( System::CalStore::commit( cal ) )
+      {
+        LOG_INFO( "Imported output current calibration from PDI" );
+      }
+
+      auto iter = pdiDB().find( PDI::KEY_CAL_OUTPUT_CURRENT );
+      mbed_dbg_assert( iter != nullptr );
+      iter->flags &= ~KV_FLAG_DEFAULT_PERSISTENT;
+      iter->flags |= KV_FLAG_DEFAULT_VOLATILE;
+    }
+
+    // Only hook writes once the import can no longer trigger a commit
+    add_on_write_callback( PDI::KEY_CAL_OUTPUT_CURRENT, VisitorFunc::create<onWrite__cal_output_current>() );
   }
 }    // namespace App::PDI
@@ -0,0 +1,42 @@
+#include <mbedutils/assert.hpp>
+#include <src/app/app_pdi.hpp>
+#include <src/app/pdi/config_group_membership.hpp>
+#include <src/system/system_db.hpp>
+
+namespace App::PDI
+{
+  bool setConfigGroupMembership( uint32_t value )
+  {
+    static_assert( sizeof( value ) == sizeof( Internal::RAMCache.configGroupMembership ) );
+    return write( KEY_CONFIG_GROUP_MEMBERSHIP, &value, sizeof( value ) ) == sizeof( value );
+  }
+
+  uint32_t getConfigGroupMembership()
+  {
+    uint32_t value = 0;
+    read( KEY_CONFIG_GROUP_MEMBERSHIP, &value, sizeof( value ) );
+    return value;
+  }
+
+  void pdi_register_key__config_group_membership()
+  {
+    using namespace App;
+    using namespace mb::db;
+    using namespace System::Database;
+
+    // Default initialize the parameter. A new node is in no groups.
+    PDI::Internal::RAMCache.configGroupMembership = 0;
+
+    // Register the parameter with the database
+    KVNode node;
+    node.hashKey   = PDI::KEY_CONFIG_GROUP_MEMBERSHIP;
+    node.writer    = KVWriter_Memcpy;
+    node.reader    = KVReader_Memcpy;
+    node.datacache = &PDI::Internal::RAMCache.configGroupMembership;
+    node.dataSize  = ichnaea_PDI_Uint32Configuration_size;
+    node.pbFields  = ichnaea_PDI_Uint32Configuration_fields;
+    node.flags     = KV_FLAG_DEFAULT_PERSISTENT;
+
+    pdi_insert_and_create( node, node.datacache, node.dataSize );
+  }
+}    // namespace App::PDI
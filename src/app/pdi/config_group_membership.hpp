@@ -0,0 +1,15 @@
+#pragma once
+#ifndef ICHNAEA_APP_PDI_CONFIG_GROUP_MEMBERSHIP_HPP
+#define ICHNAEA_APP_PDI_CONFIG_GROUP_MEMBERSHIP_HPP
+
+#include <src/app/app_pdi.hpp>
+#include <src/app/proto/ichnaea_pdi.pb.h>
+
+namespace App::PDI
+{
+  bool setConfigGroupMembership( uint32_t value );
+  uint32_t getConfigGroupMembership();
+  void pdi_register_key__config_group_membership();
+}
+
+#endif /* !ICHNAEA_APP_PDI_CONFIG_GROUP_MEMBERSHIP_HPP */
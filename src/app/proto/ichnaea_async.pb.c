@@ -9,6 +9,12 @@
 PB_BIND(ichnaea_Heartbeat, ichnaea_Heartbeat, AUTO)
 
 
+PB_BIND(ichnaea_ConsoleBatch, ichnaea_ConsoleBatch, 2)
+
+
+PB_BIND(ichnaea_Telemetry, ichnaea_Telemetry, AUTO)
+
+
 
 
 
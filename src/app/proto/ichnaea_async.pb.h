@@ -15,12 +15,15 @@
  for system health monitoring and other non-critical messages occurring in the background. These messages
  start at 500 to avoid conflicts with the mbed_rpc.proto messages and ichnaea_rpc.proto messages. */
 typedef enum _ichnaea_AsyncMessageId {
-    ichnaea_AsyncMessageId_MSG_HEARTBEAT = 200
+    ichnaea_AsyncMessageId_MSG_HEARTBEAT = 200,
+    ichnaea_AsyncMessageId_MSG_CONSOLE_BATCH = 201,
+    ichnaea_AsyncMessageId_MSG_TELEMETRY = 202
 } ichnaea_AsyncMessageId;
 
 typedef enum _ichnaea_AsyncMessageVersion {
-    /* option allow_alias = true; */
-    ichnaea_AsyncMessageVersion_MSG_VER_HEARTBEAT = 0
+    ichnaea_AsyncMessageVersion_MSG_VER_HEARTBEAT = 0,
+    ichnaea_AsyncMessageVersion_MSG_VER_CONSOLE_BATCH = 1,
+    ichnaea_AsyncMessageVersion_MSG_VER_TELEMETRY = 0
 } ichnaea_AsyncMessageVersion;
 
 /* Struct definitions */
@@ -32,6 +35,28 @@ typedef struct _ichnaea_Heartbeat {
     uint32_t timestamp;
 } ichnaea_Heartbeat;
 
+typedef PB_BYTES_ARRAY_T(576) ichnaea_ConsoleBatch_data_t;
+/* Several console log records packed into one frame. Each record in data is a one byte log level, a one
+ byte length, then that many bytes of the message. Records never span batches. */
+typedef struct _ichnaea_ConsoleBatch {
+    mbed_rpc_Header header;
+    uint8_t count;
+    ichnaea_ConsoleBatch_data_t data;
+} ichnaea_ConsoleBatch;
+
+/* Streamed sensor values for a telemetry subscription. Bit N of sensor_mask is set when the value of
+ SensorType N is present, and values holds those values in order of increasing SensorType. Values that
+ stayed inside the deadband are left out, except in periodic keyframes which carry all of them. */
+typedef struct _ichnaea_Telemetry {
+    mbed_rpc_Header header;
+    uint32_t node_id;
+    uint32_t timestamp;
+    uint16_t sequence; /* Increments each frame, gaps mean lost frames */
+    uint16_t sensor_mask;
+    pb_size_t values_count;
+    float values[11];
+} ichnaea_Telemetry;
+
 
 #ifdef __cplusplus
 extern "C" {
@@ -39,24 +64,39 @@ extern "C" {
 
 /* Helper constants for enums */
 #define _ichnaea_AsyncMessageId_MIN ichnaea_AsyncMessageId_MSG_HEARTBEAT
-#define _ichnaea_AsyncMessageId_MAX ichnaea_AsyncMessageId_MSG_HEARTBEAT
-#define _ichnaea_AsyncMessageId_ARRAYSIZE ((ichnaea_AsyncMessageId)(ichnaea_AsyncMessageId_MSG_HEARTBEAT+1))
+#define _ichnaea_AsyncMessageId_MAX ichnaea_AsyncMessageId_MSG_TELEMETRY
+#define _ichnaea_AsyncMessageId_ARRAYSIZE ((ichnaea_AsyncMessageId)(ichnaea_AsyncMessageId_MSG_TELEMETRY+1))
 
 #define _ichnaea_AsyncMessageVersion_MIN ichnaea_AsyncMessageVersion_MSG_VER_HEARTBEAT
-#define _ichnaea_AsyncMessageVersion_MAX ichnaea_AsyncMessageVersion_MSG_VER_HEARTBEAT
-#define _ichnaea_AsyncMessageVersion_ARRAYSIZE ((ichnaea_AsyncMessageVersion)(ichnaea_AsyncMessageVersion_MSG_VER_HEARTBEAT+1))
+#define _ichnaea_AsyncMessageVersion_MAX ichnaea_AsyncMessageVersion_MSG_VER_CONSOLE_BATCH
+#define _ichnaea_AsyncMessageVersion_ARRAYSIZE ((ichnaea_AsyncMessageVersion)(ichnaea_AsyncMessageVersion_MSG_VER_CONSOLE_BATCH+1))
+
+
 
 
 
 /* Initializer values for message structs */
 #define ichnaea_Heartbeat_init_default           {mbed_rpc_Header_init_default, 0, 0, 0}
+#define ichnaea_ConsoleBatch_init_default        {mbed_rpc_Header_init_default, 0, {0, {0}}}
+#define ichnaea_Telemetry_init_default           {mbed_rpc_Header_init_default, 0, 0, 0, 0, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}
 #define ichnaea_Heartbeat_init_zero              {mbed_rpc_Header_init_zero, 0, 0, 0}
+#define ichnaea_ConsoleBatch_init_zero           {mbed_rpc_Header_init_zero, 0, {0, {0}}}
+#define ichnaea_Telemetry_init_zero              {mbed_rpc_Header_init_zero, 0, 0, 0, 0, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}
 
 /* Field tags (for use in manual encoding/decoding) */
 #define ichnaea_Heartbeat_header_tag             1
 #define ichnaea_Heartbeat_boot_count_tag         2
 #define ichnaea_Heartbeat_node_id_tag            3
 #define ichnaea_Heartbeat_timestamp_tag          4
+#define ichnaea_ConsoleBatch_header_tag          1
+#define ichnaea_ConsoleBatch_count_tag           2
+#define ichnaea_ConsoleBatch_data_tag            3
+#define ichnaea_Telemetry_header_tag             1
+#define ichnaea_Telemetry_node_id_tag            2
+#define ichnaea_Telemetry_timestamp_tag          3
+#define ichnaea_Telemetry_sequence_tag           4
+#define ichnaea_Telemetry_sensor_mask_tag        5
+#define ichnaea_Telemetry_values_tag             6
 
 /* Struct field encoding specification for nanopb */
 #define ichnaea_Heartbeat_FIELDLIST(X, a) \
@@ -68,14 +108,39 @@ X(a, STATIC,   REQUIRED, UINT32,   timestamp,         4)
 #define ichnaea_Heartbeat_DEFAULT NULL
 #define ichnaea_Heartbeat_header_MSGTYPE mbed_rpc_Header
 
+#define ichnaea_ConsoleBatch_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, MESSAGE,  header,            1) \
+X(a, STATIC,   REQUIRED, UINT32,   count,             2) \
+X(a, STATIC,   REQUIRED, BYTES,    data,              3)
+#define ichnaea_ConsoleBatch_CALLBACK NULL
+#define ichnaea_ConsoleBatch_DEFAULT NULL
+#define ichnaea_ConsoleBatch_header_MSGTYPE mbed_rpc_Header
+
+#define ichnaea_Telemetry_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, MESSAGE,  header,            1) \
+X(a, STATIC,   REQUIRED, UINT32,   node_id,           2) \
+X(a, STATIC,   REQUIRED, UINT32,   timestamp,         3) \
+X(a, STATIC,   REQUIRED, UINT32,   sequence,          4) \
+X(a, STATIC,   REQUIRED, UINT32,   sensor_mask,       5) \
+X(a, STATIC,   REPEATED, FLOAT,    values,            6)
+#define ichnaea_Telemetry_CALLBACK NULL
+#define ichnaea_Telemetry_DEFAULT NULL
+#define ichnaea_Telemetry_header_MSGTYPE mbed_rpc_Header
+
 extern const pb_msgdesc_t ichnaea_Heartbeat_msg;
+extern const pb_msgdesc_t ichnaea_ConsoleBatch_msg;
+extern const pb_msgdesc_t ichnaea_Telemetry_msg;
 
 /* Defines for backwards compatibility with code written before nanopb-0.4.0 */
 #define ichnaea_Heartbeat_fields &ichnaea_Heartbeat_msg
+#define ichnaea_ConsoleBatch_fields &ichnaea_ConsoleBatch_msg
+#define ichnaea_Telemetry_fields &ichnaea_Telemetry_msg
 
 /* Maximum encoded size of messages (where known) */
-#define ICHNAEA_ICHNAEA_ASYNC_PB_H_MAX_SIZE      ichnaea_Heartbeat_size
+#define ICHNAEA_ICHNAEA_ASYNC_PB_H_MAX_SIZE      ichnaea_ConsoleBatch_size
+#define ichnaea_ConsoleBatch_size                596
 #define ichnaea_Heartbeat_size                   32
+#define ichnaea_Telemetry_size                   89
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -91,6 +156,20 @@ struct MessageDescriptor<ichnaea_Heartbeat> {
         return &ichnaea_Heartbeat_msg;
     }
 };
+template <>
+struct MessageDescriptor<ichnaea_ConsoleBatch> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 3;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_ConsoleBatch_msg;
+    }
+};
+template <>
+struct MessageDescriptor<ichnaea_Telemetry> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 6;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_Telemetry_msg;
+    }
+};
 }  // namespace nanopb
 
 #endif  /* __cplusplus */
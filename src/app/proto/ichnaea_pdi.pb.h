@@ -18,6 +18,8 @@ typedef enum _ichnaea_PDI_ID {
     ichnaea_PDI_ID_SERIAL_NUMBER = 1, /* Unique serial number of the system */
     ichnaea_PDI_ID_MFG_DATE = 2, /* Date the system was manufactured */
     ichnaea_PDI_ID_CAL_DATE = 3, /* Date the system was last calibrated */
+    /* Network configuration */
+    ichnaea_PDI_ID_CONFIG_GROUP_MEMBERSHIP = 10, /* Bit mask of the command groups (0-31) the node belongs to */
     /* Power system configuration data */
     ichnaea_PDI_ID_TARGET_SYSTEM_VOLTAGE_OUTPUT = 25, /* Requested voltage target (lower than rated limit) */
     ichnaea_PDI_ID_CONFIG_SYSTEM_VOLTAGE_OUTPUT_RATED_LIMIT = 26, /* Maximum rated voltage the system can produce */
@@ -36,6 +36,12 @@ PB_BIND(ichnaea_SensorRequest, ichnaea_SensorRequest, AUTO)
 PB_BIND(ichnaea_SensorResponse, ichnaea_SensorResponse, AUTO)
 
 
+PB_BIND(ichnaea_SensorBatchRequest, ichnaea_SensorBatchRequest, AUTO)
+
+
+PB_BIND(ichnaea_SensorBatchResponse, ichnaea_SensorBatchResponse, AUTO)
+
+
 PB_BIND(ichnaea_PDIReadRequest, ichnaea_PDIReadRequest, AUTO)
 
 
@@ -51,9 +57,93 @@ PB_BIND(ichnaea_PDIWriteResponse, ichnaea_PDIWriteResponse, AUTO)
 PB_BIND(ichnaea_SystemStatusRequest, ichnaea_SystemStatusRequest, AUTO)
 
 
+PB_BIND(ichnaea_TxQueueStats, ichnaea_TxQueueStats, AUTO)
+
+
 PB_BIND(ichnaea_SystemStatusResponse, ichnaea_SystemStatusResponse, AUTO)
 
 
+PB_BIND(ichnaea_BootStep, ichnaea_BootStep, AUTO)
+
+
+PB_BIND(ichnaea_BootTimelineRequest, ichnaea_BootTimelineRequest, AUTO)
+
+
+PB_BIND(ichnaea_BootTimelineResponse, ichnaea_BootTimelineResponse, 2)
+
+
+PB_BIND(ichnaea_CalibrationEntry, ichnaea_CalibrationEntry, AUTO)
+
+
+PB_BIND(ichnaea_CalWriteRequest, ichnaea_CalWriteRequest, AUTO)
+
+
+PB_BIND(ichnaea_CalWriteResponse, ichnaea_CalWriteResponse, AUTO)
+
+
+PB_BIND(ichnaea_FlashLatencyHistogram, ichnaea_FlashLatencyHistogram, AUTO)
+
+
+PB_BIND(ichnaea_FlashStatsRequest, ichnaea_FlashStatsRequest, AUTO)
+
+
+PB_BIND(ichnaea_FlashStatsResponse, ichnaea_FlashStatsResponse, 2)
+
+
+PB_BIND(ichnaea_LogQueryRequest, ichnaea_LogQueryRequest, AUTO)
+
+
+PB_BIND(ichnaea_LogQueryResponse, ichnaea_LogQueryResponse, 2)
+
+
+PB_BIND(ichnaea_FlightSample, ichnaea_FlightSample, AUTO)
+
+
+PB_BIND(ichnaea_FlightRecorderRequest, ichnaea_FlightRecorderRequest, AUTO)
+
+
+PB_BIND(ichnaea_FlightRecorderResponse, ichnaea_FlightRecorderResponse, 2)
+
+
+PB_BIND(ichnaea_TelemetrySubscribeRequest, ichnaea_TelemetrySubscribeRequest, AUTO)
+
+
+PB_BIND(ichnaea_TelemetrySubscribeResponse, ichnaea_TelemetrySubscribeResponse, AUTO)
+
+
+PB_BIND(ichnaea_LinkBaudRequest, ichnaea_LinkBaudRequest, AUTO)
+
+
+PB_BIND(ichnaea_LinkBaudResponse, ichnaea_LinkBaudResponse, AUTO)
+
+
+PB_BIND(ichnaea_LTCRegGetRequest, ichnaea_LTCRegGetRequest, AUTO)
+
+
+PB_BIND(ichnaea_LTCRegGetResponse, ichnaea_LTCRegGetResponse, AUTO)
+
+
+PB_BIND(ichnaea_LTCRegSetRequest, ichnaea_LTCRegSetRequest, AUTO)
+
+
+PB_BIND(ichnaea_LTCRegSetResponse, ichnaea_LTCRegSetResponse, AUTO)
+
+
+PB_BIND(ichnaea_GroupCommandRequest, ichnaea_GroupCommandRequest, AUTO)
+
+
+PB_BIND(ichnaea_GroupCommandResponse, ichnaea_GroupCommandResponse, AUTO)
+
+
+
+
+
+
+
+
+
+
+
 
 
 
@@ -22,7 +22,16 @@ typedef enum _ichnaea_Service {
     ichnaea_Service_SVC_LTC_REG_SET = 106, /* Set a specific register on the LTC7871 */
     ichnaea_Service_SVC_PDI_READ = 107, /* Read PDI data from the node */
     ichnaea_Service_SVC_PDI_WRITE = 108, /* Write PDI data to the node */
-    ichnaea_Service_SVC_SYSTEM_STATUS = 109 /* Get the system status */
+    ichnaea_Service_SVC_SYSTEM_STATUS = 109, /* Get the system status */
+    ichnaea_Service_SVC_BOOT_TIMELINE = 110, /* Read the boot timeline profile */
+    ichnaea_Service_SVC_CAL_WRITE = 111, /* Bulk write calibration data */
+    ichnaea_Service_SVC_FLASH_STATS = 112, /* Read the NOR flash wear and latency statistics */
+    ichnaea_Service_SVC_LOG_QUERY = 113, /* Read stored logs filtered by time and level */
+    ichnaea_Service_SVC_FLIGHT_RECORDER = 114, /* Read or rearm the fault flight recorder */
+    ichnaea_Service_SVC_TELEMETRY = 115, /* Subscribe to streamed sensor telemetry */
+    ichnaea_Service_SVC_SENSOR_BATCH = 116, /* Read several sensor values at once */
+    ichnaea_Service_SVC_LINK_BAUD = 117, /* Negotiate the RPC link baud rate */
+    ichnaea_Service_SVC_GROUP_COMMAND = 118 /* Scheduled command broadcast to a group of nodes */
 } ichnaea_Service;
 
 /* Message types available. These start at 100 to avoid conflicts with the
@@ -43,7 +52,29 @@ typedef enum _ichnaea_Message {
     ichnaea_Message_MSG_PDI_WRITE_REQ = 116, /* Request to write PDI data to the node */
     ichnaea_Message_MSG_PDI_WRITE_RSP = 117, /* Response to the PDI write request */
     ichnaea_Message_MSG_SYSTEM_STATUS_REQ = 118, /* Request the system status */
-    ichnaea_Message_MSG_SYSTEM_STATUS_RSP = 119 /* Response to the GetSysStatusRequest message */
+    ichnaea_Message_MSG_SYSTEM_STATUS_RSP = 119, /* Response to the GetSysStatusRequest message */
+    ichnaea_Message_MSG_BOOT_TIMELINE_REQ = 120, /* Request a page of the boot timeline */
+    ichnaea_Message_MSG_BOOT_TIMELINE_RSP = 121, /* Response to the BootTimelineRequest message */
+    ichnaea_Message_MSG_CAL_WRITE_REQ = 122, /* Request to write a set of calibrations */
+    ichnaea_Message_MSG_CAL_WRITE_RSP = 123, /* Response to the CalWriteRequest message */
+    ichnaea_Message_MSG_FLASH_STATS_REQ = 124, /* Request a page of the flash statistics */
+    ichnaea_Message_MSG_FLASH_STATS_RSP = 125, /* Response to the FlashStatsRequest message */
+    ichnaea_Message_MSG_LOG_QUERY_REQ = 126, /* Request a page of filtered log records */
+    ichnaea_Message_MSG_LOG_QUERY_RSP = 127, /* Response to the LogQueryRequest message */
+    ichnaea_Message_MSG_FLIGHT_RECORDER_REQ = 128, /* Request a page of the flight recorder capture */
+    ichnaea_Message_MSG_FLIGHT_RECORDER_RSP = 129, /* Response to the FlightRecorderRequest message */
+    ichnaea_Message_MSG_TELEMETRY_SUB_REQ = 130, /* Request to change the telemetry subscription */
+    ichnaea_Message_MSG_TELEMETRY_SUB_RSP = 131, /* Response to the TelemetrySubscribeRequest message */
+    ichnaea_Message_MSG_SENSOR_BATCH_REQ = 132, /* Request to read a set of sensor values */
+    ichnaea_Message_MSG_SENSOR_BATCH_RSP = 133, /* Response to the SensorBatchRequest message */
+    ichnaea_Message_MSG_LINK_BAUD_REQ = 134, /* Request to change the RPC link baud rate */
+    ichnaea_Message_MSG_LINK_BAUD_RSP = 135, /* Response to the LinkBaudRequest message */
+    ichnaea_Message_MSG_LTC_REG_GET_REQ = 136, /* Request to read LTC7871 registers */
+    ichnaea_Message_MSG_LTC_REG_GET_RSP = 137, /* Response to the LTCRegGetRequest message */
+    ichnaea_Message_MSG_LTC_REG_SET_REQ = 138, /* Request to write an LTC7871 register */
+    ichnaea_Message_MSG_LTC_REG_SET_RSP = 139, /* Response to the LTCRegSetRequest message */
+    ichnaea_Message_MSG_GROUP_CMD_REQ = 140, /* Request to schedule a command on a group of nodes */
+    ichnaea_Message_MSG_GROUP_CMD_RSP = 141 /* Response to the GroupCommandRequest message */
 } ichnaea_Message;
 
 /* Version of the message. This is used to ensure that the message is compatible
@@ -64,7 +95,29 @@ typedef enum _ichnaea_MessageVersion {
     ichnaea_MessageVersion_MSG_VER_PDI_WRITE_REQ = 0,
     ichnaea_MessageVersion_MSG_VER_PDI_WRITE_RSP = 0,
     ichnaea_MessageVersion_MSG_VER_SYSTEM_STATUS_REQ = 0,
-    ichnaea_MessageVersion_MSG_VER_SYSTEM_STATUS_RSP = 0
+    ichnaea_MessageVersion_MSG_VER_SYSTEM_STATUS_RSP = 0,
+    ichnaea_MessageVersion_MSG_VER_BOOT_TIMELINE_REQ = 0,
+    ichnaea_MessageVersion_MSG_VER_BOOT_TIMELINE_RSP = 0,
+    ichnaea_MessageVersion_MSG_VER_CAL_WRITE_REQ = 0,
+    ichnaea_MessageVersion_MSG_VER_CAL_WRITE_RSP = 0,
+    ichnaea_MessageVersion_MSG_VER_FLASH_STATS_REQ = 0,
+    ichnaea_MessageVersion_MSG_VER_FLASH_STATS_RSP = 0,
+    ichnaea_MessageVersion_MSG_VER_LOG_QUERY_REQ = 0,
+    ichnaea_MessageVersion_MSG_VER_LOG_QUERY_RSP = 0,
+    ichnaea_MessageVersion_MSG_VER_FLIGHT_RECORDER_REQ = 0,
+    ichnaea_MessageVersion_MSG_VER_FLIGHT_RECORDER_RSP = 0,
+    ichnaea_MessageVersion_MSG_VER_TELEMETRY_SUB_REQ = 0,
+    ichnaea_MessageVersion_MSG_VER_TELEMETRY_SUB_RSP = 0,
+    ichnaea_MessageVersion_MSG_VER_SENSOR_BATCH_REQ = 0,
+    ichnaea_MessageVersion_MSG_VER_SENSOR_BATCH_RSP = 0,
+    ichnaea_MessageVersion_MSG_VER_LINK_BAUD_REQ = 0,
+    ichnaea_MessageVersion_MSG_VER_LINK_BAUD_RSP = 0,
+    ichnaea_MessageVersion_MSG_VER_LTC_REG_GET_REQ = 0,
+    ichnaea_MessageVersion_MSG_VER_LTC_REG_GET_RSP = 0,
+    ichnaea_MessageVersion_MSG_VER_LTC_REG_SET_REQ = 0,
+    ichnaea_MessageVersion_MSG_VER_LTC_REG_SET_RSP = 0,
+    ichnaea_MessageVersion_MSG_VER_GROUP_CMD_REQ = 0,
+    ichnaea_MessageVersion_MSG_VER_GROUP_CMD_RSP = 0
 } ichnaea_MessageVersion;
 
 typedef enum _ichnaea_ManagerCommand {
@@ -119,6 +172,94 @@ typedef enum _ichnaea_EngageState {
     ichnaea_EngageState_FAULTED = 2 /* Power stage faulted */
 } ichnaea_EngageState;
 
+/* Individual steps of the boot sequence that are timed by the profiler */
+typedef enum _ichnaea_BootStepId {
+    ichnaea_BootStepId_BOOT_STEP_INIT_DRIVERS = 0, /* System::Boot::initDrivers */
+    ichnaea_BootStepId_BOOT_STEP_OSAL = 1, /* OSAL, assert and panic handler setup */
+    ichnaea_BootStepId_BOOT_STEP_BSP = 2, /* Board support package power up */
+    ichnaea_BootStepId_BOOT_STEP_HW_INTF = 3, /* mbedutils hardware integration layers */
+    ichnaea_BootStepId_BOOT_STEP_HW_GPIO = 4, /* HW::GPIO::initialize */
+    ichnaea_BootStepId_BOOT_STEP_HW_LED = 5, /* HW::LED::initialize */
+    ichnaea_BootStepId_BOOT_STEP_HW_ADC = 6, /* HW::ADC::initialize */
+    ichnaea_BootStepId_BOOT_STEP_HW_UART = 7, /* HW::UART::initialize */
+    ichnaea_BootStepId_BOOT_STEP_HW_FAN = 8, /* HW::FAN::initialize */
+    ichnaea_BootStepId_BOOT_STEP_HW_LTC7871 = 9, /* HW::LTC7871::driver_init */
+    ichnaea_BootStepId_BOOT_STEP_THREADS = 10, /* Threads::initialize */
+    ichnaea_BootStepId_BOOT_STEP_INIT_TECH = 11, /* System::Boot::initTech */
+    ichnaea_BootStepId_BOOT_STEP_CONTROL = 12, /* Control::initialize */
+    ichnaea_BootStepId_BOOT_STEP_LOGGING = 13, /* Logging::initialize */
+    ichnaea_BootStepId_BOOT_STEP_KVDB_INIT = 14, /* System::Database::initialize */
+    ichnaea_BootStepId_BOOT_STEP_SENSOR = 15, /* System::Sensor::initialize */
+    ichnaea_BootStepId_BOOT_STEP_POST = 16, /* System::Boot::runPostInit */
+    ichnaea_BootStepId_BOOT_STEP_POST_LOGGING = 17, /* Logging::postSequence */
+    ichnaea_BootStepId_BOOT_STEP_POST_LTC7871 = 18, /* HW::LTC7871::postSequence */
+    ichnaea_BootStepId_BOOT_STEP_POST_LED = 19, /* HW::LED::postSequence */
+    ichnaea_BootStepId_BOOT_STEP_POST_ADC = 20, /* HW::ADC::postSequence */
+    ichnaea_BootStepId_BOOT_STEP_POST_FAN = 21, /* HW::FAN::postSequence */
+    ichnaea_BootStepId_BOOT_STEP_APP_CONFIG = 22, /* App::Config::driver_init */
+    ichnaea_BootStepId_BOOT_STEP_APP_STATS = 23, /* App::Stats::driver_init */
+    ichnaea_BootStepId_BOOT_STEP_APP_POWER = 24, /* App::Power::driver_init */
+    ichnaea_BootStepId_BOOT_STEP_APP_FILTER = 25, /* App::Filter::driver_init */
+    ichnaea_BootStepId_BOOT_STEP_APP_MONITOR = 26, /* App::Monitor::driver_init */
+    ichnaea_BootStepId_BOOT_STEP_PDI_REGISTER = 27, /* PDI key registration. Tag is the PDI_ID. */
+    ichnaea_BootStepId_BOOT_STEP_POST_DEFERRED = 28, /* System::Boot::runDeferredPost */
+    ichnaea_BootStepId_BOOT_STEP_CAL_STORE = 29, /* System::CalStore::initialize */
+    ichnaea_BootStepId_BOOT_STEP_FLASH_STATS = 30, /* System::FlashStats::initialize */
+    ichnaea_BootStepId_BOOT_STEP_APP_GROUP = 31 /* App::Group::driver_init */
+} ichnaea_BootStepId;
+
+/* Calibrations held in the dedicated calibration store */
+typedef enum _ichnaea_CalibrationId {
+    ichnaea_CalibrationId_CAL_OUTPUT_CURRENT = 0 /* Load output current sensor */
+} ichnaea_CalibrationId;
+
+/* Operations tracked by the flash latency histograms */
+typedef enum _ichnaea_FlashOp {
+    ichnaea_FlashOp_FLASH_OP_READ = 0,
+    ichnaea_FlashOp_FLASH_OP_PROGRAM = 1,
+    ichnaea_FlashOp_FLASH_OP_ERASE = 2
+} ichnaea_FlashOp;
+
+typedef enum _ichnaea_FlightRecorderState {
+    ichnaea_FlightRecorderState_FR_ARMED = 0, /* Recording, waiting on a fault */
+    ichnaea_FlightRecorderState_FR_TRIGGERED = 1, /* Fault seen, filling the post-trigger window */
+    ichnaea_FlightRecorderState_FR_FROZEN = 2 /* Window captured and ready to read */
+} ichnaea_FlightRecorderState;
+
+typedef enum _ichnaea_LinkBaudStatus {
+    ichnaea_LinkBaudStatus_LINK_BAUD_OK = 0, /* Request accepted */
+    ichnaea_LinkBaudStatus_LINK_BAUD_UNSUPPORTED = 1, /* Rate is not one the node can run at */
+    ichnaea_LinkBaudStatus_LINK_BAUD_BUSY = 2 /* A switch is already in progress or the confirm did not match */
+} ichnaea_LinkBaudStatus;
+
+typedef enum _ichnaea_LTCRegStatus {
+    ichnaea_LTCRegStatus_LTC_REG_OK = 0, /* Access completed */
+    ichnaea_LTCRegStatus_LTC_REG_INVALID_ADDR = 1, /* Register is outside the MFR register map */
+    ichnaea_LTCRegStatus_LTC_REG_READ_ONLY = 2, /* Register cannot be written from the host */
+    ichnaea_LTCRegStatus_LTC_REG_BAD_MODE = 3, /* Driver is not in a mode that allows the access */
+    ichnaea_LTCRegStatus_LTC_REG_BAD_VALUE = 4 /* Value sets bits the register does not implement */
+} ichnaea_LTCRegStatus;
+
+typedef enum _ichnaea_GroupAddress {
+    ichnaea_GroupAddress_GROUP_ID_MAX = 31, /* Highest group a node can join through its PDI membership mask */
+    ichnaea_GroupAddress_GROUP_ID_ALL = 255 /* Reaches every node regardless of membership */
+} ichnaea_GroupAddress;
+
+typedef enum _ichnaea_GroupAction {
+    ichnaea_GroupAction_GROUP_ACTION_SETPOINT = 0, /* Apply field and value as a SetpointRequest would */
+    ichnaea_GroupAction_GROUP_ACTION_ENGAGE_OUTPUT = 1, /* Enable power output from the node */
+    ichnaea_GroupAction_GROUP_ACTION_DISENGAGE_OUTPUT = 2, /* Disable power output from the node */
+    ichnaea_GroupAction_GROUP_ACTION_CANCEL = 3 /* Drop the pending command without running it */
+} ichnaea_GroupAction;
+
+typedef enum _ichnaea_GroupCommandStatus {
+    ichnaea_GroupCommandStatus_GROUP_CMD_OK = 0, /* Command is scheduled */
+    ichnaea_GroupCommandStatus_GROUP_CMD_INVALID = 1, /* Action or setpoint field is not supported */
+    ichnaea_GroupCommandStatus_GROUP_CMD_BAD_DELAY = 2, /* Delay is outside the range the node can schedule */
+    ichnaea_GroupCommandStatus_GROUP_CMD_LATE = 3, /* Node processed the frame after the execution time */
+    ichnaea_GroupCommandStatus_GROUP_CMD_BAD_VALUE = 4 /* Setpoint value is outside what the node accepts */
+} ichnaea_GroupCommandStatus;
+
 /* Struct definitions */
 typedef struct _ichnaea_PingNodeRequest {
     mbed_rpc_Header header;
@@ -191,6 +332,26 @@ typedef struct _ichnaea_SensorResponse {
     float value;
 } ichnaea_SensorResponse;
 
+/* Reads every sensor with its bit set in sensor_mask (bit N is SensorType N). */
+typedef struct _ichnaea_SensorBatchRequest {
+    mbed_rpc_Header header;
+    uint32_t node_id;
+    uint16_t sensor_mask;
+} ichnaea_SensorBatchRequest;
+
+/* Values are in order of increasing SensorType, one per bit set in
+ sensor_mask. All of them come from the same monitor pass, taken at
+ timestamp. Unsupported sensors are dropped from the mask and flagged with
+ ERR_SENSOR_NOT_SUPPORTED. */
+typedef struct _ichnaea_SensorBatchResponse {
+    mbed_rpc_Header header;
+    ichnaea_SensorError status;
+    uint16_t sensor_mask;
+    uint32_t timestamp; /* System time in milliseconds of the sample */
+    pb_size_t values_count;
+    float values[11];
+} ichnaea_SensorBatchResponse;
+
 typedef struct _ichnaea_PDIReadRequest {
     mbed_rpc_Header header;
     uint32_t node_id;
@@ -222,12 +383,267 @@ typedef struct _ichnaea_SystemStatusRequest {
     uint32_t node_id;
 } ichnaea_SystemStatusRequest;
 
+/* Transmit queue of one priority class. Entries of SystemStatusResponse
+ are in priority order: telemetry, then bulk logs. */
+typedef struct _ichnaea_TxQueueStats {
+    uint16_t depth; /* Messages waiting to be sent */
+    uint16_t high_water; /* Deepest the queue has been */
+    uint32_t sent; /* Messages sent */
+    uint32_t dropped; /* Messages lost to a full queue */
+} ichnaea_TxQueueStats;
+
 typedef struct _ichnaea_SystemStatusResponse {
     mbed_rpc_Header header;
     uint32_t timestamp; /* System time in ms */
     ichnaea_EngageState output_state; /* Power stage output state */
+    /* TODO: Asserts/fault counters */
+    pb_size_t tx_queues_count;
+    ichnaea_TxQueueStats tx_queues[2];
 } ichnaea_SystemStatusResponse;
 
+/* A single timed step in the boot sequence */
+typedef struct _ichnaea_BootStep {
+    ichnaea_BootStepId step;
+    uint8_t depth; /* Nesting level of the step */
+    uint16_t tag; /* Step specific tag, ie PDI_ID */
+    uint32_t start_us; /* Start time since power on in us */
+    uint32_t duration_us; /* Time spent in the step in us */
+} ichnaea_BootStep;
+
+typedef struct _ichnaea_BootTimelineRequest {
+    mbed_rpc_Header header;
+    uint32_t node_id;
+    uint8_t offset; /* First step index to return */
+} ichnaea_BootTimelineRequest;
+
+typedef struct _ichnaea_BootTimelineResponse {
+    mbed_rpc_Header header;
+    uint8_t total; /* Total steps recorded this boot */
+    uint8_t offset; /* Index of the first step returned */
+    bool complete; /* Boot sequence finished */
+    pb_size_t steps_count;
+    ichnaea_BootStep steps[20];
+} ichnaea_BootTimelineResponse;
+
+/* Linear calibration for a single sensor: y = gain * x - offset */
+typedef struct _ichnaea_CalibrationEntry {
+    ichnaea_CalibrationId id;
+    float offset;
+    float gain;
+    float valid_min; /* Minimum valid calibrated value */
+    float valid_max; /* Maximum valid calibrated value */
+} ichnaea_CalibrationEntry;
+
+/* Write a set of calibrations in one shot. The entries are committed to flash
+ as a single record, so either all of them take effect or none do. */
+typedef struct _ichnaea_CalWriteRequest {
+    mbed_rpc_Header header;
+    uint32_t node_id;
+    pb_size_t entries_count;
+    ichnaea_CalibrationEntry entries[8];
+} ichnaea_CalWriteRequest;
+
+typedef struct _ichnaea_CalWriteResponse {
+    mbed_rpc_Header header;
+    bool success;
+    bool has_message;
+    char message[64];
+} ichnaea_CalWriteResponse;
+
+/* Log2 latency histogram. Bucket 0 counts ops under 2us, bucket N counts ops
+ in [2^N, 2^(N+1)) us and the last bucket catches everything slower. */
+typedef struct _ichnaea_FlashLatencyHistogram {
+    ichnaea_FlashOp op;
+    pb_size_t buckets_count;
+    uint32_t buckets[20];
+} ichnaea_FlashLatencyHistogram;
+
+typedef struct _ichnaea_FlashStatsRequest {
+    mbed_rpc_Header header;
+    uint32_t node_id;
+    uint16_t sector_offset; /* First sector erase count to return */
+} ichnaea_FlashStatsRequest;
+
+/* Lifetime totals and histograms are repeated in every page. The per-sector
+ erase counts are paged, starting from the requested sector. */
+typedef struct _ichnaea_FlashStatsResponse {
+    mbed_rpc_Header header;
+    uint64_t bytes_read;
+    uint64_t bytes_programmed;
+    uint64_t read_ops;
+    uint64_t program_ops;
+    uint64_t erase_ops;
+    uint16_t num_sectors; /* Sectors with erase counters */
+    uint16_t sector_offset; /* Sector of the first erase count */
+    pb_size_t erase_counts_count;
+    uint32_t erase_counts[20];
+    pb_size_t latency_count;
+    ichnaea_FlashLatencyHistogram latency[3];
+} ichnaea_FlashStatsResponse;
+
+/* Times are in log time, milliseconds on a clock that keeps counting across
+ reboots. Each response reports the node's current log time so the host can
+ convert. Continue a query by sending the next_time and skip values from the
+ previous response as start_time and skip. */
+typedef struct _ichnaea_LogQueryRequest {
+    mbed_rpc_Header header;
+    uint32_t node_id;
+    uint64_t start_time; /* Oldest record to return */
+    uint64_t end_time; /* Newest record to return, 0 for now */
+    uint32_t last_ms; /* If non-zero, overrides start/end with the last N ms */
+    uint8_t min_level; /* mb::logging::Level */
+    uint16_t max_count; /* Records to return, 0 for as many as fit */
+    uint16_t skip; /* Matches at start_time already received */
+} ichnaea_LogQueryRequest;
+
+typedef PB_BYTES_ARRAY_T(512) ichnaea_LogQueryResponse_data_t;
+/* Records are packed into data back to back. Each one is a 4 byte little
+ endian offset from base_time, a one byte log level, a one byte length, then
+ that many bytes of the message. */
+typedef struct _ichnaea_LogQueryResponse {
+    mbed_rpc_Header header;
+    uint64_t now; /* Current log time on the node */
+    uint64_t base_time; /* Time the record offsets are relative to */
+    uint16_t count; /* Records in data */
+    bool more; /* Matches remain past this page */
+    uint64_t next_time; /* Start time to continue the query from */
+    uint16_t skip; /* Skip value to continue the query with */
+    ichnaea_LogQueryResponse_data_t data;
+} ichnaea_LogQueryResponse;
+
+/* Channels below the sensor count are SensorType values. The next three are
+ the LTC output voltage setpoint, current setpoint and fault bits. */
+typedef struct _ichnaea_FlightSample {
+    uint32_t time; /* System time in milliseconds */
+    uint8_t channel;
+    float raw; /* Measurement or requested setpoint */
+    float value; /* Filter output or programmed register code */
+} ichnaea_FlightSample;
+
+/* Read the capture a page at a time by advancing offset. Setting rearm
+ discards the capture after this page is filled. */
+typedef struct _ichnaea_FlightRecorderRequest {
+    mbed_rpc_Header header;
+    uint32_t node_id;
+    uint16_t offset; /* First sample of the window to return */
+    bool rearm; /* Start recording again */
+    uint16_t pre_trigger; /* New pre-trigger depth on rearm, 0 to keep */
+    uint16_t post_trigger; /* New post-trigger depth on rearm, 0 to keep */
+    bool persist; /* Write future captures to the log store, applied on rearm */
+} ichnaea_FlightRecorderRequest;
+
+typedef struct _ichnaea_FlightRecorderResponse {
+    mbed_rpc_Header header;
+    ichnaea_FlightRecorderState state;
+    uint8_t trigger_code; /* Panic error code that froze the capture */
+    uint32_t trigger_time; /* System time of the trigger */
+    uint16_t total; /* Samples in the captured window */
+    uint16_t trigger_index; /* Window index of the first post-trigger sample */
+    uint16_t offset; /* Window index of the first sample in this page */
+    pb_size_t samples_count;
+    ichnaea_FlightSample samples[24];
+} ichnaea_FlightRecorderResponse;
+
+/* Replaces the node's single telemetry subscription. Frames are then pushed
+ as async Telemetry messages until a request with an empty mask stops them. */
+typedef struct _ichnaea_TelemetrySubscribeRequest {
+    mbed_rpc_Header header;
+    uint32_t node_id;
+    uint16_t sensor_mask; /* Bit per SensorType, 0 to stop */
+    uint16_t period_ms; /* Time between frames */
+    float deadband; /* Smallest change in a value that gets sent */
+    uint16_t keyframe_ms; /* Time between full frames, 0 for the default */
+} ichnaea_TelemetrySubscribeRequest;
+
+/* Echoes the subscription as applied, after unsupported sensors are dropped
+ and the timing is clamped to what the node can send. */
+typedef struct _ichnaea_TelemetrySubscribeResponse {
+    mbed_rpc_Header header;
+    uint16_t sensor_mask;
+    uint16_t period_ms;
+    float deadband;
+    uint16_t keyframe_ms;
+} ichnaea_TelemetrySubscribeResponse;
+
+/* A request with confirm clear asks the node to switch rates. The response
+ goes out at the old rate and the node switches shortly after. The host then
+ reopens its port at the new rate and sends the same request with confirm
+ set. Without that confirm the node drops back to the default rate. */
+typedef struct _ichnaea_LinkBaudRequest {
+    mbed_rpc_Header header;
+    uint32_t node_id;
+    uint32_t baud; /* Requested line rate, 0 to only read the status */
+    bool confirm; /* Host is now talking at this rate */
+} ichnaea_LinkBaudRequest;
+
+typedef struct _ichnaea_LinkBaudResponse {
+    mbed_rpc_Header header;
+    ichnaea_LinkBaudStatus status;
+    uint32_t baud; /* Rate the link is running at */
+    uint32_t fallbacks; /* Times the link dropped back to the default rate */
+    uint32_t line_errors; /* Receive line errors seen since boot */
+    pb_size_t supported_count;
+    uint32_t supported[8];
+} ichnaea_LinkBaudResponse;
+
+/* Reads a single register, or with dump set every MFR register in one burst
+ on the bus so the values form a consistent snapshot. */
+typedef struct _ichnaea_LTCRegGetRequest {
+    mbed_rpc_Header header;
+    uint32_t node_id;
+    uint8_t reg; /* Register address, ignored for a dump */
+    bool dump; /* Read the whole register map */
+} ichnaea_LTCRegGetRequest;
+
+typedef PB_BYTES_ARRAY_T(16) ichnaea_LTCRegGetResponse_values_t;
+/* Register values in address order, starting at first_reg */
+typedef struct _ichnaea_LTCRegGetResponse {
+    mbed_rpc_Header header;
+    ichnaea_LTCRegStatus status;
+    uint8_t first_reg;
+    ichnaea_LTCRegGetResponse_values_t values;
+} ichnaea_LTCRegGetResponse;
+
+/* Writes are limited to the IDAC and spread spectrum registers and are only
+ accepted while the power stage is not enabled. The IDAC write protection is
+ lifted for the write and restored after. */
+typedef struct _ichnaea_LTCRegSetRequest {
+    mbed_rpc_Header header;
+    uint32_t node_id;
+    uint8_t reg;
+    uint8_t value;
+} ichnaea_LTCRegSetRequest;
+
+typedef struct _ichnaea_LTCRegSetResponse {
+    mbed_rpc_Header header;
+    ichnaea_LTCRegStatus status;
+    uint8_t value; /* Register read back after the write */
+} ichnaea_LTCRegSetResponse;
+
+/* Broadcast once to every member of a group. Each member times the delay from
+ the moment the frame finished arriving on its link, not from when it got
+ around to processing it, so members on the same bus act together. A newer
+ command replaces one that is still pending. */
+typedef struct _ichnaea_GroupCommandRequest {
+    mbed_rpc_Header header;
+    uint8_t group_id; /* Group to address, or GROUP_ID_ALL */
+    uint16_t command_id; /* Host chosen tag echoed in every ack */
+    ichnaea_GroupAction action;
+    ichnaea_SetpointField field; /* Setpoint to change, only for GROUP_ACTION_SETPOINT */
+    float value; /* Setpoint value, only for GROUP_ACTION_SETPOINT */
+    uint32_t delay_us; /* Time from frame arrival to execution */
+} ichnaea_GroupCommandRequest;
+
+/* Sent by every member that received the command. Nodes outside the group
+ stay silent. */
+typedef struct _ichnaea_GroupCommandResponse {
+    mbed_rpc_Header header;
+    uint32_t node_id;
+    uint16_t command_id;
+    ichnaea_GroupCommandStatus status;
+    uint32_t latency_us; /* Time between frame arrival and the node processing it */
+} ichnaea_GroupCommandResponse;
+
 
 #ifdef __cplusplus
 extern "C" {
@@ -235,16 +651,16 @@ extern "C" {
 
 /* Helper constants for enums */
 #define _ichnaea_Service_MIN ichnaea_Service_SVC_IDENTITY
-#define _ichnaea_Service_MAX ichnaea_Service_SVC_SYSTEM_STATUS
-#define _ichnaea_Service_ARRAYSIZE ((ichnaea_Service)(ichnaea_Service_SVC_SYSTEM_STATUS+1))
+#define _ichnaea_Service_MAX ichnaea_Service_SVC_GROUP_COMMAND
+#define _ichnaea_Service_ARRAYSIZE ((ichnaea_Service)(ichnaea_Service_SVC_GROUP_COMMAND+1))
 
 #define _ichnaea_Message_MIN ichnaea_Message_MSG_GET_ID_REQ
-#define _ichnaea_Message_MAX ichnaea_Message_MSG_SYSTEM_STATUS_RSP
-#define _ichnaea_Message_ARRAYSIZE ((ichnaea_Message)(ichnaea_Message_MSG_SYSTEM_STATUS_RSP+1))
+#define _ichnaea_Message_MAX ichnaea_Message_MSG_GROUP_CMD_RSP
+#define _ichnaea_Message_ARRAYSIZE ((ichnaea_Message)(ichnaea_Message_MSG_GROUP_CMD_RSP+1))
 
-#define _ichnaea_MessageVersion_MIN ichnaea_MessageVersion_MSG_VER_GET_ID_REQ
-#define _ichnaea_MessageVersion_MAX ichnaea_MessageVersion_MSG_VER_SYSTEM_STATUS_RSP
-#define _ichnaea_MessageVersion_ARRAYSIZE ((ichnaea_MessageVersion)(ichnaea_MessageVersion_MSG_VER_SYSTEM_STATUS_RSP+1))
+#define _ichnaea_MessageVersion_MIN ichnaea_MessageVersion_MSG_VER_BOOT_TIMELINE_REQ
+#define _ichnaea_MessageVersion_MAX ichnaea_MessageVersion_MSG_VER_TELEMETRY_SUB_RSP
+#define _ichnaea_MessageVersion_ARRAYSIZE ((ichnaea_MessageVersion)(ichnaea_MessageVersion_MSG_VER_TELEMETRY_SUB_RSP+1))
 
 #define _ichnaea_ManagerCommand_MIN ichnaea_ManagerCommand_CMD_REBOOT
 #define _ichnaea_ManagerCommand_MAX ichnaea_ManagerCommand_CMD_ZERO_OUTPUT_CURRENT
@@ -274,6 +690,42 @@ extern "C" {
 #define _ichnaea_EngageState_MAX ichnaea_EngageState_FAULTED
 #define _ichnaea_EngageState_ARRAYSIZE ((ichnaea_EngageState)(ichnaea_EngageState_FAULTED+1))
 
+#define _ichnaea_BootStepId_MIN ichnaea_BootStepId_BOOT_STEP_INIT_DRIVERS
+#define _ichnaea_BootStepId_MAX ichnaea_BootStepId_BOOT_STEP_APP_GROUP
+#define _ichnaea_BootStepId_ARRAYSIZE ((ichnaea_BootStepId)(ichnaea_BootStepId_BOOT_STEP_APP_GROUP+1))
+
+#define _ichnaea_CalibrationId_MIN ichnaea_CalibrationId_CAL_OUTPUT_CURRENT
+#define _ichnaea_CalibrationId_MAX ichnaea_CalibrationId_CAL_OUTPUT_CURRENT
+#define _ichnaea_CalibrationId_ARRAYSIZE ((ichnaea_CalibrationId)(ichnaea_CalibrationId_CAL_OUTPUT_CURRENT+1))
+
+#define _ichnaea_FlashOp_MIN ichnaea_FlashOp_FLASH_OP_READ
+#define _ichnaea_FlashOp_MAX ichnaea_FlashOp_FLASH_OP_ERASE
+#define _ichnaea_FlashOp_ARRAYSIZE ((ichnaea_FlashOp)(ichnaea_FlashOp_FLASH_OP_ERASE+1))
+
+#define _ichnaea_FlightRecorderState_MIN ichnaea_FlightRecorderState_FR_ARMED
+#define _ichnaea_FlightRecorderState_MAX ichnaea_FlightRecorderState_FR_FROZEN
+#define _ichnaea_FlightRecorderState_ARRAYSIZE ((ichnaea_FlightRecorderState)(ichnaea_FlightRecorderState_FR_FROZEN+1))
+
+#define _ichnaea_LinkBaudStatus_MIN ichnaea_LinkBaudStatus_LINK_BAUD_OK
+#define _ichnaea_LinkBaudStatus_MAX ichnaea_LinkBaudStatus_LINK_BAUD_BUSY
+#define _ichnaea_LinkBaudStatus_ARRAYSIZE ((ichnaea_LinkBaudStatus)(ichnaea_LinkBaudStatus_LINK_BAUD_BUSY+1))
+
+#define _ichnaea_LTCRegStatus_MIN ichnaea_LTCRegStatus_LTC_REG_OK
+#define _ichnaea_LTCRegStatus_MAX ichnaea_LTCRegStatus_LTC_REG_BAD_VALUE
+#define _ichnaea_LTCRegStatus_ARRAYSIZE ((ichnaea_LTCRegStatus)(ichnaea_LTCRegStatus_LTC_REG_BAD_VALUE+1))
+
+#define _ichnaea_GroupAddress_MIN ichnaea_GroupAddress_GROUP_ID_MAX
+#define _ichnaea_GroupAddress_MAX ichnaea_GroupAddress_GROUP_ID_ALL
+#define _ichnaea_GroupAddress_ARRAYSIZE ((ichnaea_GroupAddress)(ichnaea_GroupAddress_GROUP_ID_ALL+1))
+
+#define _ichnaea_GroupAction_MIN ichnaea_GroupAction_GROUP_ACTION_SETPOINT
+#define _ichnaea_GroupAction_MAX ichnaea_GroupAction_GROUP_ACTION_CANCEL
+#define _ichnaea_GroupAction_ARRAYSIZE ((ichnaea_GroupAction)(ichnaea_GroupAction_GROUP_ACTION_CANCEL+1))
+
+#define _ichnaea_GroupCommandStatus_MIN ichnaea_GroupCommandStatus_GROUP_CMD_OK
+#define _ichnaea_GroupCommandStatus_MAX ichnaea_GroupCommandStatus_GROUP_CMD_BAD_VALUE
+#define _ichnaea_GroupCommandStatus_ARRAYSIZE ((ichnaea_GroupCommandStatus)(ichnaea_GroupCommandStatus_GROUP_CMD_BAD_VALUE+1))
+
 
 
 
@@ -291,12 +743,50 @@ extern "C" {
 #define ichnaea_SensorResponse_status_ENUMTYPE ichnaea_SensorError
 
 
+#define ichnaea_SensorBatchResponse_status_ENUMTYPE ichnaea_SensorError
+
+
+
 
 
 
 
 #define ichnaea_SystemStatusResponse_output_state_ENUMTYPE ichnaea_EngageState
 
+#define ichnaea_BootStep_step_ENUMTYPE ichnaea_BootStepId
+
+
+
+#define ichnaea_CalibrationEntry_id_ENUMTYPE ichnaea_CalibrationId
+
+
+
+#define ichnaea_FlashLatencyHistogram_op_ENUMTYPE ichnaea_FlashOp
+
+
+
+
+
+
+
+#define ichnaea_FlightRecorderResponse_state_ENUMTYPE ichnaea_FlightRecorderState
+
+
+
+
+#define ichnaea_LinkBaudResponse_status_ENUMTYPE ichnaea_LinkBaudStatus
+
+
+#define ichnaea_LTCRegGetResponse_status_ENUMTYPE ichnaea_LTCRegStatus
+
+
+#define ichnaea_LTCRegSetResponse_status_ENUMTYPE ichnaea_LTCRegStatus
+
+#define ichnaea_GroupCommandRequest_action_ENUMTYPE ichnaea_GroupAction
+#define ichnaea_GroupCommandRequest_field_ENUMTYPE ichnaea_SetpointField
+
+#define ichnaea_GroupCommandResponse_status_ENUMTYPE ichnaea_GroupCommandStatus
+
 
 /* Initializer values for message structs */
 #define ichnaea_PingNodeRequest_init_default     {mbed_rpc_Header_init_default, 0}
@@ -309,12 +799,39 @@ extern "C" {
 #define ichnaea_SetpointResponse_init_default    {mbed_rpc_Header_init_default, _ichnaea_SetpointError_MIN, false, ""}
 #define ichnaea_SensorRequest_init_default       {mbed_rpc_Header_init_default, 0, _ichnaea_SensorType_MIN}
 #define ichnaea_SensorResponse_init_default      {mbed_rpc_Header_init_default, _ichnaea_SensorError_MIN, 0}
+#define ichnaea_SensorBatchRequest_init_default  {mbed_rpc_Header_init_default, 0, 0}
+#define ichnaea_SensorBatchResponse_init_default {mbed_rpc_Header_init_default, _ichnaea_SensorError_MIN, 0, 0, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}
 #define ichnaea_PDIReadRequest_init_default      {mbed_rpc_Header_init_default, 0, 0}
 #define ichnaea_PDIReadResponse_init_default     {mbed_rpc_Header_init_default, 0, {0, {0}}}
 #define ichnaea_PDIWriteRequest_init_default     {mbed_rpc_Header_init_default, 0, 0, {0, {0}}}
 #define ichnaea_PDIWriteResponse_init_default    {mbed_rpc_Header_init_default, 0}
 #define ichnaea_SystemStatusRequest_init_default {mbed_rpc_Header_init_default, 0}
-#define ichnaea_SystemStatusResponse_init_default {mbed_rpc_Header_init_default, 0, _ichnaea_EngageState_MIN}
+#define ichnaea_TxQueueStats_init_default        {0, 0, 0, 0}
+#define ichnaea_SystemStatusResponse_init_default {mbed_rpc_Header_init_default, 0, _ichnaea_EngageState_MIN, 0, {ichnaea_TxQueueStats_init_default, ichnaea_TxQueueStats_init_default}}
+#define ichnaea_BootStep_init_default            {_ichnaea_BootStepId_MIN, 0, 0, 0, 0}
+#define ichnaea_BootTimelineRequest_init_default {mbed_rpc_Header_init_default, 0, 0}
+#define ichnaea_BootTimelineResponse_init_default {mbed_rpc_Header_init_default, 0, 0, 0, 0, {ichnaea_BootStep_init_default, ichnaea_BootStep_init_default, ichnaea_BootStep_init_default, ichnaea_BootStep_init_default, ichnaea_BootStep_init_default, ichnaea_BootStep_init_default, ichnaea_BootStep_init_default, ichnaea_BootStep_init_default, ichnaea_BootStep_init_default, ichnaea_BootStep_init_default, ichnaea_BootStep_init_default, ichnaea_BootStep_init_default, ichnaea_BootStep_init_default, ichnaea_BootStep_init_default, ichnaea_BootStep_init_default, ichnaea_BootStep_init_default, ichnaea_BootStep_init_default, ichnaea_BootStep_init_default, ichnaea_BootStep_init_default, ichnaea_BootStep_init_default}}
+#define ichnaea_CalibrationEntry_init_default    {_ichnaea_CalibrationId_MIN, 0, 0, 0, 0}
+#define ichnaea_CalWriteRequest_init_default     {mbed_rpc_Header_init_default, 0, 0, {ichnaea_CalibrationEntry_init_default, ichnaea_CalibrationEntry_init_default, ichnaea_CalibrationEntry_init_default, ichnaea_CalibrationEntry_init_default, ichnaea_CalibrationEntry_init_default, ichnaea_CalibrationEntry_init_default, ichnaea_CalibrationEntry_init_default, ichnaea_CalibrationEntry_init_default}}
+#define ichnaea_CalWriteResponse_init_default    {mbed_rpc_Header_init_default, 0, false, ""}
+#define ichnaea_FlashLatencyHistogram_init_default {_ichnaea_FlashOp_MIN, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}
+#define ichnaea_FlashStatsRequest_init_default   {mbed_rpc_Header_init_default, 0, 0}
+#define ichnaea_FlashStatsResponse_init_default  {mbed_rpc_Header_init_default, 0, 0, 0, 0, 0, 0, 0, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 0, {ichnaea_FlashLatencyHistogram_init_default, ichnaea_FlashLatencyHistogram_init_default, ichnaea_FlashLatencyHistogram_init_default}}
+#define ichnaea_LogQueryRequest_init_default     {mbed_rpc_Header_init_default, 0, 0, 0, 0, 0, 0, 0}
+#define ichnaea_LogQueryResponse_init_default    {mbed_rpc_Header_init_default, 0, 0, 0, 0, 0, 0, {0, {0}}}
+#define ichnaea_FlightSample_init_default        {0, 0, 0, 0}
+#define ichnaea_FlightRecorderRequest_init_default {mbed_rpc_Header_init_default, 0, 0, 0, 0, 0, 0}
+#define ichnaea_FlightRecorderResponse_init_default {mbed_rpc_Header_init_default, _ichnaea_FlightRecorderState_MIN, 0, 0, 0, 0, 0, 0, {ichnaea_FlightSample_init_default, ichnaea_FlightSample_init_default, ichnaea_FlightSample_init_default, ichnaea_FlightSample_init_default, ichnaea_FlightSample_init_default, ichnaea_FlightSample_init_default, ichnaea_FlightSample_init_default, ichnaea_FlightSample_init_default, ichnaea_FlightSample_init_default, ichnaea_FlightSample_init_default, ichnaea_FlightSample_init_default, ichnaea_FlightSample_init_default, ichnaea_FlightSample_init_default, ichnaea_FlightSample_init_default, ichnaea_FlightSample_init_default, ichnaea_FlightSample_init_default, ichnaea_FlightSample_init_default, ichnaea_FlightSample_init_default, ichnaea_FlightSample_init_default, ichnaea_FlightSample_init_default, ichnaea_FlightSample_init_default, ichnaea_FlightSample_init_default, ichnaea_FlightSample_init_default, ichnaea_FlightSample_init_default}}
+#define ichnaea_TelemetrySubscribeRequest_init_default {mbed_rpc_Header_init_default, 0, 0, 0, 0, 0}
+#define ichnaea_TelemetrySubscribeResponse_init_default {mbed_rpc_Header_init_default, 0, 0, 0, 0}
+#define ichnaea_LinkBaudRequest_init_default     {mbed_rpc_Header_init_default, 0, 0, 0}
+#define ichnaea_LinkBaudResponse_init_default    {mbed_rpc_Header_init_default, _ichnaea_LinkBaudStatus_MIN, 0, 0, 0, 0, {0, 0, 0, 0, 0, 0, 0, 0}}
+#define ichnaea_LTCRegGetRequest_init_default    {mbed_rpc_Header_init_default, 0, 0, 0}
+#define ichnaea_LTCRegGetResponse_init_default   {mbed_rpc_Header_init_default, _ichnaea_LTCRegStatus_MIN, 0, {0, {0}}}
+#define ichnaea_LTCRegSetRequest_init_default    {mbed_rpc_Header_init_default, 0, 0, 0}
+#define ichnaea_LTCRegSetResponse_init_default   {mbed_rpc_Header_init_default, _ichnaea_LTCRegStatus_MIN, 0}
+#define ichnaea_GroupCommandRequest_init_default {mbed_rpc_Header_init_default, 0, 0, _ichnaea_GroupAction_MIN, _ichnaea_SetpointField_MIN, 0, 0}
+#define ichnaea_GroupCommandResponse_init_default {mbed_rpc_Header_init_default, 0, 0, _ichnaea_GroupCommandStatus_MIN, 0}
 #define ichnaea_PingNodeRequest_init_zero        {mbed_rpc_Header_init_zero, 0}
 #define ichnaea_PingNodeResponse_init_zero       {mbed_rpc_Header_init_zero}
 #define ichnaea_GetIdRequest_init_zero           {mbed_rpc_Header_init_zero}
@@ -325,12 +842,39 @@ extern "C" {
 #define ichnaea_SetpointResponse_init_zero       {mbed_rpc_Header_init_zero, _ichnaea_SetpointError_MIN, false, ""}
 #define ichnaea_SensorRequest_init_zero          {mbed_rpc_Header_init_zero, 0, _ichnaea_SensorType_MIN}
 #define ichnaea_SensorResponse_init_zero         {mbed_rpc_Header_init_zero, _ichnaea_SensorError_MIN, 0}
+#define ichnaea_SensorBatchRequest_init_zero     {mbed_rpc_Header_init_zero, 0, 0}
+#define ichnaea_SensorBatchResponse_init_zero    {mbed_rpc_Header_init_zero, _ichnaea_SensorError_MIN, 0, 0, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}
 #define ichnaea_PDIReadRequest_init_zero         {mbed_rpc_Header_init_zero, 0, 0}
 #define ichnaea_PDIReadResponse_init_zero        {mbed_rpc_Header_init_zero, 0, {0, {0}}}
 #define ichnaea_PDIWriteRequest_init_zero        {mbed_rpc_Header_init_zero, 0, 0, {0, {0}}}
 #define ichnaea_PDIWriteResponse_init_zero       {mbed_rpc_Header_init_zero, 0}
 #define ichnaea_SystemStatusRequest_init_zero    {mbed_rpc_Header_init_zero, 0}
-#define ichnaea_SystemStatusResponse_init_zero   {mbed_rpc_Header_init_zero, 0, _ichnaea_EngageState_MIN}
+#define ichnaea_TxQueueStats_init_zero           {0, 0, 0, 0}
+#define ichnaea_SystemStatusResponse_init_zero   {mbed_rpc_Header_init_zero, 0, _ichnaea_EngageState_MIN, 0, {ichnaea_TxQueueStats_init_zero, ichnaea_TxQueueStats_init_zero}}
+#define ichnaea_BootStep_init_zero               {_ichnaea_BootStepId_MIN, 0, 0, 0, 0}
+#define ichnaea_BootTimelineRequest_init_zero    {mbed_rpc_Header_init_zero, 0, 0}
+#define ichnaea_BootTimelineResponse_init_zero   {mbed_rpc_Header_init_zero, 0, 0, 0, 0, {ichnaea_BootStep_init_zero, ichnaea_BootStep_init_zero, ichnaea_BootStep_init_zero, ichnaea_BootStep_init_zero, ichnaea_BootStep_init_zero, ichnaea_BootStep_init_zero, ichnaea_BootStep_init_zero, ichnaea_BootStep_init_zero, ichnaea_BootStep_init_zero, ichnaea_BootStep_init_zero, ichnaea_BootStep_init_zero, ichnaea_BootStep_init_zero, ichnaea_BootStep_init_zero, ichnaea_BootStep_init_zero, ichnaea_BootStep_init_zero, ichnaea_BootStep_init_zero, ichnaea_BootStep_init_zero, ichnaea_BootStep_init_zero, ichnaea_BootStep_init_zero, ichnaea_BootStep_init_zero}}
+#define ichnaea_CalibrationEntry_init_zero       {_ichnaea_CalibrationId_MIN, 0, 0, 0, 0}
+#define ichnaea_CalWriteRequest_init_zero        {mbed_rpc_Header_init_zero, 0, 0, {ichnaea_CalibrationEntry_init_zero, ichnaea_CalibrationEntry_init_zero, ichnaea_CalibrationEntry_init_zero, ichnaea_CalibrationEntry_init_zero, ichnaea_CalibrationEntry_init_zero, ichnaea_CalibrationEntry_init_zero, ichnaea_CalibrationEntry_init_zero, ichnaea_CalibrationEntry_init_zero}}
+#define ichnaea_CalWriteResponse_init_zero       {mbed_rpc_Header_init_zero, 0, false, ""}
+#define ichnaea_FlashLatencyHistogram_init_zero  {_ichnaea_FlashOp_MIN, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}
+#define ichnaea_FlashStatsRequest_init_zero      {mbed_rpc_Header_init_zero, 0, 0}
+#define ichnaea_FlashStatsResponse_init_zero     {mbed_rpc_Header_init_zero, 0, 0, 0, 0, 0, 0, 0, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 0, {ichnaea_FlashLatencyHistogram_init_zero, ichnaea_FlashLatencyHistogram_init_zero, ichnaea_FlashLatencyHistogram_init_zero}}
+#define ichnaea_LogQueryRequest_init_zero        {mbed_rpc_Header_init_zero, 0, 0, 0, 0, 0, 0, 0}
+#define ichnaea_LogQueryResponse_init_zero       {mbed_rpc_Header_init_zero, 0, 0, 0, 0, 0, 0, {0, {0}}}
+#define ichnaea_FlightSample_init_zero           {0, 0, 0, 0}
+#define ichnaea_FlightRecorderRequest_init_zero  {mbed_rpc_Header_init_zero, 0, 0, 0, 0, 0, 0}
+#define ichnaea_FlightRecorderResponse_init_zero {mbed_rpc_Header_init_zero, _ichnaea_FlightRecorderState_MIN, 0, 0, 0, 0, 0, 0, {ichnaea_FlightSample_init_zero, ichnaea_FlightSample_init_zero, ichnaea_FlightSample_init_zero, ichnaea_FlightSample_init_zero, ichnaea_FlightSample_init_zero, ichnaea_FlightSample_init_zero, ichnaea_FlightSample_init_zero, ichnaea_FlightSample_init_zero, ichnaea_FlightSample_init_zero, ichnaea_FlightSample_init_zero, ichnaea_FlightSample_init_zero, ichnaea_FlightSample_init_zero, ichnaea_FlightSample_init_zero, ichnaea_FlightSample_init_zero, ichnaea_FlightSample_init_zero, ichnaea_FlightSample_init_zero, ichnaea_FlightSample_init_zero, ichnaea_FlightSample_init_zero, ichnaea_FlightSample_init_zero, ichnaea_FlightSample_init_zero, ichnaea_FlightSample_init_zero, ichnaea_FlightSample_init_zero, ichnaea_FlightSample_init_zero, ichnaea_FlightSample_init_zero}}
+#define ichnaea_TelemetrySubscribeRequest_init_zero {mbed_rpc_Header_init_zero, 0, 0, 0, 0, 0}
+#define ichnaea_TelemetrySubscribeResponse_init_zero {mbed_rpc_Header_init_zero, 0, 0, 0, 0}
+#define ichnaea_LinkBaudRequest_init_zero        {mbed_rpc_Header_init_zero, 0, 0, 0}
+#define ichnaea_LinkBaudResponse_init_zero       {mbed_rpc_Header_init_zero, _ichnaea_LinkBaudStatus_MIN, 0, 0, 0, 0, {0, 0, 0, 0, 0, 0, 0, 0}}
+#define ichnaea_LTCRegGetRequest_init_zero       {mbed_rpc_Header_init_zero, 0, 0, 0}
+#define ichnaea_LTCRegGetResponse_init_zero      {mbed_rpc_Header_init_zero, _ichnaea_LTCRegStatus_MIN, 0, {0, {0}}}
+#define ichnaea_LTCRegSetRequest_init_zero       {mbed_rpc_Header_init_zero, 0, 0, 0}
+#define ichnaea_LTCRegSetResponse_init_zero      {mbed_rpc_Header_init_zero, _ichnaea_LTCRegStatus_MIN, 0}
+#define ichnaea_GroupCommandRequest_init_zero    {mbed_rpc_Header_init_zero, 0, 0, _ichnaea_GroupAction_MIN, _ichnaea_SetpointField_MIN, 0, 0}
+#define ichnaea_GroupCommandResponse_init_zero   {mbed_rpc_Header_init_zero, 0, 0, _ichnaea_GroupCommandStatus_MIN, 0}
 
 /* Field tags (for use in manual encoding/decoding) */
 #define ichnaea_PingNodeRequest_header_tag       1
@@ -362,6 +906,14 @@ extern "C" {
 #define ichnaea_SensorResponse_header_tag        1
 #define ichnaea_SensorResponse_status_tag        2
 #define ichnaea_SensorResponse_value_tag         3
+#define ichnaea_SensorBatchRequest_header_tag    1
+#define ichnaea_SensorBatchRequest_node_id_tag   2
+#define ichnaea_SensorBatchRequest_sensor_mask_tag 3
+#define ichnaea_SensorBatchResponse_header_tag   1
+#define ichnaea_SensorBatchResponse_status_tag   2
+#define ichnaea_SensorBatchResponse_sensor_mask_tag 3
+#define ichnaea_SensorBatchResponse_timestamp_tag 4
+#define ichnaea_SensorBatchResponse_values_tag   5
 #define ichnaea_PDIReadRequest_header_tag        1
 #define ichnaea_PDIReadRequest_node_id_tag       2
 #define ichnaea_PDIReadRequest_pdi_id_tag        3
@@ -376,9 +928,136 @@ extern "C" {
 #define ichnaea_PDIWriteResponse_success_tag     2
 #define ichnaea_SystemStatusRequest_header_tag   1
 #define ichnaea_SystemStatusRequest_node_id_tag  2
+#define ichnaea_TxQueueStats_depth_tag           1
+#define ichnaea_TxQueueStats_high_water_tag      2
+#define ichnaea_TxQueueStats_sent_tag            3
+#define ichnaea_TxQueueStats_dropped_tag         4
 #define ichnaea_SystemStatusResponse_header_tag  1
 #define ichnaea_SystemStatusResponse_timestamp_tag 2
 #define ichnaea_SystemStatusResponse_output_state_tag 3
+#define ichnaea_SystemStatusResponse_tx_queues_tag 4
+#define ichnaea_BootStep_step_tag                1
+#define ichnaea_BootStep_depth_tag               2
+#define ichnaea_BootStep_tag_tag                 3
+#define ichnaea_BootStep_start_us_tag            4
+#define ichnaea_BootStep_duration_us_tag         5
+#define ichnaea_BootTimelineRequest_header_tag   1
+#define ichnaea_BootTimelineRequest_node_id_tag  2
+#define ichnaea_BootTimelineRequest_offset_tag   3
+#define ichnaea_BootTimelineResponse_header_tag  1
+#define ichnaea_BootTimelineResponse_total_tag   2
+#define ichnaea_BootTimelineResponse_offset_tag  3
+#define ichnaea_BootTimelineResponse_complete_tag 4
+#define ichnaea_BootTimelineResponse_steps_tag   5
+#define ichnaea_CalibrationEntry_id_tag          1
+#define ichnaea_CalibrationEntry_offset_tag      2
+#define ichnaea_CalibrationEntry_gain_tag        3
+#define ichnaea_CalibrationEntry_valid_min_tag   4
+#define ichnaea_CalibrationEntry_valid_max_tag   5
+#define ichnaea_CalWriteRequest_header_tag       1
+#define ichnaea_CalWriteRequest_node_id_tag      2
+#define ichnaea_CalWriteRequest_entries_tag      3
+#define ichnaea_CalWriteResponse_header_tag      1
+#define ichnaea_CalWriteResponse_success_tag     2
+#define ichnaea_CalWriteResponse_message_tag     3
+#define ichnaea_FlashLatencyHistogram_op_tag     1
+#define ichnaea_FlashLatencyHistogram_buckets_tag 2
+#define ichnaea_FlashStatsRequest_header_tag     1
+#define ichnaea_FlashStatsRequest_node_id_tag    2
+#define ichnaea_FlashStatsRequest_sector_offset_tag 3
+#define ichnaea_FlashStatsResponse_header_tag    1
+#define ichnaea_FlashStatsResponse_bytes_read_tag 2
+#define ichnaea_FlashStatsResponse_bytes_programmed_tag 3
+#define ichnaea_FlashStatsResponse_read_ops_tag  4
+#define ichnaea_FlashStatsResponse_program_ops_tag 5
+#define ichnaea_FlashStatsResponse_erase_ops_tag 6
+#define ichnaea_FlashStatsResponse_num_sectors_tag 7
+#define ichnaea_FlashStatsResponse_sector_offset_tag 8
+#define ichnaea_FlashStatsResponse_erase_counts_tag 9
+#define ichnaea_FlashStatsResponse_latency_tag   10
+#define ichnaea_LogQueryRequest_header_tag       1
+#define ichnaea_LogQueryRequest_node_id_tag      2
+#define ichnaea_LogQueryRequest_start_time_tag   3
+#define ichnaea_LogQueryRequest_end_time_tag     4
+#define ichnaea_LogQueryRequest_last_ms_tag      5
+#define ichnaea_LogQueryRequest_min_level_tag    6
+#define ichnaea_LogQueryRequest_max_count_tag    7
+#define ichnaea_LogQueryRequest_skip_tag         8
+#define ichnaea_LogQueryResponse_header_tag      1
+#define ichnaea_LogQueryResponse_now_tag         2
+#define ichnaea_LogQueryResponse_base_time_tag   3
+#define ichnaea_LogQueryResponse_count_tag       4
+#define ichnaea_LogQueryResponse_more_tag        5
+#define ichnaea_LogQueryResponse_next_time_tag   6
+#define ichnaea_LogQueryResponse_skip_tag        7
+#define ichnaea_LogQueryResponse_data_tag        8
+#define ichnaea_FlightSample_time_tag            1
+#define ichnaea_FlightSample_channel_tag         2
+#define ichnaea_FlightSample_raw_tag             3
+#define ichnaea_FlightSample_value_tag           4
+#define ichnaea_FlightRecorderRequest_header_tag 1
+#define ichnaea_FlightRecorderRequest_node_id_tag 2
+#define ichnaea_FlightRecorderRequest_offset_tag 3
+#define ichnaea_FlightRecorderRequest_rearm_tag  4
+#define ichnaea_FlightRecorderRequest_pre_trigger_tag 5
+#define ichnaea_FlightRecorderRequest_post_trigger_tag 6
+#define ichnaea_FlightRecorderRequest_persist_tag 7
+#define ichnaea_FlightRecorderResponse_header_tag 1
+#define ichnaea_FlightRecorderResponse_state_tag 2
+#define ichnaea_FlightRecorderResponse_trigger_code_tag 3
+#define ichnaea_FlightRecorderResponse_trigger_time_tag 4
+#define ichnaea_FlightRecorderResponse_total_tag 5
+#define ichnaea_FlightRecorderResponse_trigger_index_tag 6
+#define ichnaea_FlightRecorderResponse_offset_tag 7
+#define ichnaea_FlightRecorderResponse_samples_tag 8
+#define ichnaea_TelemetrySubscribeRequest_header_tag 1
+#define ichnaea_TelemetrySubscribeRequest_node_id_tag 2
+#define ichnaea_TelemetrySubscribeRequest_sensor_mask_tag 3
+#define ichnaea_TelemetrySubscribeRequest_period_ms_tag 4
+#define ichnaea_TelemetrySubscribeRequest_deadband_tag 5
+#define ichnaea_TelemetrySubscribeRequest_keyframe_ms_tag 6
+#define ichnaea_TelemetrySubscribeResponse_header_tag 1
+#define ichnaea_TelemetrySubscribeResponse_sensor_mask_tag 2
+#define ichnaea_TelemetrySubscribeResponse_period_ms_tag 3
+#define ichnaea_TelemetrySubscribeResponse_deadband_tag 4
+#define ichnaea_TelemetrySubscribeResponse_keyframe_ms_tag 5
+#define ichnaea_LinkBaudRequest_header_tag       1
+#define ichnaea_LinkBaudRequest_node_id_tag      2
+#define ichnaea_LinkBaudRequest_baud_tag         3
+#define ichnaea_LinkBaudRequest_confirm_tag      4
+#define ichnaea_LinkBaudResponse_header_tag      1
+#define ichnaea_LinkBaudResponse_status_tag      2
+#define ichnaea_LinkBaudResponse_baud_tag        3
+#define ichnaea_LinkBaudResponse_fallbacks_tag   4
+#define ichnaea_LinkBaudResponse_line_errors_tag 5
+#define ichnaea_LinkBaudResponse_supported_tag   6
+#define ichnaea_LTCRegGetRequest_header_tag      1
+#define ichnaea_LTCRegGetRequest_node_id_tag     2
+#define ichnaea_LTCRegGetRequest_reg_tag         3
+#define ichnaea_LTCRegGetRequest_dump_tag        4
+#define ichnaea_LTCRegGetResponse_header_tag     1
+#define ichnaea_LTCRegGetResponse_status_tag     2
+#define ichnaea_LTCRegGetResponse_first_reg_tag  3
+#define ichnaea_LTCRegGetResponse_values_tag     4
+#define ichnaea_LTCRegSetRequest_header_tag      1
+#define ichnaea_LTCRegSetRequest_node_id_tag     2
+#define ichnaea_LTCRegSetRequest_reg_tag         3
+#define ichnaea_LTCRegSetRequest_value_tag       4
+#define ichnaea_LTCRegSetResponse_header_tag     1
+#define ichnaea_LTCRegSetResponse_status_tag     2
+#define ichnaea_LTCRegSetResponse_value_tag      3
+#define ichnaea_GroupCommandRequest_header_tag   1
+#define ichnaea_GroupCommandRequest_group_id_tag 2
+#define ichnaea_GroupCommandRequest_command_id_tag 3
+#define ichnaea_GroupCommandRequest_action_tag   4
+#define ichnaea_GroupCommandRequest_field_tag    5
+#define ichnaea_GroupCommandRequest_value_tag    6
+#define ichnaea_GroupCommandRequest_delay_us_tag 7
+#define ichnaea_GroupCommandResponse_header_tag  1
+#define ichnaea_GroupCommandResponse_node_id_tag 2
+#define ichnaea_GroupCommandResponse_command_id_tag 3
+#define ichnaea_GroupCommandResponse_status_tag  4
+#define ichnaea_GroupCommandResponse_latency_us_tag 5
 
 /* Struct field encoding specification for nanopb */
 #define ichnaea_PingNodeRequest_FIELDLIST(X, a) \
@@ -460,6 +1139,24 @@ X(a, STATIC,   REQUIRED, FLOAT,    value,             3)
 #define ichnaea_SensorResponse_DEFAULT NULL
 #define ichnaea_SensorResponse_header_MSGTYPE mbed_rpc_Header
 
+#define ichnaea_SensorBatchRequest_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, MESSAGE,  header,            1) \
+X(a, STATIC,   REQUIRED, UINT32,   node_id,           2) \
+X(a, STATIC,   REQUIRED, UINT32,   sensor_mask,       3)
+#define ichnaea_SensorBatchRequest_CALLBACK NULL
+#define ichnaea_SensorBatchRequest_DEFAULT NULL
+#define ichnaea_SensorBatchRequest_header_MSGTYPE mbed_rpc_Header
+
+#define ichnaea_SensorBatchResponse_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, MESSAGE,  header,            1) \
+X(a, STATIC,   REQUIRED, UENUM,    status,            2) \
+X(a, STATIC,   REQUIRED, UINT32,   sensor_mask,       3) \
+X(a, STATIC,   REQUIRED, UINT32,   timestamp,         4) \
+X(a, STATIC,   REPEATED, FLOAT,    values,            5)
+#define ichnaea_SensorBatchResponse_CALLBACK NULL
+#define ichnaea_SensorBatchResponse_DEFAULT NULL
+#define ichnaea_SensorBatchResponse_header_MSGTYPE mbed_rpc_Header
+
 #define ichnaea_PDIReadRequest_FIELDLIST(X, a) \
 X(a, STATIC,   REQUIRED, MESSAGE,  header,            1) \
 X(a, STATIC,   REQUIRED, UINT32,   node_id,           2) \
@@ -499,13 +1196,265 @@ X(a, STATIC,   REQUIRED, UINT32,   node_id,           2)
 #define ichnaea_SystemStatusRequest_DEFAULT NULL
 #define ichnaea_SystemStatusRequest_header_MSGTYPE mbed_rpc_Header
 
+#define ichnaea_TxQueueStats_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, UINT32,   depth,             1) \
+X(a, STATIC,   REQUIRED, UINT32,   high_water,        2) \
+X(a, STATIC,   REQUIRED, UINT32,   sent,              3) \
+X(a, STATIC,   REQUIRED, UINT32,   dropped,           4)
+#define ichnaea_TxQueueStats_CALLBACK NULL
+#define ichnaea_TxQueueStats_DEFAULT NULL
+
 #define ichnaea_SystemStatusResponse_FIELDLIST(X, a) \
 X(a, STATIC,   REQUIRED, MESSAGE,  header,            1) \
 X(a, STATIC,   REQUIRED, UINT32,   timestamp,         2) \
-X(a, STATIC,   REQUIRED, UENUM,    output_state,      3)
+X(a, STATIC,   REQUIRED, UENUM,    output_state,      3) \
+X(a, STATIC,   REPEATED, MESSAGE,  tx_queues,         4)
 #define ichnaea_SystemStatusResponse_CALLBACK NULL
 #define ichnaea_SystemStatusResponse_DEFAULT NULL
 #define ichnaea_SystemStatusResponse_header_MSGTYPE mbed_rpc_Header
+#define ichnaea_SystemStatusResponse_tx_queues_MSGTYPE ichnaea_TxQueueStats
+
+#define ichnaea_BootStep_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, UENUM,    step,              1) \
+X(a, STATIC,   REQUIRED, UINT32,   depth,             2) \
+X(a, STATIC,   REQUIRED, UINT32,   tag,               3) \
+X(a, STATIC,   REQUIRED, UINT32,   start_us,          4) \
+X(a, STATIC,   REQUIRED, UINT32,   duration_us,       5)
+#define ichnaea_BootStep_CALLBACK NULL
+#define ichnaea_BootStep_DEFAULT NULL
+
+#define ichnaea_BootTimelineRequest_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, MESSAGE,  header,            1) \
+X(a, STATIC,   REQUIRED, UINT32,   node_id,           2) \
+X(a, STATIC,   REQUIRED, UINT32,   offset,            3)
+#define ichnaea_BootTimelineRequest_CALLBACK NULL
+#define ichnaea_BootTimelineRequest_DEFAULT NULL
+#define ichnaea_BootTimelineRequest_header_MSGTYPE mbed_rpc_Header
+
+#define ichnaea_BootTimelineResponse_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, MESSAGE,  header,            1) \
+X(a, STATIC,   REQUIRED, UINT32,   total,             2) \
+X(a, STATIC,   REQUIRED, UINT32,   offset,            3) \
+X(a, STATIC,   REQUIRED, BOOL,     complete,          4) \
+X(a, STATIC,   REPEATED, MESSAGE,  steps,             5)
+#define ichnaea_BootTimelineResponse_CALLBACK NULL
+#define ichnaea_BootTimelineResponse_DEFAULT NULL
+#define ichnaea_BootTimelineResponse_header_MSGTYPE mbed_rpc_Header
+#define ichnaea_BootTimelineResponse_steps_MSGTYPE ichnaea_BootStep
+
+#define ichnaea_CalibrationEntry_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, UENUM,    id,                1) \
+X(a, STATIC,   REQUIRED, FLOAT,    offset,            2) \
+X(a, STATIC,   REQUIRED, FLOAT,    gain,              3) \
+X(a, STATIC,   REQUIRED, FLOAT,    valid_min,         4) \
+X(a, STATIC,   REQUIRED, FLOAT,    valid_max,         5)
+#define ichnaea_CalibrationEntry_CALLBACK NULL
+#define ichnaea_CalibrationEntry_DEFAULT NULL
+
+#define ichnaea_CalWriteRequest_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, MESSAGE,  header,            1) \
+X(a, STATIC,   REQUIRED, UINT32,   node_id,           2) \
+X(a, STATIC,   REPEATED, MESSAGE,  entries,           3)
+#define ichnaea_CalWriteRequest_CALLBACK NULL
+#define ichnaea_CalWriteRequest_DEFAULT NULL
+#define ichnaea_CalWriteRequest_header_MSGTYPE mbed_rpc_Header
+#define ichnaea_CalWriteRequest_entries_MSGTYPE ichnaea_CalibrationEntry
+
+#define ichnaea_CalWriteResponse_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, MESSAGE,  header,            1) \
+X(a, STATIC,   REQUIRED, BOOL,     success,           2) \
+X(a, STATIC,   OPTIONAL, STRING,   message,           3)
+#define ichnaea_CalWriteResponse_CALLBACK NULL
+#define ichnaea_CalWriteResponse_DEFAULT NULL
+#define ichnaea_CalWriteResponse_header_MSGTYPE mbed_rpc_Header
+
+#define ichnaea_FlashLatencyHistogram_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, UENUM,    op,                1) \
+X(a, STATIC,   REPEATED, UINT32,   buckets,           2)
+#define ichnaea_FlashLatencyHistogram_CALLBACK NULL
+#define ichnaea_FlashLatencyHistogram_DEFAULT NULL
+
+#define ichnaea_FlashStatsRequest_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, MESSAGE,  header,            1) \
+X(a, STATIC,   REQUIRED, UINT32,   node_id,           2) \
+X(a, STATIC,   REQUIRED, UINT32,   sector_offset,     3)
+#define ichnaea_FlashStatsRequest_CALLBACK NULL
+#define ichnaea_FlashStatsRequest_DEFAULT NULL
+#define ichnaea_FlashStatsRequest_header_MSGTYPE mbed_rpc_Header
+
+#define ichnaea_FlashStatsResponse_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, MESSAGE,  header,            1) \
+X(a, STATIC,   REQUIRED, UINT64,   bytes_read,        2) \
+X(a, STATIC,   REQUIRED, UINT64,   bytes_programmed,   3) \
+X(a, STATIC,   REQUIRED, UINT64,   read_ops,          4) \
+X(a, STATIC,   REQUIRED, UINT64,   program_ops,       5) \
+X(a, STATIC,   REQUIRED, UINT64,   erase_ops,         6) \
+X(a, STATIC,   REQUIRED, UINT32,   num_sectors,       7) \
+X(a, STATIC,   REQUIRED, UINT32,   sector_offset,     8) \
+X(a, STATIC,   REPEATED, UINT32,   erase_counts,      9) \
+X(a, STATIC,   REPEATED, MESSAGE,  latency,          10)
+#define ichnaea_FlashStatsResponse_CALLBACK NULL
+#define ichnaea_FlashStatsResponse_DEFAULT NULL
+#define ichnaea_FlashStatsResponse_header_MSGTYPE mbed_rpc_Header
+#define ichnaea_FlashStatsResponse_latency_MSGTYPE ichnaea_FlashLatencyHistogram
+
+#define ichnaea_LogQueryRequest_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, MESSAGE,  header,            1) \
+X(a, STATIC,   REQUIRED, UINT32,   node_id,           2) \
+X(a, STATIC,   REQUIRED, UINT64,   start_time,        3) \
+X(a, STATIC,   REQUIRED, UINT64,   end_time,          4) \
+X(a, STATIC,   REQUIRED, UINT32,   last_ms,           5) \
+X(a, STATIC,   REQUIRED, UINT32,   min_level,         6) \
+X(a, STATIC,   REQUIRED, UINT32,   max_count,         7) \
+X(a, STATIC,   REQUIRED, UINT32,   skip,              8)
+#define ichnaea_LogQueryRequest_CALLBACK NULL
+#define ichnaea_LogQueryRequest_DEFAULT NULL
+#define ichnaea_LogQueryRequest_header_MSGTYPE mbed_rpc_Header
+
+#define ichnaea_LogQueryResponse_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, MESSAGE,  header,            1) \
+X(a, STATIC,   REQUIRED, UINT64,   now,               2) \
+X(a, STATIC,   REQUIRED, UINT64,   base_time,         3) \
+X(a, STATIC,   REQUIRED, UINT32,   count,             4) \
+X(a, STATIC,   REQUIRED, BOOL,     more,              5) \
+X(a, STATIC,   REQUIRED, UINT64,   next_time,         6) \
+X(a, STATIC,   REQUIRED, UINT32,   skip,              7) \
+X(a, STATIC,   REQUIRED, BYTES,    data,              8)
+#define ichnaea_LogQueryResponse_CALLBACK NULL
+#define ichnaea_LogQueryResponse_DEFAULT NULL
+#define ichnaea_LogQueryResponse_header_MSGTYPE mbed_rpc_Header
+
+#define ichnaea_FlightSample_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, UINT32,   time,              1) \
+X(a, STATIC,   REQUIRED, UINT32,   channel,           2) \
+X(a, STATIC,   REQUIRED, FLOAT,    raw,               3) \
+X(a, STATIC,   REQUIRED, FLOAT,    value,             4)
+#define ichnaea_FlightSample_CALLBACK NULL
+#define ichnaea_FlightSample_DEFAULT NULL
+
+#define ichnaea_FlightRecorderRequest_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, MESSAGE,  header,            1) \
+X(a, STATIC,   REQUIRED, UINT32,   node_id,           2) \
+X(a, STATIC,   REQUIRED, UINT32,   offset,            3) \
+X(a, STATIC,   REQUIRED, BOOL,     rearm,             4) \
+X(a, STATIC,   REQUIRED, UINT32,   pre_trigger,       5) \
+X(a, STATIC,   REQUIRED, UINT32,   post_trigger,      6) \
+X(a, STATIC,   REQUIRED, BOOL,     persist,           7)
+#define ichnaea_FlightRecorderRequest_CALLBACK NULL
+#define ichnaea_FlightRecorderRequest_DEFAULT NULL
+#define ichnaea_FlightRecorderRequest_header_MSGTYPE mbed_rpc_Header
+
+#define ichnaea_FlightRecorderResponse_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, MESSAGE,  header,            1) \
+X(a, STATIC,   REQUIRED, UENUM,    state,             2) \
+X(a, STATIC,   REQUIRED, UINT32,   trigger_code,      3) \
+X(a, STATIC,   REQUIRED, UINT32,   trigger_time,      4) \
+X(a, STATIC,   REQUIRED, UINT32,   total,             5) \
+X(a, STATIC,   REQUIRED, UINT32,   trigger_index,     6) \
+X(a, STATIC,   REQUIRED, UINT32,   offset,            7) \
+X(a, STATIC,   REPEATED, MESSAGE,  samples,           8)
+#define ichnaea_FlightRecorderResponse_CALLBACK NULL
+#define ichnaea_FlightRecorderResponse_DEFAULT NULL
+#define ichnaea_FlightRecorderResponse_header_MSGTYPE mbed_rpc_Header
+#define ichnaea_FlightRecorderResponse_samples_MSGTYPE ichnaea_FlightSample
+
+#define ichnaea_TelemetrySubscribeRequest_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, MESSAGE,  header,            1) \
+X(a, STATIC,   REQUIRED, UINT32,   node_id,           2) \
+X(a, STATIC,   REQUIRED, UINT32,   sensor_mask,       3) \
+X(a, STATIC,   REQUIRED, UINT32,   period_ms,         4) \
+X(a, STATIC,   REQUIRED, FLOAT,    deadband,          5) \
+X(a, STATIC,   REQUIRED, UINT32,   keyframe_ms,       6)
+#define ichnaea_TelemetrySubscribeRequest_CALLBACK NULL
+#define ichnaea_TelemetrySubscribeRequest_DEFAULT NULL
+#define ichnaea_TelemetrySubscribeRequest_header_MSGTYPE mbed_rpc_Header
+
+#define ichnaea_TelemetrySubscribeResponse_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, MESSAGE,  header,            1) \
+X(a, STATIC,   REQUIRED, UINT32,   sensor_mask,       2) \
+X(a, STATIC,   REQUIRED, UINT32,   period_ms,         3) \
+X(a, STATIC,   REQUIRED, FLOAT,    deadband,          4) \
+X(a, STATIC,   REQUIRED, UINT32,   keyframe_ms,       5)
+#define ichnaea_TelemetrySubscribeResponse_CALLBACK NULL
+#define ichnaea_TelemetrySubscribeResponse_DEFAULT NULL
+#define ichnaea_TelemetrySubscribeResponse_header_MSGTYPE mbed_rpc_Header
+
+#define ichnaea_LinkBaudRequest_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, MESSAGE,  header,            1) \
+X(a, STATIC,   REQUIRED, UINT32,   node_id,           2) \
+X(a, STATIC,   REQUIRED, UINT32,   baud,              3) \
+X(a, STATIC,   REQUIRED, BOOL,     confirm,           4)
+#define ichnaea_LinkBaudRequest_CALLBACK NULL
+#define ichnaea_LinkBaudRequest_DEFAULT NULL
+#define ichnaea_LinkBaudRequest_header_MSGTYPE mbed_rpc_Header
+
+#define ichnaea_LinkBaudResponse_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, MESSAGE,  header,            1) \
+X(a, STATIC,   REQUIRED, UENUM,    status,            2) \
+X(a, STATIC,   REQUIRED, UINT32,   baud,              3) \
+X(a, STATIC,   REQUIRED, UINT32,   fallbacks,         4) \
+X(a, STATIC,   REQUIRED, UINT32,   line_errors,       5) \
+X(a, STATIC,   REPEATED, UINT32,   supported,         6)
+#define ichnaea_LinkBaudResponse_CALLBACK NULL
+#define ichnaea_LinkBaudResponse_DEFAULT NULL
+#define ichnaea_LinkBaudResponse_header_MSGTYPE mbed_rpc_Header
+
+#define ichnaea_LTCRegGetRequest_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, MESSAGE,  header,            1) \
+X(a, STATIC,   REQUIRED, UINT32,   node_id,           2) \
+X(a, STATIC,   REQUIRED, UINT32,   reg,               3) \
+X(a, STATIC,   REQUIRED, BOOL,     dump,              4)
+#define ichnaea_LTCRegGetRequest_CALLBACK NULL
+#define ichnaea_LTCRegGetRequest_DEFAULT NULL
+#define ichnaea_LTCRegGetRequest_header_MSGTYPE mbed_rpc_Header
+
+#define ichnaea_LTCRegGetResponse_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, MESSAGE,  header,            1) \
+X(a, STATIC,   REQUIRED, UENUM,    status,            2) \
+X(a, STATIC,   REQUIRED, UINT32,   first_reg,         3) \
+X(a, STATIC,   REQUIRED, BYTES,    values,            4)
+#define ichnaea_LTCRegGetResponse_CALLBACK NULL
+#define ichnaea_LTCRegGetResponse_DEFAULT NULL
+#define ichnaea_LTCRegGetResponse_header_MSGTYPE mbed_rpc_Header
+
+#define ichnaea_LTCRegSetRequest_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, MESSAGE,  header,            1) \
+X(a, STATIC,   REQUIRED, UINT32,   node_id,           2) \
+X(a, STATIC,   REQUIRED, UINT32,   reg,               3) \
+X(a, STATIC,   REQUIRED, UINT32,   value,             4)
+#define ichnaea_LTCRegSetRequest_CALLBACK NULL
+#define ichnaea_LTCRegSetRequest_DEFAULT NULL
+#define ichnaea_LTCRegSetRequest_header_MSGTYPE mbed_rpc_Header
+
+#define ichnaea_LTCRegSetResponse_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, MESSAGE,  header,            1) \
+X(a, STATIC,   REQUIRED, UENUM,    status,            2) \
+X(a, STATIC,   REQUIRED, UINT32,   value,             3)
+#define ichnaea_LTCRegSetResponse_CALLBACK NULL
+#define ichnaea_LTCRegSetResponse_DEFAULT NULL
+#define ichnaea_LTCRegSetResponse_header_MSGTYPE mbed_rpc_Header
+
+#define ichnaea_GroupCommandRequest_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, MESSAGE,  header,            1) \
+X(a, STATIC,   REQUIRED, UINT32,   group_id,          2) \
+X(a, STATIC,   REQUIRED, UINT32,   command_id,        3) \
+X(a, STATIC,   REQUIRED, UENUM,    action,            4) \
+X(a, STATIC,   REQUIRED, UENUM,    field,             5) \
+X(a, STATIC,   REQUIRED, FLOAT,    value,             6) \
+X(a, STATIC,   REQUIRED, UINT32,   delay_us,          7)
+#define ichnaea_GroupCommandRequest_CALLBACK NULL
+#define ichnaea_GroupCommandRequest_DEFAULT NULL
+#define ichnaea_GroupCommandRequest_header_MSGTYPE mbed_rpc_Header
+
+#define ichnaea_GroupCommandResponse_FIELDLIST(X, a) \
+X(a, STATIC,   REQUIRED, MESSAGE,  header,            1) \
+X(a, STATIC,   REQUIRED, UINT32,   node_id,           2) \
+X(a, STATIC,   REQUIRED, UINT32,   command_id,        3) \
+X(a, STATIC,   REQUIRED, UENUM,    status,            4) \
+X(a, STATIC,   REQUIRED, UINT32,   latency_us,        5)
+#define ichnaea_GroupCommandResponse_CALLBACK NULL
+#define ichnaea_GroupCommandResponse_DEFAULT NULL
+#define ichnaea_GroupCommandResponse_header_MSGTYPE mbed_rpc_Header
 
 extern const pb_msgdesc_t ichnaea_PingNodeRequest_msg;
 extern const pb_msgdesc_t ichnaea_PingNodeResponse_msg;
@@ -517,12 +1466,39 @@ extern const pb_msgdesc_t ichnaea_SetpointRequest_msg;
 extern const pb_msgdesc_t ichnaea_SetpointResponse_msg;
 extern const pb_msgdesc_t ichnaea_SensorRequest_msg;
 extern const pb_msgdesc_t ichnaea_SensorResponse_msg;
+extern const pb_msgdesc_t ichnaea_SensorBatchRequest_msg;
+extern const pb_msgdesc_t ichnaea_SensorBatchResponse_msg;
 extern const pb_msgdesc_t ichnaea_PDIReadRequest_msg;
 extern const pb_msgdesc_t ichnaea_PDIReadResponse_msg;
 extern const pb_msgdesc_t ichnaea_PDIWriteRequest_msg;
 extern const pb_msgdesc_t ichnaea_PDIWriteResponse_msg;
 extern const pb_msgdesc_t ichnaea_SystemStatusRequest_msg;
+extern const pb_msgdesc_t ichnaea_TxQueueStats_msg;
 extern const pb_msgdesc_t ichnaea_SystemStatusResponse_msg;
+extern const pb_msgdesc_t ichnaea_BootStep_msg;
+extern const pb_msgdesc_t ichnaea_BootTimelineRequest_msg;
+extern const pb_msgdesc_t ichnaea_BootTimelineResponse_msg;
+extern const pb_msgdesc_t ichnaea_CalibrationEntry_msg;
+extern const pb_msgdesc_t ichnaea_CalWriteRequest_msg;
+extern const pb_msgdesc_t ichnaea_CalWriteResponse_msg;
+extern const pb_msgdesc_t ichnaea_FlashLatencyHistogram_msg;
+extern const pb_msgdesc_t ichnaea_FlashStatsRequest_msg;
+extern const pb_msgdesc_t ichnaea_FlashStatsResponse_msg;
+extern const pb_msgdesc_t ichnaea_LogQueryRequest_msg;
+extern const pb_msgdesc_t ichnaea_LogQueryResponse_msg;
+extern const pb_msgdesc_t ichnaea_FlightSample_msg;
+extern const pb_msgdesc_t ichnaea_FlightRecorderRequest_msg;
+extern const pb_msgdesc_t ichnaea_FlightRecorderResponse_msg;
+extern const pb_msgdesc_t ichnaea_TelemetrySubscribeRequest_msg;
+extern const pb_msgdesc_t ichnaea_TelemetrySubscribeResponse_msg;
+extern const pb_msgdesc_t ichnaea_LinkBaudRequest_msg;
+extern const pb_msgdesc_t ichnaea_LinkBaudResponse_msg;
+extern const pb_msgdesc_t ichnaea_LTCRegGetRequest_msg;
+extern const pb_msgdesc_t ichnaea_LTCRegGetResponse_msg;
+extern const pb_msgdesc_t ichnaea_LTCRegSetRequest_msg;
+extern const pb_msgdesc_t ichnaea_LTCRegSetResponse_msg;
+extern const pb_msgdesc_t ichnaea_GroupCommandRequest_msg;
+extern const pb_msgdesc_t ichnaea_GroupCommandResponse_msg;
 
 /* Defines for backwards compatibility with code written before nanopb-0.4.0 */
 #define ichnaea_PingNodeRequest_fields &ichnaea_PingNodeRequest_msg
@@ -535,17 +1511,66 @@ extern const pb_msgdesc_t ichnaea_SystemStatusResponse_msg;
 #define ichnaea_SetpointResponse_fields &ichnaea_SetpointResponse_msg
 #define ichnaea_SensorRequest_fields &ichnaea_SensorRequest_msg
 #define ichnaea_SensorResponse_fields &ichnaea_SensorResponse_msg
+#define ichnaea_SensorBatchRequest_fields &ichnaea_SensorBatchRequest_msg
+#define ichnaea_SensorBatchResponse_fields &ichnaea_SensorBatchResponse_msg
 #define ichnaea_PDIReadRequest_fields &ichnaea_PDIReadRequest_msg
 #define ichnaea_PDIReadResponse_fields &ichnaea_PDIReadResponse_msg
 #define ichnaea_PDIWriteRequest_fields &ichnaea_PDIWriteRequest_msg
 #define ichnaea_PDIWriteResponse_fields &ichnaea_PDIWriteResponse_msg
 #define ichnaea_SystemStatusRequest_fields &ichnaea_SystemStatusRequest_msg
+#define ichnaea_TxQueueStats_fields &ichnaea_TxQueueStats_msg
 #define ichnaea_SystemStatusResponse_fields &ichnaea_SystemStatusResponse_msg
+#define ichnaea_BootStep_fields &ichnaea_BootStep_msg
+#define ichnaea_BootTimelineRequest_fields &ichnaea_BootTimelineRequest_msg
+#define ichnaea_BootTimelineResponse_fields &ichnaea_BootTimelineResponse_msg
+#define ichnaea_CalibrationEntry_fields &ichnaea_CalibrationEntry_msg
+#define ichnaea_CalWriteRequest_fields &ichnaea_CalWriteRequest_msg
+#define ichnaea_CalWriteResponse_fields &ichnaea_CalWriteResponse_msg
+#define ichnaea_FlashLatencyHistogram_fields &ichnaea_FlashLatencyHistogram_msg
+#define ichnaea_FlashStatsRequest_fields &ichnaea_FlashStatsRequest_msg
+#define ichnaea_FlashStatsResponse_fields &ichnaea_FlashStatsResponse_msg
+#define ichnaea_LogQueryRequest_fields &ichnaea_LogQueryRequest_msg
+#define ichnaea_LogQueryResponse_fields &ichnaea_LogQueryResponse_msg
+#define ichnaea_FlightSample_fields &ichnaea_FlightSample_msg
+#define ichnaea_FlightRecorderRequest_fields &ichnaea_FlightRecorderRequest_msg
+#define ichnaea_FlightRecorderResponse_fields &ichnaea_FlightRecorderResponse_msg
+#define ichnaea_TelemetrySubscribeRequest_fields &ichnaea_TelemetrySubscribeRequest_msg
+#define ichnaea_TelemetrySubscribeResponse_fields &ichnaea_TelemetrySubscribeResponse_msg
+#define ichnaea_LinkBaudRequest_fields &ichnaea_LinkBaudRequest_msg
+#define ichnaea_LinkBaudResponse_fields &ichnaea_LinkBaudResponse_msg
+#define ichnaea_LTCRegGetRequest_fields &ichnaea_LTCRegGetRequest_msg
+#define ichnaea_LTCRegGetResponse_fields &ichnaea_LTCRegGetResponse_msg
+#define ichnaea_LTCRegSetRequest_fields &ichnaea_LTCRegSetRequest_msg
+#define ichnaea_LTCRegSetResponse_fields &ichnaea_LTCRegSetResponse_msg
+#define ichnaea_GroupCommandRequest_fields &ichnaea_GroupCommandRequest_msg
+#define ichnaea_GroupCommandResponse_fields &ichnaea_GroupCommandResponse_msg
 
 /* Maximum encoded size of messages (where known) */
-#define ICHNAEA_ICHNAEA_RPC_PB_H_MAX_SIZE        ichnaea_PDIWriteRequest_size
+#define ICHNAEA_ICHNAEA_RPC_PB_H_MAX_SIZE        ichnaea_LogQueryResponse_size
+#define ichnaea_BootStep_size                    21
+#define ichnaea_BootTimelineRequest_size         23
+#define ichnaea_BootTimelineResponse_size        482
+#define ichnaea_CalWriteRequest_size             212
+#define ichnaea_CalWriteResponse_size            81
+#define ichnaea_CalibrationEntry_size            22
+#define ichnaea_FlashLatencyHistogram_size       122
+#define ichnaea_FlashStatsRequest_size           24
+#define ichnaea_FlashStatsResponse_size          569
+#define ichnaea_FlightRecorderRequest_size       36
+#define ichnaea_FlightRecorderResponse_size      541
+#define ichnaea_FlightSample_size                19
 #define ichnaea_GetIdRequest_size                14
 #define ichnaea_GetIdResponse_size               29
+#define ichnaea_GroupCommandRequest_size         36
+#define ichnaea_GroupCommandResponse_size        32
+#define ichnaea_LTCRegGetRequest_size            25
+#define ichnaea_LTCRegGetResponse_size           37
+#define ichnaea_LTCRegSetRequest_size            26
+#define ichnaea_LTCRegSetResponse_size           19
+#define ichnaea_LinkBaudRequest_size             28
+#define ichnaea_LinkBaudResponse_size            82
+#define ichnaea_LogQueryRequest_size             59
+#define ichnaea_LogQueryResponse_size            572
 #define ichnaea_ManagerRequest_size              22
 #define ichnaea_ManagerResponse_size             81
 #define ichnaea_PDIReadRequest_size              26
@@ -554,12 +1579,17 @@ extern const pb_msgdesc_t ichnaea_SystemStatusResponse_msg;
 #define ichnaea_PDIWriteResponse_size            16
 #define ichnaea_PingNodeRequest_size             20
 #define ichnaea_PingNodeResponse_size            14
+#define ichnaea_SensorBatchRequest_size          24
+#define ichnaea_SensorBatchResponse_size         81
 #define ichnaea_SensorRequest_size               22
 #define ichnaea_SensorResponse_size              21
 #define ichnaea_SetpointRequest_size             28
 #define ichnaea_SetpointResponse_size            81
 #define ichnaea_SystemStatusRequest_size         20
-#define ichnaea_SystemStatusResponse_size        22
+#define ichnaea_SystemStatusResponse_size        66
+#define ichnaea_TelemetrySubscribeRequest_size   37
+#define ichnaea_TelemetrySubscribeResponse_size  31
+#define ichnaea_TxQueueStats_size                20
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -639,6 +1669,20 @@ struct MessageDescriptor<ichnaea_SensorResponse> {
     }
 };
 template <>
+struct MessageDescriptor<ichnaea_SensorBatchRequest> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 3;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_SensorBatchRequest_msg;
+    }
+};
+template <>
+struct MessageDescriptor<ichnaea_SensorBatchResponse> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 5;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_SensorBatchResponse_msg;
+    }
+};
+template <>
 struct MessageDescriptor<ichnaea_PDIReadRequest> {
     static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 3;
     static inline const pb_msgdesc_t* fields() {
@@ -674,12 +1718,187 @@ struct MessageDescriptor<ichnaea_SystemStatusRequest> {
     }
 };
 template <>
+struct MessageDescriptor<ichnaea_TxQueueStats> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 4;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_TxQueueStats_msg;
+    }
+};
+template <>
 struct MessageDescriptor<ichnaea_SystemStatusResponse> {
-    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 3;
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 4;
     static inline const pb_msgdesc_t* fields() {
         return &ichnaea_SystemStatusResponse_msg;
     }
 };
+template <>
+struct MessageDescriptor<ichnaea_BootStep> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 5;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_BootStep_msg;
+    }
+};
+template <>
+struct MessageDescriptor<ichnaea_BootTimelineRequest> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 3;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_BootTimelineRequest_msg;
+    }
+};
+template <>
+struct MessageDescriptor<ichnaea_BootTimelineResponse> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 5;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_BootTimelineResponse_msg;
+    }
+};
+template <>
+struct MessageDescriptor<ichnaea_CalibrationEntry> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 5;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_CalibrationEntry_msg;
+    }
+};
+template <>
+struct MessageDescriptor<ichnaea_CalWriteRequest> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 3;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_CalWriteRequest_msg;
+    }
+};
+template <>
+struct MessageDescriptor<ichnaea_CalWriteResponse> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 3;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_CalWriteResponse_msg;
+    }
+};
+template <>
+struct MessageDescriptor<ichnaea_FlashLatencyHistogram> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 2;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_FlashLatencyHistogram_msg;
+    }
+};
+template <>
+struct MessageDescriptor<ichnaea_FlashStatsRequest> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 3;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_FlashStatsRequest_msg;
+    }
+};
+template <>
+struct MessageDescriptor<ichnaea_FlashStatsResponse> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 10;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_FlashStatsResponse_msg;
+    }
+};
+template <>
+struct MessageDescriptor<ichnaea_LogQueryRequest> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 8;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_LogQueryRequest_msg;
+    }
+};
+template <>
+struct MessageDescriptor<ichnaea_LogQueryResponse> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 8;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_LogQueryResponse_msg;
+    }
+};
+template <>
+struct MessageDescriptor<ichnaea_FlightSample> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 4;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_FlightSample_msg;
+    }
+};
+template <>
+struct MessageDescriptor<ichnaea_FlightRecorderRequest> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 7;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_FlightRecorderRequest_msg;
+    }
+};
+template <>
+struct MessageDescriptor<ichnaea_FlightRecorderResponse> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 8;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_FlightRecorderResponse_msg;
+    }
+};
+template <>
+struct MessageDescriptor<ichnaea_TelemetrySubscribeRequest> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 6;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_TelemetrySubscribeRequest_msg;
+    }
+};
+template <>
+struct MessageDescriptor<ichnaea_TelemetrySubscribeResponse> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 5;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_TelemetrySubscribeResponse_msg;
+    }
+};
+template <>
+struct MessageDescriptor<ichnaea_LinkBaudRequest> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 4;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_LinkBaudRequest_msg;
+    }
+};
+template <>
+struct MessageDescriptor<ichnaea_LinkBaudResponse> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 6;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_LinkBaudResponse_msg;
+    }
+};
+template <>
+struct MessageDescriptor<ichnaea_LTCRegGetRequest> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 4;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_LTCRegGetRequest_msg;
+    }
+};
+template <>
+struct MessageDescriptor<ichnaea_LTCRegGetResponse> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 4;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_LTCRegGetResponse_msg;
+    }
+};
+template <>
+struct MessageDescriptor<ichnaea_LTCRegSetRequest> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 4;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_LTCRegSetRequest_msg;
+    }
+};
+template <>
+struct MessageDescriptor<ichnaea_LTCRegSetResponse> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 3;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_LTCRegSetResponse_msg;
+    }
+};
+template <>
+struct MessageDescriptor<ichnaea_GroupCommandRequest> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 7;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_GroupCommandRequest_msg;
+    }
+};
+template <>
+struct MessageDescriptor<ichnaea_GroupCommandResponse> {
+    static PB_INLINE_CONSTEXPR const pb_size_t fields_array_length = 5;
+    static inline const pb_msgdesc_t* fields() {
+        return &ichnaea_GroupCommandResponse_msg;
+    }
+};
 }  // namespace nanopb
 
 #endif  /* __cplusplus */
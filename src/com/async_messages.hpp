@@ -28,6 +28,13 @@ namespace COM::MSG
 
   static constexpr Descriptor Heartbeat{ ichnaea_AsyncMessageId_MSG_HEARTBEAT, ichnaea_AsyncMessageVersion_MSG_VER_HEARTBEAT,
                                          ichnaea_Heartbeat_fields, ichnaea_Heartbeat_size };
+
+  static constexpr Descriptor ConsoleBatch{ ichnaea_AsyncMessageId_MSG_CONSOLE_BATCH,
+                                            ichnaea_AsyncMessageVersion_MSG_VER_CONSOLE_BATCH, ichnaea_ConsoleBatch_fields,
+                                            ichnaea_ConsoleBatch_size };
+
+  static constexpr Descriptor Telemetry{ ichnaea_AsyncMessageId_MSG_TELEMETRY, ichnaea_AsyncMessageVersion_MSG_VER_TELEMETRY,
+                                         ichnaea_Telemetry_fields, ichnaea_Telemetry_size };
 }  // namespace COM::MSG
 
 #endif  /* !ICHNAEA_ASYNC_MESSAGES_HPP */
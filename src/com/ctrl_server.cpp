@@ -11,9 +11,16 @@
 /*-----------------------------------------------------------------------------
 Includes
 -----------------------------------------------------------------------------*/
+#include <cstring>
+#include <etl/algorithm.h>
+#include <mbedutils/interfaces/time_intf.hpp>
 #include <mbedutils/memory.hpp>
+#include <mbedutils/osal.hpp>
 #include <mbedutils/rpc.hpp>
+#include <mbedutils/threading.hpp>
+#include <pb_encode.h>
 #include <src/com/async_messages.hpp>
+#include <src/com/ctrl_server.hpp>
 #include <src/com/rpc/rpc_messages.hpp>
 #include <src/com/rpc/rpc_services.hpp>
 #include <src/hw/uart.hpp>
@@ -24,8 +31,8 @@ namespace Control
   Constants
   ---------------------------------------------------------------------------*/
 
-  static constexpr size_t RPC_MAX_SERVICES       = 15;
-  static constexpr size_t RPC_MAX_MESSAGES       = 50;
+  static constexpr size_t RPC_MAX_SERVICES       = 24;
+  static constexpr size_t RPC_MAX_MESSAGES       = 64;
   static constexpr size_t RPC_MAX_MSG_SIZE       = 608;    // PDI read/write
   static constexpr size_t RPC_RX_STREAM_BUF_SIZE = 3 * RPC_MAX_MSG_SIZE;
   static constexpr size_t RPC_RX_TRANSCODE_BUF_SIZE =
@@ -36,6 +43,38 @@ namespace Control
   static_assert( RPC_RX_TRANSCODE_BUF_SIZE % sizeof( uint32_t ) == 0, "Transcode buffer must be word aligned" );
   static_assert( RPC_TX_TRANSCODE_BUF_SIZE % sizeof( uint32_t ) == 0, "Transcode buffer must be word aligned" );
 
+  /* Transmit queues. Slots hold the decoded message structure. */
+  static constexpr size_t TX_SMALL_SLOT_SIZE =
+      ALIGN_UP( etl::max( sizeof( ichnaea_Telemetry ), sizeof( ichnaea_Heartbeat ) ), sizeof( uint32_t ) );
+  static constexpr size_t TX_BULK_SLOT_SIZE =
+      ALIGN_UP( etl::max( sizeof( ichnaea_ConsoleBatch ), sizeof( mbed_rpc_ConsoleMessage ) ), sizeof( uint32_t ) );
+  static constexpr size_t TX_TELEMETRY_DEPTH = 16;
+  static constexpr size_t TX_BULK_DEPTH      = 6;
+
+  static constexpr uint32_t TX_BULK_SHARE_PCT  = 50;                        /**< Share of the line rate bulk may use */
+  static constexpr uint32_t TX_BULK_CREDIT_MAX = RPC_TX_TRANSCODE_BUF_SIZE; /**< Largest bulk burst, one full frame */
+  static constexpr uint32_t BITS_PER_CHAR      = 10;                        /**< 8N1 framing */
+  static constexpr uint32_t TX_CREDIT_POLL_MS  = 1;                         /**< Wait between checks for bulk credit */
+
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  struct TxEntry
+  {
+    uint32_t msgId;    /**< Message identifier to publish under */
+    uint32_t wireSize; /**< Encoded size, charged against the bulk share */
+  };
+
+  struct TxQueue
+  {
+    uint8_t *storage;  /**< depth slots of sizeof( TxEntry ) + slotSize bytes */
+    size_t   slotSize; /**< Largest message structure a slot holds */
+    size_t   depth;    /**< Number of slots */
+    size_t   head;     /**< Slot of the oldest message */
+    TxStats  stats;
+  };
+
 
   /*---------------------------------------------------------------------------
   Static Data
@@ -54,13 +93,136 @@ namespace Control
   static COM::RPC::ManagerService               s_manager_service;
   static COM::RPC::SetpointService              s_setpoint_service;
   static COM::RPC::SensorService                s_sensor_service;
+  static COM::RPC::SensorBatchService           s_sensor_batch_service;
   static COM::RPC::PDIReadService               s_pdi_read_service;
   static COM::RPC::PDIWriteService              s_pdi_write_service;
   static COM::RPC::SystemStatusService          s_system_status_service;
+  static COM::RPC::BootTimelineService          s_boot_timeline_service;
+  static COM::RPC::CalWriteService              s_cal_write_service;
+  static COM::RPC::FlashStatsService            s_flash_stats_service;
+  static COM::RPC::LogQueryService              s_log_query_service;
+  static COM::RPC::FlightRecorderService        s_flight_recorder_service;
+  static COM::RPC::TelemetryService             s_telemetry_service;
+  static COM::RPC::LinkBaudService              s_link_baud_service;
+  static COM::RPC::LTCRegGetService             s_ltc_reg_get_service;
+  static COM::RPC::LTCRegSetService             s_ltc_reg_set_service;
+  static COM::RPC::GroupCommandService          s_group_command_service;
   static mb::rpc::service::logger::EraseService s_logger_erase_service;
   static mb::rpc::service::logger::WriteService s_logger_write_service;
   static mb::rpc::service::logger::ReadService  s_logger_read_service;
 
+  /* Transmit Queue Memory */
+  alignas( uint32_t ) static uint8_t s_tx_telemetry_storage[ TX_TELEMETRY_DEPTH * ( sizeof( TxEntry ) + TX_SMALL_SLOT_SIZE ) ];
+  alignas( uint32_t ) static uint8_t s_tx_bulk_storage[ TX_BULK_DEPTH * ( sizeof( TxEntry ) + TX_BULK_SLOT_SIZE ) ];
+  alignas( uint32_t ) static uint8_t s_tx_scratch[ TX_BULK_SLOT_SIZE ]; /**< Message being published */
+
+  static TxQueue s_tx_queue[ static_cast<size_t>( TxClass::NUM_OPTIONS ) ] = {
+    { s_tx_telemetry_storage, TX_SMALL_SLOT_SIZE, TX_TELEMETRY_DEPTH, 0, {} },
+    { s_tx_bulk_storage, TX_BULK_SLOT_SIZE, TX_BULK_DEPTH, 0, {} },
+  };
+
+  static mb::osal::mb_recursive_mutex_t s_tx_lock;
+  static bool                           s_tx_ready;
+  static uint32_t                       s_tx_bulk_credit; /**< Bytes bulk traffic may still send */
+  static size_t                         s_tx_last_flush;  /**< System time of the previous flush */
+
+  /*---------------------------------------------------------------------------
+  Private Functions
+  ---------------------------------------------------------------------------*/
+
+  static inline TxEntry *tx_slot( TxQueue &q, const size_t idx )
+  {
+    return reinterpret_cast<TxEntry *>( q.storage + ( idx * ( sizeof( TxEntry ) + q.slotSize ) ) );
+  }
+
+
+  /**
+   * @brief Removes the oldest message of a class into the scratch buffer.
+   * Bulk messages are only taken if the class has enough link credit left.
+   *
+   * @param cls    Class to pop from
+   * @param entry  Output for the message header
+   * @return true  A message was copied into s_tx_scratch
+   */
+  static bool tx_pop( const TxClass cls, TxEntry &entry )
+  {
+    mb::thread::RecursiveLockGuard lock( s_tx_lock );
+
+    TxQueue &q = s_tx_queue[ static_cast<size_t>( cls ) ];
+    if( !q.stats.depth )
+    {
+      return false;
+    }
+
+    const TxEntry *slot = tx_slot( q, q.head );
+    if( ( cls == TxClass::BULK ) && ( slot->wireSize > s_tx_bulk_credit ) )
+    {
+      return false;
+    }
+
+    entry = *slot;
+    memcpy( s_tx_scratch, slot + 1, q.slotSize );
+
+    q.head = ( q.head + 1 ) % q.depth;
+    q.stats.depth--;
+
+    if( cls == TxClass::BULK )
+    {
+      s_tx_bulk_credit -= entry.wireSize;
+    }
+
+    return true;
+  }
+
+
+  /**
+   * @brief Earns bulk credit for the link time that passed since the last call
+   */
+  static void earn_bulk_credit()
+  {
+    const size_t   now        = mb::time::millis();
+    const uint32_t elapsed_ms = static_cast<uint32_t>( now - s_tx_last_flush );
+    const uint32_t line_bps   = HW::UART::getBaudRate( HW::UART::UART_BMS ) / BITS_PER_CHAR;
+    const uint64_t earned     = ( static_cast<uint64_t>( line_bps ) * elapsed_ms * TX_BULK_SHARE_PCT ) / ( 1000u * 100u );
+
+    mb::thread::RecursiveLockGuard lock( s_tx_lock );
+    if( earned != 0 )
+    {
+      s_tx_bulk_credit = static_cast<uint32_t>( etl::min<uint64_t>( s_tx_bulk_credit + earned, TX_BULK_CREDIT_MAX ) );
+      s_tx_last_flush  = now;
+    }
+  }
+
+
+  /**
+   * @brief Sends every message of a class that may go right now. Messages are
+   * published outside the lock so that anything logged while encoding can
+   * queue without deadlocking.
+   *
+   * @param cls   Class to send
+   */
+  static void send_class( const TxClass cls )
+  {
+    TxQueue &q = s_tx_queue[ static_cast<size_t>( cls ) ];
+    TxEntry  entry;
+
+    while( tx_pop( cls, entry ) )
+    {
+      const bool sent = s_rpc_server.publishMessage( entry.msgId, s_tx_scratch );
+
+      mb::thread::RecursiveLockGuard lock( s_tx_lock );
+      if( sent )
+      {
+        q.stats.sent++;
+      }
+      else
+      {
+        q.stats.dropped++;
+      }
+    }
+  }
+
+
   /*---------------------------------------------------------------------------
   Public Functions
   ---------------------------------------------------------------------------*/
@@ -74,6 +236,11 @@ namespace Control
     -------------------------------------------------------------------------*/
     message::initialize( &s_rpc_msg_registry );
 
+    mbed_assert( mb::osal::buildRecursiveMutexStrategy( s_tx_lock ) );
+    s_tx_bulk_credit = TX_BULK_CREDIT_MAX;
+    s_tx_last_flush  = mb::time::millis();
+    s_tx_ready       = true;
+
     auto rpc_cfg = s_rpc_server_storage.make_config( HW::UART::getDriver( HW::UART::Channel::UART_BMS ) );
     mbed_assert_continue( s_rpc_server.open( rpc_cfg ) );
 
@@ -81,6 +248,8 @@ namespace Control
     Add system message definitions
     -------------------------------------------------------------------------*/
     mbed_assert_continue( message::addDescriptor( COM::MSG::Heartbeat ) );
+    mbed_assert_continue( message::addDescriptor( COM::MSG::ConsoleBatch ) );
+    mbed_assert_continue( message::addDescriptor( COM::MSG::Telemetry ) );
 
     /*-------------------------------------------------------------------------
     Add the system services
@@ -111,6 +280,11 @@ namespace Control
     mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::SensorRequest ) );
     mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::SensorResponse ) );
 
+    /* Sensor Batch Service */
+    mbed_assert( s_rpc_server.addService( &s_sensor_batch_service ) );
+    mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::SensorBatchRequest ) );
+    mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::SensorBatchResponse ) );
+
     /* PDI Read Service */
     mbed_assert( s_rpc_server.addService( &s_pdi_read_service ) );
     mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::PDIReadRequest ) );
@@ -126,6 +300,56 @@ namespace Control
     mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::SystemStatusRequest ) );
     mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::SystemStatusResponse ) );
 
+    /* Boot Timeline Service */
+    mbed_assert( s_rpc_server.addService( &s_boot_timeline_service ) );
+    mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::BootTimelineRequest ) );
+    mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::BootTimelineResponse ) );
+
+    /* Calibration Write Service */
+    mbed_assert( s_rpc_server.addService( &s_cal_write_service ) );
+    mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::CalWriteRequest ) );
+    mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::CalWriteResponse ) );
+
+    /* Flash Statistics Service */
+    mbed_assert( s_rpc_server.addService( &s_flash_stats_service ) );
+    mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::FlashStatsRequest ) );
+    mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::FlashStatsResponse ) );
+
+    /* Log Query Service */
+    mbed_assert( s_rpc_server.addService( &s_log_query_service ) );
+    mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::LogQueryRequest ) );
+    mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::LogQueryResponse ) );
+
+    /* Flight Recorder Service */
+    mbed_assert( s_rpc_server.addService( &s_flight_recorder_service ) );
+    mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::FlightRecorderRequest ) );
+    mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::FlightRecorderResponse ) );
+
+    /* Telemetry Service */
+    mbed_assert( s_rpc_server.addService( &s_telemetry_service ) );
+    mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::TelemetrySubscribeRequest ) );
+    mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::TelemetrySubscribeResponse ) );
+
+    /* Link Baud Service */
+    mbed_assert( s_rpc_server.addService( &s_link_baud_service ) );
+    mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::LinkBaudRequest ) );
+    mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::LinkBaudResponse ) );
+
+    /* LTC Register Get Service */
+    mbed_assert( s_rpc_server.addService( &s_ltc_reg_get_service ) );
+    mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::LTCRegGetRequest ) );
+    mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::LTCRegGetResponse ) );
+
+    /* LTC Register Set Service */
+    mbed_assert( s_rpc_server.addService( &s_ltc_reg_set_service ) );
+    mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::LTCRegSetRequest ) );
+    mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::LTCRegSetResponse ) );
+
+    /* Group Command Service */
+    mbed_assert( s_rpc_server.addService( &s_group_command_service ) );
+    mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::GroupCommandRequest ) );
+    mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::GroupCommandResponse ) );
+
     /* Logger Erase Service */
     mbed_assert( s_rpc_server.addService( &s_logger_erase_service ) );
     mbed_assert( mb::rpc::message::addDescriptor( COM::RPC::LoggerEraseRequest ) );
@@ -148,4 +372,111 @@ namespace Control
     return s_rpc_server;
   }
 
+
+  bool publish( const TxClass cls, const uint32_t msgId, const pb_msgdesc_t *const fields, const void *const msg,
+                const size_t size )
+  {
+    if( !s_tx_ready || ( cls >= TxClass::NUM_OPTIONS ) || !fields || !msg )
+    {
+      return false;
+    }
+
+    TxQueue &q = s_tx_queue[ static_cast<size_t>( cls ) ];
+    if( size > q.slotSize )
+    {
+      mbed_assert_continue_msg( false, "Msg %d too large for TX class %d", static_cast<int>( msgId ), static_cast<int>( cls ) );
+      return false;
+    }
+
+    size_t wire_size = 0;
+    if( !pb_get_encoded_size( &wire_size, fields, msg ) )
+    {
+      return false;
+    }
+
+    /*-------------------------------------------------------------------------
+    Drop the newest message when full so the queued ones still go out in order
+    -------------------------------------------------------------------------*/
+    mb::thread::RecursiveLockGuard lock( s_tx_lock );
+
+    if( q.stats.depth >= q.depth )
+    {
+      q.stats.dropped++;
+      return false;
+    }
+
+    TxEntry *slot  = tx_slot( q, ( q.head + q.stats.depth ) % q.depth );
+    slot->msgId    = msgId;
+    slot->wireSize = static_cast<uint32_t>( wire_size );
+    memcpy( slot + 1, msg, size );
+
+    q.stats.depth++;
+    q.stats.high_water = etl::max( q.stats.high_water, q.stats.depth );
+
+    return true;
+  }
+
+
+  void flushTx()
+  {
+    if( !s_tx_ready )
+    {
+      return;
+    }
+
+    /*-------------------------------------------------------------------------
+    Earn bulk credit for the link time that passed since the last flush, then
+    send in strict priority order
+    -------------------------------------------------------------------------*/
+    earn_bulk_credit();
+
+    for( size_t idx = 0; idx < static_cast<size_t>( TxClass::NUM_OPTIONS ); idx++ )
+    {
+      send_class( static_cast<TxClass>( idx ) );
+    }
+  }
+
+
+  void awaitBulkCredit( const size_t wireSize )
+  {
+    if( !s_tx_ready )
+    {
+      return;
+    }
+
+    const uint32_t cost = static_cast<uint32_t>( etl::min<size_t>( wireSize, TX_BULK_CREDIT_MAX ) );
+
+    while( true )
+    {
+      /*-----------------------------------------------------------------------
+      Everything ahead of bulk in priority goes first
+      -----------------------------------------------------------------------*/
+      earn_bulk_credit();
+      send_class( TxClass::TELEMETRY );
+
+      {
+        mb::thread::RecursiveLockGuard lock( s_tx_lock );
+        if( s_tx_bulk_credit >= cost )
+        {
+          s_tx_bulk_credit -= cost;
+          return;
+        }
+      }
+
+      mb::thread::this_thread::sleep_for( TX_CREDIT_POLL_MS );
+    }
+  }
+
+
+  TxStats txStats( const TxClass cls )
+  {
+    if( cls >= TxClass::NUM_OPTIONS )
+    {
+      return {};
+    }
+
+    mb::thread::RecursiveLockGuard lock( s_tx_lock );
+    return s_tx_queue[ static_cast<size_t>( cls ) ].stats;
+  }
+
 }    // namespace Control
@@ -16,10 +16,41 @@
 /*-----------------------------------------------------------------------------
 Includes
 -----------------------------------------------------------------------------*/
+#include <cstddef>
+#include <cstdint>
 #include <mbedutils/rpc.hpp>
+#include <pb.h>
 
 namespace Control
 {
+  /*---------------------------------------------------------------------------
+  Enumerations
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Transmit priority of an unsolicited message. RPC responses are sent
+   * as soon as the service runs and always go ahead of all of these.
+   */
+  enum class TxClass : uint8_t
+  {
+    TELEMETRY, /**< Heartbeats and streamed sensor data, sent first */
+    BULK,      /**< Console logs, limited to a share of the link */
+
+    NUM_OPTIONS
+  };
+
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  struct TxStats
+  {
+    uint16_t depth;      /**< Messages waiting to be sent */
+    uint16_t high_water; /**< Deepest the queue has been */
+    uint32_t sent;       /**< Messages handed to the RPC server */
+    uint32_t dropped;    /**< Messages lost to a full queue or a failed publish */
+  };
+
   /*---------------------------------------------------------------------------
   Public Functions
   ---------------------------------------------------------------------------*/
@@ -36,6 +67,53 @@ namespace Control
    */
   mb::rpc::server::Server &getRPCServer();
 
+  /**
+   * @brief Queue an unsolicited message for transmission. The message is
+   * copied, so the caller may reuse it as soon as this returns.
+   *
+   * @param cls     Priority class to send the message in
+   * @param msgId   Message identifier, as registered with the RPC server
+   * @param fields  Nanopb descriptor of the message, used to size it on the wire
+   * @param msg     Message to send
+   * @param size    Size of the message structure
+   * @return true   The message was queued
+   * @return false  The queue for that class is full or the message is too large
+   */
+  bool publish( const TxClass cls, const uint32_t msgId, const pb_msgdesc_t *const fields, const void *const msg,
+                const size_t size );
+
+  template<typename T>
+  inline bool publish( const TxClass cls, const uint32_t msgId, const pb_msgdesc_t *const fields, const T &msg )
+  {
+    return publish( cls, msgId, fields, &msg, sizeof( T ) );
+  }
+
+  /**
+   * @brief Send queued messages in strict priority order. Bulk messages only
+   * go out while they have link time to spend, so a log storm can't back up
+   * the UART in front of control traffic. Called periodically from the
+   * control thread, right after the RPC services run.
+   */
+  void flushTx();
+
+  /**
+   * @brief Charge bulk output the RPC server writes directly, such as the
+   * logger read stream, against the bulk share of the link. Blocks until the
+   * share can cover it, sending queued telemetry while it waits so a long
+   * stream doesn't hold it up. Only call from the control thread.
+   *
+   * @param wireSize  Bytes about to be written to the link
+   */
+  void awaitBulkCredit( const size_t wireSize );
+
+  /**
+   * @brief Get the queue statistics for a transmit class
+   *
+   * @param cls  Class to query
+   * @return TxStats
+   */
+  TxStats txStats( const TxClass cls );
+
 }  // namespace Control
 
 #endif  /* !ICHNAEA_CONTROL_SERVER_HPP */
@@ -0,0 +1,209 @@
+/******************************************************************************
+ *  File Name:
+ *    link_speed.cpp
+ *
+ *  Description:
+ *    Line rate negotiation for the BMS/RPC UART
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <etl/algorithm.h>
+#include <mbedutils/interfaces/time_intf.hpp>
+#include <mbedutils/logging.hpp>
+#include <src/com/link_speed.hpp>
+#include <src/hw/uart.hpp>
+
+namespace COM::LinkSpeed
+{
+  /*---------------------------------------------------------------------------
+  Enumerations
+  ---------------------------------------------------------------------------*/
+
+  enum class State : uint8_t
+  {
+    STABLE,    /**< Running at a committed rate */
+    SWITCHING, /**< Waiting for the acknowledgement to go out */
+    PROBATION, /**< Running at the new rate, waiting on the host */
+  };
+
+  /*---------------------------------------------------------------------------
+  Static Data
+  ---------------------------------------------------------------------------*/
+
+  static volatile State s_state;
+  static uint32_t       s_pending_baud;
+  static size_t         s_deadline;
+  static size_t         s_window_start;
+  static uint32_t       s_window_errors;
+  static uint32_t       s_fallbacks;
+  static uint32_t       s_line_errors;
+
+  /*---------------------------------------------------------------------------
+  Private Functions
+  ---------------------------------------------------------------------------*/
+
+  static bool is_supported( const uint32_t baud )
+  {
+    return etl::find( SUPPORTED_BAUD.begin(), SUPPORTED_BAUD.end(), baud ) != SUPPORTED_BAUD.end();
+  }
+
+
+  static void fall_back( const char *reason )
+  {
+    HW::UART::setBaudRate( HW::UART::UART_BMS, HW::UART::DEFAULT_BAUD );
+
+    s_state        = State::STABLE;
+    s_pending_baud = 0;
+    s_fallbacks++;
+
+    LOG_WARN( "RPC link back to %u baud: %s", static_cast<unsigned>( HW::UART::DEFAULT_BAUD ), reason );
+  }
+
+
+  static void count_error( const size_t now, const uint32_t count )
+  {
+    if( !count )
+    {
+      return;
+    }
+
+    if( ( now - s_window_start ) >= ERROR_WINDOW_MS )
+    {
+      s_window_start  = now;
+      s_window_errors = 0;
+    }
+
+    s_window_errors += count;
+    s_line_errors += count;
+  }
+
+  /*---------------------------------------------------------------------------
+  Public Functions
+  ---------------------------------------------------------------------------*/
+
+  ichnaea_LinkBaudStatus request( const uint32_t baud )
+  {
+    if( !is_supported( baud ) )
+    {
+      return ichnaea_LinkBaudStatus_LINK_BAUD_UNSUPPORTED;
+    }
+
+    if( s_state != State::STABLE )
+    {
+      return ichnaea_LinkBaudStatus_LINK_BAUD_BUSY;
+    }
+
+    if( baud == HW::UART::getBaudRate( HW::UART::UART_BMS ) )
+    {
+      return ichnaea_LinkBaudStatus_LINK_BAUD_OK;
+    }
+
+    s_pending_baud = baud;
+    s_deadline     = mb::time::millis() + SWITCH_TIMEOUT_MS;
+    s_state        = State::SWITCHING;
+
+    return ichnaea_LinkBaudStatus_LINK_BAUD_OK;
+  }
+
+
+  ichnaea_LinkBaudStatus confirm( const uint32_t baud )
+  {
+    if( ( s_state == State::PROBATION ) && ( baud == s_pending_baud ) )
+    {
+      s_state        = State::STABLE;
+      s_pending_baud = 0;
+
+      LOG_INFO( "RPC link running at %u baud", static_cast<unsigned>( baud ) );
+      return ichnaea_LinkBaudStatus_LINK_BAUD_OK;
+    }
+
+    /*-------------------------------------------------------------------------
+    Confirming the rate already in use is harmless
+    -------------------------------------------------------------------------*/
+    if( ( s_state == State::STABLE ) && ( baud == HW::UART::getBaudRate( HW::UART::UART_BMS ) ) )
+    {
+      return ichnaea_LinkBaudStatus_LINK_BAUD_OK;
+    }
+
+    return ichnaea_LinkBaudStatus_LINK_BAUD_BUSY;
+  }
+
+
+  void reportError( const uint32_t count )
+  {
+    count_error( mb::time::millis(), count );
+  }
+
+
+  Stats stats()
+  {
+    Stats result;
+
+    result.baud        = HW::UART::getBaudRate( HW::UART::UART_BMS );
+    result.pending     = s_pending_baud;
+    result.fallbacks   = s_fallbacks;
+    result.line_errors = s_line_errors;
+
+    return result;
+  }
+
+
+  void process()
+  {
+    const size_t now = mb::time::millis();
+
+    /*-------------------------------------------------------------------------
+    Move to the requested rate once the acknowledgement, and everything queued
+    ahead of it, has gone out. A link too busy to ever drain keeps the old rate.
+    -------------------------------------------------------------------------*/
+    if( ( s_state == State::SWITCHING ) && !HW::UART::isTxIdle( HW::UART::UART_BMS ) && ( now >= s_deadline ) )
+    {
+      LOG_WARN( "RPC link never drained, staying at %u baud",
+                static_cast<unsigned>( HW::UART::getBaudRate( HW::UART::UART_BMS ) ) );
+      s_state        = State::STABLE;
+      s_pending_baud = 0;
+    }
+
+    if( ( s_state == State::SWITCHING ) && HW::UART::isTxIdle( HW::UART::UART_BMS ) )
+    {
+      if( HW::UART::setBaudRate( HW::UART::UART_BMS, s_pending_baud ) )
+      {
+        s_state         = State::PROBATION;
+        s_deadline      = now + CONFIRM_TIMEOUT_MS;
+        s_window_start  = now;
+        s_window_errors = 0;
+      }
+      else
+      {
+        s_state        = State::STABLE;
+        s_pending_baud = 0;
+      }
+    }
+
+    /*-------------------------------------------------------------------------
+    The host never showed up at the new rate
+    -------------------------------------------------------------------------*/
+    if( ( s_state == State::PROBATION ) && ( now >= s_deadline ) )
+    {
+      fall_back( "rate not confirmed" );
+    }
+
+    /*-------------------------------------------------------------------------
+    Watch the line for errors. At the default rate there is nowhere slower to
+    go, so only count them.
+    -------------------------------------------------------------------------*/
+    count_error( now, HW::UART::takeLineErrors( HW::UART::UART_BMS ) );
+
+    if( ( s_window_errors >= ERROR_LIMIT ) && ( s_state != State::SWITCHING ) &&
+        ( HW::UART::getBaudRate( HW::UART::UART_BMS ) != HW::UART::DEFAULT_BAUD ) )
+    {
+      s_window_errors = 0;
+      fall_back( "too many line errors" );
+    }
+  }
+
+}    // namespace COM::LinkSpeed
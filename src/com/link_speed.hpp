@@ -0,0 +1,98 @@
+/******************************************************************************
+ *  File Name:
+ *    link_speed.hpp
+ *
+ *  Description:
+ *    Line rate negotiation for the BMS/RPC UART. The host asks for a faster
+ *    rate, the node switches once the acknowledgement is out, and the host
+ *    has to confirm at the new rate or the node drops back to the default.
+ *    A committed rate also falls back if receive line errors pile up.
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+#pragma once
+#ifndef ICHNAEA_COM_LINK_SPEED_HPP
+#define ICHNAEA_COM_LINK_SPEED_HPP
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <cstddef>
+#include <cstdint>
+#include <etl/array.h>
+#include <src/app/proto/ichnaea_rpc.pb.h>
+
+namespace COM::LinkSpeed
+{
+  /*---------------------------------------------------------------------------
+  Constants
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Rates a host may ask for, slowest first
+   */
+  static constexpr etl::array<uint32_t, 6> SUPPORTED_BAUD = { 115200, 230400, 460800, 921600, 1000000, 2000000 };
+
+  static constexpr uint32_t SWITCH_TIMEOUT_MS  = 250;  /**< Longest to wait for the acknowledgement to clear the wire */
+  static constexpr uint32_t CONFIRM_TIMEOUT_MS = 2000; /**< Time the host has to confirm a new rate */
+  static constexpr uint32_t ERROR_WINDOW_MS    = 1000; /**< Span line errors are counted over */
+  static constexpr uint32_t ERROR_LIMIT        = 8;    /**< Errors in one window that force a fallback */
+
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  struct Stats
+  {
+    uint32_t baud;        /**< Rate the link is running at */
+    uint32_t pending;     /**< Rate waiting on a switch or confirmation, 0 if none */
+    uint32_t fallbacks;   /**< Times the link dropped back to the default rate */
+    uint32_t line_errors; /**< Receive line errors seen since boot */
+  };
+
+  /*---------------------------------------------------------------------------
+  Public Functions
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Ask to move the link to a new rate. The switch happens a little
+   * after the call so the response can go out at the current rate.
+   *
+   * @param baud  Requested line rate
+   * @return ichnaea_LinkBaudStatus
+   */
+  ichnaea_LinkBaudStatus request( const uint32_t baud );
+
+  /**
+   * @brief Confirm the host is talking at the new rate, making it stick
+   *
+   * @param baud  Rate the host believes the link is running at
+   * @return ichnaea_LinkBaudStatus
+   */
+  ichnaea_LinkBaudStatus confirm( const uint32_t baud );
+
+  /**
+   * @brief Count link level errors from outside the UART line status, such as
+   * received frames that can't be decoded
+   *
+   * @param count   Number of errors to add
+   */
+  void reportError( const uint32_t count );
+
+  /**
+   * @brief Get the current link state
+   *
+   * @return Stats
+   */
+  Stats stats();
+
+  /**
+   * @brief Run pending switches, confirmation timeouts and error fallbacks.
+   * Called periodically from the control thread.
+   */
+  void process();
+
+}    // namespace COM::LinkSpeed
+
+#endif /* !ICHNAEA_COM_LINK_SPEED_HPP */
@@ -22,7 +22,7 @@ namespace COM::RPC
   Service Implementations
   ---------------------------------------------------------------------------*/
 
-  mb::rpc::ErrId PingNodeService::processRequest()
+  mb::rpc::ErrId PingNodeService::handleRequest()
   {
     /*-------------------------------------------------------------------------
     Assuming the node ID is the same as the system ID, we can respond
@@ -39,7 +39,7 @@ namespace COM::RPC
   }
 
 
-  mb::rpc::ErrId IdentityService::processRequest()
+  mb::rpc::ErrId IdentityService::handleRequest()
   {
     response.unique_id = System::identity();
     response.ver_major = System::kMajorVersion;
@@ -0,0 +1,59 @@
+/******************************************************************************
+ *  File Name:
+ *    boot_timeline_service.cpp
+ *
+ *  Description:
+ *    Implement the boot timeline service
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <src/app/proto/ichnaea_rpc.pb.h>
+#include <src/com/rpc/rpc_services.hpp>
+#include <src/system/system_boot_profile.hpp>
+
+namespace COM::RPC
+{
+  /*---------------------------------------------------------------------------
+  Service Implementations
+  ---------------------------------------------------------------------------*/
+  mb::rpc::ErrId BootTimelineService::handleRequest()
+  {
+    namespace Profiler = System::Boot::Profiler;
+
+    /*-------------------------------------------------------------------------
+    Ignore requests that are not intended for this node
+    -------------------------------------------------------------------------*/
+    if( request.node_id != System::identity() )
+    {
+      return mbed_rpc_ErrorCode_ERR_SVC_NO_RSP;
+    }
+
+    /*-------------------------------------------------------------------------
+    Copy out the requested page of the timeline
+    -------------------------------------------------------------------------*/
+    const size_t max_steps = sizeof( response.steps ) / sizeof( response.steps[ 0 ] );
+
+    response.total       = static_cast<uint8_t>( Profiler::count() );
+    response.offset      = request.offset;
+    response.complete    = Profiler::isComplete();
+    response.steps_count = 0;
+
+    Profiler::Record record;
+    for( size_t idx = request.offset; ( response.steps_count < max_steps ) && Profiler::getRecord( idx, record ); idx++ )
+    {
+      ichnaea_BootStep &step = response.steps[ response.steps_count++ ];
+
+      step.step        = static_cast<ichnaea_BootStepId>( record.step );
+      step.depth       = record.depth;
+      step.tag         = record.tag;
+      step.start_us    = record.start_us;
+      step.duration_us = record.duration_us;
+    }
+
+    return mbed_rpc_ErrorCode_ERR_NO_ERROR;
+  }
+}  // namespace COM::RPC
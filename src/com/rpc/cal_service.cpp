@@ -0,0 +1,95 @@
+/******************************************************************************
+ *  File Name:
+ *    cal_service.cpp
+ *
+ *  Description:
+ *    Implements the bulk calibration write RPC service
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <cmath>
+#include <cstdio>
+#include <mbedutils/logging.hpp>
+#include <src/app/app_pdi.hpp>
+#include <src/com/rpc/rpc_services.hpp>
+#include <src/system/system_cal.hpp>
+#include <src/system/system_util.hpp>
+
+namespace COM::RPC
+{
+  /*---------------------------------------------------------------------------
+  Service Implementations
+  ---------------------------------------------------------------------------*/
+
+  mb::rpc::ErrId CalWriteService::handleRequest()
+  {
+    /*-------------------------------------------------------------------------
+    Ignore the message if it's not for us
+    -------------------------------------------------------------------------*/
+    if( request.node_id != System::identity() )
+    {
+      return mbed_rpc_ErrorCode_ERR_SVC_NO_RSP;
+    }
+
+    response.success     = false;
+    response.has_message = true;
+
+    /*-------------------------------------------------------------------------
+    Stage every entry on top of the active calibration before touching flash
+    -------------------------------------------------------------------------*/
+    System::CalStore::CalData cal = System::CalStore::data();
+
+    for( size_t idx = 0; idx < request.entries_count; idx++ )
+    {
+      const ichnaea_CalibrationEntry &entry = request.entries[ idx ];
+
+      if( !std::isfinite( entry.gain ) || !std::isfinite( entry.offset ) || !( entry.valid_min < entry.valid_max ) )
+      {
+        snprintf( response.message, sizeof( response.message ), "Entry %u has an invalid range", static_cast<unsigned>( idx ) );
+        return mbed_rpc_ErrorCode_ERR_NO_ERROR;
+      }
+
+      ichnaea_PDI_BasicCalibration *target = nullptr;
+      switch( entry.id )
+      {
+        case ichnaea_CalibrationId_CAL_OUTPUT_CURRENT:
+          target = &cal.outputCurrent;
+          break;
+
+        default:
+          snprintf( response.message, sizeof( response.message ), "Unknown calibration id %d", entry.id );
+          return mbed_rpc_ErrorCode_ERR_NO_ERROR;
+      }
+
+      target->offset    = entry.offset;
+      target->gain      = entry.gain;
+      target->valid_min = entry.valid_min;
+      target->valid_max = entry.valid_max;
+    }
+
+    /*-------------------------------------------------------------------------
+    Commit the full set as one record
+    -------------------------------------------------------------------------*/
+    if( !System::CalStore::commit( cal ) )
+    {
+      snprintf( response.message, sizeof( response.message ), "Flash commit failed" );
+      return mbed_rpc_ErrorCode_ERR_SVC_FAILED;
+    }
+
+    /*-------------------------------------------------------------------------
+    Keep the PDI mirror of the calibrations in sync
+    -------------------------------------------------------------------------*/
+    App::PDI::Internal::RAMCache.calOutputCurrent = cal.outputCurrent;
+    App::PDI::invalidate_encode_cache( App::PDI::KEY_CAL_OUTPUT_CURRENT );
+
+    LOG_INFO( "Committed %d calibration entries", request.entries_count );
+    response.success     = true;
+    response.has_message = false;
+    return mbed_rpc_ErrorCode_ERR_NO_ERROR;
+  }
+
+}    // namespace COM::RPC
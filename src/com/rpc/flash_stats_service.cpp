@@ -0,0 +1,76 @@
+/******************************************************************************
+ *  File Name:
+ *    flash_stats_service.cpp
+ *
+ *  Description:
+ *    Implement the flash statistics service
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <src/app/proto/ichnaea_rpc.pb.h>
+#include <src/com/rpc/rpc_services.hpp>
+#include <src/system/system_flash_stats.hpp>
+
+namespace COM::RPC
+{
+  /*---------------------------------------------------------------------------
+  Service Implementations
+  ---------------------------------------------------------------------------*/
+  mb::rpc::ErrId FlashStatsService::handleRequest()
+  {
+    namespace FlashStats = System::FlashStats;
+
+    /*-------------------------------------------------------------------------
+    Ignore requests that are not intended for this node
+    -------------------------------------------------------------------------*/
+    if( request.node_id != System::identity() )
+    {
+      return mbed_rpc_ErrorCode_ERR_SVC_NO_RSP;
+    }
+
+    /*-------------------------------------------------------------------------
+    Lifetime totals go out with every page
+    -------------------------------------------------------------------------*/
+    const FlashStats::Totals totals = FlashStats::totals();
+
+    response.bytes_read       = totals.bytes_read;
+    response.bytes_programmed = totals.bytes_programmed;
+    response.read_ops         = totals.read_ops;
+    response.program_ops      = totals.program_ops;
+    response.erase_ops        = totals.erase_ops;
+    response.num_sectors      = static_cast<uint16_t>( FlashStats::numSectors() );
+    response.sector_offset    = request.sector_offset;
+
+    /*-------------------------------------------------------------------------
+    Copy out the requested page of sector erase counts
+    -------------------------------------------------------------------------*/
+    const size_t max_sectors = sizeof( response.erase_counts ) / sizeof( response.erase_counts[ 0 ] );
+
+    response.erase_counts_count = 0;
+    for( size_t idx = request.sector_offset; ( response.erase_counts_count < max_sectors ) && ( idx < FlashStats::numSectors() ); idx++ )
+    {
+      response.erase_counts[ response.erase_counts_count++ ] = FlashStats::sectorEraseCount( idx );
+    }
+
+    /*-------------------------------------------------------------------------
+    Latency histograms for each operation type
+    -------------------------------------------------------------------------*/
+    static_assert( sizeof( response.latency[ 0 ].buckets ) / sizeof( uint32_t ) == FlashStats::LATENCY_BUCKETS );
+
+    response.latency_count = 0;
+    for( size_t op = 0; op < FlashStats::OP_NUM_OPTIONS; op++ )
+    {
+      ichnaea_FlashLatencyHistogram &hist = response.latency[ response.latency_count++ ];
+
+      hist.op            = static_cast<ichnaea_FlashOp>( op );
+      hist.buckets_count = FlashStats::LATENCY_BUCKETS;
+      FlashStats::histogram( static_cast<FlashStats::Op>( op ), hist.buckets );
+    }
+
+    return mbed_rpc_ErrorCode_ERR_NO_ERROR;
+  }
+}  // namespace COM::RPC
@@ -0,0 +1,91 @@
+/******************************************************************************
+ *  File Name:
+ *    flight_recorder_service.cpp
+ *
+ *  Description:
+ *    Implement the flight recorder readout service
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <etl/array.h>
+#include <src/app/proto/ichnaea_rpc.pb.h>
+#include <src/com/rpc/rpc_services.hpp>
+#include <src/system/system_flight_recorder.hpp>
+
+namespace COM::RPC
+{
+  /*---------------------------------------------------------------------------
+  Private Functions
+  ---------------------------------------------------------------------------*/
+
+  static ichnaea_FlightRecorderState to_proto_state( const System::FlightRecorder::State state )
+  {
+    switch( state )
+    {
+      case System::FlightRecorder::State::TRIGGERED:
+        return ichnaea_FlightRecorderState_FR_TRIGGERED;
+
+      case System::FlightRecorder::State::FROZEN:
+        return ichnaea_FlightRecorderState_FR_FROZEN;
+
+      case System::FlightRecorder::State::ARMED:
+      default:
+        return ichnaea_FlightRecorderState_FR_ARMED;
+    }
+  }
+
+  /*---------------------------------------------------------------------------
+  Service Implementations
+  ---------------------------------------------------------------------------*/
+  mb::rpc::ErrId FlightRecorderService::handleRequest()
+  {
+    using namespace System::FlightRecorder;
+
+    /*-------------------------------------------------------------------------
+    Ignore requests that are not intended for this node
+    -------------------------------------------------------------------------*/
+    if( request.node_id != System::identity() )
+    {
+      return mbed_rpc_ErrorCode_ERR_SVC_NO_RSP;
+    }
+
+    /*-------------------------------------------------------------------------
+    Describe the capture and fill the requested page
+    -------------------------------------------------------------------------*/
+    etl::array<Sample, sizeof( response.samples ) / sizeof( response.samples[ 0 ] )> page;
+
+    const Capture cap   = capture();
+    const size_t  count = read( request.offset, page.data(), page.size() );
+
+    response.state         = to_proto_state( cap.state );
+    response.trigger_code  = static_cast<uint8_t>( cap.trigger_code );
+    response.trigger_time  = cap.trigger_time;
+    response.total         = static_cast<uint16_t>( cap.count );
+    response.trigger_index = static_cast<uint16_t>( cap.trigger_index );
+    response.offset        = request.offset;
+    response.samples_count = static_cast<pb_size_t>( count );
+
+    for( size_t idx = 0; idx < count; idx++ )
+    {
+      response.samples[ idx ].time    = page[ idx ].time;
+      response.samples[ idx ].channel = page[ idx ].channel;
+      response.samples[ idx ].raw     = page[ idx ].raw;
+      response.samples[ idx ].value   = page[ idx ].value;
+    }
+
+    /*-------------------------------------------------------------------------
+    Start recording again once the host has what it asked for
+    -------------------------------------------------------------------------*/
+    if( request.rearm )
+    {
+      setPersist( request.persist );
+      rearm( request.pre_trigger, request.post_trigger );
+    }
+
+    return mbed_rpc_ErrorCode_ERR_NO_ERROR;
+  }
+}  // namespace COM::RPC
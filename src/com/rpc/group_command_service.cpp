@@ -0,0 +1,51 @@
+/******************************************************************************
+ *  File Name:
+ *    group_command_service.cpp
+ *
+ *  Description:
+ *    Implements the group command RPC service
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <src/app/app_group.hpp>
+#include <src/app/proto/ichnaea_rpc.pb.h>
+#include <src/com/rpc/rpc_services.hpp>
+#include <src/system/system_util.hpp>
+
+namespace COM::RPC
+{
+  /*---------------------------------------------------------------------------
+  Service Implementations
+  ---------------------------------------------------------------------------*/
+
+  mb::rpc::ErrId GroupCommandService::handleRequest()
+  {
+    /*-------------------------------------------------------------------------
+    Only members of the addressed group act on or acknowledge the command
+    -------------------------------------------------------------------------*/
+    if( !App::Group::isMember( request.group_id ) )
+    {
+      return mbed_rpc_ErrorCode_ERR_SVC_NO_RSP;
+    }
+
+    /*-------------------------------------------------------------------------
+    Hand the command off to run at its scheduled time
+    -------------------------------------------------------------------------*/
+    App::Group::Command cmd;
+    cmd.command_id = static_cast<uint16_t>( request.command_id );
+    cmd.action     = request.action;
+    cmd.field      = request.field;
+    cmd.value      = request.value;
+
+    response.node_id    = System::identity();
+    response.command_id = request.command_id;
+    response.status     = App::Group::schedule( cmd, requestArrivalUs(), request.delay_us, response.latency_us );
+
+    return mbed_rpc_ErrorCode_ERR_NO_ERROR;
+  }
+
+}    // namespace COM::RPC
@@ -0,0 +1,64 @@
+/******************************************************************************
+ *  File Name:
+ *    link_baud_service.cpp
+ *
+ *  Description:
+ *    Implement the RPC link baud rate negotiation service
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <src/app/proto/ichnaea_rpc.pb.h>
+#include <src/com/link_speed.hpp>
+#include <src/com/rpc/rpc_services.hpp>
+
+namespace COM::RPC
+{
+  static_assert( LinkSpeed::SUPPORTED_BAUD.size() <= ( sizeof( ichnaea_LinkBaudResponse::supported ) / sizeof( uint32_t ) ),
+                 "Supported rate list does not fit in the response" );
+
+  /*---------------------------------------------------------------------------
+  Service Implementations
+  ---------------------------------------------------------------------------*/
+  mb::rpc::ErrId LinkBaudService::handleRequest()
+  {
+    /*-------------------------------------------------------------------------
+    Ignore requests that are not intended for this node
+    -------------------------------------------------------------------------*/
+    if( request.node_id != System::identity() )
+    {
+      return mbed_rpc_ErrorCode_ERR_SVC_NO_RSP;
+    }
+
+    /*-------------------------------------------------------------------------
+    A zero rate only reads the link status
+    -------------------------------------------------------------------------*/
+    response.status = ichnaea_LinkBaudStatus_LINK_BAUD_OK;
+
+    if( request.baud != 0 )
+    {
+      response.status = request.confirm ? LinkSpeed::confirm( request.baud ) : LinkSpeed::request( request.baud );
+    }
+
+    /*-------------------------------------------------------------------------
+    Report the rate in use. A requested switch has not happened yet, so this
+    is still the rate the response goes out at.
+    -------------------------------------------------------------------------*/
+    const LinkSpeed::Stats stats = LinkSpeed::stats();
+
+    response.baud            = stats.baud;
+    response.fallbacks       = stats.fallbacks;
+    response.line_errors     = stats.line_errors;
+    response.supported_count = 0;
+
+    for( const uint32_t baud : LinkSpeed::SUPPORTED_BAUD )
+    {
+      response.supported[ response.supported_count++ ] = baud;
+    }
+
+    return mbed_rpc_ErrorCode_ERR_NO_ERROR;
+  }
+}  // namespace COM::RPC
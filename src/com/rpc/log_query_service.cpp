@@ -0,0 +1,163 @@
+/******************************************************************************
+ *  File Name:
+ *    log_query_service.cpp
+ *
+ *  Description:
+ *    Implement the filtered log query service
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <cstring>
+#include <etl/algorithm.h>
+#include <src/app/proto/ichnaea_rpc.pb.h>
+#include <src/com/rpc/rpc_services.hpp>
+#include <src/system/system_logging.hpp>
+
+namespace COM::RPC
+{
+  /*---------------------------------------------------------------------------
+  Constants
+  ---------------------------------------------------------------------------*/
+
+  static constexpr size_t RECORD_HEADER_SIZE = 6; /**< Time offset, level and length */
+
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief State of a single page being filled by the query
+   */
+  struct QueryPage
+  {
+    ichnaea_LogQueryResponse *response;
+    uint64_t                  start;     /**< Start time of the request */
+    uint32_t                  limit;     /**< Records allowed in this page */
+    uint32_t                  skip;      /**< Matches at the start time left to skip */
+    uint64_t                  last_time; /**< Time of the last packed record */
+    uint32_t                  run;       /**< Packed records sharing last_time */
+  };
+
+  /*---------------------------------------------------------------------------
+  Private Functions
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Packs a matching log entry into the response, stopping once the
+   * page is full.
+   */
+  static bool pack_entry( const Logging::LogEntry &entry, void *arg )
+  {
+    QueryPage                *page = static_cast<QueryPage *>( arg );
+    ichnaea_LogQueryResponse &rsp  = *page->response;
+
+    /*-------------------------------------------------------------------------
+    Drop what the host already has from the previous page
+    -------------------------------------------------------------------------*/
+    if( page->skip && ( entry.time == page->start ) )
+    {
+      page->skip--;
+      return true;
+    }
+
+    /*-------------------------------------------------------------------------
+    Stop if this record won't fit. It becomes the start of the next page.
+    -------------------------------------------------------------------------*/
+    const size_t msg_size = etl::min<size_t>( entry.size, UINT8_MAX );
+    const bool   no_room  = ( rsp.data.size + RECORD_HEADER_SIZE + msg_size ) > sizeof( rsp.data.bytes );
+    const bool   too_far  = ( rsp.count != 0 ) && ( ( entry.time - rsp.base_time ) > UINT32_MAX );
+
+    if( ( rsp.count >= page->limit ) || no_room || too_far )
+    {
+      rsp.more      = true;
+      rsp.next_time = entry.time;
+      return false;
+    }
+
+    if( rsp.count == 0 )
+    {
+      rsp.base_time = entry.time;
+    }
+
+    const uint32_t offset   = static_cast<uint32_t>( entry.time - rsp.base_time );
+    uint8_t       *p_record = rsp.data.bytes + rsp.data.size;
+
+    memcpy( p_record, &offset, sizeof( offset ) );
+    p_record[ 4 ] = static_cast<uint8_t>( entry.level );
+    p_record[ 5 ] = static_cast<uint8_t>( msg_size );
+    memcpy( p_record + RECORD_HEADER_SIZE, entry.data, msg_size );
+
+    rsp.data.size += static_cast<pb_size_t>( RECORD_HEADER_SIZE + msg_size );
+    rsp.count++;
+
+    page->run       = ( entry.time == page->last_time ) ? ( page->run + 1 ) : 1;
+    page->last_time = entry.time;
+    return true;
+  }
+
+  /*---------------------------------------------------------------------------
+  Service Implementations
+  ---------------------------------------------------------------------------*/
+  mb::rpc::ErrId LogQueryService::handleRequest()
+  {
+    /*-------------------------------------------------------------------------
+    Ignore requests that are not intended for this node
+    -------------------------------------------------------------------------*/
+    if( request.node_id != System::identity() )
+    {
+      return mbed_rpc_ErrorCode_ERR_SVC_NO_RSP;
+    }
+
+    /*-------------------------------------------------------------------------
+    Resolve the time range to search
+    -------------------------------------------------------------------------*/
+    const uint64_t now   = Logging::logTime();
+    uint64_t       start = request.start_time;
+    uint64_t       end   = request.end_time ? request.end_time : now;
+
+    if( request.last_ms )
+    {
+      start = ( now > request.last_ms ) ? ( now - request.last_ms ) : 0;
+      end   = now;
+    }
+
+    response.now       = now;
+    response.base_time = start;
+    response.count     = 0;
+    response.more      = false;
+    response.next_time = 0;
+    response.skip      = 0;
+    response.data.size = 0;
+
+    /*-------------------------------------------------------------------------
+    Fill the page straight from the store, oldest match first
+    -------------------------------------------------------------------------*/
+    QueryPage page;
+    page.response  = &response;
+    page.start     = start;
+    page.limit     = request.max_count ? request.max_count : UINT16_MAX;
+    page.skip      = request.skip;
+    page.last_time = 0;
+    page.run       = 0;
+
+    Logging::queryLog( start, end, static_cast<mb::logging::Level>( request.min_level ), pack_entry, &page );
+
+    /*-------------------------------------------------------------------------
+    Tell the host how many records at the resume time it already has
+    -------------------------------------------------------------------------*/
+    if( response.more && ( response.count != 0 ) && ( response.next_time == page.last_time ) )
+    {
+      response.skip = page.run + ( ( page.last_time == start ) ? request.skip : 0 );
+    }
+    else if( response.more && ( response.count == 0 ) && ( response.next_time == start ) )
+    {
+      response.skip = request.skip;
+    }
+
+    return mbed_rpc_ErrorCode_ERR_NO_ERROR;
+  }
+}  // namespace COM::RPC
@@ -0,0 +1,105 @@
+/******************************************************************************
+ *  File Name:
+ *    ltc_reg_service.cpp
+ *
+ *  Description:
+ *    Implement the LTC7871 register get/set services
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <src/app/proto/ichnaea_rpc.pb.h>
+#include <src/com/rpc/rpc_services.hpp>
+#include <src/hw/ltc7871.hpp>
+#include <src/hw/ltc7871_reg.hpp>
+
+namespace COM::RPC
+{
+  static constexpr size_t LTC_NUM_REGS = HW::LTC7871::REG_MAX_ADDR - HW::LTC7871::REG_MIN_ADDR + 1u;
+
+  static_assert( LTC_NUM_REGS <= sizeof( ichnaea_LTCRegGetResponse_values_t::bytes ),
+                 "LTC register map does not fit in the response" );
+
+  /*---------------------------------------------------------------------------
+  Private Functions
+  ---------------------------------------------------------------------------*/
+
+  static ichnaea_LTCRegStatus to_proto( const HW::LTC7871::RegStatus status )
+  {
+    switch( status )
+    {
+      case HW::LTC7871::RegStatus::OK:
+        return ichnaea_LTCRegStatus_LTC_REG_OK;
+
+      case HW::LTC7871::RegStatus::READ_ONLY:
+        return ichnaea_LTCRegStatus_LTC_REG_READ_ONLY;
+
+      case HW::LTC7871::RegStatus::BAD_MODE:
+        return ichnaea_LTCRegStatus_LTC_REG_BAD_MODE;
+
+      case HW::LTC7871::RegStatus::BAD_VALUE:
+        return ichnaea_LTCRegStatus_LTC_REG_BAD_VALUE;
+
+      case HW::LTC7871::RegStatus::INVALID_ADDR:
+      default:
+        return ichnaea_LTCRegStatus_LTC_REG_INVALID_ADDR;
+    }
+  }
+
+  /*---------------------------------------------------------------------------
+  Service Implementations
+  ---------------------------------------------------------------------------*/
+  mb::rpc::ErrId LTCRegGetService::handleRequest()
+  {
+    /*-------------------------------------------------------------------------
+    Ignore requests that are not intended for this node
+    -------------------------------------------------------------------------*/
+    if( request.node_id != System::identity() )
+    {
+      return mbed_rpc_ErrorCode_ERR_SVC_NO_RSP;
+    }
+
+    /*-------------------------------------------------------------------------
+    A dump reads the whole register map in one burst on the bus
+    -------------------------------------------------------------------------*/
+    const uint8_t first = request.dump ? HW::LTC7871::REG_MIN_ADDR : static_cast<uint8_t>( request.reg );
+    const size_t  count = request.dump ? LTC_NUM_REGS : 1u;
+
+    response.first_reg   = first;
+    response.values.size = 0;
+    response.status      = to_proto( HW::LTC7871::readRegisters( first, response.values.bytes, count ) );
+
+    if( response.status == ichnaea_LTCRegStatus_LTC_REG_OK )
+    {
+      response.values.size = static_cast<pb_size_t>( count );
+    }
+
+    return mbed_rpc_ErrorCode_ERR_NO_ERROR;
+  }
+
+
+  mb::rpc::ErrId LTCRegSetService::handleRequest()
+  {
+    /*-------------------------------------------------------------------------
+    Ignore requests that are not intended for this node
+    -------------------------------------------------------------------------*/
+    if( request.node_id != System::identity() )
+    {
+      return mbed_rpc_ErrorCode_ERR_SVC_NO_RSP;
+    }
+
+    /*-------------------------------------------------------------------------
+    The driver enforces the write policy and the IDAC write protection
+    -------------------------------------------------------------------------*/
+    uint8_t readback = 0;
+
+    response.status =
+        to_proto( HW::LTC7871::writeRegister( static_cast<uint8_t>( request.reg ), static_cast<uint8_t>( request.value ), readback ) );
+    response.value = readback;
+
+    return mbed_rpc_ErrorCode_ERR_NO_ERROR;
+  }
+}  // namespace COM::RPC
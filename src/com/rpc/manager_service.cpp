@@ -32,7 +32,7 @@ namespace COM::RPC
   Service Implementations
   ---------------------------------------------------------------------------*/
 
-  mb::rpc::ErrId ManagerService::processRequest()
+  mb::rpc::ErrId ManagerService::handleRequest()
   {
     mb::rpc::ErrId rpc_result = mbed_rpc_ErrorCode_ERR_NO_ERROR;
 
@@ -24,7 +24,7 @@ namespace COM::RPC
   Service Implementations
   ---------------------------------------------------------------------------*/
 
-  mb::rpc::ErrId PDIReadService::processRequest()
+  mb::rpc::ErrId PDIReadService::handleRequest()
   {
     /*-------------------------------------------------------------------------
     Validate the request
@@ -38,7 +38,7 @@ namespace COM::RPC
     Find the PDI data and encode it into the response buffer
     -------------------------------------------------------------------------*/
     auto key  = static_cast<App::PDI::PDIKey>( request.pdi_id );
-    auto size = System::Database::pdiDB().encode( key, response.data.bytes, sizeof( response.data.bytes ) );
+    auto size = App::PDI::encode( key, response.data.bytes, sizeof( response.data.bytes ) );
 
     if( size <= 0 )
     {
@@ -53,7 +53,7 @@ namespace COM::RPC
   }
 
 
-  mb::rpc::ErrId PDIWriteService::processRequest()
+  mb::rpc::ErrId PDIWriteService::handleRequest()
   {
     /*-------------------------------------------------------------------------
     Validate the request
@@ -0,0 +1,55 @@
+/******************************************************************************
+ *  File Name:
+ *    rpc_arena.cpp
+ *
+ *  Description:
+ *    Shared request/response storage for Ichnaea RPC services
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <src/com/rpc/rpc_arena.hpp>
+#include <src/hw/uart.hpp>
+
+namespace COM::RPC
+{
+  /*---------------------------------------------------------------------------
+  Static Data
+  ---------------------------------------------------------------------------*/
+
+  alignas( ArenaRequests::alignment ) static uint8_t s_request_arena[ ARENA_REQUEST_SIZE ];
+  alignas( ArenaResponses::alignment ) static uint8_t s_response_arena[ ARENA_RESPONSE_SIZE ];
+
+  static uint32_t s_arrival_us; /**< Arrival of the frame carrying the current request */
+
+  /*---------------------------------------------------------------------------
+  Public Functions
+  ---------------------------------------------------------------------------*/
+
+  void *arenaRequest()
+  {
+    return s_request_arena;
+  }
+
+
+  void *arenaResponse()
+  {
+    return s_response_arena;
+  }
+
+
+  uint32_t requestArrivalUs()
+  {
+    return s_arrival_us;
+  }
+
+
+  void beginRequest()
+  {
+    s_arrival_us = HW::UART::takeFrameTimeUs( HW::UART::UART_BMS );
+  }
+
+}    // namespace COM::RPC
@@ -0,0 +1,164 @@
+/******************************************************************************
+ *  File Name:
+ *    rpc_arena.hpp
+ *
+ *  Description:
+ *    Shared request/response storage for Ichnaea RPC services
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+#pragma once
+#ifndef ICHNAEA_RPC_ARENA_HPP
+#define ICHNAEA_RPC_ARENA_HPP
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <cstring>
+#include <etl/largest.h>
+#include <etl/string_view.h>
+#include <mbedutils/rpc.hpp>
+#include <src/app/proto/ichnaea_rpc.pb.h>
+
+namespace COM::RPC
+{
+  /*---------------------------------------------------------------------------
+  Constants
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Every request type that borrows from the arena. Add new services here.
+   */
+  using ArenaRequests =
+      etl::largest<ichnaea_PingNodeRequest, ichnaea_GetIdRequest, ichnaea_ManagerRequest, ichnaea_SetpointRequest,
+                   ichnaea_SensorRequest, ichnaea_SensorBatchRequest, ichnaea_PDIReadRequest, ichnaea_PDIWriteRequest,
+                   ichnaea_SystemStatusRequest, ichnaea_BootTimelineRequest, ichnaea_CalWriteRequest,
+                   ichnaea_FlashStatsRequest, ichnaea_LogQueryRequest, ichnaea_FlightRecorderRequest,
+                   ichnaea_TelemetrySubscribeRequest, ichnaea_LinkBaudRequest, ichnaea_LTCRegGetRequest,
+                   ichnaea_LTCRegSetRequest, ichnaea_GroupCommandRequest>;
+
+  /**
+   * @brief Every response type that borrows from the arena. Add new services here.
+   */
+  using ArenaResponses =
+      etl::largest<ichnaea_PingNodeResponse, ichnaea_GetIdResponse, ichnaea_ManagerResponse, ichnaea_SetpointResponse,
+                   ichnaea_SensorResponse, ichnaea_SensorBatchResponse, ichnaea_PDIReadResponse, ichnaea_PDIWriteResponse,
+                   ichnaea_SystemStatusResponse, ichnaea_BootTimelineResponse, ichnaea_CalWriteResponse,
+                   ichnaea_FlashStatsResponse, ichnaea_LogQueryResponse, ichnaea_FlightRecorderResponse,
+                   ichnaea_TelemetrySubscribeResponse, ichnaea_LinkBaudResponse, ichnaea_LTCRegGetResponse,
+                   ichnaea_LTCRegSetResponse, ichnaea_GroupCommandResponse>;
+
+  static constexpr size_t ARENA_REQUEST_SIZE  = ArenaRequests::size;
+  static constexpr size_t ARENA_RESPONSE_SIZE = ArenaResponses::size;
+
+  /*---------------------------------------------------------------------------
+  Public Functions
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Storage every arena service decodes its request into
+   *
+   * @return void*  ARENA_REQUEST_SIZE bytes, aligned for any request type
+   */
+  void *arenaRequest();
+
+  /**
+   * @brief Storage every arena service builds its response in
+   *
+   * @return void*  ARENA_RESPONSE_SIZE bytes, aligned for any response type
+   */
+  void *arenaResponse();
+
+  /**
+   * @brief Arrival time of the frame carrying the request being serviced.
+   * Only valid from inside ArenaService::handleRequest().
+   *
+   * @return uint32_t Hardware timer value in microseconds, 0 if not tracked
+   */
+  uint32_t requestArrivalUs();
+
+  /**
+   * @brief Pairs the request about to be serviced with the frame it arrived
+   * in. Called by ArenaService once per dispatched request.
+   */
+  void beginRequest();
+
+  /*---------------------------------------------------------------------------
+  Classes
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Service whose request and response live in the shared arena
+   * instead of the service object.
+   *
+   * The RPC server runs one request at a time from the control thread, so
+   * only one service ever needs message storage at once. Nothing may hold
+   * on to request or response after handleRequest() returns, the next
+   * request will reuse the memory.
+   *
+   * @tparam ReqType  Request message structure
+   * @tparam RspType  Response message structure
+   */
+  template<typename ReqType, typename RspType>
+  class ArenaService : public mb::rpc::service::IService
+  {
+  public:
+    static_assert( sizeof( ReqType ) <= ARENA_REQUEST_SIZE, "Request type missing from ArenaRequests" );
+    static_assert( sizeof( RspType ) <= ARENA_RESPONSE_SIZE, "Response type missing from ArenaResponses" );
+    static_assert( alignof( ReqType ) <= ArenaRequests::alignment, "Request type missing from ArenaRequests" );
+    static_assert( alignof( RspType ) <= ArenaResponses::alignment, "Response type missing from ArenaResponses" );
+
+    ArenaService( const etl::string_view &name, const mb::rpc::SvcId svcId, const mb::rpc::MsgId reqId,
+                  const mb::rpc::MsgId rspId ) :
+        IService( name, svcId, reqId, rspId ),
+        request( *static_cast<ReqType *>( arenaRequest() ) ), response( *static_cast<RspType *>( arenaResponse() ) )
+    {
+    }
+
+    ~ArenaService() = default;
+
+    /**
+     * @copydoc IService::processRequest
+     *
+     * Claims the arrival time of the request's frame and clears whatever the
+     * previous service left in the response, then runs the service.
+     */
+    mb::rpc::ErrId processRequest() final override
+    {
+      beginRequest();
+      memset( &response, 0, sizeof( RspType ) );
+      return handleRequest();
+    }
+
+    /**
+     * @copydoc IService::getRequestData
+     */
+    void *getRequestData() final override
+    {
+      return &request;
+    }
+
+    /**
+     * @copydoc IService::getResponseData
+     */
+    void *getResponseData() final override
+    {
+      return &response;
+    }
+
+  protected:
+    ReqType &request;  /**< Decoded request, valid during handleRequest() */
+    RspType &response; /**< Response to send, zeroed before handleRequest() */
+
+    /**
+     * @brief Services the decoded request and fills in the response
+     *
+     * @return mb::rpc::ErrId  Result code for the response
+     */
+    virtual mb::rpc::ErrId handleRequest() = 0;
+  };
+
+}    // namespace COM::RPC
+
+#endif /* !ICHNAEA_RPC_ARENA_HPP */
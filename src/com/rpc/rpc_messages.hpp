@@ -50,6 +50,12 @@ namespace COM::RPC
   static constexpr Descriptor SensorResponse{ ichnaea_Message_MSG_SENSOR_RSP, ichnaea_MessageVersion_MSG_VER_SENSOR_RSP,
                                               ichnaea_SensorResponse_fields, ichnaea_SensorResponse_size };
 
+  static constexpr Descriptor SensorBatchRequest{ ichnaea_Message_MSG_SENSOR_BATCH_REQ, ichnaea_MessageVersion_MSG_VER_SENSOR_BATCH_REQ,
+                                                  ichnaea_SensorBatchRequest_fields, ichnaea_SensorBatchRequest_size };
+
+  static constexpr Descriptor SensorBatchResponse{ ichnaea_Message_MSG_SENSOR_BATCH_RSP, ichnaea_MessageVersion_MSG_VER_SENSOR_BATCH_RSP,
+                                                   ichnaea_SensorBatchResponse_fields, ichnaea_SensorBatchResponse_size };
+
   static constexpr Descriptor ManagerRequest{ ichnaea_Message_MSG_MANAGER_REQ, ichnaea_MessageVersion_MSG_VER_MANAGER_REQ,
                                               ichnaea_ManagerRequest_fields, ichnaea_ManagerRequest_size };
 
@@ -73,6 +79,72 @@ namespace COM::RPC
 
   static constexpr Descriptor SystemStatusResponse{ ichnaea_Message_MSG_SYSTEM_STATUS_RSP, ichnaea_MessageVersion_MSG_VER_SYSTEM_STATUS_RSP,
                                                     ichnaea_SystemStatusResponse_fields, ichnaea_SystemStatusResponse_size };
+
+  static constexpr Descriptor BootTimelineRequest{ ichnaea_Message_MSG_BOOT_TIMELINE_REQ, ichnaea_MessageVersion_MSG_VER_BOOT_TIMELINE_REQ,
+                                                   ichnaea_BootTimelineRequest_fields, ichnaea_BootTimelineRequest_size };
+
+  static constexpr Descriptor BootTimelineResponse{ ichnaea_Message_MSG_BOOT_TIMELINE_RSP, ichnaea_MessageVersion_MSG_VER_BOOT_TIMELINE_RSP,
+                                                    ichnaea_BootTimelineResponse_fields, ichnaea_BootTimelineResponse_size };
+
+  static constexpr Descriptor CalWriteRequest{ ichnaea_Message_MSG_CAL_WRITE_REQ, ichnaea_MessageVersion_MSG_VER_CAL_WRITE_REQ,
+                                               ichnaea_CalWriteRequest_fields, ichnaea_CalWriteRequest_size };
+
+  static constexpr Descriptor CalWriteResponse{ ichnaea_Message_MSG_CAL_WRITE_RSP, ichnaea_MessageVersion_MSG_VER_CAL_WRITE_RSP,
+                                                ichnaea_CalWriteResponse_fields, ichnaea_CalWriteResponse_size };
+
+  static constexpr Descriptor FlashStatsRequest{ ichnaea_Message_MSG_FLASH_STATS_REQ, ichnaea_MessageVersion_MSG_VER_FLASH_STATS_REQ,
+                                                 ichnaea_FlashStatsRequest_fields, ichnaea_FlashStatsRequest_size };
+
+  static constexpr Descriptor FlashStatsResponse{ ichnaea_Message_MSG_FLASH_STATS_RSP, ichnaea_MessageVersion_MSG_VER_FLASH_STATS_RSP,
+                                                  ichnaea_FlashStatsResponse_fields, ichnaea_FlashStatsResponse_size };
+
+  static constexpr Descriptor LogQueryRequest{ ichnaea_Message_MSG_LOG_QUERY_REQ, ichnaea_MessageVersion_MSG_VER_LOG_QUERY_REQ,
+                                               ichnaea_LogQueryRequest_fields, ichnaea_LogQueryRequest_size };
+
+  static constexpr Descriptor LogQueryResponse{ ichnaea_Message_MSG_LOG_QUERY_RSP, ichnaea_MessageVersion_MSG_VER_LOG_QUERY_RSP,
+                                                ichnaea_LogQueryResponse_fields, ichnaea_LogQueryResponse_size };
+
+  static constexpr Descriptor FlightRecorderRequest{ ichnaea_Message_MSG_FLIGHT_RECORDER_REQ,
+                                                     ichnaea_MessageVersion_MSG_VER_FLIGHT_RECORDER_REQ,
+                                                     ichnaea_FlightRecorderRequest_fields, ichnaea_FlightRecorderRequest_size };
+
+  static constexpr Descriptor FlightRecorderResponse{ ichnaea_Message_MSG_FLIGHT_RECORDER_RSP,
+                                                      ichnaea_MessageVersion_MSG_VER_FLIGHT_RECORDER_RSP,
+                                                      ichnaea_FlightRecorderResponse_fields, ichnaea_FlightRecorderResponse_size };
+
+  static constexpr Descriptor TelemetrySubscribeRequest{ ichnaea_Message_MSG_TELEMETRY_SUB_REQ,
+                                                         ichnaea_MessageVersion_MSG_VER_TELEMETRY_SUB_REQ,
+                                                         ichnaea_TelemetrySubscribeRequest_fields,
+                                                         ichnaea_TelemetrySubscribeRequest_size };
+
+  static constexpr Descriptor TelemetrySubscribeResponse{ ichnaea_Message_MSG_TELEMETRY_SUB_RSP,
+                                                          ichnaea_MessageVersion_MSG_VER_TELEMETRY_SUB_RSP,
+                                                          ichnaea_TelemetrySubscribeResponse_fields,
+                                                          ichnaea_TelemetrySubscribeResponse_size };
+
+  static constexpr Descriptor LinkBaudRequest{ ichnaea_Message_MSG_LINK_BAUD_REQ, ichnaea_MessageVersion_MSG_VER_LINK_BAUD_REQ,
+                                               ichnaea_LinkBaudRequest_fields, ichnaea_LinkBaudRequest_size };
+
+  static constexpr Descriptor LinkBaudResponse{ ichnaea_Message_MSG_LINK_BAUD_RSP, ichnaea_MessageVersion_MSG_VER_LINK_BAUD_RSP,
+                                                ichnaea_LinkBaudResponse_fields, ichnaea_LinkBaudResponse_size };
+
+  static constexpr Descriptor LTCRegGetRequest{ ichnaea_Message_MSG_LTC_REG_GET_REQ, ichnaea_MessageVersion_MSG_VER_LTC_REG_GET_REQ,
+                                                ichnaea_LTCRegGetRequest_fields, ichnaea_LTCRegGetRequest_size };
+
+  static constexpr Descriptor LTCRegGetResponse{ ichnaea_Message_MSG_LTC_REG_GET_RSP, ichnaea_MessageVersion_MSG_VER_LTC_REG_GET_RSP,
+                                                 ichnaea_LTCRegGetResponse_fields, ichnaea_LTCRegGetResponse_size };
+
+  static constexpr Descriptor LTCRegSetRequest{ ichnaea_Message_MSG_LTC_REG_SET_REQ, ichnaea_MessageVersion_MSG_VER_LTC_REG_SET_REQ,
+                                                ichnaea_LTCRegSetRequest_fields, ichnaea_LTCRegSetRequest_size };
+
+  static constexpr Descriptor LTCRegSetResponse{ ichnaea_Message_MSG_LTC_REG_SET_RSP, ichnaea_MessageVersion_MSG_VER_LTC_REG_SET_RSP,
+                                                 ichnaea_LTCRegSetResponse_fields, ichnaea_LTCRegSetResponse_size };
+
+  static constexpr Descriptor GroupCommandRequest{ ichnaea_Message_MSG_GROUP_CMD_REQ, ichnaea_MessageVersion_MSG_VER_GROUP_CMD_REQ,
+                                                   ichnaea_GroupCommandRequest_fields, ichnaea_GroupCommandRequest_size };
+
+  static constexpr Descriptor GroupCommandResponse{ ichnaea_Message_MSG_GROUP_CMD_RSP, ichnaea_MessageVersion_MSG_VER_GROUP_CMD_RSP,
+                                                    ichnaea_GroupCommandResponse_fields, ichnaea_GroupCommandResponse_size };
 }    // namespace COM::RPC
 
 #endif /* !ICHNAEA_RPC_MESSAGES_HPP */
@@ -17,6 +17,7 @@
 Includes
 -----------------------------------------------------------------------------*/
 #include <src/app/proto/ichnaea_rpc.pb.h>
+#include <src/com/rpc/rpc_arena.hpp>
 #include <src/system/system_util.hpp>
 #include <mbedutils/rpc.hpp>
 
@@ -26,48 +27,48 @@ namespace COM::RPC
   Classes
   ---------------------------------------------------------------------------*/
 
-  class PingNodeService : public mb::rpc::service::BaseService<ichnaea_PingNodeRequest, ichnaea_PingNodeResponse>
+  class PingNodeService : public ArenaService<ichnaea_PingNodeRequest, ichnaea_PingNodeResponse>
   {
   public:
     PingNodeService() :
-        BaseService<ichnaea_PingNodeRequest, ichnaea_PingNodeResponse>( "PingNodeService", ichnaea_Service_SVC_PING_NODE,
-                                                                        ichnaea_Message_MSG_PING_NODE_REQ,
-                                                                        ichnaea_Message_MSG_PING_NODE_RSP ){};
+        ArenaService<ichnaea_PingNodeRequest, ichnaea_PingNodeResponse>( "PingNodeService", ichnaea_Service_SVC_PING_NODE,
+                                                                         ichnaea_Message_MSG_PING_NODE_REQ,
+                                                                         ichnaea_Message_MSG_PING_NODE_RSP ){};
     ~PingNodeService() = default;
 
     /**
-     * @copydoc IService::processRequest
+     * @copydoc ArenaService::handleRequest
      */
-    mb::rpc::ErrId processRequest() final override;
+    mb::rpc::ErrId handleRequest() final override;
   };
 
-  class IdentityService : public mb::rpc::service::BaseService<ichnaea_GetIdRequest, ichnaea_GetIdResponse>
+  class IdentityService : public ArenaService<ichnaea_GetIdRequest, ichnaea_GetIdResponse>
   {
   public:
     IdentityService() :
-        BaseService<ichnaea_GetIdRequest, ichnaea_GetIdResponse>(
+        ArenaService<ichnaea_GetIdRequest, ichnaea_GetIdResponse>(
             "IdentityService", ichnaea_Service_SVC_IDENTITY, ichnaea_Message_MSG_GET_ID_REQ, ichnaea_Message_MSG_GET_ID_RSP ){};
     ~IdentityService() = default;
 
     /**
-     * @copydoc IService::processRequest
+     * @copydoc ArenaService::handleRequest
      */
-    mb::rpc::ErrId processRequest() final override;
+    mb::rpc::ErrId handleRequest() final override;
   };
 
 
-  class ManagerService : public mb::rpc::service::BaseService<ichnaea_ManagerRequest, ichnaea_ManagerResponse>
+  class ManagerService : public ArenaService<ichnaea_ManagerRequest, ichnaea_ManagerResponse>
   {
   public:
     ManagerService() :
-        BaseService<ichnaea_ManagerRequest, ichnaea_ManagerResponse>(
+        ArenaService<ichnaea_ManagerRequest, ichnaea_ManagerResponse>(
             "ManagerService", ichnaea_Service_SVC_MANAGER, ichnaea_Message_MSG_MANAGER_REQ, ichnaea_Message_MSG_MANAGER_RSP ){};
     ~ManagerService() = default;
 
     /**
-     * @copydoc IService::processRequest
+     * @copydoc ArenaService::handleRequest
      */
-    mb::rpc::ErrId processRequest() final override;
+    mb::rpc::ErrId handleRequest() final override;
 
   private:
     mb::rpc::ErrId reboot();
@@ -75,82 +76,262 @@ namespace COM::RPC
     mb::rpc::ErrId disengage_output();
   };
 
-  class SetpointService : public mb::rpc::service::BaseService<ichnaea_SetpointRequest, ichnaea_SetpointResponse>
+  class SetpointService : public ArenaService<ichnaea_SetpointRequest, ichnaea_SetpointResponse>
   {
   public:
     SetpointService() :
-        BaseService<ichnaea_SetpointRequest, ichnaea_SetpointResponse>( "SetpointService", ichnaea_Service_SVC_SETPOINT,
-                                                                        ichnaea_Message_MSG_SETPOINT_REQ,
-                                                                        ichnaea_Message_MSG_SETPOINT_RSP ){};
+        ArenaService<ichnaea_SetpointRequest, ichnaea_SetpointResponse>( "SetpointService", ichnaea_Service_SVC_SETPOINT,
+                                                                         ichnaea_Message_MSG_SETPOINT_REQ,
+                                                                         ichnaea_Message_MSG_SETPOINT_RSP ){};
     ~SetpointService() = default;
 
     /**
-     * @copydoc IService::processRequest
+     * @copydoc ArenaService::handleRequest
      */
-    mb::rpc::ErrId processRequest() final override;
+    mb::rpc::ErrId handleRequest() final override;
   };
 
 
-  class SensorService : public mb::rpc::service::BaseService<ichnaea_SensorRequest, ichnaea_SensorResponse>
+  class SensorService : public ArenaService<ichnaea_SensorRequest, ichnaea_SensorResponse>
   {
   public:
     SensorService() :
-        BaseService<ichnaea_SensorRequest, ichnaea_SensorResponse>(
+        ArenaService<ichnaea_SensorRequest, ichnaea_SensorResponse>(
             "SensorService", ichnaea_Service_SVC_SENSOR, ichnaea_Message_MSG_SENSOR_REQ, ichnaea_Message_MSG_SENSOR_RSP ){};
     ~SensorService() = default;
 
     /**
-     * @copydoc IService::processRequest
+     * @copydoc ArenaService::handleRequest
      */
-    mb::rpc::ErrId processRequest() final override;
+    mb::rpc::ErrId handleRequest() final override;
   };
 
 
-  class PDIReadService : public mb::rpc::service::BaseService<ichnaea_PDIReadRequest, ichnaea_PDIReadResponse>
+  class SensorBatchService : public ArenaService<ichnaea_SensorBatchRequest, ichnaea_SensorBatchResponse>
+  {
+  public:
+    SensorBatchService() :
+        ArenaService<ichnaea_SensorBatchRequest, ichnaea_SensorBatchResponse>(
+            "SensorBatchService", ichnaea_Service_SVC_SENSOR_BATCH, ichnaea_Message_MSG_SENSOR_BATCH_REQ,
+            ichnaea_Message_MSG_SENSOR_BATCH_RSP ){};
+    ~SensorBatchService() = default;
+
+    /**
+     * @copydoc ArenaService::handleRequest
+     */
+    mb::rpc::ErrId handleRequest() final override;
+  };
+
+
+  class PDIReadService : public ArenaService<ichnaea_PDIReadRequest, ichnaea_PDIReadResponse>
   {
   public:
     PDIReadService() :
-        BaseService<ichnaea_PDIReadRequest, ichnaea_PDIReadResponse>( "PDIReadService", ichnaea_Service_SVC_PDI_READ,
-                                                                      ichnaea_Message_MSG_PDI_READ_REQ,
-                                                                      ichnaea_Message_MSG_PDI_READ_RSP ){};
+        ArenaService<ichnaea_PDIReadRequest, ichnaea_PDIReadResponse>( "PDIReadService", ichnaea_Service_SVC_PDI_READ,
+                                                                       ichnaea_Message_MSG_PDI_READ_REQ,
+                                                                       ichnaea_Message_MSG_PDI_READ_RSP ){};
     ~PDIReadService() = default;
 
     /**
-     * @copydoc IService::processRequest
+     * @copydoc ArenaService::handleRequest
      */
-    mb::rpc::ErrId processRequest() final override;
+    mb::rpc::ErrId handleRequest() final override;
   };
 
 
-  class PDIWriteService : public mb::rpc::service::BaseService<ichnaea_PDIWriteRequest, ichnaea_PDIWriteResponse>
+  class PDIWriteService : public ArenaService<ichnaea_PDIWriteRequest, ichnaea_PDIWriteResponse>
   {
   public:
     PDIWriteService() :
-        BaseService<ichnaea_PDIWriteRequest, ichnaea_PDIWriteResponse>( "PDIWriteService", ichnaea_Service_SVC_PDI_WRITE,
-                                                                        ichnaea_Message_MSG_PDI_WRITE_REQ,
-                                                                        ichnaea_Message_MSG_PDI_WRITE_RSP ){};
+        ArenaService<ichnaea_PDIWriteRequest, ichnaea_PDIWriteResponse>( "PDIWriteService", ichnaea_Service_SVC_PDI_WRITE,
+                                                                         ichnaea_Message_MSG_PDI_WRITE_REQ,
+                                                                         ichnaea_Message_MSG_PDI_WRITE_RSP ){};
     ~PDIWriteService() = default;
 
     /**
-     * @copydoc IService::processRequest
+     * @copydoc ArenaService::handleRequest
      */
-    mb::rpc::ErrId processRequest() final override;
+    mb::rpc::ErrId handleRequest() final override;
   };
 
 
-  class SystemStatusService : public mb::rpc::service::BaseService<ichnaea_SystemStatusRequest, ichnaea_SystemStatusResponse>
+  class SystemStatusService : public ArenaService<ichnaea_SystemStatusRequest, ichnaea_SystemStatusResponse>
   {
   public:
     SystemStatusService() :
-        BaseService<ichnaea_SystemStatusRequest, ichnaea_SystemStatusResponse>(
+        ArenaService<ichnaea_SystemStatusRequest, ichnaea_SystemStatusResponse>(
             "SystemStatusService", ichnaea_Service_SVC_SYSTEM_STATUS, ichnaea_Message_MSG_SYSTEM_STATUS_REQ,
             ichnaea_Message_MSG_SYSTEM_STATUS_RSP ){};
     ~SystemStatusService() = default;
 
     /**
-     * @copydoc IService::processRequest
+     * @copydoc ArenaService::handleRequest
+     */
+    mb::rpc::ErrId handleRequest() final override;
+  };
+
+
+  class BootTimelineService : public ArenaService<ichnaea_BootTimelineRequest, ichnaea_BootTimelineResponse>
+  {
+  public:
+    BootTimelineService() :
+        ArenaService<ichnaea_BootTimelineRequest, ichnaea_BootTimelineResponse>(
+            "BootTimelineService", ichnaea_Service_SVC_BOOT_TIMELINE, ichnaea_Message_MSG_BOOT_TIMELINE_REQ,
+            ichnaea_Message_MSG_BOOT_TIMELINE_RSP ){};
+    ~BootTimelineService() = default;
+
+    /**
+     * @copydoc ArenaService::handleRequest
+     */
+    mb::rpc::ErrId handleRequest() final override;
+  };
+
+
+  class CalWriteService : public ArenaService<ichnaea_CalWriteRequest, ichnaea_CalWriteResponse>
+  {
+  public:
+    CalWriteService() :
+        ArenaService<ichnaea_CalWriteRequest, ichnaea_CalWriteResponse>( "CalWriteService", ichnaea_Service_SVC_CAL_WRITE,
+                                                                         ichnaea_Message_MSG_CAL_WRITE_REQ,
+                                                                         ichnaea_Message_MSG_CAL_WRITE_RSP ){};
+    ~CalWriteService() = default;
+
+    /**
+     * @copydoc ArenaService::handleRequest
+     */
+    mb::rpc::ErrId handleRequest() final override;
+  };
+
+
+  class FlashStatsService : public ArenaService<ichnaea_FlashStatsRequest, ichnaea_FlashStatsResponse>
+  {
+  public:
+    FlashStatsService() :
+        ArenaService<ichnaea_FlashStatsRequest, ichnaea_FlashStatsResponse>(
+            "FlashStatsService", ichnaea_Service_SVC_FLASH_STATS, ichnaea_Message_MSG_FLASH_STATS_REQ,
+            ichnaea_Message_MSG_FLASH_STATS_RSP ){};
+    ~FlashStatsService() = default;
+
+    /**
+     * @copydoc ArenaService::handleRequest
+     */
+    mb::rpc::ErrId handleRequest() final override;
+  };
+
+
+
+  class LogQueryService : public ArenaService<ichnaea_LogQueryRequest, ichnaea_LogQueryResponse>
+  {
+  public:
+    LogQueryService() :
+        ArenaService<ichnaea_LogQueryRequest, ichnaea_LogQueryResponse>(
+            "LogQueryService", ichnaea_Service_SVC_LOG_QUERY, ichnaea_Message_MSG_LOG_QUERY_REQ,
+            ichnaea_Message_MSG_LOG_QUERY_RSP ){};
+    ~LogQueryService() = default;
+
+    /**
+     * @copydoc ArenaService::handleRequest
+     */
+    mb::rpc::ErrId handleRequest() final override;
+  };
+
+
+  class FlightRecorderService
+      : public ArenaService<ichnaea_FlightRecorderRequest, ichnaea_FlightRecorderResponse>
+  {
+  public:
+    FlightRecorderService() :
+        ArenaService<ichnaea_FlightRecorderRequest, ichnaea_FlightRecorderResponse>(
+            "FlightRecorderService", ichnaea_Service_SVC_FLIGHT_RECORDER, ichnaea_Message_MSG_FLIGHT_RECORDER_REQ,
+            ichnaea_Message_MSG_FLIGHT_RECORDER_RSP ){};
+    ~FlightRecorderService() = default;
+
+    /**
+     * @copydoc ArenaService::handleRequest
+     */
+    mb::rpc::ErrId handleRequest() final override;
+  };
+
+
+  class TelemetryService
+      : public ArenaService<ichnaea_TelemetrySubscribeRequest, ichnaea_TelemetrySubscribeResponse>
+  {
+  public:
+    TelemetryService() :
+        ArenaService<ichnaea_TelemetrySubscribeRequest, ichnaea_TelemetrySubscribeResponse>(
+            "TelemetryService", ichnaea_Service_SVC_TELEMETRY, ichnaea_Message_MSG_TELEMETRY_SUB_REQ,
+            ichnaea_Message_MSG_TELEMETRY_SUB_RSP ){};
+    ~TelemetryService() = default;
+
+    /**
+     * @copydoc ArenaService::handleRequest
+     */
+    mb::rpc::ErrId handleRequest() final override;
+  };
+
+
+  class LinkBaudService : public ArenaService<ichnaea_LinkBaudRequest, ichnaea_LinkBaudResponse>
+  {
+  public:
+    LinkBaudService() :
+        ArenaService<ichnaea_LinkBaudRequest, ichnaea_LinkBaudResponse>( "LinkBaudService", ichnaea_Service_SVC_LINK_BAUD,
+                                                                         ichnaea_Message_MSG_LINK_BAUD_REQ,
+                                                                         ichnaea_Message_MSG_LINK_BAUD_RSP ){};
+    ~LinkBaudService() = default;
+
+    /**
+     * @copydoc ArenaService::handleRequest
+     */
+    mb::rpc::ErrId handleRequest() final override;
+  };
+
+
+  class LTCRegGetService : public ArenaService<ichnaea_LTCRegGetRequest, ichnaea_LTCRegGetResponse>
+  {
+  public:
+    LTCRegGetService() :
+        ArenaService<ichnaea_LTCRegGetRequest, ichnaea_LTCRegGetResponse>( "LTCRegGetService", ichnaea_Service_SVC_LTC_REG_GET,
+                                                                           ichnaea_Message_MSG_LTC_REG_GET_REQ,
+                                                                           ichnaea_Message_MSG_LTC_REG_GET_RSP ){};
+    ~LTCRegGetService() = default;
+
+    /**
+     * @copydoc ArenaService::handleRequest
+     */
+    mb::rpc::ErrId handleRequest() final override;
+  };
+
+
+  class LTCRegSetService : public ArenaService<ichnaea_LTCRegSetRequest, ichnaea_LTCRegSetResponse>
+  {
+  public:
+    LTCRegSetService() :
+        ArenaService<ichnaea_LTCRegSetRequest, ichnaea_LTCRegSetResponse>( "LTCRegSetService", ichnaea_Service_SVC_LTC_REG_SET,
+                                                                           ichnaea_Message_MSG_LTC_REG_SET_REQ,
+                                                                           ichnaea_Message_MSG_LTC_REG_SET_RSP ){};
+    ~LTCRegSetService() = default;
+
+    /**
+     * @copydoc ArenaService::handleRequest
+     */
+    mb::rpc::ErrId handleRequest() final override;
+  };
+
+
+  class GroupCommandService : public ArenaService<ichnaea_GroupCommandRequest, ichnaea_GroupCommandResponse>
+  {
+  public:
+    GroupCommandService() :
+        ArenaService<ichnaea_GroupCommandRequest, ichnaea_GroupCommandResponse>( "GroupCommandService",
+                                                                                 ichnaea_Service_SVC_GROUP_COMMAND,
+                                                                                 ichnaea_Message_MSG_GROUP_CMD_REQ,
+                                                                                 ichnaea_Message_MSG_GROUP_CMD_RSP ){};
+    ~GroupCommandService() = default;
+
+    /**
+     * @copydoc ArenaService::handleRequest
      */
-    mb::rpc::ErrId processRequest() final override;
+    mb::rpc::ErrId handleRequest() final override;
   };
 
 }    // namespace COM::RPC
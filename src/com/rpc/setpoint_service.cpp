@@ -23,7 +23,7 @@ namespace COM::RPC
   Service Implementations
   ---------------------------------------------------------------------------*/
 
-  mb::rpc::ErrId SetpointService::processRequest()
+  mb::rpc::ErrId SetpointService::handleRequest()
   {
     /*-------------------------------------------------------------------------
     Ignore the message if it's not for us
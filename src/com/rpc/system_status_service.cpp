@@ -14,6 +14,7 @@ Includes
 #include "mbedutils/interfaces/time_intf.hpp"
 #include <src/hw/ltc7871.hpp>
 #include <src/app/proto/ichnaea_rpc.pb.h>
+#include <src/com/ctrl_server.hpp>
 #include <src/com/rpc/rpc_services.hpp>
 
 namespace COM::RPC
@@ -21,7 +22,7 @@ namespace COM::RPC
   /*---------------------------------------------------------------------------
   Service Implementations
   ---------------------------------------------------------------------------*/
-  mb::rpc::ErrId SystemStatusService::processRequest()
+  mb::rpc::ErrId SystemStatusService::handleRequest()
   {
     /*-------------------------------------------------------------------------
     Ignore requests that are not intended for this node
@@ -51,6 +52,22 @@ namespace COM::RPC
         break;
     }
 
+    /*-------------------------------------------------------------------------
+    Report how the transmit queues are keeping up
+    -------------------------------------------------------------------------*/
+    response.tx_queues_count = 0;
+
+    for( size_t idx = 0; idx < static_cast<size_t>( Control::TxClass::NUM_OPTIONS ); idx++ )
+    {
+      const Control::TxStats stats = Control::txStats( static_cast<Control::TxClass>( idx ) );
+
+      ichnaea_TxQueueStats &entry = response.tx_queues[ response.tx_queues_count++ ];
+      entry.depth                 = stats.depth;
+      entry.high_water            = stats.high_water;
+      entry.sent                  = stats.sent;
+      entry.dropped               = stats.dropped;
+    }
+
     return mbed_rpc_ErrorCode_ERR_NO_ERROR;
   }
 }  // namespace COM::RPC
@@ -0,0 +1,51 @@
+/******************************************************************************
+ *  File Name:
+ *    telemetry_service.cpp
+ *
+ *  Description:
+ *    Implement the telemetry subscription service
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <src/app/app_telemetry.hpp>
+#include <src/app/proto/ichnaea_rpc.pb.h>
+#include <src/com/rpc/rpc_services.hpp>
+
+namespace COM::RPC
+{
+  /*---------------------------------------------------------------------------
+  Service Implementations
+  ---------------------------------------------------------------------------*/
+  mb::rpc::ErrId TelemetryService::handleRequest()
+  {
+    /*-------------------------------------------------------------------------
+    Ignore requests that are not intended for this node
+    -------------------------------------------------------------------------*/
+    if( request.node_id != System::identity() )
+    {
+      return mbed_rpc_ErrorCode_ERR_SVC_NO_RSP;
+    }
+
+    /*-------------------------------------------------------------------------
+    Swap in the new subscription and report what was actually applied
+    -------------------------------------------------------------------------*/
+    App::Telemetry::Subscription sub;
+    sub.sensor_mask = request.sensor_mask;
+    sub.period_ms   = request.period_ms;
+    sub.deadband    = request.deadband;
+    sub.keyframe_ms = request.keyframe_ms;
+
+    const App::Telemetry::Subscription applied = App::Telemetry::subscribe( sub );
+
+    response.sensor_mask = static_cast<uint16_t>( applied.sensor_mask );
+    response.period_ms   = static_cast<uint16_t>( applied.period_ms );
+    response.deadband    = applied.deadband;
+    response.keyframe_ms = static_cast<uint16_t>( applied.keyframe_ms );
+
+    return mbed_rpc_ErrorCode_ERR_NO_ERROR;
+  }
+}  // namespace COM::RPC
@@ -15,7 +15,9 @@ Includes
 #include <etl/array.h>
 #include <src/bsp/board_map.hpp>
 #include <src/hw/led.hpp>
+#include <mbedutils/assert.hpp>
 #include <mbedutils/interfaces/time_intf.hpp>
+#include <mbedutils/osal.hpp>
 
 namespace HW::LED
 {
@@ -48,6 +50,57 @@ namespace HW::LED
   ---------------------------------------------------------------------------*/
 
   static etl::array<LEDState, Channel::NUM_OPTIONS> s_led_map;
+  static mb::osal::mb_recursive_mutex_t             s_led_lock;    /**< Guards s_led_map and POST ownership */
+  static uint                                       s_post_owner;  /**< Channel currently driven by POST */
+
+  /*---------------------------------------------------------------------------
+  Private Functions
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Converts a brightness request into a PWM level for this board
+   *
+   * @param brightness  Brightness level from 0.0 to 1.0
+   * @return uint16_t
+   */
+  static uint16_t brightness_to_level( const float brightness )
+  {
+    /*-------------------------------------------------------------------------
+    Clamp the brightness level to a valid range and convert it to a PWM level.
+    -------------------------------------------------------------------------*/
+    const float clamped_brightness = etl::max( 0.0f, etl::min( brightness, 0.99f ) );
+    uint16_t    approx_level       = etl::min( PWM_COUNTER_WRAP, static_cast<uint16_t>( PWM_COUNTER_WRAP * clamped_brightness ) );
+
+    /*-------------------------------------------------------------------------
+    Invert the brightness level if the board is version 1. Direct drive LEDs.
+    -------------------------------------------------------------------------*/
+    if( BSP::getIOConfig().majorVersion == 1 )
+    {
+      approx_level = PWM_COUNTER_WRAP - approx_level;
+    }
+
+    return approx_level;
+  }
+
+
+  /**
+   * @brief Pushes the cached state of a channel out to the hardware
+   *
+   * Skipped while POST owns the channel. POST applies the latest cached state
+   * once it hands the channel back.
+   *
+   * @param channel   Which LED to update
+   */
+  static void apply( const uint channel )
+  {
+    if( channel == s_post_owner )
+    {
+      return;
+    }
+
+    auto &state = s_led_map[ channel ];
+    pwm_set_chan_level( state.pwm_slice, state.pwm_channel, state.enabled ? state.on_level : state.off_level );
+  }
 
   /*---------------------------------------------------------------------------
   Public Functions
@@ -59,6 +112,8 @@ namespace HW::LED
     Initialize the LED mapping
     -------------------------------------------------------------------------*/
     memset( &s_led_map, 0, sizeof( s_led_map ) );
+    mbed_assert( mb::osal::buildRecursiveMutexStrategy( s_led_lock ) );
+    s_post_owner = Channel::NUM_OPTIONS;
 
     s_led_map[ STATUS_0 ].pin = BSP::getPin( mb::hw::PERIPH_PWM, BSP::PWM_LED_STATUS_0 );
     s_led_map[ STATUS_1 ].pin = BSP::getPin( mb::hw::PERIPH_PWM, BSP::PWM_LED_STATUS_1 );
@@ -127,31 +182,41 @@ namespace HW::LED
   void postSequence()
   {
     /*-------------------------------------------------------------------------
-    Quickly pulse each led on a ramp up/down sequence
+    Quickly pulse each led on a ramp up/down sequence. POST may run deferred,
+    after other code has already started using the LEDs (ie the heartbeat),
+    so it takes ownership of one channel at a time and drives the PWM level
+    directly. Updates made by others in the meantime only land in the cache.
     -------------------------------------------------------------------------*/
-    for( size_t channel = 0; channel < s_led_map.size(); channel++ )
+    for( uint channel = 0; channel < s_led_map.size(); channel++ )
     {
-      float current_brightness = 0.0f;
+      {
+        mb::thread::RecursiveLockGuard lock( s_led_lock );
+        s_post_owner = channel;
+      }
 
-      enable( channel );
-      setBrightness( channel, current_brightness );
+      const auto &state              = s_led_map[ channel ];
+      float       current_brightness = 0.0f;
 
       for( uint32_t i = 0; i < POST_RAMP_STEPS; i++ )
       {
         current_brightness += POST_RAMP_STEP_SZ;
-        setBrightness( channel, current_brightness );
+        pwm_set_chan_level( state.pwm_slice, state.pwm_channel, brightness_to_level( current_brightness ) );
         mb::time::delayMicroseconds( POST_RAMP_SLEEP_US );
       }
 
       for( uint32_t i = 0; i < POST_RAMP_STEPS; i++ )
       {
         current_brightness -= POST_RAMP_STEP_SZ;
-        setBrightness( channel, current_brightness );
+        pwm_set_chan_level( state.pwm_slice, state.pwm_channel, brightness_to_level( current_brightness ) );
         mb::time::delayMicroseconds( POST_RAMP_SLEEP_US );
       }
 
-      setBrightness( channel, 0.0f );
-      disable( channel );
+      /*-----------------------------------------------------------------------
+      Hand the channel back with whatever state it was last given
+      -----------------------------------------------------------------------*/
+      mb::thread::RecursiveLockGuard lock( s_led_lock );
+      s_post_owner = Channel::NUM_OPTIONS;
+      apply( channel );
     }
   }
 
@@ -163,9 +228,9 @@ namespace HW::LED
       return;
     }
 
-    auto &state = s_led_map[ channel ];
-    pwm_set_chan_level( state.pwm_slice, state.pwm_channel, state.on_level );
-    state.enabled = true;
+    mb::thread::RecursiveLockGuard lock( s_led_lock );
+    s_led_map[ channel ].enabled = true;
+    apply( channel );
   }
 
 
@@ -176,9 +241,9 @@ namespace HW::LED
       return;
     }
 
-    auto &state = s_led_map[ channel ];
-    pwm_set_chan_level( state.pwm_slice, state.pwm_channel, state.off_level );
-    state.enabled = true;
+    mb::thread::RecursiveLockGuard lock( s_led_lock );
+    s_led_map[ channel ].enabled = false;
+    apply( channel );
   }
 
 
@@ -189,17 +254,9 @@ namespace HW::LED
       return;
     }
 
-    auto &state   = s_led_map[ channel ];
-    state.enabled = !state.enabled;
-
-    if( state.enabled )
-    {
-      pwm_set_chan_level( state.pwm_slice, state.pwm_channel, state.on_level );
-    }
-    else
-    {
-      pwm_set_chan_level( state.pwm_slice, state.pwm_channel, state.off_level );
-    }
+    mb::thread::RecursiveLockGuard lock( s_led_lock );
+    s_led_map[ channel ].enabled = !s_led_map[ channel ].enabled;
+    apply( channel );
   }
 
 
@@ -210,31 +267,13 @@ namespace HW::LED
       return;
     }
 
-    /*-------------------------------------------------------------------------
-    Clamp the brightness level to a valid range and convert it to a PWM level.
-    -------------------------------------------------------------------------*/
-    const float    clamped_brightness = etl::max( 0.0f, etl::min( brightness, 0.99f ) );
-    uint16_t       approx_level       = etl::min( PWM_COUNTER_WRAP, static_cast<uint16_t>( PWM_COUNTER_WRAP * clamped_brightness ) );
-
-    /*-------------------------------------------------------------------------
-    Invert the brightness level if the board is version 1. Direct drive LEDs.
-    -------------------------------------------------------------------------*/
-    if( BSP::getIOConfig().majorVersion == 1 )
-    {
-      approx_level = PWM_COUNTER_WRAP - approx_level;
-    }
-
     /*-------------------------------------------------------------------------
     Apply the updates to the cache to track for future state changes and then
     update the hardware.
     -------------------------------------------------------------------------*/
-    auto &state = s_led_map[ channel ];
-    state.on_level = approx_level;
-
-    if( state.enabled )
-    {
-      pwm_set_chan_level( state.pwm_slice, state.pwm_channel, state.on_level );
-    }
+    mb::thread::RecursiveLockGuard lock( s_led_lock );
+    s_led_map[ channel ].on_level = brightness_to_level( brightness );
+    apply( channel );
   }
 
 }    // namespace HW::LED
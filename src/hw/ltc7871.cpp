@@ -32,6 +32,8 @@ Includes
 #include <src/hw/ltc7871_reg.hpp>
 #include <src/system/system_db.hpp>
 #include <src/system/system_error.hpp>
+#include <src/system/system_flight_recorder.hpp>
+#include <src/system/system_retained.hpp>
 #include <src/system/system_sensor.hpp>
 
 namespace HW::LTC7871
@@ -80,6 +82,20 @@ namespace HW::LTC7871
     s_ltc_state.fault_bits        = 0;
     s_ltc_state.fault_code_logged = 0;
 
+    /*-------------------------------------------------------------------------
+    Resume the last measured operating point after a warm restart so setpoint
+    checks are valid before the first state update. The power stage itself is
+    never resumed and always comes back disabled below.
+    -------------------------------------------------------------------------*/
+    if( System::Retained::isValid() )
+    {
+      const RetainedState &retained     = System::Retained::image().ltc;
+      s_ltc_state.msr_input_voltage     = retained.msr_input_voltage;
+      s_ltc_state.msr_output_voltage    = retained.msr_output_voltage;
+      s_ltc_state.msr_average_current   = retained.msr_average_current;
+      s_ltc_state.msr_immediate_current = retained.msr_immediate_current;
+    }
+
     Private::initialize();
 
     /*-------------------------------------------------------------------------
@@ -519,6 +535,14 @@ namespace HW::LTC7871
 
     if( ( s_ltc_state.fault_bits != 0 ) && ( s_ltc_state.driver_mode != DriverMode::FAULTED ) )
     {
+      /*-----------------------------------------------------------------------
+      Mark the fault in the flight recorder first so the power down sequence
+      lands in the post-trigger window.
+      -----------------------------------------------------------------------*/
+      const float fault_bits = static_cast<float>( s_ltc_state.fault_bits );
+      System::FlightRecorder::record( System::FlightRecorder::CH_LTC_FAULT_BITS, fault_bits, fault_bits );
+      System::FlightRecorder::trigger( Panic::ErrorCode::ERR_LTC_FAULT );
+
       /*-----------------------------------------------------------------------
       Run the full power down sequence with a bit more breathing room.
       -----------------------------------------------------------------------*/
@@ -552,6 +576,80 @@ namespace HW::LTC7871
   }
 
 
+  void saveRetainedState( RetainedState &state )
+  {
+    state.msr_input_voltage     = s_ltc_state.msr_input_voltage;
+    state.msr_output_voltage    = s_ltc_state.msr_output_voltage;
+    state.msr_average_current   = s_ltc_state.msr_average_current;
+    state.msr_immediate_current = s_ltc_state.msr_immediate_current;
+  }
+
+
+  RegStatus readRegisters( const uint8_t first, uint8_t *const values, const size_t count )
+  {
+    if( !values || !count || ( first < REG_MIN_ADDR ) || ( ( first + count - 1u ) > REG_MAX_ADDR ) )
+    {
+      return RegStatus::INVALID_ADDR;
+    }
+
+    Private::read_registers( first, values, count );
+    return RegStatus::OK;
+  }
+
+
+  RegStatus writeRegister( const uint8_t reg, const uint8_t value, uint8_t &readback )
+  {
+    /*-------------------------------------------------------------------------
+    Validate the access
+    -------------------------------------------------------------------------*/
+    if( ( reg < REG_MIN_ADDR ) || ( reg > REG_MAX_ADDR ) )
+    {
+      return RegStatus::INVALID_ADDR;
+    }
+
+    const uint8_t mask = direct_write_mask( reg );
+    if( !mask )
+    {
+      return RegStatus::READ_ONLY;
+    }
+
+    if( value & ~mask )
+    {
+      return RegStatus::BAD_VALUE;
+    }
+
+    /*-------------------------------------------------------------------------
+    Never change the converter configuration underneath the control loop
+    -------------------------------------------------------------------------*/
+    if( s_ltc_state.driver_mode != DriverMode::DISABLED )
+    {
+      return RegStatus::BAD_MODE;
+    }
+
+    /*-------------------------------------------------------------------------
+    Program the register, keeping the IDAC protected outside of the write
+    -------------------------------------------------------------------------*/
+    const bool is_idac = ( reg >= REG_MFR_IDAC_VLOW ) && ( reg <= REG_MFR_IDAC_SETCUR );
+
+    if( is_idac )
+    {
+      Private::idac_write_protect( false );
+    }
+
+    Private::write_register( reg, value );
+
+    if( is_idac )
+    {
+      Private::idac_write_protect( true );
+    }
+
+    readback = Private::read_register( reg );
+    LOG_INFO( "LTC7871 register 0x%02X set to 0x%02X", reg, readback );
+
+    return RegStatus::OK;
+  }
+
+
   /*---------------------------------------------------------------------------
   Private Functions
   ---------------------------------------------------------------------------*/
@@ -685,6 +783,8 @@ namespace HW::LTC7871
     Private::idac_write_protect( false );
     Private::write_register( REG_MFR_IDAC_VLOW, idac_vlow );
     Private::idac_write_protect( true );
+
+    System::FlightRecorder::record( System::FlightRecorder::CH_LTC_VOUT_SETPOINT, voltage, idac_vlow );
   }
 
 
@@ -707,6 +807,8 @@ namespace HW::LTC7871
     Private::idac_write_protect( false );
     Private::write_register( REG_MFR_IDAC_SETCUR, new_idac_value );
     Private::idac_write_protect( true );
+
+    System::FlightRecorder::record( System::FlightRecorder::CH_LTC_IOUT_SETPOINT, current, new_idac_value );
   }
 
 
@@ -73,6 +73,33 @@ namespace HW::LTC7871
     LTC_FAULT_COUNT
   };
 
+  /**
+   * @brief Result of a direct register access
+   */
+  enum class RegStatus : uint8_t
+  {
+    OK,           /**< Access completed */
+    INVALID_ADDR, /**< Register is outside the MFR register map */
+    READ_ONLY,    /**< Register cannot be written through this interface */
+    BAD_MODE,     /**< Driver is not in a mode that allows the access */
+    BAD_VALUE,    /**< Value sets bits the register does not implement */
+  };
+
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Operating point carried across a warm restart
+   */
+  struct RetainedState
+  {
+    float msr_input_voltage;     /**< Measured input voltage (volts) */
+    float msr_output_voltage;    /**< Measured output voltage (volts) */
+    float msr_average_current;   /**< Measured average current (amps) */
+    float msr_immediate_current; /**< Measured output current (amps) */
+  };
+
   /*---------------------------------------------------------------------------
   Public Functions
   ---------------------------------------------------------------------------*/
@@ -170,6 +197,40 @@ namespace HW::LTC7871
    */
   void runFaultMonitoring();
 
+  /**
+   * @brief Snapshot the operating point so it can be resumed after a warm restart
+   *
+   * @param state Where to place the snapshot
+   */
+  void saveRetainedState( RetainedState &state );
+
+  /**
+   * @brief Reads a run of consecutive MFR registers for debugging.
+   *
+   * The whole run is read while holding the bus, so the values form a single
+   * consistent snapshot. Every read is PEC checked.
+   *
+   * @param first   First register address to read
+   * @param values  Output for the register values, in address order
+   * @param count   Number of registers to read
+   * @return RegStatus
+   */
+  RegStatus readRegisters( const uint8_t first, uint8_t *const values, const size_t count );
+
+  /**
+   * @brief Writes an MFR register directly, bypassing the setpoint logic.
+   *
+   * Only the IDAC and SSFM registers may be written, and only while the power
+   * stage is disabled. The IDAC write protection is lifted for the write and
+   * restored afterwards.
+   *
+   * @param reg       Register address to write
+   * @param value     Value to write
+   * @param readback  Output for the register value after the write
+   * @return RegStatus
+   */
+  RegStatus writeRegister( const uint8_t reg, const uint8_t value, uint8_t &readback );
+
 }    // namespace HW::LTC7871
 
 #endif /* !ICHNAEA_LTC7871_HPP */
@@ -188,6 +188,17 @@ namespace HW::LTC7871::Private
   }
 
 
+  void read_registers( const uint8_t first, uint8_t *const data, const size_t count )
+  {
+    mb::thread::RecursiveLockGuard lock( s_bus_lock );
+
+    for( size_t idx = 0; idx < count; idx++ )
+    {
+      data[ idx ] = read_register( static_cast<uint8_t>( first + idx ) );
+    }
+  }
+
+
   uint8_t compute_pec( const uint8_t addr, const uint8_t data )
   {
     /*-------------------------------------------------------------------------
@@ -152,6 +152,17 @@ namespace HW::LTC7871::Private
    */
   uint8_t read_register( const uint8_t reg );
 
+  /**
+   * @brief Reads a run of consecutive registers without releasing the bus.
+   *
+   * Each register is PEC checked exactly as in read_register().
+   *
+   * @param first First register address to read
+   * @param data  Output for the register values, in address order
+   * @param count Number of registers to read
+   */
+  void read_registers( const uint8_t first, uint8_t *const data, const size_t count );
+
   /**
    * @brief Computes the PEC code for the given buffer
    *
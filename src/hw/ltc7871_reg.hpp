@@ -207,6 +207,39 @@ namespace HW::LTC7871
   static constexpr uint8_t MFR_SSFM_FREQ_SPREAD_15  = 1u << MFR_SSFM_FREQ_SPREAD_Pos;
   static constexpr uint8_t MFR_SSFM_FREQ_SPREAD_10  = 2u << MFR_SSFM_FREQ_SPREAD_Pos;
   static constexpr uint8_t MFR_SSFM_FREQ_SPREAD_8   = 3u << MFR_SSFM_FREQ_SPREAD_Pos;
+  static constexpr uint8_t MFR_SSFM_Msk             = MFR_SSFM_MOD_FREQ_Msk | MFR_SSFM_FREQ_SPREAD_Msk;
+
+  /*---------------------------------------------------------------------------
+  Direct Access
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Bits of a register that may be written outside of the driver.
+   *
+   * MFR_CHIP_CTRL is left out on purpose: the driver owns write protection,
+   * reset and the communication fault flag.
+   *
+   * @param reg Register address
+   * @return Writable bits, zero if the register may not be written
+   */
+  static constexpr uint8_t direct_write_mask( const uint8_t reg )
+  {
+    switch( reg )
+    {
+      case REG_MFR_IDAC_VLOW:
+      case REG_MFR_IDAC_VHIGH:
+        return MFR_IDAC_V_Msk;
+
+      case REG_MFR_IDAC_SETCUR:
+        return MFR_IDAC_SETCUR_Msk;
+
+      case REG_MFR_SSFM:
+        return MFR_SSFM_Msk;
+
+      default:
+        return 0;
+    }
+  }
 }    // namespace HW::LTC7871
 
 #endif /* !ICHNAEA_LTC7871_REGISTERS_HPP */
@@ -3,7 +3,18 @@
  *    nor.cpp
  *
  *  Description:
- *    NOR interface for supporting database storage
+ *    NOR interface for supporting database storage.
+ *
+ *    Payload transfers run on a pair of DMA channels paced by the SPI DREQs.
+ *    The calling thread blocks on a task notification raised by the DMA IRQ,
+ *    and program/erase busy polling sleeps between status reads, so the CPU
+ *    is free for other threads while the flash is working.
+ *
+ *    Programs and erases only hold the bus while issuing commands. A read
+ *    that arrives while one is in progress suspends it on the device, does
+ *    the read, then resumes it, so readers never wait out an erase. The one
+ *    exception is a read touching the page or sector being changed, whose
+ *    contents are undefined until the op completes. That read waits.
  *
  *  2024 | Brandon Braun | brandonbraun653@protonmail.com
  *****************************************************************************/
@@ -11,13 +22,24 @@
 /*-----------------------------------------------------------------------------
 Includes
 -----------------------------------------------------------------------------*/
+#include "FreeRTOS.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/spi.h"
 #include "mbedutils/drivers/logging/logging_macros.hpp"
-#include <mbedutils/interfaces/gpio_intf.hpp>
-#include <mbedutils/interfaces/spi_intf.hpp>
-#include <mbedutils/memory.hpp>
+#include "pico/platform.h"
+#include "pico/time.h"
+#include "task.h"
+#include <cstring>
+#include <etl/algorithm.h>
+#include <mbedutils/assert.hpp>
+#include <mbedutils/osal.hpp>
+#include <mbedutils/threading.hpp>
 #include <src/bsp/board_map.hpp>
 #include <src/hw/nor.hpp>
+#include <src/hw/nor_cache.hpp>
 #include <src/system/system_error.hpp>
+#include <src/system/system_flash_stats.hpp>
 
 /*-----------------------------------------------------------------------------
 Module Literals
@@ -26,14 +48,482 @@ Module Literals
 
 namespace HW::NOR
 {
-  using namespace mb::memory;
-  using namespace mb::memory::nor;
+  /*---------------------------------------------------------------------------
+  Constants
+  ---------------------------------------------------------------------------*/
+
+  static constexpr size_t PAGE_SIZE        = 256;
+  static constexpr size_t DMA_MIN_TRANSFER = 32;  /**< Below this, PIO beats the notify round trip */
+  static constexpr size_t DMA_NOTIFY_INDEX = 1;   /**< Task notification slot reserved for this driver */
+  static constexpr size_t DMA_TIMEOUT_MS   = 50;  /**< Far longer than a 64k payload at 31.25 MHz */
+
+  static constexpr uint32_t PROGRAM_TIMEOUT_MS  = 3;
+  static constexpr uint32_t ERASE_4K_TIMEOUT_MS = 400;
+  static constexpr uint32_t ERASE_POLL_MS       = 5;
+  static constexpr uint32_t SUSPEND_TIMEOUT_US  = 100; /**< tSUS is 20us max */
+  static constexpr uint32_t RESUME_HOLDOFF_US   = 500; /**< Guaranteed progress between suspends */
+
+  /*---------------------------------------------------------------------------
+  Enumerations
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief AT25SF command set used by the driver
+   */
+  enum Command : uint8_t
+  {
+    CMD_WRITE_ENABLE  = 0x06,
+    CMD_READ_STATUS_1 = 0x05,
+    CMD_FAST_READ     = 0x0B,
+    CMD_PAGE_PROGRAM  = 0x02,
+    CMD_READ_STATUS_2 = 0x35,
+    CMD_ERASE_4K      = 0x20,
+    CMD_SUSPEND       = 0x75,
+    CMD_RESUME        = 0x7A,
+    CMD_READ_JEDEC_ID = 0x9F,
+  };
+
+  static constexpr uint8_t STATUS_BUSY    = 0x01; /**< Status register 1 */
+  static constexpr uint8_t STATUS_SUSPEND = 0x80; /**< Status register 2 */
+
+  static_assert( CACHE_LINE_SIZE == PAGE_SIZE, "Cache lines must map onto device pages" );
 
   /*---------------------------------------------------------------------------
   Private Data
   ---------------------------------------------------------------------------*/
 
-  static DeviceDriver s_flash_mem;
+  static mb::osal::mb_recursive_mutex_t s_nor_mutex;    /**< Bus and driver state lock */
+  static mb::osal::mb_recursive_mutex_t s_op_mutex;     /**< Serializes programs and erases */
+  static volatile bool                  s_op_active;    /**< A program/erase was issued and may be running */
+  static volatile long                  s_op_address;   /**< Start of the range the active op is changing */
+  static volatile size_t                s_op_size;      /**< Size of the range the active op is changing */
+  static uint64_t                       s_resume_us;    /**< Time of the last resume */
+  static volatile uint32_t              s_suspend_us;   /**< Total time ops have spent suspended */
+  static spi_inst_t                    *s_spi;          /**< NOR SPI peripheral */
+  static size_t                         s_cs_pin;       /**< Chip select GPIO */
+  static int                            s_dma_tx;       /**< DMA channel feeding the SPI TX FIFO */
+  static int                            s_dma_rx;       /**< DMA channel draining the SPI RX FIFO */
+  static volatile TaskHandle_t          s_dma_waiter;   /**< Thread blocked on the active transfer */
+  static uint8_t                        s_dummy_tx;     /**< Clock-out byte for receive-only transfers */
+  static uint8_t                        s_dummy_rx;     /**< Sink for transmit-only transfers */
+
+  static PageCache<CACHE_SETS, CACHE_WAYS, CACHE_LINE_SIZE> s_cache; /**< Page read cache */
+
+  /*---------------------------------------------------------------------------
+  Private Functions
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Checks if the calling context is allowed to block on the scheduler
+   *
+   * @return true   Running in a thread with the scheduler started
+   * @return false  Boot context or ISR, must poll instead
+   */
+  static inline bool can_block()
+  {
+    return ( xTaskGetSchedulerState() == taskSCHEDULER_RUNNING ) && ( __get_current_exception() == 0 );
+  }
+
+
+  static inline void cs_assert()
+  {
+    gpio_put( s_cs_pin, 0 );
+  }
+
+
+  static inline void cs_release()
+  {
+    gpio_put( s_cs_pin, 1 );
+  }
+
+
+  /**
+   * @brief Sleeps the calling thread, or spins if that isn't possible yet
+   *
+   * @param ms  Time to wait
+   */
+  static void wait_ms( const uint32_t ms )
+  {
+    if( can_block() )
+    {
+      vTaskDelay( etl::max<TickType_t>( pdMS_TO_TICKS( ms ), 1 ) );
+    }
+    else
+    {
+      busy_wait_us( ms * 1000 );
+    }
+  }
+
+
+  /**
+   * @brief DMA completion handler. Only the RX channel raises the IRQ, as it
+   * is the last to finish and guarantees the bus has gone idle.
+   */
+  static void dma_irq_handler()
+  {
+    if( !dma_channel_get_irq1_status( s_dma_rx ) )
+    {
+      return;
+    }
+
+    dma_channel_acknowledge_irq1( s_dma_rx );
+
+    BaseType_t   woken  = pdFALSE;
+    TaskHandle_t waiter = s_dma_waiter;
+    if( waiter )
+    {
+      vTaskNotifyGiveIndexedFromISR( waiter, DMA_NOTIFY_INDEX, &woken );
+    }
+
+    portYIELD_FROM_ISR( woken );
+  }
+
+
+  /**
+   * @brief Runs the data phase of a command. Chip select must already be held.
+   *
+   * Either buffer may be null, in which case dummy bytes are clocked out or
+   * received data is discarded.
+   *
+   * @param tx    Data to transmit, or nullptr
+   * @param rx    Buffer to receive into, or nullptr
+   * @param size  Number of bytes to exchange
+   * @return true   Transfer completed
+   * @return false  Transfer timed out
+   */
+  static bool transfer( const uint8_t *tx, uint8_t *rx, const size_t size )
+  {
+    /*-------------------------------------------------------------------------
+    Short transfers are cheaper to push through the FIFOs directly
+    -------------------------------------------------------------------------*/
+    if( size < DMA_MIN_TRANSFER )
+    {
+      if( tx && rx )
+      {
+        spi_write_read_blocking( s_spi, tx, rx, size );
+      }
+      else if( tx )
+      {
+        spi_write_blocking( s_spi, tx, size );
+      }
+      else if( rx )
+      {
+        spi_read_blocking( s_spi, s_dummy_tx, rx, size );
+      }
+
+      return true;
+    }
+
+    /*-------------------------------------------------------------------------
+    Program both channels. The RX channel is always used so that completion
+    means every byte has finished shifting on the wire.
+    -------------------------------------------------------------------------*/
+    dma_channel_config tx_cfg = dma_channel_get_default_config( s_dma_tx );
+    channel_config_set_transfer_data_size( &tx_cfg, DMA_SIZE_8 );
+    channel_config_set_dreq( &tx_cfg, spi_get_dreq( s_spi, true ) );
+    channel_config_set_read_increment( &tx_cfg, tx != nullptr );
+    channel_config_set_write_increment( &tx_cfg, false );
+    dma_channel_configure( s_dma_tx, &tx_cfg, &spi_get_hw( s_spi )->dr, tx ? tx : &s_dummy_tx, size, false );
+
+    dma_channel_config rx_cfg = dma_channel_get_default_config( s_dma_rx );
+    channel_config_set_transfer_data_size( &rx_cfg, DMA_SIZE_8 );
+    channel_config_set_dreq( &rx_cfg, spi_get_dreq( s_spi, false ) );
+    channel_config_set_read_increment( &rx_cfg, false );
+    channel_config_set_write_increment( &rx_cfg, rx != nullptr );
+    dma_channel_configure( s_dma_rx, &rx_cfg, rx ? rx : &s_dummy_rx, &spi_get_hw( s_spi )->dr, size, false );
+
+    /*-------------------------------------------------------------------------
+    Start the transfer and wait for the RX channel to drain
+    -------------------------------------------------------------------------*/
+    const bool blocking = can_block();
+    if( blocking )
+    {
+      ulTaskNotifyTakeIndexed( DMA_NOTIFY_INDEX, pdTRUE, 0 );
+      s_dma_waiter = xTaskGetCurrentTaskHandle();
+    }
+
+    dma_start_channel_mask( ( 1u << s_dma_tx ) | ( 1u << s_dma_rx ) );
+
+    bool done = true;
+    if( blocking )
+    {
+      done         = ulTaskNotifyTakeIndexed( DMA_NOTIFY_INDEX, pdTRUE, pdMS_TO_TICKS( DMA_TIMEOUT_MS ) ) != 0;
+      s_dma_waiter = nullptr;
+    }
+    else
+    {
+      dma_channel_wait_for_finish_blocking( s_dma_rx );
+    }
+
+    if( !done )
+    {
+      dma_channel_abort( s_dma_tx );
+      dma_channel_abort( s_dma_rx );
+      LOG_ERROR( "NOR DMA timeout, %d bytes", size );
+    }
+
+    return done;
+  }
+
+
+  /**
+   * @brief Sends a command with an optional 24-bit address
+   *
+   * @param cmd           Command opcode
+   * @param address       Address to follow the opcode, or negative for none
+   * @param dummy_bytes   Number of dummy bytes after the address
+   */
+  static void send_header( const uint8_t cmd, const long address, const size_t dummy_bytes )
+  {
+    uint8_t hdr[ 5 ] = { cmd, 0, 0, 0, 0 };
+    size_t  len      = 1;
+
+    if( address >= 0 )
+    {
+      hdr[ 1 ] = static_cast<uint8_t>( ( address >> 16 ) & 0xFF );
+      hdr[ 2 ] = static_cast<uint8_t>( ( address >> 8 ) & 0xFF );
+      hdr[ 3 ] = static_cast<uint8_t>( address & 0xFF );
+      len      = 4;
+    }
+
+    len += dummy_bytes;
+    spi_write_blocking( s_spi, hdr, len );
+  }
+
+
+  static void simple_command( const uint8_t cmd )
+  {
+    cs_assert();
+    send_header( cmd, -1, 0 );
+    cs_release();
+  }
+
+
+  static uint8_t read_status( const uint8_t cmd = CMD_READ_STATUS_1 )
+  {
+    uint8_t status = 0;
+
+    cs_assert();
+    send_header( cmd, -1, 0 );
+    spi_read_blocking( s_spi, 0, &status, 1 );
+    cs_release();
+
+    return status;
+  }
+
+
+  /**
+   * @brief Checks if a range overlaps the one an in-progress program/erase
+   * is changing. Caller must hold the bus lock.
+   *
+   * @param offset  Start of the range
+   * @param size    Size of the range
+   * @return true   The range holds undefined data until the op finishes
+   * @return false  Safe to read, with a suspend if needed
+   */
+  static bool op_overlaps( const long offset, const size_t size )
+  {
+    return s_op_active && ( offset < static_cast<long>( s_op_address + s_op_size ) ) &&
+           ( s_op_address < static_cast<long>( offset + size ) );
+  }
+
+
+  /**
+   * @brief Suspends an in-progress program/erase so the array can be read.
+   * Caller must hold the bus lock.
+   *
+   * @param suspended  Set if the device was suspended and must be resumed
+   * @return true   The array is readable
+   * @return false  The device is still busy, ie the suspend never took effect
+   */
+  static bool suspend_op( bool &suspended )
+  {
+    suspended = false;
+    if( !s_op_active || !( read_status() & STATUS_BUSY ) )
+    {
+      return true;
+    }
+
+    /*-------------------------------------------------------------------------
+    Give the op a minimum run time since the last resume. Back to back reads
+    would otherwise starve it indefinitely.
+    -------------------------------------------------------------------------*/
+    const uint64_t since_resume = time_us_64() - s_resume_us;
+    if( since_resume < RESUME_HOLDOFF_US )
+    {
+      busy_wait_us( RESUME_HOLDOFF_US - since_resume );
+    }
+
+    simple_command( CMD_SUSPEND );
+
+    const absolute_time_t deadline = make_timeout_time_us( SUSPEND_TIMEOUT_US );
+    while( ( read_status() & STATUS_BUSY ) && !time_reached( deadline ) )
+    {
+      tight_loop_contents();
+    }
+
+    /*-------------------------------------------------------------------------
+    The op may have finished on its own right before the suspend landed
+    -------------------------------------------------------------------------*/
+    suspended = ( read_status( CMD_READ_STATUS_2 ) & STATUS_SUSPEND ) != 0;
+    return suspended || !( read_status() & STATUS_BUSY );
+  }
+
+
+  /**
+   * @brief Resumes a program/erase suspended by suspend_op()
+   *
+   * @param start_us  Time the suspend began
+   */
+  static void resume_op( const uint64_t start_us )
+  {
+    simple_command( CMD_RESUME );
+
+    s_resume_us = time_us_64();
+    s_suspend_us += static_cast<uint32_t>( s_resume_us - start_us );
+  }
+
+
+  /**
+   * @brief Waits for a program/erase to finish, sleeping between status polls.
+   *
+   * The bus is only held for each status read so readers can get in and
+   * suspend the op. Time spent suspended doesn't count against the timeout.
+   *
+   * @param timeout_ms  Worst case latency of the operation
+   * @param poll_ms     Time to sleep between polls
+   * @return true   Device is idle
+   * @return false  Device still busy after the timeout
+   */
+  static bool wait_ready( const uint32_t timeout_ms, const uint32_t poll_ms )
+  {
+    const uint64_t start_us      = time_us_64();
+    const uint32_t suspend_start = s_suspend_us;
+    const uint64_t budget_us     = static_cast<uint64_t>( timeout_ms + poll_ms ) * 1000;
+
+    while( true )
+    {
+      {
+        mb::thread::RecursiveLockGuard lock( s_nor_mutex );
+        if( !( read_status() & STATUS_BUSY ) )
+        {
+          s_op_active = false;
+          return true;
+        }
+      }
+
+      const uint64_t elapsed_us = time_us_64() - start_us - ( s_suspend_us - suspend_start );
+      if( elapsed_us > budget_us )
+      {
+        LOG_ERROR( "NOR busy timeout after %d ms", timeout_ms );
+        s_op_active = false;
+        return false;
+      }
+
+      wait_ms( poll_ms );
+    }
+  }
+
+
+  /**
+   * @brief Programs data that fits inside a single page. Caller must hold the
+   * op lock.
+   */
+  static bool program_page( const long address, const uint8_t *buf, const size_t size )
+  {
+    const uint64_t start_us = time_us_64();
+    bool           sent     = false;
+
+    {
+      mb::thread::RecursiveLockGuard lock( s_nor_mutex );
+
+      simple_command( CMD_WRITE_ENABLE );
+
+      cs_assert();
+      send_header( CMD_PAGE_PROGRAM, address, 0 );
+      sent = transfer( buf, nullptr, size );
+      cs_release();
+
+      s_op_address = address;
+      s_op_size    = size;
+      s_op_active  = sent;
+    }
+
+    const bool ok = sent && wait_ready( PROGRAM_TIMEOUT_MS, 1 );
+    System::FlashStats::recordProgram( size, static_cast<uint32_t>( time_us_64() - start_us ) );
+    return ok;
+  }
+
+
+  /**
+   * @brief Erases a single 4k sector. Caller must hold the op lock.
+   */
+  static bool erase_sector( const long address )
+  {
+    const uint64_t start_us = time_us_64();
+
+    {
+      mb::thread::RecursiveLockGuard lock( s_nor_mutex );
+
+      simple_command( CMD_WRITE_ENABLE );
+
+      cs_assert();
+      send_header( CMD_ERASE_4K, address, 0 );
+      cs_release();
+
+      s_op_address = address;
+      s_op_size    = ERASE_BLOCK_SIZE;
+      s_op_active  = true;
+    }
+
+    const bool ok = wait_ready( ERASE_4K_TIMEOUT_MS, ERASE_POLL_MS );
+    System::FlashStats::recordErase( address, static_cast<uint32_t>( time_us_64() - start_us ) );
+    return ok;
+  }
+
+
+  /**
+   * @brief Reads straight from the device, bypassing the cache. Suspends any
+   * in-progress program/erase for the duration, unless the read overlaps the
+   * range it is changing. Then the read waits for the op to finish instead.
+   * Caller must hold the bus lock.
+   */
+  static int device_read( long offset, uint8_t *buf, size_t size )
+  {
+    const uint64_t suspend_start = time_us_64();
+
+    /*-------------------------------------------------------------------------
+    Never hand back, or let the cache keep, data from a page or sector that
+    is mid program/erase. A failed read is not cached.
+    -------------------------------------------------------------------------*/
+    if( op_overlaps( offset, size ) && !wait_ready( ERASE_4K_TIMEOUT_MS, 1 ) )
+    {
+      return -1;
+    }
+
+    /*-------------------------------------------------------------------------
+    A read issued while the device is busy returns garbage. If the suspend
+    didn't take, fall back to waiting out the op.
+    -------------------------------------------------------------------------*/
+    bool suspended = false;
+    if( !suspend_op( suspended ) && !wait_ready( ERASE_4K_TIMEOUT_MS, 1 ) )
+    {
+      return -1;
+    }
+
+    cs_assert();
+    send_header( CMD_FAST_READ, offset, 1 );
+    const bool done = transfer( nullptr, buf, size );
+    cs_release();
+
+    if( suspended )
+    {
+      resume_op( suspend_start );
+    }
+
+    System::FlashStats::recordRead( size, static_cast<uint32_t>( time_us_64() - suspend_start ) );
+    return done ? static_cast<int>( size ) : -1;
+  }
 
   /*---------------------------------------------------------------------------
   Public Functions
@@ -45,6 +535,9 @@ namespace HW::NOR
 
     auto io_cfg = BSP::getIOConfig();
 
+    mbed_assert( mb::osal::buildRecursiveMutexStrategy( s_nor_mutex ) );
+    mbed_assert( mb::osal::buildRecursiveMutexStrategy( s_op_mutex ) );
+
     /*-------------------------------------------------------------------------
     Initialize the GPIO pins for SPI control
     -------------------------------------------------------------------------*/
@@ -64,59 +557,64 @@ namespace HW::NOR
     gpio_pull_up( io_cfg.spi[ BSP::SPI_NOR_FLASH ].miso );
 
     /* CS */
-    auto pin = BSP::getPin( mb::hw::PERIPH_GPIO, BSP::GPIO_SPI_CS_NOR );
-    gpio_init( pin );
-    gpio_set_dir( pin, GPIO_OUT );
-    gpio_pull_up( pin );
-    gpio_put( pin, 1 );
+    s_cs_pin = BSP::getPin( mb::hw::PERIPH_GPIO, BSP::GPIO_SPI_CS_NOR );
+    gpio_init( s_cs_pin );
+    gpio_set_dir( s_cs_pin, GPIO_OUT );
+    gpio_pull_up( s_cs_pin );
+    gpio_put( s_cs_pin, 1 );
 
     /*-------------------------------------------------------------------------
     Initialize the SPI peripheral
     -------------------------------------------------------------------------*/
     constexpr uint32_t spi_clk_rate = 31'250'000;
 
-    auto pSPI = reinterpret_cast<spi_inst_t *>( BSP::getHardware( mb::hw::PERIPH_SPI, BSP::SPI_NOR_FLASH ) );
+    s_spi = reinterpret_cast<spi_inst_t *>( BSP::getHardware( mb::hw::PERIPH_SPI, BSP::SPI_NOR_FLASH ) );
 
-    const uint32_t act_baud = spi_init( pSPI, spi_clk_rate );
+    const uint32_t act_baud = spi_init( s_spi, spi_clk_rate );
     if( ( act_baud < ( spi_clk_rate * 0.9f ) ) || ( act_baud > ( spi_clk_rate * 1.1f ) ) )
     {
       Panic::throwError( Panic::ErrorCode::ERR_SYSTEM_INIT_FAIL );
     }
 
-    spi_set_format( pSPI, 8, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST );
+    spi_set_format( s_spi, 8, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST );
 
     /*-------------------------------------------------------------------------
-    Configure the NOR flash driver
+    Claim the DMA channels and hook the completion IRQ. The IRQ line is shared
+    so other drivers may attach to it as well.
     -------------------------------------------------------------------------*/
-    DeviceConfig cfg;
-
-    cfg.dev_attr.size               = 4 * 1024 * 1024;
-    cfg.dev_attr.block_size         = 4096;
-    cfg.dev_attr.write_size         = 256;
-    cfg.dev_attr.read_size          = 256;
-    cfg.dev_attr.erase_size         = 4096;
-    cfg.dev_attr.erase_chip_latency = 50'000;    // 50 seconds
-    cfg.dev_attr.write_latency      = 3;
-    cfg.dev_attr.erase_latency      = 400;
-    cfg.spi_port                    = io_cfg.spi[ BSP::SPI_NOR_FLASH ].port;
-    cfg.spi_cs_pin                  = io_cfg.gpio[ BSP::GPIO_SPI_CS_NOR ].pin;
-    cfg.spi_cs_port                 = 0;    // This doesn't mean anything for the Pico implementation
-    cfg.use_hs_read                 = true;
-    cfg.pend_event_cb               = mb::memory::nor::device::adesto_at25sfxxx_pend_event;
-
-    s_flash_mem.open( cfg );
+    s_dma_tx     = dma_claim_unused_channel( true );
+    s_dma_rx     = dma_claim_unused_channel( true );
+    s_dma_waiter = nullptr;
+    s_dummy_tx   = 0x00;
+
+    dma_channel_set_irq1_enabled( s_dma_rx, true );
+    irq_add_shared_handler( DMA_IRQ_1, dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY );
+    irq_set_enabled( DMA_IRQ_1, true );
 
     /*-------------------------------------------------------------------------
-    Verify the driver is ready by getting the manufacturer information
+    Verify the device is present by reading the JEDEC id
     -------------------------------------------------------------------------*/
-    auto info = s_flash_mem.getDeviceInfo();
+    uint8_t id[ 3 ] = { 0, 0, 0 };
 
-    if( info.manufacturer == 0 || info.type == 0 || info.capacity == 0 )
+    cs_assert();
+    send_header( CMD_READ_JEDEC_ID, -1, 0 );
+    spi_read_blocking( s_spi, 0, id, sizeof( id ) );
+    cs_release();
+
+    if( ( id[ 0 ] == 0 ) || ( id[ 1 ] == 0 ) || ( id[ 2 ] == 0 ) || ( id[ 0 ] == 0xFF ) )
     {
       Panic::throwError( Panic::ErrorCode::ERR_SYSTEM_INIT_FAIL );
       return -1;
     }
 
+    /*-------------------------------------------------------------------------
+    A reset while an op was suspended leaves the device suspended. Resume is
+    ignored by the device if nothing is pending.
+    -------------------------------------------------------------------------*/
+    simple_command( CMD_RESUME );
+    s_op_active = true;
+    wait_ready( ERASE_4K_TIMEOUT_MS, 1 );
+
     return 0;
   }
 
@@ -124,14 +622,54 @@ namespace HW::NOR
   int read( long offset, uint8_t *buf, size_t size )
   {
     LOG_TRACE_IF( NOR_DEBUG, "Read 0x%08X, %d bytes", offset, size );
-    return s_flash_mem.read( offset, buf, size ) == Status::ERR_OK ? size : -1;
+
+    if( ( offset < 0 ) || ( ( offset + size ) > DEVICE_SIZE ) || !buf )
+    {
+      return -1;
+    }
+
+    mb::thread::RecursiveLockGuard lock( s_nor_mutex );
+    return s_cache.read( offset, buf, size, device_read );
   }
 
 
   int write( long offset, const uint8_t *buf, size_t size )
   {
     LOG_TRACE_IF( NOR_DEBUG, "Write 0x%08X, %d bytes", offset, size );
-    int result = s_flash_mem.write( offset, buf, size ) == Status::ERR_OK ? size : -1;
+
+    if( ( offset < 0 ) || ( ( offset + size ) > DEVICE_SIZE ) || !buf )
+    {
+      return -1;
+    }
+
+    mb::thread::RecursiveLockGuard lock( s_op_mutex );
+
+    /*-------------------------------------------------------------------------
+    Program page by page. A page program wraps at the page boundary, so never
+    let one cross it.
+    -------------------------------------------------------------------------*/
+    int    result  = static_cast<int>( size );
+    size_t written = 0;
+
+    while( written < size )
+    {
+      const long   address = offset + written;
+      const size_t room    = PAGE_SIZE - ( address % PAGE_SIZE );
+      const size_t chunk   = etl::min( room, size - written );
+
+      if( !program_page( address, buf + written, chunk ) )
+      {
+        result = -1;
+        break;
+      }
+
+      written += chunk;
+    }
+
+    {
+      mb::thread::RecursiveLockGuard bus_lock( s_nor_mutex );
+      s_cache.invalidate( offset, size );
+    }
 
 /*-------------------------------------------------------------------------
 Integrity check to make sure the data was written correctly
@@ -139,9 +677,9 @@ Integrity check to make sure the data was written correctly
 #if NOR_DEBUG
     static etl::array<uint8_t, 512> s_debug_buffer;
 
-    if( result > 0 )
+    if( ( result > 0 ) && ( size <= s_debug_buffer.size() ) )
     {
-      s_flash_mem.read( offset, s_debug_buffer.data(), size );
+      read( offset, s_debug_buffer.data(), size );
       if( memcmp( buf, s_debug_buffer.data(), size ) != 0 )
       {
         result = -1;
@@ -156,8 +694,56 @@ Integrity check to make sure the data was written correctly
 
   int erase( long offset, size_t size )
   {
-    return s_flash_mem.erase( offset, size ) == Status::ERR_OK ? size : -1;
+    if( ( offset < 0 ) || ( ( offset % ERASE_BLOCK_SIZE ) != 0 ) || ( ( size % ERASE_BLOCK_SIZE ) != 0 ) ||
+        ( ( offset + size ) > DEVICE_SIZE ) )
+    {
+      return -1;
+    }
+
+    /*-------------------------------------------------------------------------
+    Erase one sector at a time, releasing the op lock and yielding between
+    sectors. A pending program gets in between chunks instead of waiting out
+    the whole range.
+    -------------------------------------------------------------------------*/
+    for( size_t erased = 0; erased < size; erased += ERASE_BLOCK_SIZE )
+    {
+      const long address = offset + erased;
+      bool       ok      = false;
+
+      {
+        mb::thread::RecursiveLockGuard lock( s_op_mutex );
+        ok = erase_sector( address );
+
+        mb::thread::RecursiveLockGuard bus_lock( s_nor_mutex );
+        s_cache.invalidate( address, ERASE_BLOCK_SIZE );
+      }
+
+      if( !ok )
+      {
+        return -1;
+      }
+
+      if( can_block() )
+      {
+        taskYIELD();
+      }
+    }
+
+    return static_cast<int>( size );
   }
 
 
+  CacheStats getCacheStats()
+  {
+    mb::thread::RecursiveLockGuard lock( s_nor_mutex );
+    return s_cache.stats();
+  }
+
+
+  void resetCacheStats()
+  {
+    mb::thread::RecursiveLockGuard lock( s_nor_mutex );
+    s_cache.resetStats();
+  }
+
 }    // namespace HW::NOR
@@ -27,6 +27,29 @@ namespace HW::NOR
   static constexpr size_t ERASE_BLOCK_SIZE = 4096;
   static constexpr size_t FLASH_ADDR_MIN   = 0x00000000;
   static constexpr size_t FLASH_ADDR_MAX   = 8 * 1024 * 1024;
+  static constexpr size_t DEVICE_SIZE      = 4 * 1024 * 1024; /**< Capacity of the fitted part */
+
+  static_assert( DEVICE_SIZE <= FLASH_ADDR_MAX, "Device must fit in the flash address space" );
+
+  static constexpr size_t CACHE_LINE_SIZE = 256; /**< One device page per line */
+  static constexpr size_t CACHE_SETS      = 4;   /**< Sets in the read cache */
+  static constexpr size_t CACHE_WAYS      = 2;   /**< Lines per set */
+
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Read cache counters since boot or the last reset
+   */
+  struct CacheStats
+  {
+    uint32_t hits;          /**< Line reads served from RAM */
+    uint32_t misses;        /**< Line reads that had to fill from the device */
+    uint32_t bypass;        /**< Multi-line reads sent straight to the device */
+    uint32_t invalidations; /**< Lines dropped by writes or erases */
+    uint32_t device_reads;  /**< Read transactions issued to the device */
+  };
 
   /*---------------------------------------------------------------------------
   Public Functions
@@ -43,7 +66,7 @@ namespace HW::NOR
    * @param offset    Address to start reading from
    * @param buf       Buffer to read data into
    * @param size      Number of bytes to read
-   * @return int      0 on success, error code otherwise
+   * @return int      Number of bytes read, negative on failure
    */
   int read( long offset, uint8_t* buf, size_t size );
 
@@ -53,7 +76,7 @@ namespace HW::NOR
    * @param offset    Address to start writing to
    * @param buf       Buffer to write data from
    * @param size      Number of bytes to write
-   * @return int      0 on success, error code otherwise
+   * @return int      Number of bytes written, negative on failure
    */
   int write( long offset, const uint8_t* buf, size_t size );
 
@@ -62,10 +85,22 @@ namespace HW::NOR
    *
    * @param offset    Address to start erasing from
    * @param size      Number of bytes to erase
-   * @return int      0 on success, error code otherwise
+   * @return int      Number of bytes erased, negative on failure
    */
   int erase( long offset, size_t size );
 
+  /**
+   * @brief Get a snapshot of the read cache counters
+   *
+   * @return CacheStats
+   */
+  CacheStats getCacheStats();
+
+  /**
+   * @brief Zero the read cache counters
+   */
+  void resetCacheStats();
+
 }  // namespace HW::NOR
 
 #endif  /* !ICHNAEA_NOR_HPP */
@@ -0,0 +1,230 @@
+/******************************************************************************
+ *  File Name:
+ *    nor_cache.hpp
+ *
+ *  Description:
+ *    Set-associative page cache sitting in front of the NOR flash. Shared by
+ *    the hardware driver and the simulator so both see the same hit rates.
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+#pragma once
+#ifndef ICHNAEA_NOR_CACHE_HPP
+#define ICHNAEA_NOR_CACHE_HPP
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <etl/algorithm.h>
+#include <src/hw/nor.hpp>
+
+namespace HW::NOR
+{
+  /*---------------------------------------------------------------------------
+  Classes
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Read cache of whole flash pages.
+   *
+   * Lines are page aligned and a page may only live in the set selected by its
+   * page number. Within a set the least recently used line is replaced. The
+   * cache is not thread safe, the owning driver must hold its bus lock.
+   *
+   * @tparam SETS       Number of sets
+   * @tparam WAYS       Lines per set
+   * @tparam LINE_SIZE  Bytes per line, must match the device page size
+   */
+  template<size_t SETS, size_t WAYS, size_t LINE_SIZE>
+  class PageCache
+  {
+  public:
+    static_assert( SETS > 0 && WAYS > 0, "Cache must hold at least one line" );
+    static_assert( ( LINE_SIZE & ( LINE_SIZE - 1 ) ) == 0, "Line size must be a power of two" );
+
+    /**
+     * @brief Reads a full line from the backing device
+     *
+     * @return int  Negative on failure
+     */
+    using FillFunc = int ( * )( long offset, uint8_t *buf, size_t size );
+
+    PageCache() : mStats{}, mTick( 0 )
+    {
+      invalidateAll();
+    }
+
+    /**
+     * @brief Read through the cache, filling missed lines from the device.
+     *
+     * Reads larger than a single line go straight to the device as one
+     * transfer. Splitting them into line sized fills would cost a command and
+     * address phase per line, and a long sequential scan would evict the hot
+     * pages.
+     *
+     * @param offset  Address to start reading from
+     * @param buf     Buffer to read into
+     * @param size    Number of bytes to read
+     * @param fill    Device read function
+     * @return int    Negative on failure, otherwise size
+     */
+    int read( const long offset, uint8_t *const buf, const size_t size, FillFunc fill )
+    {
+      if( size > LINE_SIZE )
+      {
+        mStats.bypass++;
+        mStats.device_reads++;
+        return ( fill( offset, buf, size ) < 0 ) ? -1 : static_cast<int>( size );
+      }
+
+      size_t done = 0;
+      while( done < size )
+      {
+        const long   address = offset + done;
+        const long   base    = address & ~static_cast<long>( LINE_SIZE - 1 );
+        const size_t skip    = static_cast<size_t>( address - base );
+        const size_t chunk   = etl::min( LINE_SIZE - skip, size - done );
+
+        Line *line = lookup( base );
+        if( line )
+        {
+          mStats.hits++;
+        }
+        else
+        {
+          mStats.misses++;
+          mStats.device_reads++;
+
+          line = victim( base );
+          if( fill( base, line->data, LINE_SIZE ) < 0 )
+          {
+            line->valid = false;
+            return -1;
+          }
+
+          line->valid = true;
+          line->base  = base;
+        }
+
+        line->last_used = ++mTick;
+        memcpy( buf + done, line->data + skip, chunk );
+        done += chunk;
+      }
+
+      return static_cast<int>( size );
+    }
+
+    /**
+     * @brief Drop any lines overlapping a modified address range
+     *
+     * @param offset  Start of the modified range
+     * @param size    Length of the modified range
+     */
+    void invalidate( const long offset, const size_t size )
+    {
+      const long end = offset + static_cast<long>( size );
+
+      for( auto &set : mSets )
+      {
+        for( auto &line : set )
+        {
+          if( line.valid && ( line.base < end ) && ( ( line.base + static_cast<long>( LINE_SIZE ) ) > offset ) )
+          {
+            line.valid = false;
+            mStats.invalidations++;
+          }
+        }
+      }
+    }
+
+    /**
+     * @brief Drop every line in the cache
+     */
+    void invalidateAll()
+    {
+      for( auto &set : mSets )
+      {
+        for( auto &line : set )
+        {
+          line.valid = false;
+        }
+      }
+    }
+
+    /**
+     * @brief Access the cache counters
+     *
+     * @return const CacheStats&
+     */
+    const CacheStats &stats() const
+    {
+      return mStats;
+    }
+
+    /**
+     * @brief Zero the cache counters
+     */
+    void resetStats()
+    {
+      mStats = {};
+    }
+
+  private:
+    struct Line
+    {
+      bool     valid;
+      long     base;
+      uint32_t last_used;
+      uint8_t  data[ LINE_SIZE ];
+    };
+
+    CacheStats mStats;
+    uint32_t   mTick;
+    Line       mSets[ SETS ][ WAYS ];
+
+    static size_t set_index( const long base )
+    {
+      return static_cast<size_t>( base / LINE_SIZE ) % SETS;
+    }
+
+    Line *lookup( const long base )
+    {
+      for( auto &line : mSets[ set_index( base ) ] )
+      {
+        if( line.valid && ( line.base == base ) )
+        {
+          return &line;
+        }
+      }
+
+      return nullptr;
+    }
+
+    Line *victim( const long base )
+    {
+      Line *oldest = nullptr;
+
+      for( auto &line : mSets[ set_index( base ) ] )
+      {
+        if( !line.valid )
+        {
+          return &line;
+        }
+
+        if( !oldest || ( line.last_used < oldest->last_used ) )
+        {
+          oldest = &line;
+        }
+      }
+
+      return oldest;
+    }
+  };
+
+}    // namespace HW::NOR
+
+#endif /* !ICHNAEA_NOR_CACHE_HPP */
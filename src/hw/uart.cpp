@@ -13,13 +13,44 @@ Includes
 -----------------------------------------------------------------------------*/
 #include <src/bsp/board_map.hpp>
 #include <src/hw/uart.hpp>
+#include <cstring>
+#include <etl/algorithm.h>
 #include <etl/bip_buffer_spsc_atomic.h>
+#include <hardware/clocks.h>
+#include <hardware/dma.h>
+#include <hardware/irq.h>
+#include <hardware/uart.h>
 #include <mbedutils/drivers/hardware/pico/pico_serial.hpp>
+#include <mbedutils/interfaces/irq_intf.hpp>
+#include <pico/time.h>
 
 namespace HW::UART
 {
   static_assert( ( size_t )Channel::NUM_OPTIONS == ( size_t )BSP::UART_MAX_PORTS, "UART channel mismatch" );
 
+  /*---------------------------------------------------------------------------
+  Constants
+  ---------------------------------------------------------------------------*/
+
+  static constexpr uint32_t RX_RING_BITS   = 11;                  /**< Log2 size of the BMS DMA receive ring */
+  static constexpr size_t   RX_RING_SIZE   = 1u << RX_RING_BITS;  /**< ~10ms of data at 2 Mbaud */
+  static constexpr uint32_t RX_DMA_COUNT   = 0xFFFFFFFFu;         /**< Transfers per arm, rearmed from the DMA IRQ */
+  static constexpr int64_t  RX_POLL_US     = 1000;                /**< Ring drain period */
+  static constexpr size_t   RX_FLUSH_LEVEL = RX_RING_SIZE / 2;    /**< Drain a partial frame past this fill level */
+  static constexpr uint8_t  FRAME_DELIM    = 0x00;                /**< COBS frame terminator */
+  static constexpr uint64_t BITS_PER_CHAR  = 10;                  /**< 8N1 framing */
+  static constexpr size_t   RX_STAMP_DEPTH = 8;                   /**< Frame arrival times held until claimed */
+
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  struct FrameStamp
+  {
+    uint32_t end; /**< Bytes handed to the RX buffer up to and including the delimiter */
+    uint32_t us;  /**< Time the delimiter finished arriving */
+  };
+
   /*---------------------------------------------------------------------------
   Static Data
   ---------------------------------------------------------------------------*/
@@ -32,6 +63,342 @@ namespace HW::UART
   static etl::bip_buffer_spsc_atomic<uint8_t, 512> s_debug_tx_buffer;
   static etl::bip_buffer_spsc_atomic<uint8_t, 512> s_debug_rx_buffer;
 
+  static uint32_t s_baud_rate[ Channel::NUM_OPTIONS ];
+
+  alignas( RX_RING_SIZE ) static uint8_t s_rx_ring[ RX_RING_SIZE ];     /**< DMA receive ring for the BMS channel */
+  static int                             s_rx_dma;                      /**< DMA channel draining the BMS RX FIFO */
+  static repeating_timer_t               s_rx_timer;                    /**< Periodic ring drain */
+  static volatile uint32_t               s_rx_base;                     /**< Bytes received before the current DMA arm */
+  static uint32_t                        s_rx_consumed;                 /**< Bytes moved out of the ring */
+  static uint32_t                        s_rx_scanned;                  /**< Bytes checked for a frame delimiter */
+  static uint32_t                        s_rx_last;                     /**< Bytes received at the previous drain */
+  static uint32_t                        s_rx_last_us;                  /**< Time of the previous drain */
+  static bool                            s_rx_mid_frame;                /**< Previous drain ended part way into a frame */
+  static uint32_t                        s_rx_frame_start;              /**< Bytes received before the current frame began */
+  static bool                            s_rx_resync;                   /**< Current frame started before data was lost */
+  static volatile uint32_t               s_rx_overruns;                 /**< Times ring data was lost */
+  static uint32_t                        s_rx_overruns_taken;           /**< Value of s_rx_overruns at the last check */
+  static volatile uint32_t               s_rx_bad_frames;               /**< Frames with broken COBS framing */
+  static uint32_t                        s_rx_bad_frames_taken;         /**< Value of s_rx_bad_frames at the last check */
+  static uint32_t                        s_rx_delivered;                /**< Bytes handed to the serial driver's RX buffer */
+  static FrameStamp                      s_rx_stamps[ RX_STAMP_DEPTH ]; /**< Unclaimed frame arrivals, oldest first */
+  static size_t                          s_rx_stamp_head;               /**< Index of the oldest stamp */
+  static size_t                          s_rx_stamp_count;              /**< Number of stamps held */
+
+  /*---------------------------------------------------------------------------
+  Private Functions
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Rearms the receive DMA once it runs out of transfers. At 2 Mbaud
+   * this only happens every few hours, but without it the ring stops filling.
+   */
+  static void rx_dma_irq_handler()
+  {
+    if( !dma_channel_get_irq1_status( s_rx_dma ) )
+    {
+      return;
+    }
+
+    dma_channel_acknowledge_irq1( s_rx_dma );
+    s_rx_base = s_rx_base + RX_DMA_COUNT;
+    dma_channel_set_trans_count( s_rx_dma, RX_DMA_COUNT, true );
+  }
+
+
+  /**
+   * @brief Time it takes a number of characters to shift in at the BMS rate
+   *
+   * @param chars   Number of characters
+   * @return uint32_t Microseconds
+   */
+  static inline uint32_t chars_to_us( const uint32_t chars )
+  {
+    return static_cast<uint32_t>( ( chars * BITS_PER_CHAR * 1'000'000u ) / s_baud_rate[ UART_BMS ] );
+  }
+
+
+  /**
+   * @brief Walks the COBS code bytes of a received frame. On a clean line the
+   * chain of block lengths lands exactly on the delimiter. Anything else means
+   * bytes were lost or corrupted and the frame won't decode.
+   *
+   * @param start     Stream offset of the first byte of the frame
+   * @param delim     Stream offset of the frame delimiter
+   * @param received  Stream offset the DMA has written up to
+   * @return true     Framing is intact, or the frame is too old to check
+   * @return false    Framing is broken
+   */
+  static bool cobs_intact( const uint32_t start, const uint32_t delim, const uint32_t received )
+  {
+    /*-------------------------------------------------------------------------
+    The DMA keeps writing while this runs, so stay well clear of the bytes it
+    is about to reuse
+    -------------------------------------------------------------------------*/
+    if( ( received - start ) > RX_FLUSH_LEVEL )
+    {
+      return true;
+    }
+
+    uint32_t pos = start;
+    while( static_cast<int32_t>( delim - pos ) > 0 )
+    {
+      const uint8_t code = s_rx_ring[ pos & ( RX_RING_SIZE - 1u ) ];
+      if( code == FRAME_DELIM )
+      {
+        return false;
+      }
+
+      pos += code;
+    }
+
+    return pos == delim;
+  }
+
+
+  /**
+   * @brief Bound when a frame delimiter arrived using the DMA count at this
+   * drain and the previous one. It can't have landed sooner than the bytes
+   * ahead of it take to shift in after the previous drain, nor later than the
+   * bytes behind it allow before this one. If the line has been busy since the
+   * previous drain, the early bound is good to a character. Otherwise the
+   * frame started somewhere in between and the middle of the bounds halves
+   * the worst case error.
+   *
+   * @param end       Stream offset just past the delimiter
+   * @param received  Stream offset the DMA has written up to
+   * @param now_us    Time of this drain
+   * @param busy      Line has been busy since the previous drain
+   * @return uint32_t Hardware timer value in microseconds
+   */
+  static uint32_t delim_time_us( const uint32_t end, const uint32_t received, const uint32_t now_us, const bool busy )
+  {
+    const uint32_t early = s_rx_last_us + chars_to_us( end - s_rx_last );
+    const uint32_t late  = now_us - chars_to_us( received - end );
+
+    if( static_cast<int32_t>( late - early ) <= 0 )
+    {
+      return late;
+    }
+    else if( busy )
+    {
+      return early;
+    }
+    else
+    {
+      return early + ( ( late - early ) / 2u );
+    }
+  }
+
+
+  /**
+   * @brief Records when a frame arrived. If nobody has claimed the oldest
+   * stamp by now, it is dropped to make room.
+   *
+   * @param end   RX buffer offset just past the frame delimiter
+   * @param us    Arrival time of the delimiter
+   */
+  static void push_stamp( const uint32_t end, const uint32_t us )
+  {
+    if( s_rx_stamp_count == RX_STAMP_DEPTH )
+    {
+      s_rx_stamp_head = ( s_rx_stamp_head + 1u ) % RX_STAMP_DEPTH;
+      s_rx_stamp_count--;
+    }
+
+    FrameStamp &stamp = s_rx_stamps[ ( s_rx_stamp_head + s_rx_stamp_count ) % RX_STAMP_DEPTH ];
+    stamp.end         = end;
+    stamp.us          = us;
+    s_rx_stamp_count++;
+  }
+
+
+  /**
+   * @brief Checks if the RPC server has read a frame out of the RX buffer.
+   * Call with interrupts disabled so the drain can't move the buffer mid-check.
+   *
+   * @param stamp   Frame to check
+   * @return true   The whole frame has been read
+   */
+  static bool stamp_read( const FrameStamp &stamp )
+  {
+    const uint32_t read = s_rx_delivered - static_cast<uint32_t>( s_bms_rx_buffer.size() );
+    return static_cast<int32_t>( read - stamp.end ) >= 0;
+  }
+
+
+  /**
+   * @brief Moves received bytes from the DMA ring into the serial driver's RX
+   * buffer. Data is held back until a COBS delimiter arrives, the line goes
+   * idle for a poll period or the ring is half full, so the RPC server sees
+   * whole frames instead of fragments.
+   *
+   * @param rt  Unused
+   * @return true   Keep the timer running
+   */
+  static bool rx_drain( repeating_timer_t *rt )
+  {
+    ( void )rt;
+
+    const uint32_t received = s_rx_base + ( RX_DMA_COUNT - dma_channel_hw_addr( s_rx_dma )->transfer_count );
+    const uint32_t now_us   = time_us_32();
+    uint32_t       pending  = received - s_rx_consumed;
+
+    /*-------------------------------------------------------------------------
+    The ring wrapped over data that was never drained. Whatever is left can't
+    be trusted, so drop it and let the frame CRC sort out the rest.
+    -------------------------------------------------------------------------*/
+    if( pending > RX_RING_SIZE )
+    {
+      s_rx_consumed    = received;
+      s_rx_scanned     = received;
+      s_rx_last        = received;
+      s_rx_last_us     = now_us;
+      s_rx_mid_frame   = false;
+      s_rx_frame_start = received;
+      s_rx_resync      = true;
+      s_rx_overruns    = s_rx_overruns + 1u;
+
+      /*-----------------------------------------------------------------------
+      Frames dropped with the ring never reach the RX buffer
+      -----------------------------------------------------------------------*/
+      while( s_rx_stamp_count )
+      {
+        const FrameStamp &newest = s_rx_stamps[ ( s_rx_stamp_head + s_rx_stamp_count - 1u ) % RX_STAMP_DEPTH ];
+        if( static_cast<int32_t>( newest.end - s_rx_delivered ) <= 0 )
+        {
+          break;
+        }
+
+        s_rx_stamp_count--;
+      }
+
+      return true;
+    }
+
+    /*-------------------------------------------------------------------------
+    Find every frame end in the bytes that arrived since the last poll and
+    check each frame's COBS framing on the way. The first frame after lost
+    data started somewhere unknown, so it can't be judged. Each frame gets an
+    arrival stamp tied to where it ends in the RX buffer, so the one the RPC
+    server is dispatching can be told apart from any that arrived after it.
+    If the sender was part way into a frame at the previous drain, the line
+    has been busy up to the first delimiter.
+    -------------------------------------------------------------------------*/
+    bool frame_end = false;
+
+    while( s_rx_scanned != received )
+    {
+      const size_t   idx = s_rx_scanned & ( RX_RING_SIZE - 1u );
+      const size_t   len = etl::min<size_t>( received - s_rx_scanned, RX_RING_SIZE - idx );
+      const uint8_t *hit = static_cast<const uint8_t *>( memchr( &s_rx_ring[ idx ], FRAME_DELIM, len ) );
+
+      if( !hit )
+      {
+        s_rx_scanned += len;
+        continue;
+      }
+
+      const uint32_t delim = s_rx_scanned + static_cast<uint32_t>( hit - &s_rx_ring[ idx ] );
+      if( !s_rx_resync && !cobs_intact( s_rx_frame_start, delim, received ) )
+      {
+        s_rx_bad_frames = s_rx_bad_frames + 1u;
+      }
+
+      push_stamp( s_rx_delivered + ( delim + 1u - s_rx_consumed ),
+                  delim_time_us( delim + 1u, received, now_us, !frame_end && s_rx_mid_frame ) );
+
+      frame_end        = true;
+      s_rx_frame_start = delim + 1u;
+      s_rx_scanned     = delim + 1u;
+      s_rx_resync      = false;
+    }
+
+    const bool idle = ( received == s_rx_last );
+    s_rx_last       = received;
+    s_rx_last_us    = now_us;
+    s_rx_mid_frame  = ( s_rx_frame_start != received );
+
+    if( !pending || !( frame_end || idle || ( pending >= RX_FLUSH_LEVEL ) ) )
+    {
+      return true;
+    }
+
+    /*-------------------------------------------------------------------------
+    Copy out in contiguous runs. Anything that doesn't fit stays in the ring
+    for the next poll.
+    -------------------------------------------------------------------------*/
+    while( pending )
+    {
+      const size_t idx = s_rx_consumed & ( RX_RING_SIZE - 1u );
+      auto         dst = s_bms_rx_buffer.write_reserve( etl::min<size_t>( pending, RX_RING_SIZE - idx ) );
+
+      if( dst.empty() )
+      {
+        break;
+      }
+
+      memcpy( dst.data(), &s_rx_ring[ idx ], dst.size() );
+      s_bms_rx_buffer.write_commit( dst );
+
+      s_rx_consumed += dst.size();
+      s_rx_delivered += dst.size();
+      pending -= dst.size();
+    }
+
+    return true;
+  }
+
+
+  /**
+   * @brief Switches the BMS channel receive path from per-byte interrupts to
+   * a DMA ring. The Pico serial backend fills the RX buffer from the UART
+   * interrupt, so that is masked and the ring drain becomes the only producer.
+   * Transmit already goes out by DMA, one encoded frame per write.
+   *
+   * @param uart  BMS UART peripheral
+   */
+  static void start_rx_dma( uart_inst_t *const uart )
+  {
+    uart_hw_t *const hw = uart_get_hw( uart );
+
+    hw_clear_bits( &hw->imsc, UART_UARTIMSC_RXIM_BITS | UART_UARTIMSC_RTIM_BITS );
+
+    s_rx_base     = 0;
+    s_rx_consumed = 0;
+    s_rx_scanned  = 0;
+    s_rx_last     = 0;
+    s_rx_last_us  = time_us_32();
+    s_rx_dma      = dma_claim_unused_channel( true );
+
+    s_rx_frame_start      = 0;
+    s_rx_mid_frame        = false;
+    s_rx_resync           = true;
+    s_rx_overruns         = 0;
+    s_rx_overruns_taken   = 0;
+    s_rx_bad_frames       = 0;
+    s_rx_bad_frames_taken = 0;
+    s_rx_delivered        = 0;
+    s_rx_stamp_head       = 0;
+    s_rx_stamp_count      = 0;
+
+    dma_channel_config cfg = dma_channel_get_default_config( s_rx_dma );
+    channel_config_set_transfer_data_size( &cfg, DMA_SIZE_8 );
+    channel_config_set_dreq( &cfg, uart_get_dreq( uart, false ) );
+    channel_config_set_read_increment( &cfg, false );
+    channel_config_set_write_increment( &cfg, true );
+    channel_config_set_ring( &cfg, true, RX_RING_BITS );
+
+    dma_channel_set_irq1_enabled( s_rx_dma, true );
+    irq_add_shared_handler( DMA_IRQ_1, rx_dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY );
+    irq_set_enabled( DMA_IRQ_1, true );
+
+    dma_channel_configure( s_rx_dma, &cfg, s_rx_ring, &hw->dr, RX_DMA_COUNT, true );
+    hw_set_bits( &hw->dmacr, UART_UARTDMACR_RXDMAE_BITS );
+
+    mbed_assert( add_repeating_timer_us( -RX_POLL_US, rx_drain, nullptr, &s_rx_timer ) );
+  }
+
   /*---------------------------------------------------------------------------
   Public Functions
   ---------------------------------------------------------------------------*/
@@ -53,7 +420,7 @@ namespace HW::UART
 
     uart_cfg.reset();
     uart_cfg.uart        = io_cfg.uart[ UART_BMS ].pHw;
-    uart_cfg.baudrate    = 115200;
+    uart_cfg.baudrate    = DEFAULT_BAUD;
     uart_cfg.data_bits   = 8;
     uart_cfg.stop_bits   = 1;
     uart_cfg.parity      = UART_PARITY_NONE;
@@ -69,6 +436,8 @@ namespace HW::UART
     serial_cfg.txBuffer = &s_bms_tx_buffer;
 
     mbed_assert( s_bms_driver.open( serial_cfg ) );
+    s_baud_rate[ UART_BMS ] = DEFAULT_BAUD;
+    start_rx_dma( io_cfg.uart[ UART_BMS ].pHw );
 
     /*-------------------------------------------------------------------------
     Configure the Debug UART channel
@@ -77,7 +446,7 @@ namespace HW::UART
     {
       uart_cfg.reset();
       uart_cfg.uart        = io_cfg.uart[ UART_DEBUG ].pHw;
-      uart_cfg.baudrate    = 115200;
+      uart_cfg.baudrate    = DEFAULT_BAUD;
       uart_cfg.data_bits   = 8;
       uart_cfg.stop_bits   = 1;
       uart_cfg.parity      = UART_PARITY_NONE;
@@ -92,6 +461,7 @@ namespace HW::UART
       serial_cfg.txBuffer = &s_debug_tx_buffer;
 
       mbed_assert( s_debug_driver.open( serial_cfg ) );
+      s_baud_rate[ UART_DEBUG ] = DEFAULT_BAUD;
     }
   }
 
@@ -114,4 +484,183 @@ namespace HW::UART
     return s_bms_driver;
   }
 
+
+  bool isTxIdle( const Channel channel )
+  {
+    if( channel >= Channel::NUM_OPTIONS )
+    {
+      return true;
+    }
+
+    /*-------------------------------------------------------------------------
+    Bytes the serial driver hasn't handed to the hardware yet
+    -------------------------------------------------------------------------*/
+    const bool queued = ( channel == UART_BMS ) ? !s_bms_tx_buffer.empty() : !s_debug_tx_buffer.empty();
+    if( queued )
+    {
+      return false;
+    }
+
+    /*-------------------------------------------------------------------------
+    The driver owns its TX DMA channel, so look for any busy channel paced by
+    this UART's TX request line
+    -------------------------------------------------------------------------*/
+    uart_inst_t *const uart = BSP::getIOConfig().uart[ channel ].pHw;
+    const uint32_t     dreq = uart_get_dreq( uart, true );
+
+    for( uint dma_ch = 0; dma_ch < NUM_DMA_CHANNELS; dma_ch++ )
+    {
+      const uint32_t treq = ( dma_hw->ch[ dma_ch ].al1_ctrl & DMA_CH0_CTRL_TRIG_TREQ_SEL_BITS ) >> DMA_CH0_CTRL_TRIG_TREQ_SEL_LSB;
+      if( ( treq == dreq ) && dma_channel_is_busy( dma_ch ) )
+      {
+        return false;
+      }
+    }
+
+    /*-------------------------------------------------------------------------
+    Finally the FIFO and shift register
+    -------------------------------------------------------------------------*/
+    return ( uart_get_hw( uart )->fr & UART_UARTFR_BUSY_BITS ) == 0;
+  }
+
+
+  bool setBaudRate( const Channel channel, const uint32_t baud )
+  {
+    if( ( channel >= Channel::NUM_OPTIONS ) || !baud )
+    {
+      return false;
+    }
+
+    uart_inst_t *const uart = BSP::getIOConfig().uart[ channel ].pHw;
+
+    /*-------------------------------------------------------------------------
+    Check the divider can get close enough before touching the hardware. The
+    PL011 divider is 16.6 fixed point off the peripheral clock.
+    -------------------------------------------------------------------------*/
+    const uint32_t peri_hz = clock_get_hz( clk_peri );
+    const uint32_t divider = ( ( 8u * peri_hz ) / baud ) + 1u;
+    const uint32_t ibrd    = divider >> 7;
+
+    if( ( ibrd == 0 ) || ( ibrd >= 65535 ) )
+    {
+      return false;
+    }
+
+    const uint32_t fbrd   = ( divider & 0x7f ) >> 1;
+    const uint32_t actual = ( 4u * peri_hz ) / ( 64u * ibrd + fbrd );
+    const uint32_t error  = ( actual > baud ) ? ( actual - baud ) : ( baud - actual );
+
+    if( ( error * 50u ) > baud )
+    {
+      return false;
+    }
+
+    /*-------------------------------------------------------------------------
+    Let the FIFO and shift register empty so the last frame goes out whole
+    -------------------------------------------------------------------------*/
+    uart_tx_wait_blocking( uart );
+    uart_set_baudrate( uart, baud );
+    s_baud_rate[ channel ] = baud;
+
+    return true;
+  }
+
+
+  uint32_t getBaudRate( const Channel channel )
+  {
+    return ( channel < Channel::NUM_OPTIONS ) ? s_baud_rate[ channel ] : 0;
+  }
+
+
+  uint32_t takeLineErrors( const Channel channel )
+  {
+    if( channel >= Channel::NUM_OPTIONS )
+    {
+      return 0;
+    }
+
+    /*-------------------------------------------------------------------------
+    The receive status bits are sticky until cleared by any write
+    -------------------------------------------------------------------------*/
+    uart_hw_t *const hw     = uart_get_hw( BSP::getIOConfig().uart[ channel ].pHw );
+    const uint32_t   status = hw->rsr & UART_UARTRSR_BITS;
+    uint32_t         errors = static_cast<uint32_t>( __builtin_popcount( status ) );
+
+    if( status )
+    {
+      hw->rsr = 0;
+    }
+
+    /*-------------------------------------------------------------------------
+    Data lost to a full DMA ring counts the same as a FIFO overrun
+    -------------------------------------------------------------------------*/
+    if( channel == UART_BMS )
+    {
+      const uint32_t overruns = s_rx_overruns;
+      errors += overruns - s_rx_overruns_taken;
+      s_rx_overruns_taken = overruns;
+    }
+
+    return errors;
+  }
+
+
+  uint32_t takeFrameErrors( const Channel channel )
+  {
+    if( channel != UART_BMS )
+    {
+      return 0;
+    }
+
+    const uint32_t bad_frames = s_rx_bad_frames;
+    const uint32_t errors     = bad_frames - s_rx_bad_frames_taken;
+    s_rx_bad_frames_taken     = bad_frames;
+
+    return errors;
+  }
+
+
+  uint32_t takeFrameTimeUs( const Channel channel )
+  {
+    if( channel != UART_BMS )
+    {
+      return 0;
+    }
+
+    uint32_t arrival_us = 0;
+
+    mb::irq::disable_interrupts();
+    {
+      const FrameStamp &oldest = s_rx_stamps[ s_rx_stamp_head ];
+      if( s_rx_stamp_count && stamp_read( oldest ) )
+      {
+        arrival_us       = oldest.us;
+        s_rx_stamp_head  = ( s_rx_stamp_head + 1u ) % RX_STAMP_DEPTH;
+        s_rx_stamp_count = s_rx_stamp_count - 1u;
+      }
+    }
+    mb::irq::enable_interrupts();
+
+    return arrival_us;
+  }
+
+
+  void releaseFrames( const Channel channel )
+  {
+    if( channel != UART_BMS )
+    {
+      return;
+    }
+
+    mb::irq::disable_interrupts();
+    {
+      while( s_rx_stamp_count && stamp_read( s_rx_stamps[ s_rx_stamp_head ] ) )
+      {
+        s_rx_stamp_head  = ( s_rx_stamp_head + 1u ) % RX_STAMP_DEPTH;
+        s_rx_stamp_count = s_rx_stamp_count - 1u;
+      }
+    }
+    mb::irq::enable_interrupts();
+  }
+
 }  // namespace HW::UART
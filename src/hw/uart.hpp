@@ -24,6 +24,12 @@ Includes
 
 namespace HW::UART
 {
+  /*---------------------------------------------------------------------------
+  Constants
+  ---------------------------------------------------------------------------*/
+
+  static constexpr uint32_t DEFAULT_BAUD = 115200; /**< Rate every channel boots at */
+
   /*---------------------------------------------------------------------------
   Enumerations
   ---------------------------------------------------------------------------*/
@@ -53,6 +59,78 @@ namespace HW::UART
    */
   mb::hw::serial::SerialDriver &getDriver( const Channel channel );
 
+  /**
+   * @brief Checks if a channel has nothing left to send. Covers bytes still
+   * queued in the serial driver, a TX DMA transfer in flight, and the FIFO and
+   * shift register.
+   *
+   * @param channel  UART channel to check
+   * @return true    The line is quiet
+   * @return false   Data is still on its way out
+   */
+  bool isTxIdle( const Channel channel );
+
+  /**
+   * @brief Change the line rate of a channel. Anything still in the hardware
+   * FIFO is sent at the old rate first, but bytes queued in the serial driver
+   * are not, so callers should wait for isTxIdle() before switching.
+   *
+   * @param channel  UART channel to change
+   * @param baud     New line rate
+   * @return true    The hardware can run within 2% of the requested rate
+   * @return false   The rate is not achievable, nothing was changed
+   */
+  bool setBaudRate( const Channel channel, const uint32_t baud );
+
+  /**
+   * @brief Get the line rate a channel is running at
+   *
+   * @param channel  UART channel to query
+   * @return uint32_t
+   */
+  uint32_t getBaudRate( const Channel channel );
+
+  /**
+   * @brief Count receive line errors (framing, parity, break, overrun) since
+   * the last call, and clear them. The hardware latches each kind of error,
+   * so a burst of the same kind between calls counts once.
+   *
+   * @param channel  UART channel to check
+   * @return uint32_t Number of errors seen, 0 if the line has been clean
+   */
+  uint32_t takeLineErrors( const Channel channel );
+
+  /**
+   * @brief Count received frames since the last call whose COBS framing was
+   * broken, meaning the RPC layer will fail to decode them
+   *
+   * @param channel  UART channel to check
+   * @return uint32_t Number of malformed frames
+   */
+  uint32_t takeFrameErrors( const Channel channel );
+
+  /**
+   * @brief Claim the arrival time of the oldest frame the RPC server has read
+   * out of the receive buffer. The RPC server dispatches frames in the order
+   * they arrive, so calling this once per dispatched request pairs each
+   * request with its own frame, not whatever arrived after it. The time is
+   * bounded from the receive DMA progress between drains, so it does not
+   * depend on when the receive path got to the frame.
+   *
+   * @param channel  UART channel to check
+   * @return uint32_t Hardware timer value in microseconds, 0 if not tracked
+   */
+  uint32_t takeFrameTimeUs( const Channel channel );
+
+  /**
+   * @brief Drop the arrival times of every frame the RPC server has read.
+   * Call once the server has run, so frames it read without dispatching to
+   * a service don't pair with later requests.
+   *
+   * @param channel  UART channel to release
+   */
+  void releaseFrames( const Channel channel );
+
 }  // namespace HW::UART
 
 #endif  /* !ICHNAEA_HW_UART_HPP */
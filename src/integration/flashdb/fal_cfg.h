@@ -29,6 +29,7 @@ Literals
 #define ICHNAEA_DB_PDI_RGN_NAME "pdi"
 #define ICHNAEA_DB_CAL_RGN_NAME "cal"
 #define ICHNAEA_DB_LOG_RGN_NAME "log"
+#define ICHNAEA_DB_WEAR_RGN_NAME "wear"
 
 /* PDI Region */
 #define ICHNAEA_DB_PDI_RGN_START ( 0 )
@@ -40,7 +41,11 @@ Literals
 
 /* LOG Region */
 #define ICHNAEA_DB_LOG_RGN_START ( ICHNAEA_DB_CAL_RGN_START + ICHNAEA_DB_CAL_RGN_SIZE )
-#define ICHNAEA_DB_LOG_RGN_SIZE ( 2048 * 1024 )
+#define ICHNAEA_DB_LOG_RGN_SIZE ( ( 2048 - 64 ) * 1024 )
+
+/* WEAR Region, carved from the tail of LOG so no region start moves */
+#define ICHNAEA_DB_WEAR_RGN_START ( ICHNAEA_DB_LOG_RGN_START + ICHNAEA_DB_LOG_RGN_SIZE )
+#define ICHNAEA_DB_WEAR_RGN_SIZE ( 64 * 1024 )
 
 extern const struct fal_flash_dev fdb_nor_flash0;
 #define FAL_FLASH_DEV_TABLE \
@@ -54,6 +59,7 @@ extern const struct fal_flash_dev fdb_nor_flash0;
   { FAL_PART_MAGIC_WORD, ICHNAEA_DB_PDI_RGN_NAME, ICHNAEA_DB_FLASH_DEV_NAME,  ICHNAEA_DB_PDI_RGN_START, ICHNAEA_DB_PDI_RGN_SIZE, 0 }, \
   { FAL_PART_MAGIC_WORD,  ICHNAEA_DB_CAL_RGN_NAME, ICHNAEA_DB_FLASH_DEV_NAME, ICHNAEA_DB_CAL_RGN_START, ICHNAEA_DB_CAL_RGN_SIZE, 0 }, \
   { FAL_PART_MAGIC_WORD,  ICHNAEA_DB_LOG_RGN_NAME, ICHNAEA_DB_FLASH_DEV_NAME, ICHNAEA_DB_LOG_RGN_START, ICHNAEA_DB_LOG_RGN_SIZE, 0 }, \
+  { FAL_PART_MAGIC_WORD, ICHNAEA_DB_WEAR_RGN_NAME, ICHNAEA_DB_FLASH_DEV_NAME, ICHNAEA_DB_WEAR_RGN_START, ICHNAEA_DB_WEAR_RGN_SIZE, 0 }, \
 }
 
 #ifdef __cplusplus
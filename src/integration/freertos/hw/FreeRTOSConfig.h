@@ -149,8 +149,9 @@
 /* Each task has an array of task notifications.
  * configTASK_NOTIFICATION_ARRAY_ENTRIES sets the number of indexes in the
  * array. See https://www.freertos.org/RTOS-task-notifications.html  Defaults to
- * 1 if left undefined. */
-#define configTASK_NOTIFICATION_ARRAY_ENTRIES      1
+ * 1 if left undefined. Index 0 is left to the OSAL, index 1 is used by the
+ * NOR flash driver to signal DMA completion. */
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES      2
 
 /* configQUEUE_REGISTRY_SIZE sets the maximum number of queues and semaphores
  * that can be referenced from the queue registry.  Only required when using a
@@ -12,6 +12,7 @@
 Includes
 -----------------------------------------------------------------------------*/
 #include <src/bsp/board_map.hpp>
+#include <src/system/system_logging.hpp>
 #include <mbedutils/interfaces/assert_intf.hpp>
 #include <mbedutils/interfaces/system_intf.hpp>
 #include <mbedutils/logging.hpp>
@@ -35,6 +36,7 @@ namespace mb::assert
     -------------------------------------------------------------------------*/
     if( halt )
     {
+      Logging::flush();
       mb::util::breakpoint();
       mb::system::intf::warm_reset();
     }
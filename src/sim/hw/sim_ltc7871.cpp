@@ -14,6 +14,7 @@
 Includes
 -----------------------------------------------------------------------------*/
 #include <cstdint>
+#include <cstring>
 #include <mbedutils/drivers/hardware/analog.hpp>
 #include <mbedutils/logging.hpp>
 #include <src/bsp/board_map.hpp>
@@ -36,6 +37,7 @@ namespace HW::LTC7871
   static float      s_iout_ref;
   static float      s_phase_iout_ref;
   static DriverMode s_driver_mode;
+  static uint8_t    s_registers[ REG_MAX_ADDR + 1u ];
 
   /*---------------------------------------------------------------------------
   Private Functions
@@ -83,6 +85,9 @@ namespace HW::LTC7871
     s_phase_iout_ref  = 0.0f;
     s_driver_mode     = DriverMode::DISABLED;
 
+    memset( s_registers, 0, sizeof( s_registers ) );
+    s_registers[ REG_MFR_CHIP_CTRL ] = MFR_CHIP_CTRL_WP_Enable;
+
     /*-------------------------------------------------------------------------
     Register ADC measurement callbacks
     -------------------------------------------------------------------------*/
@@ -166,4 +171,56 @@ namespace HW::LTC7871
   void runStateUpdater()
   {
   }
+
+
+  void saveRetainedState( RetainedState &state )
+  {
+    /*-------------------------------------------------------------------------
+    The simulator has no measured operating point, only the references
+    -------------------------------------------------------------------------*/
+    state                     = {};
+    state.msr_output_voltage  = s_vout_ref;
+    state.msr_average_current = s_iout_ref;
+  }
+
+
+  RegStatus readRegisters( const uint8_t first, uint8_t *const values, const size_t count )
+  {
+    if( !values || !count || ( first < REG_MIN_ADDR ) || ( ( first + count - 1u ) > REG_MAX_ADDR ) )
+    {
+      return RegStatus::INVALID_ADDR;
+    }
+
+    memcpy( values, &s_registers[ first ], count );
+    return RegStatus::OK;
+  }
+
+
+  RegStatus writeRegister( const uint8_t reg, const uint8_t value, uint8_t &readback )
+  {
+    if( ( reg < REG_MIN_ADDR ) || ( reg > REG_MAX_ADDR ) )
+    {
+      return RegStatus::INVALID_ADDR;
+    }
+
+    const uint8_t mask = direct_write_mask( reg );
+    if( !mask )
+    {
+      return RegStatus::READ_ONLY;
+    }
+
+    if( value & ~mask )
+    {
+      return RegStatus::BAD_VALUE;
+    }
+
+    if( s_driver_mode != DriverMode::DISABLED )
+    {
+      return RegStatus::BAD_MODE;
+    }
+
+    s_registers[ reg ] = value;
+    readback           = value;
+    return RegStatus::OK;
+  }
 }    // namespace HW::LTC7871
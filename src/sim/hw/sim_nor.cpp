@@ -1,9 +1,13 @@
 /******************************************************************************
  *  File Name:
- *    nor.cpp
+ *    sim_nor.cpp
  *
  *  Description:
- *    NOR interface for supporting database storage
+ *    Simulated NOR flash backed by a memory mapped image file.
+ *
+ *    Reads are a memcpy out of the mapping. Programs can only clear bits,
+ *    exactly like the real device, and erases set whole sectors back to
+ *    0xFF. Every program and erase is counted so flash wear can be measured.
  *
  *  2024 | Brandon Braun | brandonbraun653@protonmail.com
  *****************************************************************************/
@@ -11,17 +15,87 @@
 /*-----------------------------------------------------------------------------
 Includes
 -----------------------------------------------------------------------------*/
-#include "mbedutils/drivers/memory/nvm/nor_flash.hpp"
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <mbedutils/assert.hpp>
+#include <mbedutils/logging.hpp>
+#include <mbedutils/osal.hpp>
+#include <mbedutils/threading.hpp>
 #include <src/hw/nor.hpp>
-#include <nor_flash_file.hpp>
+#include <src/hw/nor_cache.hpp>
+#include <src/sim/hw/sim_nor.hpp>
+#include <src/system/system_flash_stats.hpp>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace HW::NOR
 {
+  /*---------------------------------------------------------------------------
+  Constants
+  ---------------------------------------------------------------------------*/
+
+  static constexpr const char *IMAGE_FILE  = "nor_flash.bin";
+  static constexpr const char *SYNC_ENV    = "ICHNAEA_SIM_NOR_SYNC";
+  static constexpr size_t      NUM_SECTORS = DEVICE_SIZE / ERASE_BLOCK_SIZE;
+
   /*---------------------------------------------------------------------------
   Private Data
   ---------------------------------------------------------------------------*/
 
-  static fake::memory::nor::FileFlash mNorFlash;
+  static mb::osal::mb_recursive_mutex_t                     s_nor_mutex;
+  static PageCache<CACHE_SETS, CACHE_WAYS, CACHE_LINE_SIZE> s_cache;
+  static uint8_t                                           *s_image;
+  static bool                                               s_sync_on_flush;
+  static SimDeviceStats                                     s_stats;
+  static std::array<uint32_t, NUM_SECTORS>                  s_erase_count;
+
+  /*---------------------------------------------------------------------------
+  Private Functions
+  ---------------------------------------------------------------------------*/
+
+  static inline bool in_range( const long offset, const size_t size )
+  {
+    return s_image && ( offset >= 0 ) && ( ( static_cast<size_t>( offset ) + size ) <= DEVICE_SIZE );
+  }
+
+
+  static inline uint64_t now_us()
+  {
+    using namespace std::chrono;
+    return static_cast<uint64_t>( duration_cast<microseconds>( steady_clock::now().time_since_epoch() ).count() );
+  }
+
+
+  static int device_read( long offset, uint8_t* buf, size_t size )
+  {
+    const uint64_t start_us = now_us();
+    memcpy( buf, s_image + offset, size );
+    System::FlashStats::recordRead( size, static_cast<uint32_t>( now_us() - start_us ) );
+    return 0;
+  }
+
+
+  /**
+   * @brief Makes a program/erase durable if the environment asked for it
+   */
+  static void flush( const long offset, const size_t size )
+  {
+    if( !s_sync_on_flush )
+    {
+      return;
+    }
+
+    /*-------------------------------------------------------------------------
+    msync needs a page aligned start address
+    -------------------------------------------------------------------------*/
+    const size_t page  = static_cast<size_t>( sysconf( _SC_PAGESIZE ) );
+    const size_t start = ( static_cast<size_t>( offset ) / page ) * page;
+    msync( s_image + start, ( static_cast<size_t>( offset ) - start ) + size, MS_SYNC );
+  }
 
   /*---------------------------------------------------------------------------
   Public Functions
@@ -29,30 +103,159 @@ namespace HW::NOR
 
   int init()
   {
-    mb::memory::nor::DeviceConfig flash_cfg;
-    flash_cfg.dev_attr.block_size = ERASE_BLOCK_SIZE;
-    flash_cfg.dev_attr.size = FLASH_ADDR_MAX;
+    mbed_assert( mb::osal::buildRecursiveMutexStrategy( s_nor_mutex ) );
+
+    const char *sync_env = std::getenv( SYNC_ENV );
+    s_sync_on_flush      = sync_env && ( strcmp( sync_env, "1" ) == 0 );
+    s_stats              = {};
+    s_erase_count.fill( 0 );
+
+    /*-------------------------------------------------------------------------
+    Open the image, growing it to the full device size if needed. The newly
+    added space reads back as erased flash.
+    -------------------------------------------------------------------------*/
+    const int fd = open( IMAGE_FILE, O_RDWR | O_CREAT, 0644 );
+    mbed_assert_msg( fd >= 0, "Failed to open %s", IMAGE_FILE );
+
+    struct stat st;
+    mbed_assert( fstat( fd, &st ) == 0 );
+
+    const size_t old_size = static_cast<size_t>( st.st_size );
+    if( old_size < FLASH_ADDR_MAX )
+    {
+      mbed_assert( ftruncate( fd, FLASH_ADDR_MAX ) == 0 );
+    }
+
+    void *map = mmap( nullptr, FLASH_ADDR_MAX, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+    close( fd );
+    mbed_assert_msg( map != MAP_FAILED, "Failed to map %s", IMAGE_FILE );
+
+    s_image = static_cast<uint8_t *>( map );
+    if( old_size < FLASH_ADDR_MAX )
+    {
+      memset( s_image + old_size, 0xFF, FLASH_ADDR_MAX - old_size );
+    }
 
-    mNorFlash.open( "nor_flash.bin", flash_cfg );
     return 0;
   }
 
 
   int read( long offset, uint8_t* buf, size_t size )
   {
-    return ( mb::memory::Status::ERR_OK == mNorFlash.read( offset, buf, size ) ) ? 0 : -1;
+    if( !in_range( offset, size ) )
+    {
+      return -1;
+    }
+
+    mb::thread::RecursiveLockGuard lock( s_nor_mutex );
+    return ( s_cache.read( offset, buf, size, device_read ) < 0 ) ? -1 : static_cast<int>( size );
   }
 
 
   int write( long offset, const uint8_t* buf, size_t size )
   {
-    return ( mb::memory::Status::ERR_OK == mNorFlash.write( offset, buf, size ) ) ? 0 : -1;
+    if( !in_range( offset, size ) )
+    {
+      return -1;
+    }
+
+    mb::thread::RecursiveLockGuard lock( s_nor_mutex );
+    const uint64_t start_us = now_us();
+
+    /*-------------------------------------------------------------------------
+    Programming can only clear bits. Asking to set one is a driver bug on
+    real hardware, so count it rather than silently hiding it.
+    -------------------------------------------------------------------------*/
+    uint8_t *dst = s_image + offset;
+    for( size_t idx = 0; idx < size; idx++ )
+    {
+      if( ~dst[ idx ] & buf[ idx ] )
+      {
+        s_stats.program_conflicts++;
+      }
+
+      dst[ idx ] &= buf[ idx ];
+    }
+
+    s_stats.program_ops++;
+    s_stats.program_bytes += size;
+
+    s_cache.invalidate( offset, size );
+    flush( offset, size );
+
+    System::FlashStats::recordProgram( size, static_cast<uint32_t>( now_us() - start_us ) );
+    return static_cast<int>( size );
   }
 
 
   int erase( long offset, size_t size )
   {
-    return ( mb::memory::Status::ERR_OK == mNorFlash.erase( offset, size ) ) ? 0 : -1;
+    if( !in_range( offset, size ) || ( ( offset % ERASE_BLOCK_SIZE ) != 0 ) || ( ( size % ERASE_BLOCK_SIZE ) != 0 ) )
+    {
+      return -1;
+    }
+
+    mb::thread::RecursiveLockGuard lock( s_nor_mutex );
+    const uint64_t start_us = now_us();
+
+    memset( s_image + offset, 0xFF, size );
+
+    s_cache.invalidate( offset, size );
+    flush( offset, size );
+
+    /*-------------------------------------------------------------------------
+    Spread the time evenly, the whole range went out in one operation
+    -------------------------------------------------------------------------*/
+    const size_t   num_sectors = size / ERASE_BLOCK_SIZE;
+    const uint32_t latency_us  = num_sectors ? static_cast<uint32_t>( ( now_us() - start_us ) / num_sectors ) : 0;
+
+    for( size_t sector = offset / ERASE_BLOCK_SIZE; sector < ( offset + size ) / ERASE_BLOCK_SIZE; sector++ )
+    {
+      s_erase_count[ sector ]++;
+      s_stats.erase_ops++;
+      System::FlashStats::recordErase( static_cast<long>( sector * ERASE_BLOCK_SIZE ), latency_us );
+    }
+
+    return static_cast<int>( size );
+  }
+
+
+  CacheStats getCacheStats()
+  {
+    mb::thread::RecursiveLockGuard lock( s_nor_mutex );
+    return s_cache.stats();
+  }
+
+
+  void resetCacheStats()
+  {
+    mb::thread::RecursiveLockGuard lock( s_nor_mutex );
+    s_cache.resetStats();
+  }
+
+
+  SimDeviceStats getSimDeviceStats()
+  {
+    mb::thread::RecursiveLockGuard lock( s_nor_mutex );
+    return s_stats;
+  }
+
+
+  uint32_t getSimSectorEraseCount( const size_t sector )
+  {
+    mb::thread::RecursiveLockGuard lock( s_nor_mutex );
+    return ( sector < s_erase_count.size() ) ? s_erase_count[ sector ] : 0;
+  }
+
+
+  void syncSimImage()
+  {
+    mb::thread::RecursiveLockGuard lock( s_nor_mutex );
+
+    if( s_image )
+    {
+      msync( s_image, FLASH_ADDR_MAX, MS_SYNC );
+    }
   }
 
 }  // namespace HW::NOR
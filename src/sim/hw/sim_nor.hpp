@@ -0,0 +1,69 @@
+/******************************************************************************
+ *  File Name:
+ *    sim_nor.hpp
+ *
+ *  Description:
+ *    Simulator NOR flash interface
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+#pragma once
+#ifndef ICHNAEA_HW_SIM_NOR_HPP
+#define ICHNAEA_HW_SIM_NOR_HPP
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <cstddef>
+#include <cstdint>
+#include <src/hw/nor.hpp>
+
+namespace HW::NOR
+{
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Program/erase activity seen by the simulated flash since boot
+   */
+  struct SimDeviceStats
+  {
+    uint64_t program_ops;       /**< Calls to write() */
+    uint64_t program_bytes;     /**< Bytes programmed */
+    uint64_t program_conflicts; /**< Bytes that asked for a 0 -> 1 transition without an erase */
+    uint64_t erase_ops;         /**< Sectors erased */
+  };
+
+  /*---------------------------------------------------------------------------
+  Public Functions
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Get a snapshot of the simulated flash activity counters
+   *
+   * @return SimDeviceStats
+   */
+  SimDeviceStats getSimDeviceStats();
+
+  /**
+   * @brief Number of times a sector has been erased since boot
+   *
+   * @param sector  Sector index, ie address / ERASE_BLOCK_SIZE
+   * @return uint32_t
+   */
+  uint32_t getSimSectorEraseCount( const size_t sector );
+
+  /**
+   * @brief Flush the whole flash image to disk.
+   *
+   * Individual programs/erases are only synced as they happen when
+   * ICHNAEA_SIM_NOR_SYNC=1 is set in the environment. Otherwise they are
+   * left to the kernel's writeback until this is called on shutdown.
+   */
+  void syncSimImage();
+
+}  // namespace HW::NOR
+
+#endif  /* !ICHNAEA_HW_SIM_NOR_HPP */
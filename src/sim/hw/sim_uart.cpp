@@ -33,6 +33,8 @@ namespace HW::UART
   static etl::bip_buffer_spsc_atomic<uint8_t, 512> s_debug_tx_buffer;
   static etl::bip_buffer_spsc_atomic<uint8_t, 512> s_debug_rx_buffer;
 
+  static uint32_t s_baud_rate[ Channel::NUM_OPTIONS ] = { DEFAULT_BAUD, DEFAULT_BAUD };
+
   /*---------------------------------------------------------------------------
   Public Functions
   ---------------------------------------------------------------------------*/
@@ -94,4 +96,72 @@ namespace HW::UART
     return s_bms_driver;
   }
 
+
+  bool isTxIdle( const Channel channel )
+  {
+    switch( channel )
+    {
+      case UART_BMS:
+        return s_bms_tx_buffer.empty();
+
+      case UART_DEBUG:
+        return s_debug_tx_buffer.empty();
+
+      default:
+        return true;
+    }
+  }
+
+
+  bool setBaudRate( const Channel channel, const uint32_t baud )
+  {
+    /*-------------------------------------------------------------------------
+    ZMQ pipes have no line rate. Track it so negotiation behaves the same as
+    on hardware.
+    -------------------------------------------------------------------------*/
+    if( ( channel >= Channel::NUM_OPTIONS ) || !baud )
+    {
+      return false;
+    }
+
+    s_baud_rate[ channel ] = baud;
+    return true;
+  }
+
+
+  uint32_t getBaudRate( const Channel channel )
+  {
+    return ( channel < Channel::NUM_OPTIONS ) ? s_baud_rate[ channel ] : 0;
+  }
+
+
+  uint32_t takeLineErrors( const Channel channel )
+  {
+    ( void )channel;
+    return 0;
+  }
+
+
+  uint32_t takeFrameErrors( const Channel channel )
+  {
+    ( void )channel;
+    return 0;
+  }
+
+
+  uint32_t takeFrameTimeUs( const Channel channel )
+  {
+    /*-------------------------------------------------------------------------
+    Frames show up over ZMQ whole, with no line timing to recover
+    -------------------------------------------------------------------------*/
+    ( void )channel;
+    return 0;
+  }
+
+
+  void releaseFrames( const Channel channel )
+  {
+    ( void )channel;
+  }
+
 }    // namespace HW::UART
@@ -11,6 +11,7 @@
 /*-----------------------------------------------------------------------------
 Includes
 -----------------------------------------------------------------------------*/
+#include <src/sim/hw/sim_nor.hpp>
 #include <src/sim/sim_services.hpp>
 #include <src/sim/sim_load.hpp>
 
@@ -30,5 +31,6 @@ namespace SIM
   void shutdown()
   {
     SIM::destroyServices();
+    HW::NOR::syncSimImage();
   }
 }  // namespace SIM
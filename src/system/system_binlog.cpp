@@ -0,0 +1,57 @@
+/******************************************************************************
+ *  File Name:
+ *    system_binlog.cpp
+ *
+ *  Description:
+ *    Binary deferred logging implementation
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <mbedutils/interfaces/time_intf.hpp>
+#include <mbedutils/logging.hpp>
+#include <src/system/system_binlog.hpp>
+
+/*-----------------------------------------------------------------------------
+Linker Symbols
+-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Start of the format string section, emitted by the linker
+ */
+extern "C" const char __start_ichnaea_logfmt[];
+
+namespace Logging::Binary
+{
+  /*---------------------------------------------------------------------------
+  Static Data
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Guarantees the format section exists even if no call site uses the
+   * binary macros, otherwise the __start_ symbol would be undefined.
+   */
+  static const char s_section_anchor[] __attribute__( ( section( ICHNAEA_BINLOG_SECTION ), used ) ) = "";
+
+  /*---------------------------------------------------------------------------
+  Private Functions
+  ---------------------------------------------------------------------------*/
+  namespace Internal
+  {
+    void submit( const mb::logging::Level level, const char *fmt, Record &record )
+    {
+      ( void )s_section_anchor;
+
+      record.header.sync      = SYNC_BYTE;
+      record.header.level     = static_cast<uint8_t>( level );
+      record.header.fmt_id    = static_cast<uint32_t>( fmt - __start_ichnaea_logfmt );
+      record.header.timestamp = static_cast<uint32_t>( mb::time::millis() );
+
+      mb::logging::log( level, reinterpret_cast<const char *>( &record ), recordSize( record ) );
+    }
+  }    // namespace Internal
+
+}    // namespace Logging::Binary
@@ -0,0 +1,314 @@
+/******************************************************************************
+ *  File Name:
+ *    system_binlog.hpp
+ *
+ *  Description:
+ *    Binary deferred logging. Call sites record a format string ID, a time
+ *    stamp and the raw arguments. Formatting into text is done on the host
+ *    using the format strings pulled out of the firmware ELF.
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+#pragma once
+#ifndef ICHNAEA_SYSTEM_BINLOG_HPP
+#define ICHNAEA_SYSTEM_BINLOG_HPP
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <etl/algorithm.h>
+#include <mbedutils/logging.hpp>
+#include <src/bsp/board_map.hpp>
+#include <src/system/system_log_limit.hpp>
+#include <type_traits>
+
+/*-----------------------------------------------------------------------------
+Configuration
+-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Selects binary records for the BLOG_* macros. When disabled they fall
+ * back to the regular text LOG_* macros. The simulator has cycles to spare and
+ * defaults to text so the console stays readable.
+ */
+#ifndef ICHNAEA_BINARY_LOGGING
+#if defined( ICHNAEA_EMBEDDED )
+#define ICHNAEA_BINARY_LOGGING 1
+#else
+#define ICHNAEA_BINARY_LOGGING 0
+#endif
+#endif
+
+/**
+ * @brief Linker section holding every binary log format string. Must be a
+ * valid C identifier so the linker emits a __start_ symbol for it.
+ */
+#define ICHNAEA_BINLOG_SECTION "ichnaea_logfmt"
+
+namespace Logging::Binary
+{
+  /*---------------------------------------------------------------------------
+  Constants
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief First byte of every record. Text logs never contain a NUL, so this
+   * lets a decoder pick binary records out of a mixed stream.
+   */
+  static constexpr uint8_t SYNC_BYTE = 0x00;
+
+  /**
+   * @brief Largest encoded record, header included
+   */
+  static constexpr size_t MAX_RECORD_SIZE = 64;
+
+  /**
+   * @brief Longest string argument copied into a record
+   */
+  static constexpr size_t MAX_STRING_ARG = 24;
+
+  /*---------------------------------------------------------------------------
+  Enumerations
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Type tag preceding each encoded argument
+   */
+  enum ArgType : uint8_t
+  {
+    ARG_U32, /**< 4 byte unsigned integer */
+    ARG_I32, /**< 4 byte signed integer */
+    ARG_U64, /**< 8 byte unsigned integer */
+    ARG_I64, /**< 8 byte signed integer */
+    ARG_F32, /**< 4 byte float, doubles are narrowed */
+    ARG_STR, /**< 1 byte length followed by the characters, no terminator */
+  };
+
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Fixed header at the start of every record. Little endian.
+   */
+  struct RecordHeader
+  {
+    uint8_t  sync;      /**< Always SYNC_BYTE */
+    uint8_t  level;     /**< mb::logging::Level of the message */
+    uint8_t  length;    /**< Bytes of argument data following the header */
+    uint8_t  argc;      /**< Arguments encoded. Missing ones were truncated. */
+    uint32_t fmt_id;    /**< Offset of the format string in ICHNAEA_BINLOG_SECTION */
+    uint32_t timestamp; /**< System time in milliseconds */
+  } __attribute__( ( packed ) );
+
+  static constexpr size_t MAX_ARG_BYTES = MAX_RECORD_SIZE - sizeof( RecordHeader );
+
+  /**
+   * @brief A complete record as it is handed to the log sinks
+   */
+  struct Record
+  {
+    RecordHeader header;
+    uint8_t      args[ MAX_ARG_BYTES ];
+  } __attribute__( ( packed ) );
+
+  static_assert( sizeof( RecordHeader ) == 12 );
+  static_assert( sizeof( Record ) == MAX_RECORD_SIZE );
+
+  /*---------------------------------------------------------------------------
+  Private Functions
+  ---------------------------------------------------------------------------*/
+  namespace Internal
+  {
+    /**
+     * @brief Stamps the record and hands it to the log sinks
+     *
+     * @param level   Severity of the message
+     * @param fmt     Format string, must live in ICHNAEA_BINLOG_SECTION
+     * @param record  Record with the arguments already packed
+     */
+    void submit( const mb::logging::Level level, const char *fmt, Record &record );
+
+    inline void pack_raw( Record &record, const ArgType type, const void *src, const size_t size )
+    {
+      if( ( record.header.length + 1u + size ) > MAX_ARG_BYTES )
+      {
+        return;
+      }
+
+      record.args[ record.header.length ] = type;
+      memcpy( &record.args[ record.header.length + 1u ], src, size );
+      record.header.length += static_cast<uint8_t>( 1u + size );
+      record.header.argc++;
+    }
+
+    inline void pack_string( Record &record, const char *str )
+    {
+      const size_t limit = MAX_ARG_BYTES - record.header.length;
+      if( limit < 2u )
+      {
+        return;
+      }
+
+      const size_t len = str ? strnlen( str, etl::min<size_t>( MAX_STRING_ARG, limit - 2u ) ) : 0u;
+
+      record.args[ record.header.length ]      = ARG_STR;
+      record.args[ record.header.length + 1u ] = static_cast<uint8_t>( len );
+      memcpy( &record.args[ record.header.length + 2u ], str, len );
+      record.header.length += static_cast<uint8_t>( 2u + len );
+      record.header.argc++;
+    }
+
+    template<typename T>
+    inline void pack( Record &record, const T &value )
+    {
+      using U = std::decay_t<T>;
+
+      if constexpr( std::is_same_v<U, const char *> || std::is_same_v<U, char *> )
+      {
+        pack_string( record, value );
+      }
+      else if constexpr( std::is_floating_point_v<U> )
+      {
+        const float narrowed = static_cast<float>( value );
+        pack_raw( record, ARG_F32, &narrowed, sizeof( narrowed ) );
+      }
+      else if constexpr( std::is_enum_v<U> )
+      {
+        pack( record, static_cast<std::underlying_type_t<U>>( value ) );
+      }
+      else if constexpr( std::is_pointer_v<U> )
+      {
+        pack( record, reinterpret_cast<uintptr_t>( value ) );
+      }
+      else if constexpr( std::is_integral_v<U> && ( sizeof( U ) <= sizeof( uint32_t ) ) )
+      {
+        if constexpr( std::is_signed_v<U> )
+        {
+          const int32_t widened = static_cast<int32_t>( value );
+          pack_raw( record, ARG_I32, &widened, sizeof( widened ) );
+        }
+        else
+        {
+          const uint32_t widened = static_cast<uint32_t>( value );
+          pack_raw( record, ARG_U32, &widened, sizeof( widened ) );
+        }
+      }
+      else if constexpr( std::is_integral_v<U> )
+      {
+        const uint64_t raw = static_cast<uint64_t>( value );
+        pack_raw( record, std::is_signed_v<U> ? ARG_I64 : ARG_U64, &raw, sizeof( raw ) );
+      }
+      else
+      {
+        static_assert( std::is_void_v<U>, "Unsupported binary log argument type" );
+      }
+    }
+  }    // namespace Internal
+
+  /*---------------------------------------------------------------------------
+  Public Functions
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Record a binary log message. Use the BLOG_* macros instead of
+   * calling this directly so the format string lands in the right section.
+   *
+   * @param level   Severity of the message
+   * @param fmt     printf style format string
+   * @param args    Arguments referenced by the format string
+   */
+  template<typename... Args>
+  inline void log( const mb::logging::Level level, const char *fmt, const Args &...args )
+  {
+    Record record;
+    record.header.length = 0;
+    record.header.argc   = 0;
+
+    ( Internal::pack( record, args ), ... );
+    Internal::submit( level, fmt, record );
+  }
+
+  /**
+   * @brief Size of an encoded record, header included
+   *
+   * @param record  Record to measure
+   * @return size_t
+   */
+  inline size_t recordSize( const Record &record )
+  {
+    return sizeof( RecordHeader ) + record.header.length;
+  }
+
+}    // namespace Logging::Binary
+
+/*-----------------------------------------------------------------------------
+Macros
+-----------------------------------------------------------------------------*/
+
+/*
+ * Every BLOG_* call site is rate limited, see system_log_limit.hpp. Repeats
+ * beyond the limit are summarized instead of flooding the sinks.
+ */
+#if ICHNAEA_BINARY_LOGGING
+
+#define ICHNAEA_BLOG( level, fmt, ... )                                                                      \
+  do                                                                                                         \
+  {                                                                                                          \
+    static const char _blog_fmt[] __attribute__( ( section( ICHNAEA_BINLOG_SECTION ), used ) ) = fmt;        \
+    ICHNAEA_RATE_LIMITED( level, _blog_fmt, ::Logging::Binary::log( level, _blog_fmt, ##__VA_ARGS__ ) );     \
+  } while( 0 )
+
+#define BLOG_TRACE( fmt, ... ) ICHNAEA_BLOG( ::mb::logging::Level::LVL_TRACE, fmt, ##__VA_ARGS__ )
+#define BLOG_DEBUG( fmt, ... ) ICHNAEA_BLOG( ::mb::logging::Level::LVL_DEBUG, fmt, ##__VA_ARGS__ )
+#define BLOG_INFO( fmt, ... ) ICHNAEA_BLOG( ::mb::logging::Level::LVL_INFO, fmt, ##__VA_ARGS__ )
+#define BLOG_WARN( fmt, ... ) ICHNAEA_BLOG( ::mb::logging::Level::LVL_WARN, fmt, ##__VA_ARGS__ )
+#define BLOG_ERROR( fmt, ... ) ICHNAEA_BLOG( ::mb::logging::Level::LVL_ERROR, fmt, ##__VA_ARGS__ )
+
+#else /* !ICHNAEA_BINARY_LOGGING */
+
+#define BLOG_TRACE( fmt, ... ) \
+  ICHNAEA_RATE_LIMITED( ::mb::logging::Level::LVL_TRACE, fmt, LOG_TRACE( fmt, ##__VA_ARGS__ ) )
+#define BLOG_DEBUG( fmt, ... ) \
+  ICHNAEA_RATE_LIMITED( ::mb::logging::Level::LVL_DEBUG, fmt, LOG_DEBUG( fmt, ##__VA_ARGS__ ) )
+#define BLOG_INFO( fmt, ... ) \
+  ICHNAEA_RATE_LIMITED( ::mb::logging::Level::LVL_INFO, fmt, LOG_INFO( fmt, ##__VA_ARGS__ ) )
+#define BLOG_WARN( fmt, ... ) \
+  ICHNAEA_RATE_LIMITED( ::mb::logging::Level::LVL_WARN, fmt, LOG_WARN( fmt, ##__VA_ARGS__ ) )
+#define BLOG_ERROR( fmt, ... ) \
+  ICHNAEA_RATE_LIMITED( ::mb::logging::Level::LVL_ERROR, fmt, LOG_ERROR( fmt, ##__VA_ARGS__ ) )
+
+#endif /* ICHNAEA_BINARY_LOGGING */
+
+#define BLOG_TRACE_IF( cond, fmt, ... ) \
+  do                                    \
+  {                                     \
+    if( cond )                          \
+    {                                   \
+      BLOG_TRACE( fmt, ##__VA_ARGS__ ); \
+    }                                   \
+  } while( 0 )
+
+#define BLOG_WARN_IF( cond, fmt, ... ) \
+  do                                   \
+  {                                    \
+    if( cond )                         \
+    {                                  \
+      BLOG_WARN( fmt, ##__VA_ARGS__ ); \
+    }                                  \
+  } while( 0 )
+
+#define BLOG_ERROR_IF( cond, fmt, ... ) \
+  do                                    \
+  {                                     \
+    if( cond )                          \
+    {                                   \
+      BLOG_ERROR( fmt, ##__VA_ARGS__ ); \
+    }                                   \
+  } while( 0 )
+
+#endif /* !ICHNAEA_SYSTEM_BINLOG_HPP */
@@ -0,0 +1,314 @@
+/******************************************************************************
+ *  File Name:
+ *    system_boot_profile.cpp
+ *
+ *  Description:
+ *    Boot timeline profiler implementation
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <cstring>
+#include "FreeRTOS.h"
+#include "task.h"
+#include <mbedutils/interfaces/irq_intf.hpp>
+#include <mbedutils/logging.hpp>
+#include <src/bsp/board_map.hpp>
+#include <src/system/system_boot_profile.hpp>
+
+namespace System::Boot::Profiler
+{
+  /*---------------------------------------------------------------------------
+  Constants
+  ---------------------------------------------------------------------------*/
+
+  static constexpr uint32_t TIMELINE_MAGIC = 0xB007F11E;
+  static constexpr size_t   INVALID_INDEX  = MAX_RECORDS;
+  static constexpr size_t   MAX_CONTEXTS   = 4;
+
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Layout of the timeline in no-init RAM
+   */
+  struct Timeline
+  {
+    uint32_t magic;    /**< Marks the timeline as holding valid data */
+    uint32_t count;    /**< Number of records in use */
+    uint32_t complete; /**< Boot sequence has finished */
+    Record   records[ MAX_RECORDS ];
+  };
+
+  /**
+   * @brief Nesting state for one thread of execution recording steps
+   */
+  struct Context
+  {
+    TaskHandle_t owner; /**< Recording task, null before the scheduler starts */
+    size_t       open;  /**< Innermost step still running in this context */
+    bool         used;  /**< Slot is assigned to the owner */
+  };
+
+  /*---------------------------------------------------------------------------
+  Static Data
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Timeline storage. Survives a soft reset so a hung boot can be
+   * diagnosed on the next power up.
+   */
+  static Timeline __uninitialized_ram( s_timeline );
+
+  static Context s_contexts[ MAX_CONTEXTS ];
+  static bool    s_prev_stalled;
+  static Record  s_prev_last;
+
+  /*---------------------------------------------------------------------------
+  Private Functions
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Current hardware timer value in microseconds
+   *
+   * @return uint32_t
+   */
+  static inline uint32_t now_us()
+  {
+    return static_cast<uint32_t>( time_us_64() );
+  }
+
+
+  /**
+   * @brief Identifies the thread of execution calling into the profiler.
+   *
+   * Steps recorded before the scheduler starts all belong to the boot context.
+   *
+   * @return TaskHandle_t
+   */
+  static inline TaskHandle_t current_owner()
+  {
+    if( xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED )
+    {
+      return nullptr;
+    }
+
+    return xTaskGetCurrentTaskHandle();
+  }
+
+
+  /**
+   * @brief Finds the nesting context of a thread. Must be called with
+   * interrupts disabled.
+   *
+   * @param owner   Thread to look up
+   * @param create  Claim a free slot if the thread has none yet
+   * @return Context*  Context of the thread, nullptr if not tracked
+   */
+  static Context *find_context( const TaskHandle_t owner, const bool create )
+  {
+    Context *free_slot = nullptr;
+    for( auto &ctx : s_contexts )
+    {
+      if( ctx.used && ( ctx.owner == owner ) )
+      {
+        return &ctx;
+      }
+
+      if( !ctx.used && !free_slot )
+      {
+        free_slot = &ctx;
+      }
+    }
+
+    if( create && free_slot )
+    {
+      free_slot->owner = owner;
+      free_slot->open  = INVALID_INDEX;
+      free_slot->used  = true;
+    }
+
+    return create ? free_slot : nullptr;
+  }
+
+  /*---------------------------------------------------------------------------
+  Classes
+  ---------------------------------------------------------------------------*/
+
+  ScopedStep::ScopedStep( const StepId step, const uint16_t tag ) : mIndex( begin( step, tag ) )
+  {
+  }
+
+
+  ScopedStep::~ScopedStep()
+  {
+    end( mIndex );
+  }
+
+  /*---------------------------------------------------------------------------
+  Public Functions
+  ---------------------------------------------------------------------------*/
+
+  void initialize()
+  {
+    /*-------------------------------------------------------------------------
+    Look for evidence the last boot never finished
+    -------------------------------------------------------------------------*/
+    s_prev_stalled = false;
+    if( ( s_timeline.magic == TIMELINE_MAGIC ) && !s_timeline.complete && ( s_timeline.count > 0 ) &&
+        ( s_timeline.count <= MAX_RECORDS ) )
+    {
+      s_prev_stalled = true;
+      s_prev_last    = s_timeline.records[ s_timeline.count - 1 ];
+    }
+
+    /*-------------------------------------------------------------------------
+    Start a fresh timeline
+    -------------------------------------------------------------------------*/
+    memset( &s_timeline, 0, sizeof( s_timeline ) );
+    s_timeline.magic = TIMELINE_MAGIC;
+    memset( s_contexts, 0, sizeof( s_contexts ) );
+  }
+
+
+  size_t begin( const StepId step, const uint16_t tag )
+  {
+    /*-------------------------------------------------------------------------
+    Claim a slot. Deferred POST records from its own thread while the boot
+    thread may still be recording steps, so nesting is tracked per thread.
+    -------------------------------------------------------------------------*/
+    mb::irq::disable_interrupts();
+    if( s_timeline.complete || ( s_timeline.count >= MAX_RECORDS ) )
+    {
+      mb::irq::enable_interrupts();
+      return INVALID_INDEX;
+    }
+
+    size_t   index  = s_timeline.count++;
+    Record  &record = s_timeline.records[ index ];
+    Context *ctx    = find_context( current_owner(), true );
+    size_t   parent = ctx ? ctx->open : INVALID_INDEX;
+
+    record.step        = static_cast<uint8_t>( step );
+    record.tag         = tag;
+    record.parent      = static_cast<uint8_t>( parent );
+    record.depth       = ( parent != INVALID_INDEX ) ? s_timeline.records[ parent ].depth + 1u : 0u;
+    record.duration_us = 0;
+    record.start_us    = now_us();
+
+    if( ctx )
+    {
+      ctx->open = index;
+    }
+    mb::irq::enable_interrupts();
+
+    return index;
+  }
+
+
+  void end( const size_t index )
+  {
+    mb::irq::disable_interrupts();
+    if( index >= s_timeline.count )
+    {
+      mb::irq::enable_interrupts();
+      return;
+    }
+
+    Record &record     = s_timeline.records[ index ];
+    record.duration_us = now_us() - record.start_us;
+
+    /*-------------------------------------------------------------------------
+    Pop back out to the enclosing step, releasing the context once the thread
+    has no steps left open.
+    -------------------------------------------------------------------------*/
+    Context *ctx = find_context( current_owner(), false );
+    if( ctx && ( ctx->open == index ) )
+    {
+      ctx->open = record.parent;
+      if( ctx->open == INVALID_INDEX )
+      {
+        ctx->used = false;
+      }
+    }
+    mb::irq::enable_interrupts();
+  }
+
+
+  void measure( const StepId step, StepFn fn )
+  {
+    ScopedStep _step( step );
+    fn();
+  }
+
+
+  void complete()
+  {
+    /*-------------------------------------------------------------------------
+    Seal the timeline so no other thread can append while it is dumped
+    -------------------------------------------------------------------------*/
+    mb::irq::disable_interrupts();
+    if( s_timeline.complete )
+    {
+      mb::irq::enable_interrupts();
+      return;
+    }
+
+    s_timeline.complete = 1;
+    mb::irq::enable_interrupts();
+
+    /*-------------------------------------------------------------------------
+    Report on the previous boot if it hung up somewhere
+    -------------------------------------------------------------------------*/
+    if( s_prev_stalled )
+    {
+      LOG_WARN( "Previous boot stalled in step %d, tag %d, started @ %u us", s_prev_last.step, s_prev_last.tag,
+                s_prev_last.start_us );
+    }
+
+    /*-------------------------------------------------------------------------
+    Dump the timeline for this boot
+    -------------------------------------------------------------------------*/
+    LOG_DEBUG( "Boot timeline: %d steps", s_timeline.count );
+    for( size_t idx = 0; idx < s_timeline.count; idx++ )
+    {
+      const Record &record = s_timeline.records[ idx ];
+      LOG_DEBUG( "  step %2d depth %d tag %3d: start %8u us, took %8u us", record.step, record.depth, record.tag,
+                 record.start_us, record.duration_us );
+    }
+
+    if( s_timeline.count >= MAX_RECORDS )
+    {
+      LOG_WARN( "Boot timeline full. Some steps were not recorded." );
+    }
+  }
+
+
+  bool isComplete()
+  {
+    return s_timeline.complete != 0;
+  }
+
+
+  size_t count()
+  {
+    return s_timeline.count;
+  }
+
+
+  bool getRecord( const size_t index, Record &record )
+  {
+    if( index >= s_timeline.count )
+    {
+      return false;
+    }
+
+    record = s_timeline.records[ index ];
+    return true;
+  }
+
+}    // namespace System::Boot::Profiler
@@ -0,0 +1,144 @@
+/******************************************************************************
+ *  File Name:
+ *    system_boot_profile.hpp
+ *
+ *  Description:
+ *    Boot timeline profiler for measuring the cost of each bootup step
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+#pragma once
+#ifndef ICHNAEA_SYSTEM_BOOT_PROFILE_HPP
+#define ICHNAEA_SYSTEM_BOOT_PROFILE_HPP
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <cstddef>
+#include <cstdint>
+#include <src/app/proto/ichnaea_rpc.pb.h>
+
+namespace System::Boot::Profiler
+{
+  /*---------------------------------------------------------------------------
+  Constants
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Maximum number of steps that can be recorded in a single boot.
+   *
+   * Sized to cover the fixed boot steps plus every PDI key registration.
+   */
+  static constexpr size_t MAX_RECORDS = 128;
+  static_assert( MAX_RECORDS <= UINT8_MAX, "Record parent index must fit in a byte" );
+
+  /*---------------------------------------------------------------------------
+  Aliases
+  ---------------------------------------------------------------------------*/
+
+  using StepId = ichnaea_BootStepId;
+  using StepFn = void ( * )();
+
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief A single timed step in the boot sequence
+   */
+  struct Record
+  {
+    uint32_t start_us;    /**< Hardware timer value when the step started */
+    uint32_t duration_us; /**< Time spent in the step */
+    uint16_t tag;         /**< Step specific tag, ie the PDI key */
+    uint8_t  step;        /**< StepId of the record */
+    uint8_t  depth;       /**< Nesting level of the step within its thread */
+    uint8_t  parent;      /**< Index of the enclosing step, MAX_RECORDS if none */
+  };
+
+  /**
+   * @brief RAII helper to time a scoped block of boot code
+   */
+  class ScopedStep
+  {
+  public:
+    ScopedStep( const StepId step, const uint16_t tag = 0 );
+    ~ScopedStep();
+
+  private:
+    size_t mIndex;
+  };
+
+  /*---------------------------------------------------------------------------
+  Public Functions
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Resets the timeline for a new boot.
+   *
+   * The timeline lives in RAM that is not cleared on reset, so this first
+   * inspects the previous boot's record to see if it stalled before finishing.
+   * Must be called before any other boot step.
+   */
+  void initialize();
+
+  /**
+   * @brief Starts timing a new boot step
+   *
+   * @param step  Which step is starting
+   * @param tag   Optional step specific tag
+   * @return size_t Index of the record, used to close out the step
+   */
+  size_t begin( const StepId step, const uint16_t tag = 0 );
+
+  /**
+   * @brief Stops timing a boot step
+   *
+   * @param index Record index returned from begin()
+   */
+  void end( const size_t index );
+
+  /**
+   * @brief Times the execution of a single boot function
+   *
+   * @param step  Which step is being measured
+   * @param fn    Function to invoke
+   */
+  void measure( const StepId step, StepFn fn );
+
+  /**
+   * @brief Marks the boot sequence as complete and dumps the timeline to the log.
+   *
+   * No further steps are recorded after this call.
+   */
+  void complete();
+
+  /**
+   * @brief Checks if the boot sequence has completed
+   *
+   * @return true   Boot finished
+   * @return false  Boot is still in progress
+   */
+  bool isComplete();
+
+  /**
+   * @brief Gets the number of steps recorded this boot
+   *
+   * @return size_t
+   */
+  size_t count();
+
+  /**
+   * @brief Reads a single record from the timeline
+   *
+   * @param index Which record to read
+   * @param record Output for the record data
+   * @return true   The record was valid
+   * @return false  The index was out of range
+   */
+  bool getRecord( const size_t index, Record &record );
+
+}    // namespace System::Boot::Profiler
+
+#endif /* !ICHNAEA_SYSTEM_BOOT_PROFILE_HPP */
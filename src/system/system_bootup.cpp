@@ -23,69 +23,227 @@ Includes
 #include <src/hw/led.hpp>
 #include <src/hw/ltc7871.hpp>
 #include <src/hw/uart.hpp>
+#include <src/system/system_boot_profile.hpp>
 #include <src/system/system_bootup.hpp>
+#include <src/system/system_cal.hpp>
 #include <src/system/system_db.hpp>
 #include <src/system/system_error.hpp>
+#include <src/system/system_flash_stats.hpp>
+#include <src/system/system_flight_recorder.hpp>
 #include <src/system/system_logging.hpp>
+#include <src/system/system_retained.hpp>
 #include <src/system/system_sensor.hpp>
 #include <src/app/app_monitor.hpp>
 #include <src/threads/ichnaea_threads.hpp>
 
 namespace System::Boot
 {
+  /*---------------------------------------------------------------------------
+  Constants
+  ---------------------------------------------------------------------------*/
+
+  static constexpr uint32_t WARM_RESTART_KEY = 0x5741524D;
+
+  /*---------------------------------------------------------------------------
+  Enumerations
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Individual jobs that make up the POST sequence
+   */
+  enum PostJobId : uint8_t
+  {
+    POST_JOB_LOGGING,
+    POST_JOB_LTC7871,
+    POST_JOB_ADC,
+    POST_JOB_LED,
+    POST_JOB_FAN,
+
+    POST_JOB_COUNT
+  };
+
+  /**
+   * @brief Scheduling class of a POST job
+   */
+  enum PostJobClass : uint8_t
+  {
+    POST_CRITICAL, /**< Must pass before the node reports ready */
+    POST_DEFERRED, /**< Runs in the background after the node reports ready */
+    POST_COSMETIC, /**< Deferred, and skipped entirely on a warm restart */
+  };
+
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  struct PostJob
+  {
+    Profiler::StepId step;       /**< Boot timeline step to record under */
+    Profiler::StepFn run;        /**< Job to execute */
+    uint32_t         depends_on; /**< Bitmask of PostJobId that must finish first */
+    PostJobClass     type;       /**< When the job is allowed to run */
+  };
+
+  /*---------------------------------------------------------------------------
+  Static Data
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief POST job table, indexed by PostJobId
+   */
+  static constexpr PostJob s_post_jobs[ POST_JOB_COUNT ] = {
+    /* clang-format off */
+    /* POST_JOB_LOGGING */ { ichnaea_BootStepId_BOOT_STEP_POST_LOGGING, Logging::postSequence,     0,                        POST_CRITICAL },
+    /* POST_JOB_LTC7871 */ { ichnaea_BootStepId_BOOT_STEP_POST_LTC7871, HW::LTC7871::postSequence, 1u << POST_JOB_LOGGING,   POST_CRITICAL },
+    /* POST_JOB_ADC     */ { ichnaea_BootStepId_BOOT_STEP_POST_ADC,     HW::ADC::postSequence,     1u << POST_JOB_LOGGING,   POST_CRITICAL },
+    /* POST_JOB_LED     */ { ichnaea_BootStepId_BOOT_STEP_POST_LED,     HW::LED::postSequence,     0,                        POST_COSMETIC },
+    /* POST_JOB_FAN     */ { ichnaea_BootStepId_BOOT_STEP_POST_FAN,     HW::FAN::postSequence,     1u << POST_JOB_ADC,       POST_DEFERRED },
+    /* clang-format on */
+  };
+
+  /**
+   * @brief Soft reset request token. Lives in no-init RAM so it survives the
+   * reset triggered by the shutdown sequence.
+   */
+  static uint32_t __uninitialized_ram( s_warm_restart_key );
+
+  static bool     s_warm_restart;
+  static uint32_t s_post_done;
+
+  /*---------------------------------------------------------------------------
+  Private Functions
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Runs all POST jobs of the given classes, honoring declared dependencies.
+   *
+   * Jobs are executed in table order whenever their dependencies are met. A pass
+   * that makes no progress means a dependency can never be satisfied.
+   *
+   * @param class_mask  Bitmask of PostJobClass values allowed to run
+   */
+  static void run_post_jobs( const uint32_t class_mask )
+  {
+    uint32_t pending = 0;
+    for( size_t idx = 0; idx < POST_JOB_COUNT; idx++ )
+    {
+      if( ( class_mask & ( 1u << s_post_jobs[ idx ].type ) ) && !( s_post_done & ( 1u << idx ) ) )
+      {
+        pending |= 1u << idx;
+      }
+    }
+
+    while( pending )
+    {
+      uint32_t ran = 0;
+
+      for( size_t idx = 0; idx < POST_JOB_COUNT; idx++ )
+      {
+        const uint32_t bit = 1u << idx;
+        const PostJob &job = s_post_jobs[ idx ];
+
+        if( ( pending & bit ) && ( ( job.depends_on & s_post_done ) == job.depends_on ) )
+        {
+          Profiler::measure( job.step, job.run );
+          s_post_done |= bit;
+          pending &= ~bit;
+          ran |= bit;
+        }
+      }
+
+      if( !ran )
+      {
+        mbed_assert_continue_msg( false, "POST jobs 0x%02X have unmet dependencies", pending );
+        return;
+      }
+    }
+  }
+
   /*---------------------------------------------------------------------------
   Public Functions
   ---------------------------------------------------------------------------*/
 
   void initDrivers()
   {
+    using namespace Profiler;
+
 #if defined( ICHNAEA_EMBEDDED )
     timer_hw->dbgpause = 0;    // Do not pause the timer during debugging
 #endif                         /* ICHNAEA_EMBEDDED */
 
+    /*-------------------------------------------------------------------------
+    Start the boot timeline first so every following step is captured
+    -------------------------------------------------------------------------*/
+    Profiler::initialize();
+    ScopedStep _boot_step( ichnaea_BootStepId_BOOT_STEP_INIT_DRIVERS );
+
+    /*-------------------------------------------------------------------------
+    Consume the warm restart token. A cold boot leaves garbage here. Only
+    resume from the retained state if the image also survived intact.
+    -------------------------------------------------------------------------*/
+    s_warm_restart     = ( s_warm_restart_key == WARM_RESTART_KEY ) && Retained::load();
+    s_warm_restart_key = 0;
+    s_post_done        = 0;
+
+    if( !s_warm_restart )
+    {
+      Retained::invalidate();
+    }
+
     /*-------------------------------------------------------------------------
     Load system dependencies for the hardware (order matters here)
     -------------------------------------------------------------------------*/
-    mb::osal::initOSALDrivers();
-    mb::assert::initialize();
-    Panic::powerUp();
-    BSP::powerUp();
+    measure( ichnaea_BootStepId_BOOT_STEP_OSAL, []() {
+      mb::osal::initOSALDrivers();
+      mb::assert::initialize();
+      Panic::powerUp();
+      System::FlightRecorder::initialize();
+    } );
+    measure( ichnaea_BootStepId_BOOT_STEP_BSP, BSP::powerUp );
 
     /*-------------------------------------------------------------------------
     Initialize integration layers for the hardware
     -------------------------------------------------------------------------*/
-    mb::hw::exception::intf::driver_setup();
-    mb::hw::gpio::intf::driver_setup();
-    mb::hw::spi::intf::driver_setup();
+    measure( ichnaea_BootStepId_BOOT_STEP_HW_INTF, []() {
+      mb::hw::exception::intf::driver_setup();
+      mb::hw::gpio::intf::driver_setup();
+      mb::hw::spi::intf::driver_setup();
+    } );
 
     /*-------------------------------------------------------------------------
     Initialize the hardware peripherals. Ordered by least complex/dependent
     to most complex/dependent.
     -------------------------------------------------------------------------*/
-    HW::GPIO::initialize(); /* Must be first to init IO to a safe state */
-    HW::LED::initialize();
-    HW::ADC::initialize();
-    HW::UART::initialize();
-    HW::FAN::initialize();
-    HW::LTC7871::driver_init();
+    measure( ichnaea_BootStepId_BOOT_STEP_HW_GPIO, HW::GPIO::initialize ); /* Must be first to init IO to a safe state */
+    measure( ichnaea_BootStepId_BOOT_STEP_HW_LED, HW::LED::initialize );
+    measure( ichnaea_BootStepId_BOOT_STEP_HW_ADC, HW::ADC::initialize );
+    measure( ichnaea_BootStepId_BOOT_STEP_HW_UART, HW::UART::initialize );
+    measure( ichnaea_BootStepId_BOOT_STEP_HW_FAN, HW::FAN::initialize );
+    measure( ichnaea_BootStepId_BOOT_STEP_HW_LTC7871, HW::LTC7871::driver_init );
 
     /*-------------------------------------------------------------------------
     Finally initialize the threading system. This should be the last thing to
     set up before the system is considered ready to execute.
     -------------------------------------------------------------------------*/
-    Threads::initialize();
+    measure( ichnaea_BootStepId_BOOT_STEP_THREADS, Threads::initialize );
   }
 
 
   void initTech()
   {
+    using namespace Profiler;
+
+    ScopedStep _boot_step( ichnaea_BootStepId_BOOT_STEP_INIT_TECH );
+
     /*-------------------------------------------------------------------------
     Middle layer system drivers
     -------------------------------------------------------------------------*/
-    Control::initialize();
-    Logging::initialize();
-    System::Database::initialize();
-    System::Sensor::initialize();
+    measure( ichnaea_BootStepId_BOOT_STEP_CONTROL, Control::initialize );
+    measure( ichnaea_BootStepId_BOOT_STEP_LOGGING, Logging::initialize );
+    measure( ichnaea_BootStepId_BOOT_STEP_KVDB_INIT, System::Database::initialize );
+    measure( ichnaea_BootStepId_BOOT_STEP_CAL_STORE, System::CalStore::initialize );
+    measure( ichnaea_BootStepId_BOOT_STEP_FLASH_STATS, System::FlashStats::initialize );
+    measure( ichnaea_BootStepId_BOOT_STEP_SENSOR, System::Sensor::initialize );
 
     LOG_TRACE( "Tech stack initialization complete" );
   }
@@ -93,17 +251,45 @@ namespace System::Boot
 
   void runPostInit()
   {
-    Logging::postSequence();
+    Profiler::ScopedStep _boot_step( ichnaea_BootStepId_BOOT_STEP_POST );
 
     /*-------------------------------------------------------------------------
-    Run the POST sequence for all hardware peripherals
+    Only the safety critical POST jobs gate the node reporting ready
     -------------------------------------------------------------------------*/
     LOG_TRACE( "Running POST sequence" );
-    HW::LTC7871::postSequence();
-    HW::LED::postSequence();
-    HW::ADC::postSequence();
-    HW::FAN::postSequence();
+    run_post_jobs( 1u << POST_CRITICAL );
     LOG_TRACE( "POST sequence complete" );
   }
 
+
+  void runDeferredPost()
+  {
+    Profiler::ScopedStep _boot_step( ichnaea_BootStepId_BOOT_STEP_POST_DEFERRED );
+
+    uint32_t class_mask = 1u << POST_DEFERRED;
+    if( !s_warm_restart )
+    {
+      class_mask |= 1u << POST_COSMETIC;
+    }
+    else
+    {
+      LOG_TRACE( "Warm restart, skipping cosmetic POST" );
+    }
+
+    run_post_jobs( class_mask );
+  }
+
+
+  bool isWarmRestart()
+  {
+    return s_warm_restart;
+  }
+
+
+  void requestWarmRestart()
+  {
+    Retained::save();
+    s_warm_restart_key = WARM_RESTART_KEY;
+  }
+
 }    // namespace System::Boot
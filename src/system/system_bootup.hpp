@@ -38,9 +38,38 @@ namespace System::Boot
 
   /**
    * @brief Performs the Power On Self Test (POST) for the system
+   *
+   * Only the safety critical POST jobs are run here. Everything else is left
+   * for runDeferredPost() so the node can report ready as soon as possible.
    */
   void runPostInit();
 
+  /**
+   * @brief Runs the slow, non-critical POST jobs (LED ramp, fan spin-up, etc).
+   *
+   * Runs in its own short lived thread after the node is up and
+   * emitting heartbeats. Cosmetic jobs are skipped on a warm restart.
+   */
+  void runDeferredPost();
+
+  /**
+   * @brief Checks if the current boot is a warm restart
+   *
+   * @return true   The last reset was requested by the shutdown sequence and
+   *                the retained state image survived intact
+   * @return false  Cold boot, ie power on or a hard fault
+   */
+  bool isWarmRestart();
+
+  /**
+   * @brief Flags the next reset as a warm restart.
+   *
+   * Snapshots the live system state into retained RAM so the next boot can
+   * resume from it. Should be called immediately before a software triggered
+   * reset.
+   */
+  void requestWarmRestart();
+
 }  // namespace System::Boot
 
 #endif  /* !ICHNAEA_SYSTEM_BOOTUP_HPP */
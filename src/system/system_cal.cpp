@@ -0,0 +1,308 @@
+/******************************************************************************
+ *  File Name:
+ *    system_cal.cpp
+ *
+ *  Description:
+ *    Calibration store implementation.
+ *
+ *    The "cal" NOR region is split into two banks. Each commit appends a full
+ *    CalData record to the active bank, so the newest valid record always
+ *    wins. When a bank fills up, the other bank is erased and becomes active.
+ *    Calibration data never shares flash with the PDI KVDB, so it is never
+ *    rewritten by KVDB garbage collection.
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <cstring>
+#include <etl/crc32.h>
+#include <mbedutils/assert.hpp>
+#include <mbedutils/logging.hpp>
+#include <mbedutils/osal.hpp>
+#include <mbedutils/threading.hpp>
+#include <src/hw/nor.hpp>
+#include <src/integration/flashdb/fal_cfg.h>
+#include <src/system/system_cal.hpp>
+
+namespace System::CalStore
+{
+  /*---------------------------------------------------------------------------
+  Constants
+  ---------------------------------------------------------------------------*/
+
+  static constexpr uint32_t RECORD_MAGIC    = 0xCA1DA7A0;
+  static constexpr uint32_t ERASED_MAGIC    = 0xFFFFFFFF;
+  static constexpr uint16_t RECORD_VERSION  = 1;
+  static constexpr size_t   NUM_BANKS       = 2;
+  static constexpr size_t   BANK_SIZE       = ICHNAEA_DB_CAL_RGN_SIZE / NUM_BANKS;
+  static constexpr size_t   BANK_ERASE_SIZE = 64 * 1024;
+
+  static_assert( ( BANK_SIZE % BANK_ERASE_SIZE ) == 0, "Cal bank size must be a multiple of 64k" );
+
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief On-flash layout of a single calibration record
+   */
+  struct Record
+  {
+    uint32_t magic;    /**< Marks the slot as written */
+    uint16_t version;  /**< Layout version of the payload */
+    uint16_t size;     /**< Size of the payload */
+    uint32_t sequence; /**< Monotonic commit counter, highest wins */
+    uint32_t crc;      /**< CRC32 of the record with this field zeroed */
+    CalData  data;     /**< Calibration payload */
+  };
+
+  static_assert( ( sizeof( Record ) % sizeof( uint32_t ) ) == 0, "Cal records must be word aligned" );
+
+  /*---------------------------------------------------------------------------
+  Static Data
+  ---------------------------------------------------------------------------*/
+
+  static mb::osal::mb_recursive_mutex_t s_cal_mutex;
+  static CalData                        s_cal_data;
+  static bool                           s_loaded;
+  static size_t                         s_active_bank;
+  static size_t                         s_cursor;
+  static uint32_t                       s_sequence;
+
+  /*---------------------------------------------------------------------------
+  Private Functions
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Default calibration used when nothing has been committed yet
+   *
+   * @param cal Output for the defaults
+   */
+  static void load_defaults( CalData &cal )
+  {
+    cal                         = {};
+    cal.outputCurrent.valid_min = -250.0f;
+    cal.outputCurrent.valid_max = 250.0f;
+    cal.outputCurrent.gain      = 1.0f;
+    cal.outputCurrent.offset    = 0.0f;
+  }
+
+
+  static inline size_t bank_start( const size_t bank )
+  {
+    return ICHNAEA_DB_CAL_RGN_START + ( bank * BANK_SIZE );
+  }
+
+
+  static inline size_t bank_end( const size_t bank )
+  {
+    return bank_start( bank ) + BANK_SIZE;
+  }
+
+
+  /**
+   * @brief Computes the CRC of a record, excluding the CRC field itself
+   *
+   * @param record  Record to check
+   * @return uint32_t
+   */
+  static uint32_t calc_record_crc( const Record &record )
+  {
+    Record copy = record;
+    copy.crc    = 0;
+
+    const uint8_t *start = reinterpret_cast<const uint8_t *>( &copy );
+    return etl::crc32( start, start + sizeof( copy ) ).value();
+  }
+
+
+  /**
+   * @brief Walks a bank looking for the newest valid record.
+   *
+   * @param bank      Which bank to scan
+   * @param best      Newest record seen so far, updated in place. Only
+   *                  meaningful once s_loaded is set.
+   * @param found     Set if a newer record was found in this bank
+   * @return size_t   Address of the first free slot in the bank
+   */
+  static size_t scan_bank( const size_t bank, Record &best, bool &found )
+  {
+    Record record;
+    found = false;
+
+    for( size_t address = bank_start( bank ); ( address + sizeof( Record ) ) <= bank_end( bank ); address += sizeof( Record ) )
+    {
+      if( HW::NOR::read( address, reinterpret_cast<uint8_t *>( &record ), sizeof( record ) ) < 0 )
+      {
+        return bank_end( bank );
+      }
+
+      /*-----------------------------------------------------------------------
+      Erased slot marks the end of the log
+      -----------------------------------------------------------------------*/
+      if( record.magic == ERASED_MAGIC )
+      {
+        return address;
+      }
+
+      /*-----------------------------------------------------------------------
+      Foreign or old layout data. The stride is unknown past this point, so
+      treat the rest of the bank as used.
+      -----------------------------------------------------------------------*/
+      if( ( record.magic != RECORD_MAGIC ) || ( record.version != RECORD_VERSION ) || ( record.size != sizeof( CalData ) ) )
+      {
+        return bank_end( bank );
+      }
+
+      /*-----------------------------------------------------------------------
+      A torn write only costs the slot. Keep walking.
+      -----------------------------------------------------------------------*/
+      if( record.crc != calc_record_crc( record ) )
+      {
+        LOG_WARN( "Cal record @ 0x%08X failed CRC", static_cast<unsigned>( address ) );
+        continue;
+      }
+
+      if( !s_loaded || ( record.sequence > best.sequence ) )
+      {
+        best     = record;
+        found    = true;
+        s_loaded = true;
+      }
+    }
+
+    return bank_end( bank );
+  }
+
+  /*---------------------------------------------------------------------------
+  Public Functions
+  ---------------------------------------------------------------------------*/
+
+  void initialize()
+  {
+    mbed_assert( mb::osal::buildRecursiveMutexStrategy( s_cal_mutex ) );
+
+    load_defaults( s_cal_data );
+    s_loaded      = false;
+    s_active_bank = 0;
+    s_sequence    = 0;
+
+    /*-------------------------------------------------------------------------
+    Find the newest record across both banks. That bank becomes the one new
+    records are appended to.
+    -------------------------------------------------------------------------*/
+    Record best;
+    size_t cursor[ NUM_BANKS ];
+
+    for( size_t bank = 0; bank < NUM_BANKS; bank++ )
+    {
+      bool found     = false;
+      cursor[ bank ] = scan_bank( bank, best, found );
+
+      if( found )
+      {
+        s_active_bank = bank;
+      }
+    }
+
+    s_cursor = cursor[ s_active_bank ];
+
+    if( s_loaded )
+    {
+      s_cal_data = best.data;
+      s_sequence = best.sequence;
+      LOG_INFO( "Loaded calibration record %u from bank %u", static_cast<unsigned>( s_sequence ),
+                static_cast<unsigned>( s_active_bank ) );
+    }
+    else
+    {
+      LOG_INFO( "No calibration record found, importing from PDI" );
+    }
+  }
+
+
+  CalData data()
+  {
+    mb::thread::RecursiveLockGuard lock( s_cal_mutex );
+    return s_cal_data;
+  }
+
+
+  bool commit( const CalData &cal )
+  {
+    mb::thread::RecursiveLockGuard lock( s_cal_mutex );
+
+    /*-------------------------------------------------------------------------
+    Build the new record
+    -------------------------------------------------------------------------*/
+    Record record;
+    memset( &record, 0, sizeof( record ) );
+
+    record.magic    = RECORD_MAGIC;
+    record.version  = RECORD_VERSION;
+    record.size     = sizeof( CalData );
+    record.sequence = s_sequence + 1;
+    record.data     = cal;
+    record.crc      = calc_record_crc( record );
+
+    /*-------------------------------------------------------------------------
+    Swap banks if the active one is full. The old bank is left intact until
+    the next swap, so a power loss here still has a valid record to fall back
+    on.
+    -------------------------------------------------------------------------*/
+    if( ( s_cursor + sizeof( Record ) ) > bank_end( s_active_bank ) )
+    {
+      const size_t next_bank = ( s_active_bank + 1 ) % NUM_BANKS;
+      LOG_DEBUG( "Cal bank %u full, swapping to bank %u", static_cast<unsigned>( s_active_bank ),
+                 static_cast<unsigned>( next_bank ) );
+
+      for( size_t address = bank_start( next_bank ); address < bank_end( next_bank ); address += BANK_ERASE_SIZE )
+      {
+        if( HW::NOR::erase( address, BANK_ERASE_SIZE ) < 0 )
+        {
+          LOG_ERROR( "Failed to erase cal bank %u @ 0x%08X", static_cast<unsigned>( next_bank ),
+                     static_cast<unsigned>( address ) );
+          return false;
+        }
+      }
+
+      s_active_bank = next_bank;
+      s_cursor      = bank_start( next_bank );
+    }
+
+    /*-------------------------------------------------------------------------
+    Append and verify. The slot is consumed either way.
+    -------------------------------------------------------------------------*/
+    const size_t address = s_cursor;
+    s_cursor += sizeof( Record );
+
+    Record readback;
+    if( ( HW::NOR::write( address, reinterpret_cast<const uint8_t *>( &record ), sizeof( record ) ) < 0 ) ||
+        ( HW::NOR::read( address, reinterpret_cast<uint8_t *>( &readback ), sizeof( readback ) ) < 0 ) ||
+        ( memcmp( &record, &readback, sizeof( record ) ) != 0 ) )
+    {
+      LOG_ERROR( "Failed to commit cal record @ 0x%08X", static_cast<unsigned>( address ) );
+      return false;
+    }
+
+    /*-------------------------------------------------------------------------
+    Only now does the new calibration take effect
+    -------------------------------------------------------------------------*/
+    s_cal_data = cal;
+    s_sequence = record.sequence;
+    s_loaded   = true;
+
+    return true;
+  }
+
+
+  bool isLoaded()
+  {
+    mb::thread::RecursiveLockGuard lock( s_cal_mutex );
+    return s_loaded;
+  }
+
+}    // namespace System::CalStore
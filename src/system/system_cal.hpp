@@ -0,0 +1,80 @@
+/******************************************************************************
+ *  File Name:
+ *    system_cal.hpp
+ *
+ *  Description:
+ *    Append-only calibration store backed by the dedicated NOR "cal" region
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+#pragma once
+#ifndef ICHNAEA_SYSTEM_CAL_HPP
+#define ICHNAEA_SYSTEM_CAL_HPP
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <cstdint>
+#include <src/app/proto/ichnaea_pdi.pb.h>
+
+namespace System::CalStore
+{
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Flat image of every calibration on the node.
+   *
+   * This is the exact payload of a record in flash. Append new calibrations
+   * to the end and bump RECORD_VERSION in the implementation.
+   */
+  struct CalData
+  {
+    ichnaea_PDI_BasicCalibration outputCurrent; /**< Load output current sensor */
+  };
+
+  /*---------------------------------------------------------------------------
+  Public Functions
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Parse the calibration region and load the latest record into RAM.
+   *
+   * Falls back to the default calibrations if no valid record exists. Nodes
+   * calibrated before the store existed still hold their values in the PDI
+   * KVDB; those are imported and committed when the PDI keys register. Must
+   * be called before any calibration consumers are initialized.
+   */
+  void initialize();
+
+  /**
+   * @brief Get a copy of the active calibration data
+   *
+   * @return CalData
+   */
+  CalData data();
+
+  /**
+   * @brief Persist a complete calibration set as a new record.
+   *
+   * The RAM copy is only updated once the record has been verified in flash.
+   *
+   * @param cal   Calibration set to commit
+   * @return true   Record written and verified
+   * @return false  Flash error, the previous calibration remains active
+   */
+  bool commit( const CalData &cal );
+
+  /**
+   * @brief Checks if the active calibration was loaded from flash
+   *
+   * @return true   A valid record was found
+   * @return false  Running on default calibrations
+   */
+  bool isLoaded();
+
+}    // namespace System::CalStore
+
+#endif /* !ICHNAEA_SYSTEM_CAL_HPP */
@@ -11,13 +11,18 @@
 /*-----------------------------------------------------------------------------
 Includes
 -----------------------------------------------------------------------------*/
+#include <cstring>
+#include <etl/algorithm.h>
 #include <mbedutils/assert.hpp>
 #include <mbedutils/database.hpp>
 #include <mbedutils/logging.hpp>
 #include <mbedutils/util.hpp>
+#include <src/app/app_pdi.hpp>
 #include <src/integration/flashdb/fal_cfg.h>
+#include <src/system/system_boot_profile.hpp>
 #include <src/system/system_db.hpp>
 #include <src/system/system_error.hpp>
+#include <src/system/system_retained.hpp>
 #include <src/hw/nor.hpp>
 #include "fal_def.h"
 #include "mbedutils/drivers/database/db_kv_node.hpp"
@@ -42,7 +47,7 @@ namespace System::Database
   extern "C" const struct fal_flash_dev fdb_nor_flash0 = {
     .name       = ICHNAEA_DB_FLASH_DEV_NAME,
     .addr       = HW::NOR::FLASH_ADDR_MIN,
-    .len        = HW::NOR::FLASH_ADDR_MAX,
+    .len        = HW::NOR::DEVICE_SIZE,
     .blk_size   = HW::NOR::ERASE_BLOCK_SIZE,
     .ops        = { .init = HW::NOR::init, .read = HW::NOR::read, .write = HW::NOR::write, .erase = HW::NOR::erase },
     .write_gran = 1
@@ -121,6 +126,9 @@ namespace System::Database
       LOG_DEBUG( "Success" );
     }
 
+    const HW::NOR::CacheStats stats = HW::NOR::getCacheStats();
+    LOG_DEBUG( "PDI init NOR cache: %d hits, %d misses, %d device reads", stats.hits, stats.misses, stats.device_reads );
+
     s_db_ready = DRIVER_INITIALIZED_KEY;
   }
 
@@ -136,6 +144,9 @@ namespace System::Database
     using namespace mb;
     using namespace mb::db;
 
+    Boot::Profiler::ScopedStep _boot_step( ichnaea_BootStepId_BOOT_STEP_PDI_REGISTER,
+                                           static_cast<uint16_t>( node.hashKey ) );
+
     /*-------------------------------------------------------------------------
     Basic sanity checks on the input parameters/state
     -------------------------------------------------------------------------*/
@@ -144,10 +155,43 @@ namespace System::Database
     mbed_dbg_assert( s_db_ready == DRIVER_INITIALIZED_KEY );
 
     /*-------------------------------------------------------------------------
-    Insert the node into the database
+    Insert the node into the database, tracking writes so cached encodings of
+    the data can be invalidated.
     -------------------------------------------------------------------------*/
+    App::PDI::Internal::track_writes( node );
     mbed_assert_msg( s_pdi_kvdb.insert( node ), "PDI key %d insert fail", node.hashKey );
 
+    /*-------------------------------------------------------------------------
+    Coming out of a warm restart, the NVM backing was already verified by the
+    previous boot and the retained RAM cache holds the latest data. Restore
+    it directly and skip the NVM lookups.
+    -------------------------------------------------------------------------*/
+    if( Retained::isValid() )
+    {
+      const uint8_t *cache_start = reinterpret_cast<const uint8_t *>( &App::PDI::Internal::RAMCache );
+      const uint8_t *node_start  = static_cast<const uint8_t *>( node.datacache );
+      const size_t   offset      = static_cast<size_t>( node_start - cache_start );
+
+      if( offset < sizeof( App::PDI::PDIData ) )
+      {
+        const uint8_t *retained = reinterpret_cast<const uint8_t *>( &Retained::image().pdi );
+        memcpy( node.datacache, retained + offset, etl::min( size, sizeof( App::PDI::PDIData ) - offset ) );
+
+        /*---------------------------------------------------------------------
+        A write that was still waiting on the delayed I/O flush must survive
+        the restart, otherwise it never reaches NVM.
+        ---------------------------------------------------------------------*/
+        if( Retained::wasPdiDirty( node.hashKey ) )
+        {
+          auto iter = s_pdi_kvdb.find( node.hashKey );
+          mbed_dbg_assert( iter != nullptr );
+          iter->flags |= KV_FLAG_DIRTY;
+        }
+
+        return;
+      }
+    }
+
     /*-------------------------------------------------------------------------
     Insertion doesn't mean data fully "exists". Some keys are NVM backed and
     need explicit writes to the NVM cache before they are truly persistent.
@@ -18,6 +18,7 @@ Includes
 #include <src/ichnaea_config.hpp>
 #include <src/system/panic_handlers.hpp>
 #include <src/system/system_error.hpp>
+#include <src/system/system_flight_recorder.hpp>
 
 namespace Panic
 {
@@ -46,6 +47,11 @@ namespace Panic
   {
     s_last_error = code;
 
+    /*-------------------------------------------------------------------------
+    Start the flight recorder countdown so the lead up to a fault is kept
+    -------------------------------------------------------------------------*/
+    System::FlightRecorder::trigger( code );
+
     /*-------------------------------------------------------------------------
     Trap the system if configured and an error occurs
     -------------------------------------------------------------------------*/
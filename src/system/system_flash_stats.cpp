@@ -0,0 +1,457 @@
+/******************************************************************************
+ *  File Name:
+ *    system_flash_stats.cpp
+ *
+ *  Description:
+ *    NOR flash statistics implementation.
+ *
+ *    Counters live in RAM and are periodically written as a snapshot into the
+ *    dedicated "wear" NOR region. Each snapshot takes a whole sector and the
+ *    sectors are used round robin, so the newest valid snapshot always wins.
+ *    Per-sector erase counts are packed to 24 bits, which is still two orders
+ *    of magnitude past the rated endurance of the part.
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <cstring>
+#include <etl/algorithm.h>
+#include <etl/crc32.h>
+#include <mbedutils/assert.hpp>
+#include <mbedutils/interfaces/time_intf.hpp>
+#include <mbedutils/logging.hpp>
+#include <mbedutils/osal.hpp>
+#include <mbedutils/threading.hpp>
+#include <src/hw/nor.hpp>
+#include <src/integration/flashdb/fal_cfg.h>
+#include <src/system/system_flash_stats.hpp>
+
+namespace System::FlashStats
+{
+  /*---------------------------------------------------------------------------
+  Constants
+  ---------------------------------------------------------------------------*/
+
+  static constexpr uint32_t RECORD_MAGIC         = 0x57454152;
+  static constexpr uint16_t RECORD_VERSION       = 1;
+  static constexpr size_t   NUM_SECTORS          = ( ICHNAEA_DB_WEAR_RGN_START + ICHNAEA_DB_WEAR_RGN_SIZE ) / HW::NOR::ERASE_BLOCK_SIZE;
+  static constexpr size_t   NUM_SLOTS            = ICHNAEA_DB_WEAR_RGN_SIZE / HW::NOR::ERASE_BLOCK_SIZE;
+  static constexpr size_t   COUNTER_BYTES        = 3;
+  static constexpr uint32_t COUNTER_MAX          = 0xFFFFFF;
+  static constexpr uint32_t SAVE_ERASE_THRESHOLD = 64;
+  static constexpr size_t   SAVE_PERIOD_MS       = 60 * 60 * 1000;
+
+  static_assert( ( ICHNAEA_DB_WEAR_RGN_START + ICHNAEA_DB_WEAR_RGN_SIZE ) <= HW::NOR::DEVICE_SIZE,
+                 "Wear region must fit in the NOR device" );
+
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Everything that gets persisted
+   */
+  struct Body
+  {
+    Totals   totals;
+    uint32_t histograms[ OP_NUM_OPTIONS ][ LATENCY_BUCKETS ];
+    uint8_t  erase_counts[ NUM_SECTORS * COUNTER_BYTES ];
+  };
+
+  /**
+   * @brief Snapshot header, readable on its own during the slot scan
+   */
+  struct Header
+  {
+    uint32_t magic;    /**< Marks the slot as written */
+    uint16_t version;  /**< Layout version of the body */
+    uint16_t size;     /**< Size of the body */
+    uint32_t sequence; /**< Monotonic snapshot counter, highest wins */
+    uint32_t crc;      /**< CRC32 of the body */
+  };
+
+  /**
+   * @brief On-flash layout of a snapshot
+   */
+  struct Record
+  {
+    Header header;
+    Body   body;
+  };
+
+  static_assert( sizeof( Record ) <= HW::NOR::ERASE_BLOCK_SIZE, "Wear snapshot must fit in one sector" );
+
+  /*---------------------------------------------------------------------------
+  Static Data
+  ---------------------------------------------------------------------------*/
+
+  static mb::osal::mb_recursive_mutex_t s_stats_mutex; /**< Guards s_body */
+  static mb::osal::mb_recursive_mutex_t s_save_mutex;  /**< Serializes snapshots */
+  static bool                           s_mutex_built;
+  static bool                           s_ready;
+  static Body                           s_body;
+  static Record                         s_record;      /**< Snapshot scratch buffer */
+  static size_t                         s_slot;
+  static uint32_t                       s_sequence;
+  static uint32_t                       s_dirty_erases;
+  static bool                           s_dirty;
+  static volatile bool                  s_saving;
+  static size_t                         s_last_save;
+
+  /*---------------------------------------------------------------------------
+  Private Functions
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Gets the stats lock, building it on first use. The NOR driver
+   * starts recording before initialize() runs, while boot is still single
+   * threaded, so the lazy build can't race.
+   *
+   * @return mb::osal::mb_recursive_mutex_t&
+   */
+  static mb::osal::mb_recursive_mutex_t &stats_mutex()
+  {
+    if( !s_mutex_built )
+    {
+      mbed_assert( mb::osal::buildRecursiveMutexStrategy( s_stats_mutex ) );
+      s_mutex_built = true;
+    }
+
+    return s_stats_mutex;
+  }
+
+
+  static inline uint32_t get_count( const uint8_t *counts, const size_t sector )
+  {
+    const uint8_t *p = counts + ( sector * COUNTER_BYTES );
+    return static_cast<uint32_t>( p[ 0 ] ) | ( static_cast<uint32_t>( p[ 1 ] ) << 8 ) |
+           ( static_cast<uint32_t>( p[ 2 ] ) << 16 );
+  }
+
+
+  static inline void set_count( uint8_t *counts, const size_t sector, const uint32_t value )
+  {
+    const uint32_t clamped = etl::min( value, COUNTER_MAX );
+    uint8_t       *p       = counts + ( sector * COUNTER_BYTES );
+
+    p[ 0 ] = static_cast<uint8_t>( clamped & 0xFF );
+    p[ 1 ] = static_cast<uint8_t>( ( clamped >> 8 ) & 0xFF );
+    p[ 2 ] = static_cast<uint8_t>( ( clamped >> 16 ) & 0xFF );
+  }
+
+
+  static inline size_t bucket_index( const uint32_t latency_us )
+  {
+    if( latency_us < 2 )
+    {
+      return 0;
+    }
+
+    return etl::min<size_t>( 31 - __builtin_clz( latency_us ), LATENCY_BUCKETS - 1 );
+  }
+
+
+  static inline long slot_address( const size_t slot )
+  {
+    return ICHNAEA_DB_WEAR_RGN_START + ( slot * HW::NOR::ERASE_BLOCK_SIZE );
+  }
+
+
+  static uint32_t calc_body_crc( const Body &body )
+  {
+    const uint8_t *start = reinterpret_cast<const uint8_t *>( &body );
+    return etl::crc32( start, start + sizeof( body ) ).value();
+  }
+
+
+  static inline bool header_valid( const Header &header )
+  {
+    return ( header.magic == RECORD_MAGIC ) && ( header.version == RECORD_VERSION ) && ( header.size == sizeof( Body ) );
+  }
+
+
+  /**
+   * @brief Finds the newest snapshot with an intact body and loads it into
+   * s_record.
+   *
+   * @return true   A snapshot was loaded
+   * @return false  No valid snapshot exists
+   */
+  static bool load_newest()
+  {
+    bool     rejected[ NUM_SLOTS ] = {};
+    uint32_t sequence[ NUM_SLOTS ] = {};
+    bool     present[ NUM_SLOTS ]  = {};
+
+    /*-------------------------------------------------------------------------
+    Headers are cheap to read, so walk them first
+    -------------------------------------------------------------------------*/
+    for( size_t slot = 0; slot < NUM_SLOTS; slot++ )
+    {
+      Header header;
+      if( HW::NOR::read( slot_address( slot ), reinterpret_cast<uint8_t *>( &header ), sizeof( header ) ) < 0 )
+      {
+        continue;
+      }
+
+      present[ slot ]  = header_valid( header );
+      sequence[ slot ] = header.sequence;
+    }
+
+    /*-------------------------------------------------------------------------
+    Try the newest first, falling back if its body is torn
+    -------------------------------------------------------------------------*/
+    while( true )
+    {
+      bool   found = false;
+      size_t best  = 0;
+
+      for( size_t slot = 0; slot < NUM_SLOTS; slot++ )
+      {
+        if( present[ slot ] && !rejected[ slot ] && ( !found || ( sequence[ slot ] > sequence[ best ] ) ) )
+        {
+          best  = slot;
+          found = true;
+        }
+      }
+
+      if( !found )
+      {
+        return false;
+      }
+
+      if( ( HW::NOR::read( slot_address( best ), reinterpret_cast<uint8_t *>( &s_record ), sizeof( s_record ) ) >= 0 ) &&
+          header_valid( s_record.header ) && ( s_record.header.crc == calc_body_crc( s_record.body ) ) )
+      {
+        s_slot     = best;
+        s_sequence = s_record.header.sequence;
+        return true;
+      }
+
+      LOG_WARN( "Wear snapshot in slot %d failed CRC", best );
+      rejected[ best ] = true;
+    }
+  }
+
+
+  /**
+   * @brief Adds the persisted statistics onto what has been counted this boot
+   *
+   * @param persisted Snapshot loaded from flash
+   */
+  static void merge( const Body &persisted )
+  {
+    s_body.totals.bytes_read += persisted.totals.bytes_read;
+    s_body.totals.bytes_programmed += persisted.totals.bytes_programmed;
+    s_body.totals.read_ops += persisted.totals.read_ops;
+    s_body.totals.program_ops += persisted.totals.program_ops;
+    s_body.totals.erase_ops += persisted.totals.erase_ops;
+
+    for( size_t op = 0; op < OP_NUM_OPTIONS; op++ )
+    {
+      for( size_t idx = 0; idx < LATENCY_BUCKETS; idx++ )
+      {
+        s_body.histograms[ op ][ idx ] += persisted.histograms[ op ][ idx ];
+      }
+    }
+
+    for( size_t sector = 0; sector < NUM_SECTORS; sector++ )
+    {
+      set_count( s_body.erase_counts, sector,
+                 get_count( s_body.erase_counts, sector ) + get_count( persisted.erase_counts, sector ) );
+    }
+  }
+
+
+  static void mark_dirty( const uint32_t erases )
+  {
+    /* Snapshot writes shouldn't schedule the next snapshot */
+    if( !s_saving )
+    {
+      s_dirty = true;
+      s_dirty_erases += erases;
+    }
+  }
+
+  /*---------------------------------------------------------------------------
+  Public Functions
+  ---------------------------------------------------------------------------*/
+
+  void initialize()
+  {
+    mbed_assert( mb::osal::buildRecursiveMutexStrategy( s_save_mutex ) );
+
+    s_slot      = NUM_SLOTS - 1;
+    s_sequence  = 0;
+    s_last_save = mb::time::millis();
+
+    /*-------------------------------------------------------------------------
+    Load without holding the stats lock, the NOR driver records these reads
+    -------------------------------------------------------------------------*/
+    const bool loaded = load_newest();
+
+    {
+      mb::thread::RecursiveLockGuard lock( stats_mutex() );
+
+      if( loaded )
+      {
+        merge( s_record.body );
+      }
+
+      s_ready = true;
+    }
+
+    if( loaded )
+    {
+      LOG_INFO( "Loaded wear snapshot %d, %d lifetime erases", s_sequence,
+                static_cast<uint32_t>( s_body.totals.erase_ops ) );
+    }
+    else
+    {
+      LOG_INFO( "No wear snapshot found, starting fresh" );
+    }
+  }
+
+
+  void recordRead( const size_t bytes, const uint32_t latency_us )
+  {
+    mb::thread::RecursiveLockGuard lock( stats_mutex() );
+
+    s_body.totals.bytes_read += bytes;
+    s_body.totals.read_ops++;
+    s_body.histograms[ OP_READ ][ bucket_index( latency_us ) ]++;
+  }
+
+
+  void recordProgram( const size_t bytes, const uint32_t latency_us )
+  {
+    mb::thread::RecursiveLockGuard lock( stats_mutex() );
+
+    s_body.totals.bytes_programmed += bytes;
+    s_body.totals.program_ops++;
+    s_body.histograms[ OP_PROGRAM ][ bucket_index( latency_us ) ]++;
+    mark_dirty( 0 );
+  }
+
+
+  void recordErase( const long address, const uint32_t latency_us )
+  {
+    mb::thread::RecursiveLockGuard lock( stats_mutex() );
+
+    const size_t sector = static_cast<size_t>( address ) / HW::NOR::ERASE_BLOCK_SIZE;
+    if( sector < NUM_SECTORS )
+    {
+      set_count( s_body.erase_counts, sector, get_count( s_body.erase_counts, sector ) + 1 );
+    }
+
+    s_body.totals.erase_ops++;
+    s_body.histograms[ OP_ERASE ][ bucket_index( latency_us ) ]++;
+    mark_dirty( 1 );
+  }
+
+
+  void process()
+  {
+    if( !s_ready || !s_dirty )
+    {
+      return;
+    }
+
+    if( ( s_dirty_erases >= SAVE_ERASE_THRESHOLD ) || ( ( mb::time::millis() - s_last_save ) >= SAVE_PERIOD_MS ) )
+    {
+      save();
+    }
+  }
+
+
+  bool save()
+  {
+    if( !s_ready )
+    {
+      return false;
+    }
+
+    mb::thread::RecursiveLockGuard save_lock( s_save_mutex );
+
+    /*-------------------------------------------------------------------------
+    Copy out the counters. The stats lock must not be held across the flash
+    calls below, since the NOR driver records into these same counters while
+    holding its own locks.
+    -------------------------------------------------------------------------*/
+    {
+      mb::thread::RecursiveLockGuard lock( stats_mutex() );
+
+      s_record.body  = s_body;
+      s_dirty        = false;
+      s_dirty_erases = 0;
+    }
+
+    s_record.header.magic    = RECORD_MAGIC;
+    s_record.header.version  = RECORD_VERSION;
+    s_record.header.size     = sizeof( Body );
+    s_record.header.sequence = s_sequence + 1;
+    s_record.header.crc      = calc_body_crc( s_record.body );
+
+    /*-------------------------------------------------------------------------
+    Write into the oldest slot. The previous snapshot stays intact until the
+    next one lands, so a power loss here costs at most one save period.
+    -------------------------------------------------------------------------*/
+    const size_t slot    = ( s_slot + 1 ) % NUM_SLOTS;
+    const long   address = slot_address( slot );
+
+    s_saving = true;
+    const bool ok = ( HW::NOR::erase( address, HW::NOR::ERASE_BLOCK_SIZE ) >= 0 ) &&
+                    ( HW::NOR::write( address, reinterpret_cast<const uint8_t *>( &s_record ), sizeof( s_record ) ) >= 0 );
+    s_saving = false;
+
+    s_last_save = mb::time::millis();
+
+    if( !ok )
+    {
+      LOG_ERROR( "Failed to write wear snapshot @ 0x%08X", address );
+      return false;
+    }
+
+    s_slot     = slot;
+    s_sequence = s_record.header.sequence;
+    return true;
+  }
+
+
+  Totals totals()
+  {
+    mb::thread::RecursiveLockGuard lock( stats_mutex() );
+    return s_body.totals;
+  }
+
+
+  void histogram( const Op op, uint32_t ( &dst )[ LATENCY_BUCKETS ] )
+  {
+    mbed_dbg_assert( op < OP_NUM_OPTIONS );
+
+    mb::thread::RecursiveLockGuard lock( stats_mutex() );
+    memcpy( dst, s_body.histograms[ op ], sizeof( dst ) );
+  }
+
+
+  size_t numSectors()
+  {
+    return NUM_SECTORS;
+  }
+
+
+  uint32_t sectorEraseCount( const size_t sector )
+  {
+    if( sector >= NUM_SECTORS )
+    {
+      return 0;
+    }
+
+    mb::thread::RecursiveLockGuard lock( stats_mutex() );
+    return get_count( s_body.erase_counts, sector );
+  }
+
+}    // namespace System::FlashStats
@@ -0,0 +1,146 @@
+/******************************************************************************
+ *  File Name:
+ *    system_flash_stats.hpp
+ *
+ *  Description:
+ *    NOR flash wear and latency statistics, persisted across power cycles
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+#pragma once
+#ifndef ICHNAEA_SYSTEM_FLASH_STATS_HPP
+#define ICHNAEA_SYSTEM_FLASH_STATS_HPP
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <cstddef>
+#include <cstdint>
+
+namespace System::FlashStats
+{
+  /*---------------------------------------------------------------------------
+  Constants
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Number of log2 latency buckets per operation. Bucket 0 counts ops
+   * under 2us, bucket N counts ops in [2^N, 2^(N+1)) us and the last bucket
+   * catches everything slower.
+   */
+  static constexpr size_t LATENCY_BUCKETS = 20;
+
+  /*---------------------------------------------------------------------------
+  Enumerations
+  ---------------------------------------------------------------------------*/
+
+  enum Op : uint8_t
+  {
+    OP_READ,
+    OP_PROGRAM,
+    OP_ERASE,
+
+    OP_NUM_OPTIONS
+  };
+
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Lifetime totals across every sector
+   */
+  struct Totals
+  {
+    uint64_t bytes_read;       /**< Bytes read from the device */
+    uint64_t bytes_programmed; /**< Bytes programmed into the device */
+    uint64_t read_ops;         /**< Read transactions */
+    uint64_t program_ops;      /**< Program calls */
+    uint64_t erase_ops;        /**< Sector erases */
+  };
+
+  /*---------------------------------------------------------------------------
+  Public Functions
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Load the persisted statistics and merge in anything counted so far
+   * this boot.
+   *
+   * Flash is already in use before this runs, so counting starts on the
+   * first NOR access and this only folds in the lifetime history.
+   */
+  void initialize();
+
+  /**
+   * @brief Record a read transaction issued to the device
+   *
+   * @param bytes       Bytes read
+   * @param latency_us  Time the transaction took
+   */
+  void recordRead( const size_t bytes, const uint32_t latency_us );
+
+  /**
+   * @brief Record a program issued to the device
+   *
+   * @param bytes       Bytes programmed
+   * @param latency_us  Time until the device went idle
+   */
+  void recordProgram( const size_t bytes, const uint32_t latency_us );
+
+  /**
+   * @brief Record a single sector erase
+   *
+   * @param address     Any address inside the erased sector
+   * @param latency_us  Time until the device went idle
+   */
+  void recordErase( const long address, const uint32_t latency_us );
+
+  /**
+   * @brief Periodic processing. Persists the statistics once enough erases
+   * have built up or the save period expires.
+   */
+  void process();
+
+  /**
+   * @brief Persist the statistics now
+   *
+   * @return true   Snapshot written
+   * @return false  Flash error
+   */
+  bool save();
+
+  /**
+   * @brief Get a snapshot of the lifetime totals
+   *
+   * @return Totals
+   */
+  Totals totals();
+
+  /**
+   * @brief Copy out the latency histogram for an operation
+   *
+   * @param op    Which operation
+   * @param dst   Where to place the bucket counts
+   */
+  void histogram( const Op op, uint32_t ( &dst )[ LATENCY_BUCKETS ] );
+
+  /**
+   * @brief Number of sectors with erase counters
+   *
+   * @return size_t
+   */
+  size_t numSectors();
+
+  /**
+   * @brief Lifetime erase count of a sector
+   *
+   * @param sector  Sector index, ie address / HW::NOR::ERASE_BLOCK_SIZE
+   * @return uint32_t
+   */
+  uint32_t sectorEraseCount( const size_t sector );
+
+}    // namespace System::FlashStats
+
+#endif /* !ICHNAEA_SYSTEM_FLASH_STATS_HPP */
@@ -0,0 +1,277 @@
+/******************************************************************************
+ *  File Name:
+ *    system_flight_recorder.cpp
+ *
+ *  Description:
+ *    Flight recorder implementation
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <atomic>
+#include <cstring>
+#include <etl/algorithm.h>
+#include <mbedutils/interfaces/time_intf.hpp>
+#include <mbedutils/logging.hpp>
+#include <src/system/system_flight_recorder.hpp>
+#include <src/system/system_logging.hpp>
+
+namespace System::FlightRecorder
+{
+  /*---------------------------------------------------------------------------
+  Constants
+  ---------------------------------------------------------------------------*/
+
+  static_assert( ( DEPTH & ( DEPTH - 1 ) ) == 0, "Depth must be a power of two" );
+  static_assert( ( DEFAULT_PRE_TRIGGER + DEFAULT_POST_TRIGGER ) <= DEPTH );
+
+  /**
+   * @brief First byte of a persisted capture entry. Keeps them apart from text
+   * and binary log records in the log region. The host decodes these entries
+   * in app/ichnaea/binlog.py, keep the layouts below in sync with it.
+   */
+  static constexpr uint8_t PERSIST_TAG = 0xFD;
+
+  /**
+   * @brief Samples written per log entry when persisting
+   */
+  static constexpr size_t PERSIST_CHUNK = 32;
+
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Layout of a persisted capture entry, followed by the samples
+   */
+  struct PersistHeader
+  {
+    uint8_t  tag;    /**< Always PERSIST_TAG */
+    uint8_t  code;   /**< Panic::ErrorCode that froze the capture */
+    uint16_t offset; /**< Window index of the first sample in this entry */
+    uint16_t total;  /**< Samples in the whole window */
+    uint16_t count;  /**< Samples in this entry */
+  } __attribute__( ( packed ) );
+
+  struct PersistSample
+  {
+    uint32_t time;
+    uint8_t  channel;
+    float    raw;
+    float    value;
+  } __attribute__( ( packed ) );
+
+  /*---------------------------------------------------------------------------
+  Static Data
+  ---------------------------------------------------------------------------*/
+
+  static Sample                s_buffer[ DEPTH ];
+  static std::atomic<uint32_t> s_head;          /**< Total samples recorded since arming */
+  static volatile State        s_state;
+  static uint32_t              s_trigger_index; /**< Value of s_head at the trigger */
+  static volatile uint32_t     s_window_end;    /**< Value of s_head that freezes the window */
+  static uint32_t              s_trigger_time;
+  static Panic::ErrorCode      s_trigger_code;
+  static size_t                s_pre;
+  static size_t                s_post;
+  static bool                  s_persist;
+  static bool                  s_persisted;
+
+  /*---------------------------------------------------------------------------
+  Private Functions
+  ---------------------------------------------------------------------------*/
+
+  static bool is_fault_code( const Panic::ErrorCode code )
+  {
+    using namespace Panic;
+
+    return ( ( code >= ErrorCode::_ERR_MONITOR_START ) && ( code < ErrorCode::_ERR_MONITOR_END ) ) ||
+           ( ( code >= ErrorCode::_ERR_LTC_START ) && ( code < ErrorCode::_ERR_LTC_END ) );
+  }
+
+
+  /**
+   * @brief Ring index of the first sample in the captured window
+   */
+  static uint32_t window_start()
+  {
+    return s_trigger_index - etl::min<uint32_t>( s_pre, s_trigger_index );
+  }
+
+  /*---------------------------------------------------------------------------
+  Public Functions
+  ---------------------------------------------------------------------------*/
+
+  void initialize()
+  {
+    s_pre     = DEFAULT_PRE_TRIGGER;
+    s_post    = DEFAULT_POST_TRIGGER;
+    s_persist = false;
+    rearm();
+  }
+
+
+  void record( const uint8_t channel, const float raw, const float value )
+  {
+    /*-------------------------------------------------------------------------
+    Claim a slot, but never past the end of a triggered window. Anything beyond
+    it would wrap around onto the oldest pre-trigger samples.
+    -------------------------------------------------------------------------*/
+    uint32_t idx = s_head.load( std::memory_order_relaxed );
+    do
+    {
+      const State state = s_state;
+      if( ( state == State::FROZEN ) || ( ( state == State::TRIGGERED ) && ( idx >= s_window_end ) ) )
+      {
+        return;
+      }
+    } while( !s_head.compare_exchange_weak( idx, idx + 1, std::memory_order_relaxed ) );
+
+    Sample &sample = s_buffer[ idx & ( DEPTH - 1 ) ];
+
+    sample.time    = static_cast<uint32_t>( mb::time::millis() );
+    sample.channel = channel;
+    sample.raw     = raw;
+    sample.value   = value;
+
+    if( ( s_state == State::TRIGGERED ) && ( ( idx + 1u ) >= s_window_end ) )
+    {
+      s_state = State::FROZEN;
+    }
+  }
+
+
+  void trigger( const Panic::ErrorCode code )
+  {
+    if( ( s_state != State::ARMED ) || !is_fault_code( code ) )
+    {
+      return;
+    }
+
+    s_trigger_code  = code;
+    s_trigger_time  = static_cast<uint32_t>( mb::time::millis() );
+    s_trigger_index = s_head.load( std::memory_order_relaxed );
+    s_window_end    = s_trigger_index + static_cast<uint32_t>( s_post );
+    s_state         = ( s_post == 0 ) ? State::FROZEN : State::TRIGGERED;
+  }
+
+
+  void rearm( const size_t pre, const size_t post )
+  {
+    s_state = State::FROZEN;
+
+    if( pre || post )
+    {
+      s_pre  = pre ? pre : s_pre;
+      s_post = post ? post : s_post;
+
+      /*-----------------------------------------------------------------------
+      The whole window has to fit in the ring. Trim the pre-trigger side first.
+      -----------------------------------------------------------------------*/
+      s_post = etl::min( s_post, DEPTH );
+      s_pre  = etl::min( s_pre, DEPTH - s_post );
+    }
+
+    s_head.store( 0, std::memory_order_relaxed );
+    s_trigger_index = 0;
+    s_window_end    = 0;
+    s_trigger_time  = 0;
+    s_trigger_code  = Panic::ErrorCode::NO_ERROR;
+    s_persisted     = false;
+    s_state         = State::ARMED;
+  }
+
+
+  Capture capture()
+  {
+    Capture cap;
+
+    cap.state         = s_state;
+    cap.trigger_code  = s_trigger_code;
+    cap.trigger_time  = s_trigger_time;
+    cap.count         = 0;
+    cap.trigger_index = 0;
+
+    if( s_state == State::FROZEN )
+    {
+      cap.count         = s_window_end - window_start();
+      cap.trigger_index = s_trigger_index - window_start();
+    }
+
+    return cap;
+  }
+
+
+  size_t read( const size_t offset, Sample *const dst, const size_t count )
+  {
+    if( ( s_state != State::FROZEN ) || !dst )
+    {
+      return 0;
+    }
+
+    const uint32_t start = window_start();
+    const size_t   total = s_window_end - start;
+    size_t         idx   = 0;
+
+    for( ; ( idx < count ) && ( ( offset + idx ) < total ); idx++ )
+    {
+      dst[ idx ] = s_buffer[ ( start + offset + idx ) & ( DEPTH - 1 ) ];
+    }
+
+    return idx;
+  }
+
+
+  void setPersist( const bool enable )
+  {
+    s_persist = enable;
+  }
+
+
+  void process()
+  {
+    if( !s_persist || s_persisted || ( s_state != State::FROZEN ) )
+    {
+      return;
+    }
+
+    s_persisted = true;
+
+    /*-------------------------------------------------------------------------
+    Write the window out in chunks small enough for a single log entry
+    -------------------------------------------------------------------------*/
+    static struct
+    {
+      PersistHeader header;
+      PersistSample samples[ PERSIST_CHUNK ];
+    } __attribute__( ( packed ) ) entry;
+
+    static Sample chunk[ PERSIST_CHUNK ];
+
+    const size_t total = capture().count;
+
+    for( size_t offset = 0; offset < total; offset += PERSIST_CHUNK )
+    {
+      const size_t count = read( offset, chunk, PERSIST_CHUNK );
+
+      entry.header.tag    = PERSIST_TAG;
+      entry.header.code   = static_cast<uint8_t>( s_trigger_code );
+      entry.header.offset = static_cast<uint16_t>( offset );
+      entry.header.total  = static_cast<uint16_t>( total );
+      entry.header.count  = static_cast<uint16_t>( count );
+
+      for( size_t idx = 0; idx < count; idx++ )
+      {
+        entry.samples[ idx ] = { chunk[ idx ].time, chunk[ idx ].channel, chunk[ idx ].raw, chunk[ idx ].value };
+      }
+
+      Logging::store( mb::logging::Level::LVL_ERROR, &entry, sizeof( PersistHeader ) + count * sizeof( PersistSample ) );
+    }
+
+    LOG_INFO( "Flight recorder capture of %d samples saved to the log", static_cast<int>( total ) );
+  }
+
+}    // namespace System::FlightRecorder
@@ -0,0 +1,171 @@
+/******************************************************************************
+ *  File Name:
+ *    system_flight_recorder.hpp
+ *
+ *  Description:
+ *    RAM flight recorder of every monitor sample and LTC setpoint change. The
+ *    buffer freezes around the first monitor or LTC fault so the lead up to
+ *    it can be read back over RPC.
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+#pragma once
+#ifndef ICHNAEA_SYSTEM_FLIGHT_RECORDER_HPP
+#define ICHNAEA_SYSTEM_FLIGHT_RECORDER_HPP
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <cstddef>
+#include <cstdint>
+#include <src/system/system_error.hpp>
+#include <src/system/system_sensor.hpp>
+
+namespace System::FlightRecorder
+{
+  /*---------------------------------------------------------------------------
+  Constants
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Samples held in the ring. Must be a power of two.
+   */
+  static constexpr size_t DEPTH = 1024;
+
+  static constexpr size_t DEFAULT_PRE_TRIGGER  = 768; /**< Samples kept from before the fault */
+  static constexpr size_t DEFAULT_POST_TRIGGER = 256; /**< Samples kept from after the fault */
+
+  /*---------------------------------------------------------------------------
+  Enumerations
+  ---------------------------------------------------------------------------*/
+
+  enum class State : uint8_t
+  {
+    ARMED,     /**< Recording, waiting on a fault */
+    TRIGGERED, /**< Fault seen, filling the post-trigger window */
+    FROZEN,    /**< Window captured, recording stopped */
+  };
+
+  /**
+   * @brief Source of a sample. Sensor elements map straight across, LTC
+   * setpoints follow them.
+   */
+  enum Channel : uint8_t
+  {
+    CH_SENSOR_FIRST = 0,
+    CH_LTC_VOUT_SETPOINT = static_cast<uint8_t>( System::Sensor::Element::NUM_OPTIONS ),
+    CH_LTC_IOUT_SETPOINT,
+    CH_LTC_FAULT_BITS,
+
+    CH_NUM_OPTIONS
+  };
+
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief One recorded data point. For sensors raw is the ADC measurement
+   * and value the filter output. For setpoints raw is the requested value and
+   * value the register code programmed into the LTC.
+   */
+  struct Sample
+  {
+    uint32_t time;    /**< System time in milliseconds */
+    uint8_t  channel; /**< Channel of the sample */
+    float    raw;     /**< Unprocessed value */
+    float    value;   /**< Processed value */
+  };
+
+  /**
+   * @brief Description of the captured window
+   */
+  struct Capture
+  {
+    State            state;         /**< Recorder state */
+    Panic::ErrorCode trigger_code;  /**< Error that froze the recorder */
+    uint32_t         trigger_time;  /**< System time of the trigger */
+    size_t           count;         /**< Samples in the window */
+    size_t           trigger_index; /**< Index of the first sample after the trigger */
+  };
+
+  /*---------------------------------------------------------------------------
+  Public Functions
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Reset and arm the recorder with the default window
+   */
+  void initialize();
+
+  /**
+   * @brief Record a sample. Does nothing once the recorder has frozen.
+   *
+   * @param channel   Source of the sample
+   * @param raw       Unprocessed value
+   * @param value     Processed value
+   */
+  void record( const uint8_t channel, const float raw, const float value );
+
+  /**
+   * @brief Record a sensor sample and its filter output
+   *
+   * @param element   Sensor that was sampled
+   * @param raw       Measurement
+   * @param filtered  Filter output
+   */
+  static inline void record( const System::Sensor::Element element, const float raw, const float filtered )
+  {
+    record( static_cast<uint8_t>( element ), raw, filtered );
+  }
+
+  /**
+   * @brief Start the post-trigger countdown if the error is a monitor or LTC
+   * fault. Only the first fault after arming is captured.
+   *
+   * @param code  Error that occurred
+   */
+  void trigger( const Panic::ErrorCode code );
+
+  /**
+   * @brief Discard the capture and start recording again
+   *
+   * @param pre   Samples to keep from before the trigger, 0 keeps the current setting
+   * @param post  Samples to keep from after the trigger, 0 keeps the current setting
+   */
+  void rearm( const size_t pre = 0, const size_t post = 0 );
+
+  /**
+   * @brief Get a description of the captured window
+   *
+   * @return Capture
+   */
+  Capture capture();
+
+  /**
+   * @brief Copy samples out of the window. Only meaningful once frozen.
+   *
+   * @param offset  First sample of the window to copy
+   * @param dst     Where to put the samples
+   * @param count   Most samples to copy
+   * @return size_t Samples copied
+   */
+  size_t read( const size_t offset, Sample *const dst, const size_t count );
+
+  /**
+   * @brief Enable writing frozen captures to the NOR log region
+   *
+   * @param enable  True to persist captures
+   */
+  void setPersist( const bool enable );
+
+  /**
+   * @brief Persist a newly frozen capture if enabled. Called periodically
+   * from the delayed IO thread.
+   */
+  void process();
+
+}    // namespace System::FlightRecorder
+
+#endif /* !ICHNAEA_SYSTEM_FLIGHT_RECORDER_HPP */
@@ -0,0 +1,219 @@
+/******************************************************************************
+ *  File Name:
+ *    system_log_limit.cpp
+ *
+ *  Description:
+ *    Per call site log rate limiting implementation
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <etl/algorithm.h>
+#include <etl/array.h>
+#include <mbedutils/interfaces/irq_intf.hpp>
+#include <mbedutils/interfaces/time_intf.hpp>
+#include <mbedutils/logging.hpp>
+#include <src/system/system_log_limit.hpp>
+
+namespace Logging::RateLimit
+{
+  /*---------------------------------------------------------------------------
+  Constants
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Buckets applied at boot, indexed by mb::logging::Level. Traces are
+   * the chattiest and get the tightest budget. Errors and fatals are never
+   * limited so nothing serious is hidden by default.
+   */
+  static constexpr Limit DEFAULT_LIMITS[ NUM_LEVELS ] = {
+    { 5, 1000 },  /* TRACE */
+    { 5, 1000 },  /* DEBUG */
+    { 10, 500 },  /* INFO  */
+    { 5, 1000 },  /* WARN  */
+    { 0, 0 },     /* ERROR */
+    { 0, 0 },     /* FATAL */
+  };
+
+  /*---------------------------------------------------------------------------
+  Static Data
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Site and limit state. Guarded by disabling interrupts rather than a
+   * mutex, since admit() runs on every log call and that includes ISRs.
+   */
+  static Limit         s_limits[ NUM_LEVELS ];
+  static Site         *s_sites;
+  static uint32_t      s_suppressed;
+  static volatile bool s_initialized;
+
+  /*---------------------------------------------------------------------------
+  Private Functions
+  ---------------------------------------------------------------------------*/
+
+  static size_t level_index( const mb::logging::Level level )
+  {
+    return etl::min<size_t>( static_cast<size_t>( level ), NUM_LEVELS - 1u );
+  }
+
+
+  /**
+   * @brief Logs how many messages a site dropped. Goes straight to the log
+   * sinks so it can't be limited itself.
+   */
+  static void emit_summary( const uint8_t level, const char *fmt, const uint32_t count )
+  {
+    etl::array<char, 128> buffer;
+
+    const int size = npf_snprintf( buffer.data(), buffer.size(), "Suppressed %lu repeats of \"%s\"\r\n",
+                                   static_cast<unsigned long>( count ), fmt );
+    if( size > 0 )
+    {
+      mb::logging::log( static_cast<mb::logging::Level>( level ), buffer.data(),
+                        etl::min<size_t>( static_cast<size_t>( size ), buffer.size() - 1u ) );
+    }
+  }
+
+  /*---------------------------------------------------------------------------
+  Public Functions
+  ---------------------------------------------------------------------------*/
+
+  void initialize()
+  {
+    for( size_t idx = 0; idx < NUM_LEVELS; idx++ )
+    {
+      s_limits[ idx ] = DEFAULT_LIMITS[ idx ];
+    }
+
+    s_sites       = nullptr;
+    s_suppressed  = 0;
+    s_initialized = true;
+  }
+
+
+  bool admit( Site &site, const mb::logging::Level level )
+  {
+    if( !s_initialized )
+    {
+      return true;
+    }
+
+    const uint32_t now = static_cast<uint32_t>( mb::time::millis() );
+
+    mb::irq::disable_interrupts();
+    const Limit limit = s_limits[ level_index( level ) ];
+    if( limit.burst == 0 )
+    {
+      mb::irq::enable_interrupts();
+      return true;
+    }
+
+    /*-------------------------------------------------------------------------
+    First message from this site, start it off with a full bucket
+    -------------------------------------------------------------------------*/
+    if( !site.registered )
+    {
+      site.registered  = true;
+      site.tokens      = limit.burst;
+      site.last_refill = now;
+      site.next        = s_sites;
+      s_sites          = &site;
+    }
+
+    site.level = static_cast<uint8_t>( level );
+
+    /*-------------------------------------------------------------------------
+    Credit the tokens earned since the last refill
+    -------------------------------------------------------------------------*/
+    const uint32_t earned = ( limit.refill_ms != 0 ) ? ( ( now - site.last_refill ) / limit.refill_ms ) : limit.burst;
+    if( earned != 0 )
+    {
+      site.tokens      = static_cast<uint16_t>( etl::min<uint32_t>( site.tokens + earned, limit.burst ) );
+      site.last_refill = now;
+    }
+
+    if( site.tokens == 0 )
+    {
+      site.suppressed++;
+      site.last_drop = now;
+      s_suppressed++;
+      mb::irq::enable_interrupts();
+      return false;
+    }
+
+    site.tokens--;
+    const uint32_t pending = site.suppressed;
+    site.suppressed        = 0;
+    mb::irq::enable_interrupts();
+
+    /*-------------------------------------------------------------------------
+    The burst is over. Account for what was dropped before the new message.
+    -------------------------------------------------------------------------*/
+    if( pending != 0 )
+    {
+      emit_summary( static_cast<uint8_t>( level ), site.fmt, pending );
+    }
+
+    return true;
+  }
+
+
+  void process()
+  {
+    if( !s_initialized )
+    {
+      return;
+    }
+
+    const uint32_t now = static_cast<uint32_t>( mb::time::millis() );
+
+    for( Site *site = s_sites; site != nullptr; site = site->next )
+    {
+      uint32_t pending = 0;
+      uint8_t  level   = 0;
+
+      mb::irq::disable_interrupts();
+      if( ( site->suppressed != 0 ) && ( ( now - site->last_drop ) >= QUIET_PERIOD_MS ) )
+      {
+        pending          = site->suppressed;
+        level            = site->level;
+        site->suppressed = 0;
+      }
+      mb::irq::enable_interrupts();
+
+      if( pending != 0 )
+      {
+        emit_summary( level, site->fmt, pending );
+      }
+    }
+  }
+
+
+  void setLimit( const mb::logging::Level level, const uint16_t burst, const uint16_t refill_ms )
+  {
+    mb::irq::disable_interrupts();
+    s_limits[ level_index( level ) ] = { burst, refill_ms };
+    mb::irq::enable_interrupts();
+  }
+
+
+  Limit getLimit( const mb::logging::Level level )
+  {
+    mb::irq::disable_interrupts();
+    const Limit limit = s_limits[ level_index( level ) ];
+    mb::irq::enable_interrupts();
+
+    return limit;
+  }
+
+
+  uint32_t suppressedCount()
+  {
+    return s_suppressed;
+  }
+
+}    // namespace Logging::RateLimit
@@ -0,0 +1,150 @@
+/******************************************************************************
+ *  File Name:
+ *    system_log_limit.hpp
+ *
+ *  Description:
+ *    Per call site rate limiting of log messages. Each site owns a token
+ *    bucket sized by the severity of its messages. Messages over the limit are
+ *    counted and later reported as a single "repeated N times" record.
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+#pragma once
+#ifndef ICHNAEA_SYSTEM_LOG_LIMIT_HPP
+#define ICHNAEA_SYSTEM_LOG_LIMIT_HPP
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <cstddef>
+#include <cstdint>
+#include <mbedutils/logging.hpp>
+
+namespace Logging::RateLimit
+{
+  /*---------------------------------------------------------------------------
+  Constants
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Number of mb::logging::Level values that can be configured
+   */
+  static constexpr size_t NUM_LEVELS = 6;
+
+  /**
+   * @brief How long a site must stay quiet before its suppressed count is
+   * reported on its own, rather than ahead of its next admitted message.
+   */
+  static constexpr uint32_t QUIET_PERIOD_MS = 1000;
+
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Token bucket parameters for one log level
+   */
+  struct Limit
+  {
+    uint16_t burst;     /**< Messages allowed back to back. Zero disables limiting. */
+    uint16_t refill_ms; /**< Time to earn back one token */
+  };
+
+  /**
+   * @brief State of a single logging call site. Declared as a function local
+   * static by the logging macros, so it must stay constant initialized.
+   */
+  struct Site
+  {
+    constexpr Site( const char *format ) :
+        fmt( format ), next( nullptr ), last_refill( 0 ), last_drop( 0 ), suppressed( 0 ), tokens( 0 ), level( 0 ),
+        registered( false )
+    {
+    }
+
+    const char *fmt;         /**< Format string of the call site */
+    Site       *next;        /**< Next site in the registry */
+    uint32_t    last_refill; /**< System time tokens were last added */
+    uint32_t    last_drop;   /**< System time of the last suppressed message */
+    uint32_t    suppressed;  /**< Messages dropped since the last summary */
+    uint16_t    tokens;      /**< Messages that may still be emitted */
+    uint8_t     level;       /**< Level of the last message at this site */
+    bool        registered;  /**< Site has been added to the registry */
+  };
+
+  /*---------------------------------------------------------------------------
+  Public Functions
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Prepare the rate limiter. Until this runs every message is admitted.
+   */
+  void initialize();
+
+  /**
+   * @brief Decide whether a call site may emit a message right now. If the
+   * site had messages suppressed, a summary of them is logged first.
+   *
+   * @param site    Call site state
+   * @param level   Severity of the message
+   * @return true   Message may be emitted
+   * @return false  Message is over the limit and was counted
+   */
+  bool admit( Site &site, const mb::logging::Level level );
+
+  /**
+   * @brief Report suppressed messages for sites that have gone quiet. Called
+   * periodically by the logging thread.
+   */
+  void process();
+
+  /**
+   * @brief Set the token bucket used by every call site at a given level
+   *
+   * @param level     Level to configure
+   * @param burst     Messages allowed back to back, zero for no limit
+   * @param refill_ms Time to earn back one token
+   */
+  void setLimit( const mb::logging::Level level, const uint16_t burst, const uint16_t refill_ms );
+
+  /**
+   * @brief Get the token bucket configured for a level
+   *
+   * @param level   Level to look up
+   * @return Limit
+   */
+  Limit getLimit( const mb::logging::Level level );
+
+  /**
+   * @brief Total messages suppressed since boot
+   *
+   * @return uint32_t
+   */
+  uint32_t suppressedCount();
+
+}    // namespace Logging::RateLimit
+
+/*-----------------------------------------------------------------------------
+Macros
+-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Runs a logging statement only if the enclosing call site is within
+ * its rate limit.
+ *
+ * @param level   mb::logging::Level of the message
+ * @param fmt     Format string, used to identify the site in summaries
+ * @param ...     Statement that emits the message
+ */
+#define ICHNAEA_RATE_LIMITED( level, fmt, ... )                           \
+  do                                                                      \
+  {                                                                       \
+    static ::Logging::RateLimit::Site _rl_site( fmt );                    \
+    if( ::Logging::RateLimit::admit( _rl_site, level ) )                  \
+    {                                                                     \
+      __VA_ARGS__;                                                        \
+    }                                                                     \
+  } while( 0 )
+
+#endif /* !ICHNAEA_SYSTEM_LOG_LIMIT_HPP */
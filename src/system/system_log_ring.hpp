@@ -0,0 +1,241 @@
+/******************************************************************************
+ *  File Name:
+ *    system_log_ring.hpp
+ *
+ *  Description:
+ *    Lock-free multi-producer single-consumer ring of log messages. Producers
+ *    claim a slot in constant time and never touch a log sink themselves.
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+#pragma once
+#ifndef ICHNAEA_SYSTEM_LOG_RING_HPP
+#define ICHNAEA_SYSTEM_LOG_RING_HPP
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <etl/algorithm.h>
+
+namespace Logging
+{
+  /*---------------------------------------------------------------------------
+  Classes
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Bounded MPSC queue of fixed size message slots.
+   *
+   * Each slot carries a sequence number telling producers and the consumer
+   * whose turn it is. Producers race for the head index with a CAS, fill
+   * their slot, then publish it by bumping its sequence. The single consumer
+   * walks the tail in order and hands the slot back once it has been written
+   * out. A message longer than a slot claims a run of consecutive slots in
+   * the same CAS, so short messages don't pay for the rare long one. Only
+   * messages longer than MAX_MSG_SIZE are truncated.
+   *
+   * @tparam SLOTS        Number of slots in the ring, must be a power of two
+   * @tparam SLOT_SIZE    Payload bytes per slot
+   * @tparam MAX_MSG_SIZE Largest message payload in bytes
+   */
+  template<size_t SLOTS, size_t SLOT_SIZE, size_t MAX_MSG_SIZE>
+  class LogRing
+  {
+  public:
+    static_assert( SLOTS > 1 && ( SLOTS & ( SLOTS - 1 ) ) == 0, "Slot count must be a power of two" );
+    static_assert( MAX_MSG_SIZE <= UINT16_MAX, "Message size must fit the length field" );
+    static_assert( MAX_MSG_SIZE >= SLOT_SIZE, "Messages must be able to fill a slot" );
+
+    /**
+     * @brief Most slots a single message can span
+     */
+    static constexpr size_t MAX_CHAIN = ( MAX_MSG_SIZE + SLOT_SIZE - 1 ) / SLOT_SIZE;
+    static_assert( MAX_CHAIN <= ( SLOTS / 2 ), "A full length message must leave room for others" );
+
+    /**
+     * @brief Called by the consumer for each message removed from the ring
+     */
+    using Visitor = void ( * )( const uint8_t level, const void *data, const size_t size );
+
+    LogRing() : mHead( 0 ), mTail( 0 )
+    {
+      for( size_t idx = 0; idx < SLOTS; idx++ )
+      {
+        mSlots[ idx ].seq.store( static_cast<uint32_t>( idx ), std::memory_order_relaxed );
+      }
+    }
+
+    /**
+     * @brief Append a message. Safe to call from any number of threads.
+     *
+     * @param level   Severity of the message
+     * @param data    Message bytes
+     * @param size    Length of the message
+     * @return true   Message queued, possibly truncated
+     * @return false  Ring doesn't have enough free slots
+     */
+    bool push( const uint8_t level, const void *data, const size_t size )
+    {
+      const size_t   len   = etl::min( size, MAX_MSG_SIZE );
+      const uint32_t chain = static_cast<uint32_t>( etl::max<size_t>( 1, ( len + SLOT_SIZE - 1 ) / SLOT_SIZE ) );
+      uint32_t       pos   = mHead.load( std::memory_order_relaxed );
+
+      while( true )
+      {
+        const uint32_t seq = mSlots[ pos & ( SLOTS - 1 ) ].seq.load( std::memory_order_acquire );
+        const int32_t  dif = static_cast<int32_t>( seq - pos );
+
+        if( dif == 0 )
+        {
+          /*-------------------------------------------------------------------
+          Slots are handed back in order, so the run is free if its last slot
+          is. Nobody else can claim them while the head still reads pos.
+          -------------------------------------------------------------------*/
+          const uint32_t last = pos + chain - 1;
+          if( mSlots[ last & ( SLOTS - 1 ) ].seq.load( std::memory_order_acquire ) != last )
+          {
+            return false;
+          }
+
+          if( mHead.compare_exchange_weak( pos, pos + chain, std::memory_order_relaxed ) )
+          {
+            break;
+          }
+        }
+        else if( dif < 0 )
+        {
+          return false;
+        }
+        else
+        {
+          pos = mHead.load( std::memory_order_relaxed );
+        }
+      }
+
+      /*-----------------------------------------------------------------------
+      Fill the run, publishing the first slot last. The consumer only looks
+      at the first slot, so it never sees a partially written message.
+      -----------------------------------------------------------------------*/
+      const uint8_t *src  = static_cast<const uint8_t *>( data );
+      Slot          &head = mSlots[ pos & ( SLOTS - 1 ) ];
+
+      for( uint32_t idx = 0; idx < chain; idx++ )
+      {
+        Slot        &slot   = mSlots[ ( pos + idx ) & ( SLOTS - 1 ) ];
+        const size_t offset = idx * SLOT_SIZE;
+        const size_t chunk  = etl::min( SLOT_SIZE, len - offset );
+
+        memcpy( slot.data, src + offset, chunk );
+        if( idx != 0 )
+        {
+          slot.seq.store( pos + idx + 1, std::memory_order_relaxed );
+        }
+      }
+
+      head.level     = level;
+      head.truncated = ( len != size );
+      head.chain     = static_cast<uint8_t>( chain );
+      head.size      = static_cast<uint16_t>( len );
+      head.seq.store( pos + 1, std::memory_order_release );
+      return true;
+    }
+
+    /**
+     * @brief Remove the oldest message and pass it to a visitor. Only one
+     * thread may consume at a time.
+     *
+     * @param visitor   Receives the message, the slot is reused once it returns
+     * @return true     A message was consumed
+     * @return false    Ring is empty
+     */
+    bool consume( Visitor visitor )
+    {
+      Slot          &slot = mSlots[ mTail & ( SLOTS - 1 ) ];
+      const uint32_t seq  = slot.seq.load( std::memory_order_acquire );
+
+      if( static_cast<int32_t>( seq - ( mTail + 1 ) ) < 0 )
+      {
+        return false;
+      }
+
+      if( slot.truncated )
+      {
+        mTruncated.fetch_add( 1, std::memory_order_relaxed );
+      }
+
+      /*-----------------------------------------------------------------------
+      A chained message isn't contiguous in memory, so stitch it back together
+      before handing it over.
+      -----------------------------------------------------------------------*/
+      const uint32_t chain = slot.chain;
+      if( chain == 1 )
+      {
+        visitor( slot.level, slot.data, slot.size );
+      }
+      else
+      {
+        for( uint32_t idx = 0; idx < chain; idx++ )
+        {
+          const size_t offset = idx * SLOT_SIZE;
+          const size_t chunk  = etl::min<size_t>( SLOT_SIZE, slot.size - offset );
+          memcpy( mScratch + offset, mSlots[ ( mTail + idx ) & ( SLOTS - 1 ) ].data, chunk );
+        }
+
+        visitor( slot.level, mScratch, slot.size );
+      }
+
+      for( uint32_t idx = 0; idx < chain; idx++ )
+      {
+        mSlots[ ( mTail + idx ) & ( SLOTS - 1 ) ].seq.store( mTail + idx + SLOTS, std::memory_order_release );
+      }
+
+      mTail += chain;
+      return true;
+    }
+
+    /**
+     * @brief Approximate number of slots in use
+     *
+     * @return size_t
+     */
+    size_t size() const
+    {
+      return static_cast<size_t>( mHead.load( std::memory_order_relaxed ) - mTail );
+    }
+
+    /**
+     * @brief Messages cut short because they were larger than MAX_MSG_SIZE
+     *
+     * @return uint32_t
+     */
+    uint32_t truncated() const
+    {
+      return mTruncated.load( std::memory_order_relaxed );
+    }
+
+  private:
+    struct Slot
+    {
+      std::atomic<uint32_t> seq;
+      uint8_t               level;     /**< Only valid in the first slot of a message */
+      bool                  truncated; /**< Only valid in the first slot of a message */
+      uint8_t               chain;     /**< Slots the message spans, first slot only */
+      uint16_t              size;      /**< Whole message length, first slot only */
+      uint8_t               data[ SLOT_SIZE ];
+    };
+
+    std::atomic<uint32_t> mHead;
+    uint32_t              mTail;
+    std::atomic<uint32_t> mTruncated{ 0 };
+    Slot                  mSlots[ SLOTS ];
+    uint8_t               mScratch[ MAX_MSG_SIZE ]; /**< Consumer side reassembly of chained messages */
+  };
+
+}    // namespace Logging
+
+#endif /* !ICHNAEA_SYSTEM_LOG_RING_HPP */
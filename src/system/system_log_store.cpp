@@ -0,0 +1,267 @@
+/******************************************************************************
+ *  File Name:
+ *    system_log_store.cpp
+ *
+ *  Description:
+ *    FlashDB TSDB backed log sink implementation
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <cstring>
+#include <etl/algorithm.h>
+#include <mbedutils/assert.hpp>
+#include <mbedutils/interfaces/time_intf.hpp>
+#include <mbedutils/logging.hpp>
+#include <src/system/system_log_store.hpp>
+
+namespace Logging
+{
+  using namespace ::mb::logging;
+
+  /*---------------------------------------------------------------------------
+  Constants
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Marks entries that start with a level header. Anything stored by
+   * the previous sink lacks it, and only ever held warnings and above.
+   */
+  static constexpr uint8_t ENTRY_TAG         = 0xA5;
+  static constexpr size_t  ENTRY_HEADER_SIZE = 2;
+  static constexpr Level   LEGACY_LEVEL      = Level::LVL_WARN;
+
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  struct ReadContext
+  {
+    TSDBLogSink *sink;
+    LogReader    visitor;
+  };
+
+  struct QueryContext
+  {
+    TSDBLogSink    *sink;
+    Level           minLevel;
+    LogQueryVisitor visitor;
+    void           *arg;
+  };
+
+  /*---------------------------------------------------------------------------
+  Static Data
+  ---------------------------------------------------------------------------*/
+
+  static uint64_t s_time_base;
+
+  /*---------------------------------------------------------------------------
+  Private Functions
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief FlashDB time source
+   */
+  static fdb_time_t get_log_time()
+  {
+    return static_cast<fdb_time_t>( s_time_base + mb::time::millis() );
+  }
+
+
+  /**
+   * @brief Reads an entry out of flash and splits off its level header
+   *
+   * @return true   Entry was read and decoded
+   * @return false  Entry is not valid
+   */
+  static bool load_entry( fdb_tsdb_t db, fdb_tsl_t tsl, uint8_t *buffer, const size_t size, LogEntry &entry )
+  {
+    if( tsl->status != FDB_TSL_WRITE )
+    {
+      return false;
+    }
+
+    struct fdb_blob blob;
+    const size_t    read = fdb_blob_read( reinterpret_cast<fdb_db_t>( db ), fdb_tsl_to_blob( tsl, fdb_blob_make( &blob, buffer, size ) ) );
+
+    entry.time = static_cast<uint64_t>( tsl->time );
+    if( ( read >= ENTRY_HEADER_SIZE ) && ( buffer[ 0 ] == ENTRY_TAG ) )
+    {
+      entry.level = static_cast<Level>( buffer[ 1 ] );
+      entry.data  = buffer + ENTRY_HEADER_SIZE;
+      entry.size  = read - ENTRY_HEADER_SIZE;
+    }
+    else
+    {
+      entry.level = LEGACY_LEVEL;
+      entry.data  = buffer;
+      entry.size  = read;
+    }
+
+    return entry.size != 0;
+  }
+
+  /*---------------------------------------------------------------------------
+  TSDBLogSink
+  ---------------------------------------------------------------------------*/
+
+  TSDBLogSink::TSDBLogSink() : mDB{}, mConfig{ nullptr, 0, nullptr, nullptr }, mOpen( false )
+  {
+  }
+
+
+  void TSDBLogSink::configure( const Config &config )
+  {
+    mConfig = config;
+  }
+
+
+  ErrCode TSDBLogSink::open()
+  {
+    mbed_assert( mConfig.part_name && mConfig.reader_buffer && ( mConfig.max_log_size > ENTRY_HEADER_SIZE ) );
+
+    this->initLockable();
+
+    s_time_base = 0;
+    if( fdb_tsdb_init( &mDB, "log", mConfig.part_name, get_log_time, mConfig.max_log_size, nullptr ) != FDB_NO_ERR )
+    {
+      return ErrCode::ERR_FAIL;
+    }
+
+    /*-------------------------------------------------------------------------
+    Carry on from the newest stored entry so time never moves backwards
+    -------------------------------------------------------------------------*/
+    s_time_base = static_cast<uint64_t>( mDB.last_time ) + 1u;
+    mOpen       = true;
+
+    return ErrCode::ERR_OK;
+  }
+
+
+  ErrCode TSDBLogSink::close()
+  {
+    if( mOpen )
+    {
+      fdb_tsdb_deinit( &mDB );
+      mOpen = false;
+    }
+
+    return ErrCode::ERR_OK;
+  }
+
+
+  ErrCode TSDBLogSink::flush()
+  {
+    return ErrCode::ERR_OK;
+  }
+
+
+  ErrCode TSDBLogSink::erase()
+  {
+    if( !mOpen )
+    {
+      return ErrCode::ERR_FAIL;
+    }
+
+    fdb_tsl_clean( &mDB );
+    return ErrCode::ERR_OK;
+  }
+
+
+  ErrCode TSDBLogSink::write( const Level level, const void *const message, const size_t length )
+  {
+    if( !mOpen || !enabled || ( level < logLevel ) || !message || !length )
+    {
+      return ErrCode::ERR_FAIL;
+    }
+
+    const size_t size = etl::min( length, mConfig.max_log_size - ENTRY_HEADER_SIZE );
+
+    mConfig.reader_buffer[ 0 ] = ENTRY_TAG;
+    mConfig.reader_buffer[ 1 ] = static_cast<uint8_t>( level );
+    memcpy( mConfig.reader_buffer + ENTRY_HEADER_SIZE, message, size );
+
+    struct fdb_blob blob;
+    if( fdb_tsl_append( &mDB, fdb_blob_make( &blob, mConfig.reader_buffer, size + ENTRY_HEADER_SIZE ) ) != FDB_NO_ERR )
+    {
+      return ErrCode::ERR_FAIL;
+    }
+
+    return ErrCode::ERR_OK;
+  }
+
+
+  void TSDBLogSink::read( LogReader visitor, const bool direction )
+  {
+    if( !mOpen )
+    {
+      return;
+    }
+
+    /*-------------------------------------------------------------------------
+    Entries are handed out without their level header, exactly as written
+    -------------------------------------------------------------------------*/
+    auto callback = []( fdb_tsl_t tsl, void *arg ) -> bool {
+      auto    *ctx = static_cast<ReadContext *>( arg );
+      LogEntry entry;
+
+      if( !load_entry( &ctx->sink->mDB, tsl, ctx->sink->mConfig.reader_buffer, ctx->sink->mConfig.max_log_size, entry ) )
+      {
+        return false;
+      }
+
+      if( ctx->sink->mConfig.read_pacer )
+      {
+        ctx->sink->mConfig.read_pacer( entry.size );
+      }
+
+      return !ctx->visitor( entry.data, entry.size );
+    };
+
+    ReadContext ctx{ this, visitor };
+    if( direction )
+    {
+      fdb_tsl_iter_reverse( &mDB, callback, &ctx );
+    }
+    else
+    {
+      fdb_tsl_iter( &mDB, callback, &ctx );
+    }
+  }
+
+
+  void TSDBLogSink::query( const uint64_t start, const uint64_t end, const Level minLevel, LogQueryVisitor visitor,
+                           void *arg )
+  {
+    if( !mOpen || !visitor || ( start > end ) )
+    {
+      return;
+    }
+
+    auto callback = []( fdb_tsl_t tsl, void *arg ) -> bool {
+      auto    *ctx = static_cast<QueryContext *>( arg );
+      LogEntry entry;
+
+      if( !load_entry( &ctx->sink->mDB, tsl, ctx->sink->mConfig.reader_buffer, ctx->sink->mConfig.max_log_size, entry ) ||
+          ( entry.level < ctx->minLevel ) )
+      {
+        return false;
+      }
+
+      return !ctx->visitor( entry, ctx->arg );
+    };
+
+    QueryContext ctx{ this, minLevel, visitor, arg };
+    fdb_tsl_iter_by_time( &mDB, static_cast<fdb_time_t>( start ), static_cast<fdb_time_t>( end ), callback, &ctx );
+  }
+
+
+  uint64_t TSDBLogSink::now() const
+  {
+    return static_cast<uint64_t>( get_log_time() );
+  }
+
+}    // namespace Logging
@@ -0,0 +1,121 @@
+/******************************************************************************
+ *  File Name:
+ *    system_log_store.hpp
+ *
+ *  Description:
+ *    Persistent log sink built on the FlashDB time series database. Each
+ *    entry keeps its log level and a timestamp, so stored logs can be queried
+ *    by time range and severity without reading back the whole region.
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+#pragma once
+#ifndef ICHNAEA_SYSTEM_LOG_STORE_HPP
+#define ICHNAEA_SYSTEM_LOG_STORE_HPP
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <cstddef>
+#include <cstdint>
+#include <flashdb.h>
+#include <mbedutils/logging.hpp>
+
+namespace Logging
+{
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief A single stored log entry handed to a query visitor
+   */
+  struct LogEntry
+  {
+    uint64_t             time;  /**< Log time the entry was written */
+    ::mb::logging::Level level; /**< Severity of the message */
+    const void          *data;  /**< Message bytes */
+    size_t               size;  /**< Length of the message */
+  };
+
+  /**
+   * @brief Called for each entry matching a query
+   *
+   * @param entry   Matching entry, only valid for the duration of the call
+   * @param arg     User context passed to the query
+   * @return true   Keep going
+   * @return false  Stop the query
+   */
+  using LogQueryVisitor = bool ( * )( const LogEntry &entry, void *arg );
+
+  /*---------------------------------------------------------------------------
+  Classes
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Stores log messages in a FlashDB TSDB partition.
+   *
+   * Timestamps are in log time: milliseconds since boot, offset so they
+   * continue on from the newest stored entry. FlashDB requires time to only
+   * move forward, and this also keeps entries from different boots in order.
+   */
+  class TSDBLogSink : public ::mb::logging::SinkInterface
+  {
+  public:
+    struct Config
+    {
+      const char *part_name;                     /**< FAL partition holding the database */
+      size_t      max_log_size;                  /**< Largest entry, level header included */
+      uint8_t    *reader_buffer;                 /**< Scratch space of max_log_size bytes */
+      void ( *read_pacer )( const size_t size ); /**< Optional, called before read() hands out each entry */
+    };
+
+    TSDBLogSink();
+    ~TSDBLogSink() = default;
+
+    ::mb::logging::ErrCode open() final override;
+    ::mb::logging::ErrCode close() final override;
+    ::mb::logging::ErrCode flush() final override;
+    ::mb::logging::ErrCode erase() final override;
+    ::mb::logging::ErrCode write( const ::mb::logging::Level level, const void *const message,
+                                  const size_t length ) final override;
+    void read( ::mb::logging::LogReader visitor, const bool direction = false ) final override;
+
+    /**
+     * @brief Set up the sink. Must be called before open().
+     *
+     * @param config  Storage configuration
+     */
+    void configure( const Config &config );
+
+    /**
+     * @brief Visit stored entries in a time range, oldest first. Uses the
+     * TSDB sector time index to skip straight to the start of the range. Must
+     * be called with the sink locked.
+     *
+     * @param start     Oldest entry time to visit
+     * @param end       Newest entry time to visit
+     * @param minLevel  Entries below this level are skipped
+     * @param visitor   Called for each match
+     * @param arg       Passed through to the visitor
+     */
+    void query( const uint64_t start, const uint64_t end, const ::mb::logging::Level minLevel, LogQueryVisitor visitor,
+                void *arg );
+
+    /**
+     * @brief Current log time
+     *
+     * @return uint64_t
+     */
+    uint64_t now() const;
+
+  private:
+    struct fdb_tsdb mDB;
+    Config          mConfig;
+    bool            mOpen;
+  };
+
+}    // namespace Logging
+
+#endif /* !ICHNAEA_SYSTEM_LOG_STORE_HPP */
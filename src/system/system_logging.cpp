@@ -15,21 +15,54 @@ Includes
 #include <src/bsp/board_map.hpp>
 #include <src/com/ctrl_server.hpp>
 #include <src/hw/uart.hpp>
+#include <src/system/system_log_limit.hpp>
+#include <src/system/system_log_ring.hpp>
+#include <src/system/system_log_store.hpp>
 #include <src/system/system_logging.hpp>
+#include <src/threads/ichnaea_threads.hpp>
+#include <atomic>
 #include <cstdarg>
+#include <etl/algorithm.h>
 #include <etl/string.h>
 #include <mbedutils/assert.hpp>
+#include <mbedutils/interfaces/irq_intf.hpp>
+#include <mbedutils/interfaces/time_intf.hpp>
 #include <mbedutils/logging.hpp>
+#include <mbedutils/osal.hpp>
+#include <mbedutils/threading.hpp>
 #include <mbedutils/util.hpp>
 
 namespace Logging
 {
   using namespace ::mb::logging;
 
+  /*---------------------------------------------------------------------------
+  Constants
+  ---------------------------------------------------------------------------*/
+
+  static constexpr size_t RING_SLOTS        = 64;  /**< Short messages the ring can hold */
+  static constexpr size_t RING_SLOT_SIZE    = 128; /**< Longer messages chain consecutive slots */
+  static constexpr size_t RING_MAX_MSG_SIZE = 512; /**< Largest message before truncation */
+  static constexpr size_t BLOCK_TIMEOUT_MS  = 20;  /**< Longest a BLOCK producer will wait */
+
+  static constexpr size_t RPC_BATCH_TIMEOUT_MS      = 50; /**< Longest a console record waits in a batch */
+  static constexpr size_t RPC_BATCH_RECORD_OVERHEAD = 2;  /**< Level and length bytes ahead of each record */
+
   /*---------------------------------------------------------------------------
   Static Data
   ---------------------------------------------------------------------------*/
 
+  /* Asynchronous front end */
+  static RingSink                                               s_ring_sink;
+  static mb::logging::SinkHandle_rPtr                           s_ring_handle;
+  static LogRing<RING_SLOTS, RING_SLOT_SIZE, RING_MAX_MSG_SIZE> s_ring;
+  static mb::osal::mb_recursive_mutex_t                         s_drain_mutex;
+  static std::atomic<uint32_t>                                  s_overflows;
+  static uint32_t                                               s_drained;
+  static volatile OverflowPolicy                                s_policy;
+  static volatile bool                                          s_drain_running;
+  static volatile bool                                          s_draining;
+
   /* Logging via RPC service */
   static RPCSink                      s_rpc_sink;
   static mb::logging::SinkHandle_rPtr s_nanopb_handle;
@@ -39,7 +72,7 @@ namespace Logging
   static mb::logging::SinkHandle_rPtr s_debug_handle;
 
   /* Logging via NOR Flash */
-  static mb::logging::TSDBSink        s_tsdb_sink;
+  static TSDBLogSink                  s_tsdb_sink;
   static mb::logging::SinkHandle_rPtr s_tsdb_handle;
   static uint32_t                     s_tsdb_read_buffer[ 512 / sizeof( uint32_t ) ];
 
@@ -53,6 +86,82 @@ namespace Logging
   static mb::logging::SinkHandle_rPtr s_file_handle;
 #endif    // ICHNAEA_SIMULATOR
 
+  /**
+   * @brief Sinks fed by the logging thread. None of these are registered with
+   * the logging framework, so nothing else writes to them behind its back.
+   */
+  static SinkInterface *const s_output_sinks[] = {
+    &s_rpc_sink,
+    &s_debug_sink,
+    &s_tsdb_sink,
+#if defined( ICHNAEA_SIMULATOR )
+    &s_console_sink,
+    &s_file_sink,
+#endif    // ICHNAEA_SIMULATOR
+  };
+
+  /*---------------------------------------------------------------------------
+  Private Functions
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Writes a single dequeued message to every output sink
+   */
+  static void fan_out( const uint8_t level, const void *data, const size_t size )
+  {
+    for( SinkInterface *sink : s_output_sinks )
+    {
+      sink->lock();
+      sink->write( static_cast<Level>( level ), data, size );
+      sink->unlock();
+    }
+  }
+
+
+  /**
+   * @brief Writes a single dequeued message to the local debug outputs only.
+   * Used from interrupt context, so no sink locks are taken and nothing that
+   * can block, like the flash store or RPC server, is touched.
+   */
+  static void fan_out_isr( const uint8_t level, const void *data, const size_t size )
+  {
+    s_debug_sink.write( static_cast<Level>( level ), data, size );
+#if defined( ICHNAEA_SIMULATOR )
+    s_console_sink.write( static_cast<Level>( level ), data, size );
+#endif    // ICHNAEA_SIMULATOR
+  }
+
+
+  /**
+   * @brief Best effort drain for fault handlers running in interrupt context.
+   * Gives up if the interrupted code was in the middle of a drain, since the
+   * ring consumer is single threaded.
+   */
+  static void drain_from_isr()
+  {
+    if( !s_drain_running || s_draining )
+    {
+      return;
+    }
+
+    s_draining = true;
+    while( s_ring.consume( fan_out_isr ) )
+    {
+      s_drained++;
+    }
+    s_draining = false;
+  }
+
+
+  /**
+   * @brief Producers may only wait on the drain task if it is running and
+   * they aren't the drain task themselves.
+   */
+  static bool can_block()
+  {
+    return s_drain_running && ( mb::thread::this_thread::id() != Threads::TSK_LOGGING_ID );
+  }
+
   /*---------------------------------------------------------------------------
   Public Functions
   ---------------------------------------------------------------------------*/
@@ -66,42 +175,49 @@ namespace Logging
     Initialize the logging framework
     -------------------------------------------------------------------------*/
     mb::logging::initialize();
+    mbed_assert( mb::osal::buildRecursiveMutexStrategy( s_drain_mutex ) );
+    RateLimit::initialize();
+
+    s_policy        = OverflowPolicy::DROP;
+    s_drain_running = false;
 
     /*-------------------------------------------------------------------------
-    Configure and register the RPC sink to output warnings and above.
+    Configure the RPC sink to output warnings and above. Errors skip the
+    batching delay.
     -------------------------------------------------------------------------*/
     s_rpc_sink.assignDriver( Control::getRPCServer() );
+    s_rpc_sink.configureBatching( RPC_BATCH_TIMEOUT_MS, Level::LVL_ERROR );
     s_rpc_sink.logLevel = Level::LVL_WARN;
     s_rpc_sink.enabled  = true;
 
     s_nanopb_handle = SinkHandle_rPtr( &s_rpc_sink );
-    mbed_assert( ErrCode::ERR_OK == registerSink( s_nanopb_handle ) );
+    mbed_assert( ErrCode::ERR_OK == s_rpc_sink.open() );
 
     /*-------------------------------------------------------------------------
-    Configure and register the Debug sink to output everything.
+    Configure the Debug sink to output everything.
     -------------------------------------------------------------------------*/
     s_debug_sink.assignDriver( HW::UART::getDriver( HW::UART::Channel::UART_DEBUG ) );
     s_debug_sink.logLevel = Level::LVL_TRACE;
     s_debug_sink.enabled  = true;
 
     s_debug_handle = SinkHandle_rPtr( &s_debug_sink );
-    mbed_assert( ErrCode::ERR_OK == registerSink( s_debug_handle ) );
+    mbed_assert( ErrCode::ERR_OK == s_debug_sink.open() );
 
     /*-------------------------------------------------------------------------
-    Configure and register the TSDB sink to log warnings and above.
+    Configure the TSDB sink to log warnings and above.
     -------------------------------------------------------------------------*/
-    TSDBSink::Config tsdb_cfg;
-    tsdb_cfg.dev_name      = ICHNAEA_DB_FLASH_DEV_NAME;
+    TSDBLogSink::Config tsdb_cfg;
     tsdb_cfg.part_name     = ICHNAEA_DB_LOG_RGN_NAME;
     tsdb_cfg.max_log_size  = sizeof( s_tsdb_read_buffer );
     tsdb_cfg.reader_buffer = reinterpret_cast<uint8_t *>( s_tsdb_read_buffer );
+    tsdb_cfg.read_pacer    = Control::awaitBulkCredit; // Logger read stream shares the bulk budget
 
     s_tsdb_sink.configure( tsdb_cfg );
     s_tsdb_sink.logLevel = Level::LVL_WARN;
     s_tsdb_sink.enabled  = false;    // Enabled after system is fully initialized
 
     s_tsdb_handle = SinkHandle_rPtr( &s_tsdb_sink );
-    mbed_assert( ErrCode::ERR_OK == registerSink( s_tsdb_handle ) );
+    mbed_assert( ErrCode::ERR_OK == s_tsdb_sink.open() );
 
     /*-------------------------------------------------------------------------
     Configure the Console and File sinks if we are in a simulator environment
@@ -111,20 +227,30 @@ namespace Logging
     s_console_sink.enabled  = true;
 
     s_console_handle = SinkHandle_rPtr( &s_console_sink );
-    mbed_assert( ErrCode::ERR_OK == registerSink( s_console_handle ) );
+    mbed_assert( ErrCode::ERR_OK == s_console_sink.open() );
 
     s_file_sink.setFile( "Ichnaea.log" );
     s_file_sink.logLevel = Level::LVL_TRACE;
     s_file_sink.enabled  = true;
 
     s_file_handle = SinkHandle_rPtr( &s_file_sink );
-    mbed_assert( ErrCode::ERR_OK == registerSink( s_file_handle ) );
+    mbed_assert( ErrCode::ERR_OK == s_file_sink.open() );
 #endif    // ICHNAEA_SIMULATOR
 
     /*-------------------------------------------------------------------------
-    Assign the root logger
+    Register the ring as the only sink the framework knows about. Every
+    message, from any thread, is queued there and written out by the logging
+    thread, so producers never block on UART or flash.
     -------------------------------------------------------------------------*/
-    mbed_assert( ErrCode::ERR_OK == setRootSink( s_debug_handle ) );
+    s_ring_sink.logLevel = Level::LVL_TRACE;
+    s_ring_sink.enabled  = true;
+
+    s_ring_handle = SinkHandle_rPtr( &s_ring_sink );
+    mbed_assert( ErrCode::ERR_OK == registerSink( s_ring_handle ) );
+    mbed_assert( ErrCode::ERR_OK == setRootSink( s_ring_handle ) );
+
+    Threads::startThread( Threads::TSK_LOGGING_ID );
+    s_drain_running = true;
 
     /*-------------------------------------------------------------------------
     Initialize the RPC logger service
@@ -144,14 +270,169 @@ namespace Logging
     s_tsdb_sink.enabled = true;
   }
 
+
+  size_t drain()
+  {
+    if( !s_drain_running )
+    {
+      return 0;
+    }
+
+    mb::thread::RecursiveLockGuard lock( s_drain_mutex );
+
+    /*-------------------------------------------------------------------------
+    A sink that fails an assert while writing ends up back here through the
+    flush on halt. The slot it was writing hasn't been released yet, so don't
+    go around again.
+    -------------------------------------------------------------------------*/
+    if( s_draining )
+    {
+      return 0;
+    }
+
+    s_draining   = true;
+    size_t count = 0;
+    while( s_ring.consume( fan_out ) )
+    {
+      count++;
+    }
+
+    /*-------------------------------------------------------------------------
+    Push out a console batch that has been sitting too long
+    -------------------------------------------------------------------------*/
+    s_rpc_sink.lock();
+    s_rpc_sink.poll();
+    s_rpc_sink.unlock();
+    s_draining = false;
+
+    s_drained += count;
+    return count;
+  }
+
+
+  void flush()
+  {
+    /*-------------------------------------------------------------------------
+    Asserts and faults can land here from an interrupt, where waiting on the
+    drain or sink locks would hang the halt path.
+    -------------------------------------------------------------------------*/
+    if( mb::irq::in_isr() )
+    {
+      drain_from_isr();
+      return;
+    }
+
+    drain();
+
+    for( SinkInterface *sink : s_output_sinks )
+    {
+      sink->lock();
+      sink->flush();
+      sink->unlock();
+    }
+  }
+
+
+  void setOverflowPolicy( const OverflowPolicy policy )
+  {
+    s_policy = policy;
+  }
+
+
+  uint64_t logTime()
+  {
+    return s_tsdb_sink.now();
+  }
+
+
+  bool store( const Level level, const void *const data, const size_t size )
+  {
+    s_tsdb_sink.lock();
+    const bool stored = ( s_tsdb_sink.write( level, data, size ) == ErrCode::ERR_OK );
+    s_tsdb_sink.unlock();
+
+    return stored;
+  }
+
+
+  void queryLog( const uint64_t start, const uint64_t end, const Level minLevel, LogQueryVisitor visitor, void *arg )
+  {
+    s_tsdb_sink.lock();
+    s_tsdb_sink.query( start, end, minLevel, visitor, arg );
+    s_tsdb_sink.unlock();
+  }
+
+
+  PipelineStats getPipelineStats()
+  {
+    PipelineStats stats;
+
+    stats.queued     = static_cast<uint32_t>( s_ring.size() );
+    stats.drained    = s_drained;
+    stats.overflows  = s_overflows.load( std::memory_order_relaxed );
+    stats.truncated  = s_ring.truncated();
+    stats.suppressed = RateLimit::suppressedCount();
+
+    return stats;
+  }
+
+  /*---------------------------------------------------------------------------
+  RingSink
+  ---------------------------------------------------------------------------*/
+
+  ErrCode RingSink::write( const Level level, const void *const message, const size_t length )
+  {
+    if( !enabled || ( level < logLevel ) || !message || !length )
+    {
+      return ErrCode::ERR_FAIL;
+    }
+
+    if( s_ring.push( static_cast<uint8_t>( level ), message, length ) )
+    {
+      return ErrCode::ERR_OK;
+    }
+
+    /*-------------------------------------------------------------------------
+    Ring is full. Either give the drain task a bounded chance to catch up, or
+    drop the message right away.
+    -------------------------------------------------------------------------*/
+    if( ( s_policy == OverflowPolicy::BLOCK ) && can_block() )
+    {
+      const size_t start = mb::time::millis();
+      while( ( mb::time::millis() - start ) < BLOCK_TIMEOUT_MS )
+      {
+        mb::thread::this_thread::sleep_for( 1 );
+        if( s_ring.push( static_cast<uint8_t>( level ), message, length ) )
+        {
+          return ErrCode::ERR_OK;
+        }
+      }
+    }
+
+    s_overflows.fetch_add( 1, std::memory_order_relaxed );
+    return ErrCode::ERR_FAIL;
+  }
+
+
+  ErrCode RingSink::flush()
+  {
+    Logging::flush();
+    return ErrCode::ERR_OK;
+  }
+
   /*---------------------------------------------------------------------------
   RPCSink
   ---------------------------------------------------------------------------*/
 
-  ErrCode RPCSink::write( const Level level, const void *const message, const size_t length )
+  RPCSink::RPCSink() :
+      mBatchStart( 0 ), mTimeout( RPC_BATCH_TIMEOUT_MS ), mFlushLevel( Level::LVL_ERROR ), mRpcServer( nullptr )
   {
-    using namespace mb::rpc::message;
+    mBatch = ichnaea_ConsoleBatch_init_zero;
+  }
+
 
+  ErrCode RPCSink::write( const Level level, const void *const message, const size_t length )
+  {
     /*-------------------------------------------------------------------------
     Check to see if we should even write
     -------------------------------------------------------------------------*/
@@ -160,13 +441,115 @@ namespace Logging
       return ErrCode::ERR_FAIL;
     }
 
+    /*-------------------------------------------------------------------------
+    Records too large to batch keep using the multi-frame console message.
+    Send what is pending first so the host sees everything in order.
+    -------------------------------------------------------------------------*/
+    constexpr size_t max_record = etl::min<size_t>( UINT8_MAX, sizeof( mBatch.data.bytes ) - RPC_BATCH_RECORD_OVERHEAD );
+    if( length > max_record )
+    {
+      if( !publishBatch() )
+      {
+        return ErrCode::ERR_FAIL;
+      }
+
+      return publishFramed( message, length ) ? ErrCode::ERR_OK : ErrCode::ERR_FAIL;
+    }
+
+    /*-------------------------------------------------------------------------
+    Make room for the record, then append it
+    -------------------------------------------------------------------------*/
+    if( ( mBatch.data.size + RPC_BATCH_RECORD_OVERHEAD + length ) > sizeof( mBatch.data.bytes ) )
+    {
+      if( !publishBatch() )
+      {
+        return ErrCode::ERR_FAIL;
+      }
+    }
+
+    if( mBatch.count == 0 )
+    {
+      mBatchStart = mb::time::millis();
+    }
+
+    uint8_t *p_record = mBatch.data.bytes + mBatch.data.size;
+    p_record[ 0 ]     = static_cast<uint8_t>( level );
+    p_record[ 1 ]     = static_cast<uint8_t>( length );
+    memcpy( p_record + RPC_BATCH_RECORD_OVERHEAD, message, length );
+
+    mBatch.data.size += static_cast<pb_size_t>( RPC_BATCH_RECORD_OVERHEAD + length );
+    mBatch.count++;
+
+    /*-------------------------------------------------------------------------
+    Don't make the host wait on anything serious
+    -------------------------------------------------------------------------*/
+    if( ( level >= mFlushLevel ) || ( mBatch.count == UINT8_MAX ) )
+    {
+      return publishBatch() ? ErrCode::ERR_OK : ErrCode::ERR_FAIL;
+    }
+
+    return ErrCode::ERR_OK;
+  }
+
+
+  ErrCode RPCSink::flush()
+  {
+    return publishBatch() ? ErrCode::ERR_OK : ErrCode::ERR_FAIL;
+  }
+
+
+  void RPCSink::configureBatching( const size_t timeout_ms, const Level flushLevel )
+  {
+    mTimeout    = timeout_ms;
+    mFlushLevel = flushLevel;
+  }
+
+
+  void RPCSink::poll()
+  {
+    if( ( mBatch.count != 0 ) && ( ( mb::time::millis() - mBatchStart ) >= mTimeout ) )
+    {
+      publishBatch();
+    }
+  }
+
+
+  bool RPCSink::publishBatch()
+  {
+    if( mBatch.count == 0 )
+    {
+      return true;
+    }
+
+    mBatch.header.version = ichnaea_AsyncMessageVersion_MSG_VER_CONSOLE_BATCH;
+    mBatch.header.msgId   = ichnaea_AsyncMessageId_MSG_CONSOLE_BATCH;
+    mBatch.header.seqId   = mb::rpc::message::next_seq_id();
+    mBatch.header.svcId   = 0;
+
+    const bool published =
+        mRpcServer && Control::publish( Control::TxClass::BULK, mBatch.header.msgId, ichnaea_ConsoleBatch_fields, mBatch );
+
+    /*-------------------------------------------------------------------------
+    Start over either way. Holding on to a batch the link won't take would
+    only stall everything queued behind it.
+    -------------------------------------------------------------------------*/
+    mBatch.count     = 0;
+    mBatch.data.size = 0;
+    return published;
+  }
+
+
+  bool RPCSink::publishFramed( const void *const message, const size_t length )
+  {
+    using namespace mb::rpc::message;
+
     /*-------------------------------------------------------------------------
     Build up the new messages
     -------------------------------------------------------------------------*/
     mb::rpc::SeqId seq          = mb::rpc::message::next_seq_id();
     size_t         byte_offset  = 0;
     uint8_t        frame_number = 0;
-    const uint8_t  max_frames   = ( length / sizeof( msg.data ) ) + 1u;
+    const uint8_t  max_frames   = ( length + sizeof( msg.data.bytes ) - 1u ) / sizeof( msg.data.bytes );
     const uint8_t *p_usr_data   = reinterpret_cast<const uint8_t *>( message );
 
     clear_struct( msg );
@@ -191,16 +574,16 @@ namespace Logging
       /*-----------------------------------------------------------------------
       Encode the data and ship it
       -----------------------------------------------------------------------*/
-      if( !mRpcServer->publishMessage( msg.header.msgId, &msg ) )
+      if( !mRpcServer || !Control::publish( Control::TxClass::BULK, msg.header.msgId, mbed_rpc_ConsoleMessage_fields, msg ) )
       {
-        return ErrCode::ERR_FAIL;
+        return false;
       }
 
       byte_offset += chunk_size;
       frame_number++;
     }
 
-    return ErrCode::ERR_OK;
+    return true;
   }
 
 
@@ -18,9 +18,40 @@ Includes
 -----------------------------------------------------------------------------*/
 #include <mbedutils/logging.hpp>
 #include <mbedutils/rpc.hpp>
+#include <src/app/proto/ichnaea_async.pb.h>
+#include <src/system/system_log_store.hpp>
 
 namespace Logging
 {
+  /*---------------------------------------------------------------------------
+  Enumerations
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief What a producer does when the log ring is full
+   */
+  enum class OverflowPolicy : uint8_t
+  {
+    DROP,  /**< Discard the message and count it */
+    BLOCK, /**< Wait a bounded time for the drain task, then drop */
+  };
+
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Health of the asynchronous log pipeline
+   */
+  struct PipelineStats
+  {
+    uint32_t queued;     /**< Messages waiting to be drained */
+    uint32_t drained;    /**< Messages written out to the sinks */
+    uint32_t overflows;  /**< Messages lost because the ring was full */
+    uint32_t truncated;  /**< Messages cut short to fit a ring slot */
+    uint32_t suppressed; /**< Messages dropped by call site rate limits */
+  };
+
   /*---------------------------------------------------------------------------
   Public Functions
   ---------------------------------------------------------------------------*/
@@ -35,17 +66,82 @@ namespace Logging
    */
   void postSequence();
 
+  /**
+   * @brief Write queued messages out to the sinks. Called by the logging
+   * thread, nothing else should need to.
+   *
+   * @return size_t Number of messages written
+   */
+  size_t drain();
+
+  /**
+   * @brief Synchronously drain everything queued so far. Use before a reset
+   * so the last messages aren't lost. From interrupt context this never
+   * blocks and only feeds the debug outputs.
+   */
+  void flush();
+
+  /**
+   * @brief Select what producers do when the log ring is full
+   *
+   * @param policy  Overflow behavior
+   */
+  void setOverflowPolicy( const OverflowPolicy policy );
+
+  /**
+   * @brief Current time on the clock used to stamp stored logs
+   *
+   * @return uint64_t Milliseconds, continuing across reboots
+   */
+  uint64_t logTime();
+
+  /**
+   * @brief Write a record straight to the persistent log store, skipping the
+   * console and RPC sinks. Used for binary records that only make sense to a
+   * host reading the store back.
+   *
+   * @param level   Severity to store the record under
+   * @param data    Record bytes
+   * @param size    Length of the record
+   * @return true   Record was stored
+   * @return false  Store is not available
+   */
+  bool store( const ::mb::logging::Level level, const void *const data, const size_t size );
+
+  /**
+   * @brief Visit stored log entries in a time range, oldest first. Writes to
+   * the log store wait until the query finishes.
+   *
+   * @param start     Oldest entry time to visit
+   * @param end       Newest entry time to visit
+   * @param minLevel  Entries below this level are skipped
+   * @param visitor   Called for each match, return false to stop early
+   * @param arg       Passed through to the visitor
+   */
+  void queryLog( const uint64_t start, const uint64_t end, const ::mb::logging::Level minLevel, LogQueryVisitor visitor,
+                 void *arg );
+
+  /**
+   * @brief Get a snapshot of the log pipeline counters
+   *
+   * @return PipelineStats
+   */
+  PipelineStats getPipelineStats();
+
   /*---------------------------------------------------------------------------
   Classes
   ---------------------------------------------------------------------------*/
 
   /**
-   * @brief Sends encoded NanoPB messages to a serial channel
+   * @brief Sends encoded NanoPB messages to a serial channel. Short records
+   * are packed together into ConsoleBatch frames to cut down on framing
+   * overhead. A batch goes out once it is full, once its oldest record has
+   * waited long enough, or as soon as a high severity record is added.
    */
   class RPCSink : public ::mb::logging::SinkInterface
   {
   public:
-    RPCSink() : mRpcServer( nullptr ){};
+    RPCSink();
     ~RPCSink() = default;
 
     ::mb::logging::ErrCode write( const ::mb::logging::Level level, const void *const message,
@@ -62,10 +158,7 @@ namespace Logging
       return ::mb::logging::ErrCode::ERR_OK;
     };
 
-    ::mb::logging::ErrCode flush() final override
-    {
-      return ::mb::logging::ErrCode::ERR_OK;
-    };
+    ::mb::logging::ErrCode flush() final override;
 
     ::mb::logging::ErrCode erase() final override
     {
@@ -85,9 +178,69 @@ namespace Logging
      */
     void assignDriver( ::mb::rpc::server::Server &rpcServer );
 
+    /**
+     * @brief Adjust when a partially filled batch is sent
+     *
+     * @param timeout_ms  Longest a record may wait in the batch
+     * @param flushLevel  Records at or above this level are sent immediately
+     */
+    void configureBatching( const size_t timeout_ms, const ::mb::logging::Level flushLevel );
+
+    /**
+     * @brief Sends the pending batch if it has timed out. Must be called with
+     * the sink locked.
+     */
+    void poll();
+
   private:
     mbed_rpc_ConsoleMessage    msg;
-    ::mb::rpc::server::Server *mRpcServer; /**< Driver for logging messages */
+    ichnaea_ConsoleBatch       mBatch;        /**< Records waiting to be sent */
+    size_t                     mBatchStart;   /**< System time the first pending record was added */
+    size_t                     mTimeout;      /**< Longest a record may wait, in milliseconds */
+    ::mb::logging::Level       mFlushLevel;   /**< Severity that forces the batch out */
+    ::mb::rpc::server::Server *mRpcServer;    /**< Driver for logging messages */
+
+    bool publishBatch();
+    bool publishFramed( const void *const message, const size_t length );
+  };
+
+
+  /**
+   * @brief Front end sink registered with the logging framework. Writes only
+   * queue the message, the logging thread fans it out to the real sinks.
+   */
+  class RingSink : public ::mb::logging::SinkInterface
+  {
+  public:
+    RingSink()  = default;
+    ~RingSink() = default;
+
+    ::mb::logging::ErrCode write( const ::mb::logging::Level level, const void *const message,
+                                  const size_t length ) final override;
+
+    ::mb::logging::ErrCode open() final override
+    {
+      this->initLockable();
+      return ::mb::logging::ErrCode::ERR_OK;
+    };
+
+    ::mb::logging::ErrCode close() final override
+    {
+      return ::mb::logging::ErrCode::ERR_OK;
+    };
+
+    ::mb::logging::ErrCode flush() final override;
+
+    ::mb::logging::ErrCode erase() final override
+    {
+      return ::mb::logging::ErrCode::ERR_OK;
+    };
+
+    void read( ::mb::logging::LogReader visitor, const bool direction = false ) final override
+    {
+      ( void )visitor;
+      ( void )direction;
+    };
   };
 
 }    // namespace Logging
@@ -0,0 +1,190 @@
+/******************************************************************************
+ *  File Name:
+ *    system_retained.cpp
+ *
+ *  Description:
+ *    Retained RAM image implementation
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <cstddef>
+#include <cstring>
+#include <etl/crc32.h>
+#include <src/system/system_retained.hpp>
+
+namespace System::Retained
+{
+  /*---------------------------------------------------------------------------
+  Constants
+  ---------------------------------------------------------------------------*/
+
+  static constexpr uint32_t IMAGE_MAGIC = 0x5245544E;
+
+  /**
+   * @brief Fingerprint of the image layout. Folds in the size and offset of
+   * every retained structure so a layout change is caught even if nobody
+   * remembered to bump LAYOUT_VERSION, while identical layouts from different
+   * builds still restore each other's images.
+   */
+  static constexpr uint32_t LAYOUT_ID = []() constexpr {
+    constexpr uint32_t shape[] = {
+      sizeof( Image ),
+      offsetof( Image, pdi ),
+      sizeof( Image::pdi ),
+      offsetof( Image, pdi_dirty_count ),
+      offsetof( Image, pdi_dirty ),
+      sizeof( Image::pdi_dirty ),
+      offsetof( Image, sensor ),
+      sizeof( Image::sensor ),
+      offsetof( Image, monitor ),
+      sizeof( Image::monitor ),
+      offsetof( Image, ltc ),
+      sizeof( Image::ltc ),
+    };
+
+    uint32_t hash = 2166136261u;
+    for( const uint32_t field : shape )
+    {
+      for( size_t shift = 0; shift < 32; shift += 8 )
+      {
+        hash = ( hash ^ ( ( field >> shift ) & 0xFFu ) ) * 16777619u;
+      }
+    }
+    return hash;
+  }();
+
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Layout of the retained RAM region
+   */
+  struct Region
+  {
+    uint32_t magic;    /**< Marks the region as holding a sealed image */
+    uint32_t version;  /**< LAYOUT_VERSION the image was written with */
+    uint32_t layout;   /**< LAYOUT_ID of the firmware that wrote the image */
+    uint32_t size;     /**< Size of the image, guards against layout changes */
+    uint32_t crc;      /**< CRC32 of the image */
+    Image    image;
+  };
+
+  /*---------------------------------------------------------------------------
+  Static Data
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Retained image storage. On hardware this is placed in the linker's
+   * .retained_data region, which the C runtime never zeroes or loads.
+   */
+#if defined( ICHNAEA_EMBEDDED )
+  static Region s_region __attribute__( ( section( ".retained_data.image" ) ) );
+#else
+  static Region s_region;
+#endif
+
+  static bool s_valid;
+
+  /*---------------------------------------------------------------------------
+  Private Functions
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Computes the CRC of the image currently in the region
+   *
+   * @return uint32_t
+   */
+  static uint32_t calc_image_crc()
+  {
+    const uint8_t *start = reinterpret_cast<const uint8_t *>( &s_region.image );
+    return etl::crc32( start, start + sizeof( s_region.image ) ).value();
+  }
+
+  /*---------------------------------------------------------------------------
+  Public Functions
+  ---------------------------------------------------------------------------*/
+
+  void save()
+  {
+    s_region.magic = 0;
+
+    /*-------------------------------------------------------------------------
+    Pull the state from each module
+    -------------------------------------------------------------------------*/
+    memcpy( &s_region.image.pdi, &App::PDI::Internal::RAMCache, sizeof( s_region.image.pdi ) );
+    s_region.image.pdi_dirty_count = App::PDI::Internal::collect_dirty_keys( s_region.image.pdi_dirty, MAX_DIRTY_PDI_KEYS );
+    Sensor::saveRetainedState( s_region.image.sensor );
+    App::Monitor::saveRetainedState( s_region.image.monitor );
+    HW::LTC7871::saveRetainedState( s_region.image.ltc );
+
+    /*-------------------------------------------------------------------------
+    Seal the image. The magic goes last so a reset partway through leaves an
+    invalid image behind.
+    -------------------------------------------------------------------------*/
+    s_region.version  = LAYOUT_VERSION;
+    s_region.layout   = LAYOUT_ID;
+    s_region.size     = sizeof( s_region.image );
+    s_region.crc      = calc_image_crc();
+    s_region.magic    = IMAGE_MAGIC;
+  }
+
+
+  bool load()
+  {
+    s_valid = ( s_region.magic == IMAGE_MAGIC ) && ( s_region.version == LAYOUT_VERSION ) &&
+              ( s_region.layout == LAYOUT_ID ) && ( s_region.size == sizeof( s_region.image ) ) &&
+              ( s_region.crc == calc_image_crc() );
+
+    /*-------------------------------------------------------------------------
+    Consume the image. The data stays in place for this boot to restore from.
+    -------------------------------------------------------------------------*/
+    s_region.magic = 0;
+    return s_valid;
+  }
+
+
+  void invalidate()
+  {
+    s_region.magic = 0;
+    s_valid        = false;
+  }
+
+
+  bool isValid()
+  {
+    return s_valid;
+  }
+
+
+  const Image &image()
+  {
+    return s_region.image;
+  }
+
+
+  bool wasPdiDirty( const mb::db::HashKey key )
+  {
+    const Image &img = s_region.image;
+
+    if( img.pdi_dirty_count > MAX_DIRTY_PDI_KEYS )
+    {
+      return true;
+    }
+
+    for( size_t idx = 0; idx < img.pdi_dirty_count; idx++ )
+    {
+      if( img.pdi_dirty[ idx ] == key )
+      {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+}    // namespace System::Retained
@@ -0,0 +1,113 @@
+/******************************************************************************
+ *  File Name:
+ *    system_retained.hpp
+ *
+ *  Description:
+ *    Live system state retained in no-init RAM across a software reset
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+#pragma once
+#ifndef ICHNAEA_SYSTEM_RETAINED_HPP
+#define ICHNAEA_SYSTEM_RETAINED_HPP
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <src/app/app_monitor.hpp>
+#include <src/app/app_pdi.hpp>
+#include <src/hw/ltc7871.hpp>
+#include <src/system/system_sensor.hpp>
+
+namespace System::Retained
+{
+  /*---------------------------------------------------------------------------
+  Constants
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Version of the Image layout. Bump whenever a retained structure
+   * changes so an image written by older firmware is never restored.
+   */
+  static constexpr uint32_t LAYOUT_VERSION = 1;
+
+  /**
+   * @brief Most PDI keys that can be carried across as awaiting a flush.
+   * Beyond this every restored key is treated as dirty.
+   */
+  static constexpr size_t MAX_DIRTY_PDI_KEYS = 16;
+
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Snapshot of the live system state kept across a warm restart
+   */
+  struct Image
+  {
+    App::PDI::PDIData           pdi;                             /**< PDI RAM cache */
+    uint32_t                    pdi_dirty_count;                 /**< Keys not yet flushed to NVM */
+    mb::db::HashKey             pdi_dirty[ MAX_DIRTY_PDI_KEYS ]; /**< Which keys were not yet flushed */
+    Sensor::RetainedState       sensor;                          /**< Cached sensor measurements */
+    App::Monitor::RetainedState monitor;                         /**< Monitor validity and filter states */
+    HW::LTC7871::RetainedState  ltc;                             /**< Power stage operating point */
+  };
+
+  /*---------------------------------------------------------------------------
+  Public Functions
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Snapshot the live system state into retained RAM and seal it.
+   *
+   * Should be called immediately before a software triggered reset, once the
+   * threads that mutate the state have been stopped.
+   */
+  void save();
+
+  /**
+   * @brief Validate the retained image left behind by the previous boot.
+   *
+   * The image is consumed by this call, so a later unexpected reset will not
+   * resume from stale data.
+   *
+   * @return true   The image is intact and may be restored from
+   * @return false  No valid image, ie a cold boot
+   */
+  bool load();
+
+  /**
+   * @brief Discard the retained image
+   */
+  void invalidate();
+
+  /**
+   * @brief Checks if this boot has a valid retained image to restore from
+   *
+   * @return true   Modules should resume from image()
+   * @return false  Modules should start from defaults
+   */
+  bool isValid();
+
+  /**
+   * @brief Gets the retained image. Only meaningful if isValid() is true.
+   *
+   * @return const Image&
+   */
+  const Image &image();
+
+  /**
+   * @brief Checks if a PDI key had a write pending to NVM when the image was
+   * saved. The restored key must be re-marked dirty so the write still lands.
+   *
+   * @param key     Key to check
+   * @return true   The key must be flushed again
+   * @return false  The key's NVM copy was already up to date
+   */
+  bool wasPdiDirty( const mb::db::HashKey key );
+
+}    // namespace System::Retained
+
+#endif /* !ICHNAEA_SYSTEM_RETAINED_HPP */
@@ -12,6 +12,7 @@
 Includes
 -----------------------------------------------------------------------------*/
 #include "mbedutils/drivers/threading/thread.hpp"
+#include <cstring>
 #include <etl/algorithm.h>
 #include <mbedutils/drivers/hardware/analog.hpp>
 #include <mbedutils/logging.hpp>
@@ -20,10 +21,20 @@ Includes
 #include <src/hw/adc.hpp>
 #include <src/hw/fan.hpp>
 #include <src/hw/ltc7871.hpp>
+#include <src/system/system_retained.hpp>
 #include <src/system/system_sensor.hpp>
 
 namespace System::Sensor
 {
+  /*---------------------------------------------------------------------------
+  Static Data
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Last measured value of each sensor, used for CACHED lookups
+   */
+  static float s_cache[ static_cast<size_t>( Element::NUM_OPTIONS ) ];
+
   /*---------------------------------------------------------------------------
   Private Functions
   ---------------------------------------------------------------------------*/
@@ -48,6 +59,18 @@ namespace System::Sensor
 
   void initialize()
   {
+    /*-------------------------------------------------------------------------
+    Start from the last known measurements if coming out of a warm restart
+    -------------------------------------------------------------------------*/
+    if( System::Retained::isValid() )
+    {
+      memcpy( s_cache, System::Retained::image().sensor.cache, sizeof( s_cache ) );
+    }
+    else
+    {
+      memset( s_cache, 0, sizeof( s_cache ) );
+    }
+
     /*-------------------------------------------------------------------------
     Register sensor calibration PDI keys
     -------------------------------------------------------------------------*/
@@ -55,6 +78,12 @@ namespace System::Sensor
   }
 
 
+  void saveRetainedState( RetainedState &state )
+  {
+    memcpy( state.cache, s_cache, sizeof( s_cache ) );
+  }
+
+
   float getMeasurement( const Element channel, const LookupType lut )
   {
     switch( channel )
@@ -141,21 +170,21 @@ namespace System::Sensor
 
   static float get_ltc_avg_current( const LookupType lut )
   {
-    static float s_cached_avg_current = 0.0f;
+    float &s_cached_value = s_cache[ static_cast<size_t>( Element::IMON_LTC_AVG ) ];
     if( lut == LookupType::CACHED )
     {
-      return s_cached_avg_current;
+      return s_cached_value;
     }
 
-    float imon           = HW::ADC::getVoltage( HW::ADC::Channel::LTC_IMON );
-    s_cached_avg_current = HW::LTC7871::getAverageOutputCurrent( imon );
-    return s_cached_avg_current;
+    float imon     = HW::ADC::getVoltage( HW::ADC::Channel::LTC_IMON );
+    s_cached_value = HW::LTC7871::getAverageOutputCurrent( imon );
+    return s_cached_value;
   }
 
 
   static float get_high_side_voltage( const LookupType lut )
   {
-    static float s_cached_value = 0.0f;
+    float &s_cached_value = s_cache[ static_cast<size_t>( Element::VMON_SOLAR_INPUT ) ];
     if( lut == LookupType::CACHED )
     {
       return s_cached_value;
@@ -170,7 +199,7 @@ namespace System::Sensor
 
   static float get_low_side_voltage( const LookupType lut )
   {
-    static float s_cached_value = 0.0f;
+    float &s_cached_value = s_cache[ static_cast<size_t>( Element::VMON_LOAD ) ];
     if( lut == LookupType::CACHED )
     {
       return s_cached_value;
@@ -185,7 +214,7 @@ namespace System::Sensor
 
   static float get_rp2040_temp( const LookupType lut )
   {
-    static float s_cached_value = 0.0f;
+    float &s_cached_value = s_cache[ static_cast<size_t>( Element::RP2040_TEMP ) ];
     if( lut == LookupType::CACHED )
     {
       return s_cached_value;
@@ -202,7 +231,7 @@ namespace System::Sensor
 
   static float get_board_temp0( const LookupType lut )
   {
-    static float s_cached_value = 0.0f;
+    float &s_cached_value = s_cache[ static_cast<size_t>( Element::BOARD_TEMP_0 ) ];
     if( lut == LookupType::CACHED )
     {
       return s_cached_value;
@@ -216,7 +245,7 @@ namespace System::Sensor
 
   static float get_board_temp1( const LookupType lut )
   {
-    static float s_cached_value = 0.0f;
+    float &s_cached_value = s_cache[ static_cast<size_t>( Element::BOARD_TEMP_1 ) ];
     if( lut == LookupType::CACHED )
     {
       return s_cached_value;
@@ -250,7 +279,7 @@ namespace System::Sensor
    */
   static float get_imon_load( const LookupType lut )
   {
-    static float s_cached_value = 0.0f;
+    float &s_cached_value = s_cache[ static_cast<size_t>( Element::IMON_LOAD ) ];
 
     if( ( lut == LookupType::CACHED ) || ( BSP::getBoardRevision() < 2 ) )
     {
@@ -282,7 +311,7 @@ namespace System::Sensor
       return 0.0f;
     }
 
-    static float s_cached_value = 0.0f;
+    float &s_cached_value = s_cache[ static_cast<size_t>( Element::VMON_1V1 ) ];
     if( lut == LookupType::CACHED )
     {
       return s_cached_value;
@@ -300,7 +329,7 @@ namespace System::Sensor
       return 0.0f;
     }
 
-    static float s_cached_value = 0.0f;
+    float &s_cached_value = s_cache[ static_cast<size_t>( Element::VMON_3V3 ) ];
     if( lut == LookupType::CACHED )
     {
       return s_cached_value;
@@ -320,7 +349,7 @@ namespace System::Sensor
       return 0.0f;
     }
 
-    static float s_cached_value = 0.0f;
+    float &s_cached_value = s_cache[ static_cast<size_t>( Element::VMON_5V0 ) ];
     if( lut == LookupType::CACHED )
     {
       return s_cached_value;
@@ -340,7 +369,7 @@ namespace System::Sensor
       return 0.0f;
     }
 
-    static float s_cached_value = 0.0f;
+    float &s_cached_value = s_cache[ static_cast<size_t>( Element::VMON_12V ) ];
     if( lut == LookupType::CACHED )
     {
       return s_cached_value;
@@ -15,6 +15,7 @@
 /*-----------------------------------------------------------------------------
 Includes
 -----------------------------------------------------------------------------*/
+#include <cstddef>
 #include <cstdint>
 
 namespace System::Sensor
@@ -61,6 +62,18 @@ namespace System::Sensor
     NUM_OPTIONS
   };
 
+  /*---------------------------------------------------------------------------
+  Structures
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief Sensor state carried across a warm restart
+   */
+  struct RetainedState
+  {
+    float cache[ static_cast<size_t>( Element::NUM_OPTIONS ) ]; /**< Last measured value of each sensor */
+  };
+
 
   /*---------------------------------------------------------------------------
   Public Functions
@@ -80,6 +93,13 @@ namespace System::Sensor
    */
   float getMeasurement( const Element channel, const LookupType lut = LookupType::CACHED );
 
+  /**
+   * @brief Snapshot the cached sensor values so they can be resumed after a warm restart
+   *
+   * @param state Where to place the snapshot
+   */
+  void saveRetainedState( RetainedState &state );
+
   namespace Calibration
   {
     /**
@@ -15,6 +15,7 @@ Includes
 #include <mbedutils/threading.hpp>
 #include <mbedutils/system.hpp>
 #include <src/bsp/board_map.hpp>
+#include <src/system/system_bootup.hpp>
 #include <src/system/system_shutdown.hpp>
 #include <src/threads/ichnaea_threads.hpp>
 
@@ -47,6 +48,7 @@ namespace System::Shutdown
     stopThread( SystemTask::TSK_CONTROL_ID );
     stopThread( SystemTask::TSK_MONITOR_ID );
     stopThread( SystemTask::TSK_DELAYED_IO_ID );
+    stopThread( SystemTask::TSK_POST_ID );
 
     // Only publish the kill request. Don't join yet.
     mb::thread::this_thread::task()->kill();
@@ -55,6 +57,7 @@ namespace System::Shutdown
 
   void Internal::trigger_reset()
   {
+    System::Boot::requestWarmRestart();
     mb::system::intf::warm_reset();
   }
 
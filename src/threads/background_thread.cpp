@@ -15,6 +15,7 @@ Includes
 #include <mbedutils/logging.hpp>
 #include <src/app/app_config.hpp>
 #include <src/app/app_filter.hpp>
+#include <src/app/app_group.hpp>
 #include <src/app/app_monitor.hpp>
 #include <src/app/app_power.hpp>
 #include <src/app/app_stats.hpp>
@@ -24,7 +25,10 @@ Includes
 #include <src/com/ctrl_server.hpp>
 #include <src/hw/led.hpp>
 #include <src/sim/sim_lifetime.hpp>
+#include <src/system/system_boot_profile.hpp>
 #include <src/system/system_bootup.hpp>
+#include <src/system/system_flash_stats.hpp>
+#include <src/system/system_logging.hpp>
 #include <src/system/system_shutdown.hpp>
 #include <src/system/system_util.hpp>
 #include <src/threads/ichnaea_threads.hpp>
@@ -53,7 +57,7 @@ namespace Threads
       signal.node_id    = System::identity();
       signal.timestamp  = current_time;
 
-      Control::getRPCServer().publishMessage( ichnaea_AsyncMessageId_MSG_HEARTBEAT, &signal );
+      Control::publish( Control::TxClass::TELEMETRY, ichnaea_AsyncMessageId_MSG_HEARTBEAT, ichnaea_Heartbeat_fields, signal );
     }
   }
 
@@ -74,11 +78,16 @@ namespace Threads
     /*-------------------------------------------------------------------------
     Start powering on application level drivers
     -------------------------------------------------------------------------*/
-    App::Config::driver_init();
-    App::Stats::driver_init();
-    App::Power::driver_init();
-    App::Filter::driver_init();
-    App::Monitor::driver_init();
+    {
+      using namespace System::Boot::Profiler;
+
+      measure( ichnaea_BootStepId_BOOT_STEP_APP_CONFIG, App::Config::driver_init );
+      measure( ichnaea_BootStepId_BOOT_STEP_APP_STATS, App::Stats::driver_init );
+      measure( ichnaea_BootStepId_BOOT_STEP_APP_POWER, App::Power::driver_init );
+      measure( ichnaea_BootStepId_BOOT_STEP_APP_FILTER, App::Filter::driver_init );
+      measure( ichnaea_BootStepId_BOOT_STEP_APP_MONITOR, App::Monitor::driver_init );
+      measure( ichnaea_BootStepId_BOOT_STEP_APP_GROUP, App::Group::driver_init );
+    }
 
     /*-------------------------------------------------------------------------
     Signal the next thread in the sequence to start. Simulators must wait b/c
@@ -130,6 +139,8 @@ namespace Threads
 
     // TODO: Reverse the bootup sequence here
 
+    System::FlashStats::save();
+    Logging::flush();
     SIM::shutdown();
 
     /*-------------------------------------------------------------------------
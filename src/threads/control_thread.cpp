@@ -13,9 +13,13 @@ Includes
 -----------------------------------------------------------------------------*/
 #include <mbedutils/logging.hpp>
 #include <mbedutils/threading.hpp>
+#include <src/app/app_group.hpp>
 #include <src/app/app_power.hpp>
+#include <src/app/app_telemetry.hpp>
 #include <src/com/ctrl_server.hpp>
+#include <src/com/link_speed.hpp>
 #include <src/hw/ltc7871.hpp>
+#include <src/hw/uart.hpp>
 #include <src/threads/ichnaea_threads.hpp>
 
 namespace Threads
@@ -40,10 +44,40 @@ namespace Threads
       -----------------------------------------------------------------------*/
       Control::getRPCServer().runServices();
 
+      /*-----------------------------------------------------------------------
+      Forget the arrival of frames the server read without dispatching them
+      -----------------------------------------------------------------------*/
+      HW::UART::releaseFrames( HW::UART::UART_BMS );
+
+      /*-----------------------------------------------------------------------
+      Frames that arrived too mangled to decode count against the link rate
+      -----------------------------------------------------------------------*/
+      COM::LinkSpeed::reportError( HW::UART::takeFrameErrors( HW::UART::UART_BMS ) );
+
+      /*-----------------------------------------------------------------------
+      Run a scheduled group command once it falls due
+      -----------------------------------------------------------------------*/
+      App::Group::process();
+
+      /*-----------------------------------------------------------------------
+      Apply any negotiated change to the RPC link rate
+      -----------------------------------------------------------------------*/
+      COM::LinkSpeed::process();
+
       /*-----------------------------------------------------------------------
       Consume new system state to make control decisions
       -----------------------------------------------------------------------*/
       App::Power::periodicProcessing();
+
+      /*-----------------------------------------------------------------------
+      Stream telemetry to any subscribed host
+      -----------------------------------------------------------------------*/
+      App::Telemetry::process();
+
+      /*-----------------------------------------------------------------------
+      Send queued async traffic behind this cycle's RPC responses
+      -----------------------------------------------------------------------*/
+      Control::flushTx();
     }
 
     /*-------------------------------------------------------------------------
@@ -14,6 +14,8 @@ Includes
 #include <mbedutils/logging.hpp>
 #include <mbedutils/threading.hpp>
 #include <src/system/system_db.hpp>
+#include <src/system/system_flash_stats.hpp>
+#include <src/system/system_flight_recorder.hpp>
 #include <src/threads/ichnaea_threads.hpp>
 
 namespace Threads
@@ -33,8 +35,10 @@ namespace Threads
     tsk_msg.size = sizeof( signal );
 
     /*-------------------------------------------------------------------------
-    Signal the next thread in the sequence to start
+    Hand the slow parts of POST off to their own thread so they don't hold up
+    the delayed I/O work, then signal the next thread in the sequence to start.
     -------------------------------------------------------------------------*/
+    startThread( SystemTask::TSK_POST_ID );
     startThread( SystemTask::TSK_MONITOR_ID );
 
     /*-------------------------------------------------------------------------
@@ -62,6 +66,8 @@ namespace Threads
       Perform delayed I/O operations
       -----------------------------------------------------------------------*/
       System::Database::pdiDB().flush();
+      System::FlashStats::process();
+      System::FlightRecorder::process();
     }
 
     /*-------------------------------------------------------------------------
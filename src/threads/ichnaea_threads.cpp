@@ -28,6 +28,8 @@ namespace Threads
    */
   enum ThreadPriority
   {
+    PRIORITY_LOGGING    = 3,  /**< Log output, runs whenever nothing else does */
+    PRIORITY_POST       = 4,  /**< Deferred POST, only around briefly at boot */
     PRIORITY_DELAYED_IO = 5,  /**< Always preemptible. Slow stuff here. */
     PRIORITY_BACKGROUND = 10, /**< Low priority background software */
     PRIORITY_CONTROL    = 15, /**< Control is fairly important */
@@ -56,6 +58,14 @@ namespace Threads
   static Task                            s_delayed_io_task;
   static Task::Storage<4096, TaskMsg, 1> s_delayed_io_storage;
 
+  /* Logging Thread */
+  static Task                            s_logging_task;
+  static Task::Storage<4096, TaskMsg, 1> s_logging_storage;
+
+  /* Deferred POST Thread */
+  static Task                            s_post_task;
+  static Task::Storage<2048, TaskMsg, 1> s_post_storage;
+
   /*---------------------------------------------------------------------------
   Public Functions
   ---------------------------------------------------------------------------*/
@@ -132,6 +142,46 @@ namespace Threads
 
     s_delayed_io_task = mb::thread::create( cfg );
 
+    /*-------------------------------------------------------------------------
+    Add the logging thread
+    -------------------------------------------------------------------------*/
+    s_logging_storage.name = "Logging";
+
+    cfg.reset();
+    cfg.name                = s_logging_storage.name;
+    cfg.id                  = TSK_LOGGING_ID;
+    cfg.func                = loggingThread;
+    cfg.affinity            = 0x3;
+    cfg.priority            = PRIORITY_LOGGING;
+    cfg.stack_buf           = s_logging_storage.stack;
+    cfg.stack_size          = count_of_array( s_logging_storage.stack );
+    cfg.msg_queue_cfg.pool  = &s_logging_storage.msg_queue_storage.pool;
+    cfg.msg_queue_cfg.queue = &s_logging_storage.msg_queue_storage.queue;
+    cfg.msg_queue_inst      = &s_logging_storage.msg_queue;
+    cfg.block_on_create     = true;
+
+    s_logging_task = mb::thread::create( cfg );
+
+    /*-------------------------------------------------------------------------
+    Add the deferred POST thread
+    -------------------------------------------------------------------------*/
+    s_post_storage.name = "Post";
+
+    cfg.reset();
+    cfg.name                = s_post_storage.name;
+    cfg.id                  = TSK_POST_ID;
+    cfg.func                = postThread;
+    cfg.affinity            = 0x3;
+    cfg.priority            = PRIORITY_POST;
+    cfg.stack_buf           = s_post_storage.stack;
+    cfg.stack_size          = count_of_array( s_post_storage.stack );
+    cfg.msg_queue_cfg.pool  = &s_post_storage.msg_queue_storage.pool;
+    cfg.msg_queue_cfg.queue = &s_post_storage.msg_queue_storage.queue;
+    cfg.msg_queue_inst      = &s_post_storage.msg_queue;
+    cfg.block_on_create     = true;
+
+    s_post_task = mb::thread::create( cfg );
+
     /*-------------------------------------------------------------------------
     Add the background thread
     -------------------------------------------------------------------------*/
@@ -175,6 +225,14 @@ namespace Threads
         s_delayed_io_task.start();
         break;
 
+      case TSK_LOGGING_ID:
+        s_logging_task.start();
+        break;
+
+      case TSK_POST_ID:
+        s_post_task.start();
+        break;
+
       default:
         break;
     }
@@ -205,6 +263,16 @@ namespace Threads
         s_delayed_io_task.join();
         break;
 
+      case TSK_LOGGING_ID:
+        s_logging_task.kill();
+        s_logging_task.join();
+        break;
+
+      case TSK_POST_ID:
+        s_post_task.kill();
+        s_post_task.join();
+        break;
+
       default:
         break;
     }
@@ -231,6 +299,14 @@ namespace Threads
         s_delayed_io_task.join();
         break;
 
+      case TSK_LOGGING_ID:
+        s_logging_task.join();
+        break;
+
+      case TSK_POST_ID:
+        s_post_task.join();
+        break;
+
       default:
         break;
     }
@@ -30,6 +30,8 @@ namespace Threads
     TSK_MONITOR_ID,
     TSK_CONTROL_ID,
     TSK_DELAYED_IO_ID,
+    TSK_LOGGING_ID,
+    TSK_POST_ID,
 
     TSK_COUNT_MAX
   };
@@ -145,6 +147,24 @@ namespace Threads
    * @param arg Unused
    */
   void delayedIOThread( void *arg );
+
+  /**
+   * @brief Lowest priority thread that drains the log ring into the sinks.
+   *
+   * Keeps all log I/O off the threads that generate the messages.
+   *
+   * @param arg Unused
+   */
+  void loggingThread( void *arg );
+
+  /**
+   * @brief Short lived thread that runs the deferred POST jobs, then exits.
+   *
+   * Keeps the slow POST sequences from holding up the delayed I/O work.
+   *
+   * @param arg Unused
+   */
+  void postThread( void *arg );
 }    // namespace Threads
 
 #endif /* !ICHNAEA_THREADS_HPP */
@@ -0,0 +1,74 @@
+/******************************************************************************
+ *  File Name:
+ *    logging_thread.cpp
+ *
+ *  Description:
+ *    Thread to drain queued log messages out to the log sinks
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <mbedutils/logging.hpp>
+#include <mbedutils/threading.hpp>
+#include <src/system/system_log_limit.hpp>
+#include <src/system/system_logging.hpp>
+#include <src/threads/ichnaea_threads.hpp>
+
+namespace Threads
+{
+  /*---------------------------------------------------------------------------
+  Constants
+  ---------------------------------------------------------------------------*/
+
+  /**
+   * @brief How long to sleep once the ring has been emptied
+   */
+  static constexpr size_t DRAIN_IDLE_MS = 5;
+
+  /*---------------------------------------------------------------------------
+  Public Functions
+  ---------------------------------------------------------------------------*/
+
+  void loggingThread( void *arg )
+  {
+    ( void )arg;
+
+    uint32_t last_overflows = 0;
+
+    /*-------------------------------------------------------------------------
+    Run the task
+    -------------------------------------------------------------------------*/
+    while( !mb::thread::this_thread::task()->killPending() )
+    {
+      if( Logging::drain() != 0 )
+      {
+        continue;
+      }
+
+      /*-----------------------------------------------------------------------
+      Summarize rate limited call sites that have gone quiet
+      -----------------------------------------------------------------------*/
+      Logging::RateLimit::process();
+
+      /*-----------------------------------------------------------------------
+      Report lost messages once the ring has room again
+      -----------------------------------------------------------------------*/
+      const uint32_t overflows = Logging::getPipelineStats().overflows;
+      if( overflows != last_overflows )
+      {
+        LOG_WARN( "Log ring overflow, %lu messages dropped", static_cast<unsigned long>( overflows - last_overflows ) );
+        last_overflows = overflows;
+      }
+
+      mb::thread::this_thread::sleep_for( DRAIN_IDLE_MS );
+    }
+
+    /*-------------------------------------------------------------------------
+    Shutdown sequence. Push out whatever is left before exiting.
+    -------------------------------------------------------------------------*/
+    Logging::flush();
+  }
+}    // namespace Threads
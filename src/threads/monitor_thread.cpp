@@ -58,6 +58,7 @@ namespace Threads
       /*-------------------------------------------------------------------------
       Refresh the sensor data
       -------------------------------------------------------------------------*/
+      App::Monitor::beginCycle();
       System::Sensor::getMeasurement( System::Sensor::Element::IMON_LOAD, System::Sensor::LookupType::REFRESH );
       System::Sensor::getMeasurement( System::Sensor::Element::VMON_LOAD, System::Sensor::LookupType::REFRESH );
       System::Sensor::getMeasurement( System::Sensor::Element::VMON_SOLAR_INPUT, System::Sensor::LookupType::REFRESH );
@@ -85,6 +86,8 @@ namespace Threads
       App::Monitor::monitorTemperature();
       // App::Monitor::monitorFanSpeed();
 
+      App::Monitor::endCycle();
+
       logMeasurements();
 
       /*-----------------------------------------------------------------------
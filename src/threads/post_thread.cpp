@@ -0,0 +1,38 @@
+/******************************************************************************
+ *  File Name:
+ *    post_thread.cpp
+ *
+ *  Description:
+ *    Short lived thread to run the deferred POST jobs
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <mbedutils/logging.hpp>
+#include <mbedutils/threading.hpp>
+#include <src/system/system_boot_profile.hpp>
+#include <src/system/system_bootup.hpp>
+#include <src/threads/ichnaea_threads.hpp>
+
+namespace Threads
+{
+  /*---------------------------------------------------------------------------
+  Public Functions
+  ---------------------------------------------------------------------------*/
+
+  void postThread( void *arg )
+  {
+    ( void )arg;
+
+    /*-------------------------------------------------------------------------
+    Finish off the slow parts of POST now that the node is reporting ready
+    -------------------------------------------------------------------------*/
+    System::Boot::runDeferredPost();
+    System::Boot::Profiler::complete();
+
+    LOG_TRACE( "Deferred POST thread exiting" );
+  }
+}    // namespace Threads
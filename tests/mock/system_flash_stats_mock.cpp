@@ -0,0 +1,62 @@
+/*
+ * This file has been auto-generated by CppUMockGen v0.6.
+ *
+ * Contents will NOT be preserved if it is regenerated!!!
+ *
+ * Generation options: -s c++20
+ */
+
+#include "../../src/system/system_flash_stats.hpp"
+
+#include <CppUTestExt/MockSupport.h>
+
+void System::FlashStats::initialize()
+{
+    mock().actualCall("System::FlashStats::initialize");
+}
+
+void System::FlashStats::recordRead(const size_t bytes, const uint32_t latency_us)
+{
+    mock().actualCall("System::FlashStats::recordRead").withUnsignedLongIntParameter("bytes", bytes).withUnsignedIntParameter("latency_us", latency_us);
+}
+
+void System::FlashStats::recordProgram(const size_t bytes, const uint32_t latency_us)
+{
+    mock().actualCall("System::FlashStats::recordProgram").withUnsignedLongIntParameter("bytes", bytes).withUnsignedIntParameter("latency_us", latency_us);
+}
+
+void System::FlashStats::recordErase(const long address, const uint32_t latency_us)
+{
+    mock().actualCall("System::FlashStats::recordErase").withLongIntParameter("address", address).withUnsignedIntParameter("latency_us", latency_us);
+}
+
+void System::FlashStats::process()
+{
+    mock().actualCall("System::FlashStats::process");
+}
+
+bool System::FlashStats::save()
+{
+    return mock().actualCall("System::FlashStats::save").returnBoolValue();
+}
+
+System::FlashStats::Totals System::FlashStats::totals()
+{
+    return *static_cast<const System::FlashStats::Totals*>(mock().actualCall("System::FlashStats::totals").returnConstPointerValue());
+}
+
+void System::FlashStats::histogram(const System::FlashStats::Op op, uint32_t (&dst)[20])
+{
+    mock().actualCall("System::FlashStats::histogram").withIntParameter("op", static_cast<int>(op)).withOutputParameter("dst", dst);
+}
+
+size_t System::FlashStats::numSectors()
+{
+    return mock().actualCall("System::FlashStats::numSectors").returnUnsignedLongIntValue();
+}
+
+uint32_t System::FlashStats::sectorEraseCount(const size_t sector)
+{
+    return mock().actualCall("System::FlashStats::sectorEraseCount").withUnsignedLongIntParameter("sector", sector).returnUnsignedIntValue();
+}
+
@@ -0,0 +1,161 @@
+/******************************************************************************
+ *  File Name:
+ *    test_nor_cache.cpp
+ *
+ *  Description:
+ *    Tests nor_cache.hpp
+ *
+ *  2024 | Brandon Braun | brandonbraun653@protonmail.com
+ *****************************************************************************/
+
+/*-----------------------------------------------------------------------------
+Includes
+-----------------------------------------------------------------------------*/
+#include <cstring>
+#include <src/hw/nor_cache.hpp>
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTestExt/MockSupport.h"
+#include "CppUTestExt/MockSupportPlugin.h"
+#include "CppUTest/CommandLineTestRunner.h"
+
+
+/*-----------------------------------------------------------------------------
+Tests
+-----------------------------------------------------------------------------*/
+
+static constexpr size_t TEST_LINE_SIZE = 16;
+static constexpr size_t TEST_DEV_SIZE  = 1024;
+
+static uint8_t s_fake_dev[ TEST_DEV_SIZE ];
+static size_t  s_fill_count;
+
+static int fake_fill( long offset, uint8_t *buf, size_t size )
+{
+  s_fill_count++;
+  memcpy( buf, s_fake_dev + offset, size );
+  return 0;
+}
+
+static int failing_fill( long offset, uint8_t *buf, size_t size )
+{
+  ( void )offset;
+  ( void )buf;
+  ( void )size;
+  return -1;
+}
+
+using TestCache = HW::NOR::PageCache<2, 2, TEST_LINE_SIZE>;
+
+TEST_GROUP( PageCache )
+{
+  void setup()
+  {
+    for( size_t i = 0; i < TEST_DEV_SIZE; i++ )
+    {
+      s_fake_dev[ i ] = static_cast<uint8_t>( i );
+    }
+
+    s_fill_count = 0;
+  }
+};
+
+TEST( PageCache, RepeatedReadHits )
+{
+  TestCache cache;
+  uint8_t   buf[ 4 ];
+
+  CHECK_EQUAL( 4, cache.read( 20, buf, sizeof( buf ), fake_fill ) );
+  CHECK_EQUAL( 4, cache.read( 24, buf, sizeof( buf ), fake_fill ) );
+  CHECK_EQUAL( 1, s_fill_count );
+  CHECK_EQUAL( 24, buf[ 0 ] );
+  CHECK_EQUAL( 1, cache.stats().hits );
+  CHECK_EQUAL( 1, cache.stats().misses );
+}
+
+TEST( PageCache, ReadSpanningLines )
+{
+  TestCache cache;
+  uint8_t   buf[ 8 ];
+
+  CHECK_EQUAL( 8, cache.read( 12, buf, sizeof( buf ), fake_fill ) );
+  CHECK_EQUAL( 2, s_fill_count );
+
+  for( size_t i = 0; i < sizeof( buf ); i++ )
+  {
+    CHECK_EQUAL( 12 + i, buf[ i ] );
+  }
+}
+
+TEST( PageCache, WriteInvalidatesLine )
+{
+  TestCache cache;
+  uint8_t   buf[ 1 ];
+
+  cache.read( 0, buf, 1, fake_fill );
+  s_fake_dev[ 0 ] = 0xAA;
+  cache.invalidate( 0, 1 );
+
+  cache.read( 0, buf, 1, fake_fill );
+  CHECK_EQUAL( 0xAA, buf[ 0 ] );
+  CHECK_EQUAL( 2, s_fill_count );
+  CHECK_EQUAL( 1, cache.stats().invalidations );
+}
+
+TEST( PageCache, EvictsLeastRecentlyUsed )
+{
+  TestCache cache;
+  uint8_t   buf[ 1 ];
+
+  /* Lines 0, 2 and 4 all map to set 0 */
+  cache.read( 0 * TEST_LINE_SIZE, buf, 1, fake_fill );
+  cache.read( 2 * TEST_LINE_SIZE, buf, 1, fake_fill );
+  cache.read( 0 * TEST_LINE_SIZE, buf, 1, fake_fill );
+  cache.read( 4 * TEST_LINE_SIZE, buf, 1, fake_fill );
+  CHECK_EQUAL( 3, s_fill_count );
+
+  /* Line 0 was used more recently than line 2, so it survived */
+  cache.read( 0 * TEST_LINE_SIZE, buf, 1, fake_fill );
+  CHECK_EQUAL( 3, s_fill_count );
+
+  cache.read( 2 * TEST_LINE_SIZE, buf, 1, fake_fill );
+  CHECK_EQUAL( 4, s_fill_count );
+}
+
+TEST( PageCache, LargeReadBypasses )
+{
+  TestCache cache;
+  uint8_t   buf[ 5 * TEST_LINE_SIZE ];
+
+  CHECK_EQUAL( sizeof( buf ), cache.read( 0, buf, sizeof( buf ), fake_fill ) );
+  CHECK_EQUAL( 1, cache.stats().bypass );
+  CHECK_EQUAL( 0, cache.stats().misses );
+}
+
+TEST( PageCache, MultiLineReadIsOneDeviceRead )
+{
+  TestCache cache;
+  uint8_t   buf[ TEST_LINE_SIZE + 1 ];
+
+  CHECK_EQUAL( sizeof( buf ), cache.read( 4, buf, sizeof( buf ), fake_fill ) );
+  CHECK_EQUAL( 1, s_fill_count );
+  CHECK_EQUAL( 1, cache.stats().bypass );
+  CHECK_EQUAL( 4, buf[ 0 ] );
+  CHECK_EQUAL( 4 + TEST_LINE_SIZE, buf[ TEST_LINE_SIZE ] );
+}
+
+TEST( PageCache, FailedFillIsNotCached )
+{
+  TestCache cache;
+  uint8_t   buf[ 1 ];
+
+  CHECK_EQUAL( -1, cache.read( 0, buf, 1, failing_fill ) );
+  cache.read( 0, buf, 1, fake_fill );
+  CHECK_EQUAL( 1, s_fill_count );
+}
+
+
+int main( int argc, char **argv )
+{
+  return RUN_ALL_TESTS( argc, argv );
+}
@@ -0,0 +1,59 @@
+import logging
+import statistics
+import time
+from typing import Tuple
+
+from ichnaea.network_client import NetworkClient
+from ichnaea.proto.ichnaea_pdi_pb2 import *
+from tests.sys.fixtures import *
+
+LOGGER = logging.getLogger(__name__)
+
+
+@pytest.mark.parametrize("product_config", ["simulator"], indirect=True)
+class TestPDIReadBenchmark:
+    """Measure PDI read service time with and without the node's encode cache."""
+
+    TestParam_Iterations = 50  # Number of timed reads per scenario
+    TestParam_PDI = PDI_ID.CONFIG_MON_FILTER_INPUT_VOLTAGE  # Largest encoded PDI type
+
+    @pytest.fixture(autouse=True)
+    def setup_method(self, node_link: NodeClient, persistent_connection: NetworkClient, product_config):
+        """Common setup routines before each test case"""
+        self.node_link: NodeClient = node_link
+        self.net_client: NetworkClient = persistent_connection
+        self.platform: Platform = product_config["type"]
+
+    def _timed_read(self) -> Tuple[float, bytes]:
+        start = time.perf_counter()
+        data = self.net_client.pdi_read(self.node_link.node_id, self.TestParam_PDI)
+        elapsed = time.perf_counter() - start
+        assert data
+        return elapsed, data
+
+    def test_repeated_read_of_unchanged_key(self):
+        """Repeated reads of an unchanged key should be served from the encode cache."""
+        _, reference = self._timed_read()
+
+        # Every read of an unchanged key after the first is a cache hit
+        hit_times = []
+        for _ in range(self.TestParam_Iterations):
+            elapsed, data = self._timed_read()
+            assert data == reference
+            hit_times.append(elapsed)
+
+        # Writing the same value back still bumps the write generation, so each read re-encodes
+        miss_times = []
+        for _ in range(self.TestParam_Iterations):
+            assert self.net_client.pdi_write(self.node_link.node_id, self.TestParam_PDI, reference)
+            elapsed, data = self._timed_read()
+            assert data == reference
+            miss_times.append(elapsed)
+
+        hit_ms = statistics.median(hit_times) * 1e3
+        miss_ms = statistics.median(miss_times) * 1e3
+        LOGGER.info(f"PDI read median: cached {hit_ms:.3f} ms, re-encoded {miss_ms:.3f} ms")
+        LOGGER.info(
+            f"PDI read p90: cached {statistics.quantiles(hit_times, n=10)[-1] * 1e3:.3f} ms, "
+            f"re-encoded {statistics.quantiles(miss_times, n=10)[-1] * 1e3:.3f} ms"
+        )